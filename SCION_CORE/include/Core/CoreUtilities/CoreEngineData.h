@@ -1,4 +1,5 @@
 #pragma once
+#include "Core/Scripting/LuaGCSettings.h"
 
 #define CORE_GLOBALS() Scion::Core::CoreEngineData::GetInstance()
 
@@ -64,6 +65,13 @@ class CoreEngineData
 	inline const bool IsPhysicsEnabled() const { return m_bPhysicsEnabled; }
 	inline const bool IsPhysicsPaused() const { return m_bPhysicsPaused; }
 
+	inline void EnableTileColliderMerging() { m_bMergeTileColliders = true; }
+	inline void DisableTileColliderMerging() { m_bMergeTileColliders = false; }
+	inline const bool IsTileColliderMergingEnabled() const { return m_bMergeTileColliders; }
+
+	inline const Scripting::LuaGCSettings& GetLuaGCSettings() const { return m_LuaGCSettings; }
+	inline void SetLuaGCSettings( const Scripting::LuaGCSettings& settings ) { m_LuaGCSettings = settings; }
+
 	inline const std::string& GetProjectPath() const { return m_sProjectPath; }
 	inline void SetProjectPath( const std::string& sPath ) { m_sProjectPath = sPath; }
 
@@ -95,9 +103,12 @@ class CoreEngineData
 
 	bool m_bPhysicsEnabled;
 	bool m_bPhysicsPaused;
+	bool m_bMergeTileColliders;
 	bool m_bRenderColliders;
 	bool m_bRenderAnimations;
 
+	Scripting::LuaGCSettings m_LuaGCSettings{};
+
 	std::string m_sProjectPath;
 
 	EGameType m_eGameType{ EGameType::NoType };
@@ -88,6 +88,49 @@ void main()
 }
 )";
 
+static const char* particleShaderVert = R"(
+#version 450 core
+layout (location = 0) in vec2 aCorner;
+layout (location = 1) in vec2 aPosition;
+layout (location = 2) in float aScale;
+layout (location = 3) in float aRotation;
+layout (location = 4) in vec4 aColor;
+
+out vec2 fragUVs;
+out vec4 fragColor;
+
+uniform mat4 uProjection;
+uniform vec2 uSize;
+uniform vec4 uUVRect;
+
+void main()
+{
+	// The quad is centered on the particle, then scaled and rotated around it.
+	vec2 local = (aCorner - 0.5) * uSize * aScale;
+	float s = sin(aRotation);
+	float c = cos(aRotation);
+	vec2 rotated = vec2(local.x * c - local.y * s, local.x * s + local.y * c);
+
+	gl_Position = uProjection * vec4(aPosition + rotated, 0.0, 1.0);
+	fragUVs = uUVRect.xy + aCorner * uUVRect.zw;
+	fragColor = aColor;
+}
+)";
+
+static const char* particleShaderFrag = R"(
+#version 450 core
+
+in vec2 fragUVs;
+in vec4 fragColor;
+out vec4 color;
+uniform sampler2D uTexture;
+
+void main()
+{
+	color = texture(uTexture, fragUVs) * fragColor;
+}
+)";
+
 static const char* fontShaderVert = R"(
 #version 450 core
 
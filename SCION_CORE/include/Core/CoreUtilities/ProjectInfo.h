@@ -1,4 +1,5 @@
 #pragma once
+#include "Core/Scripting/LuaGCSettings.h"
 
 namespace fs = std::filesystem;
 
@@ -263,8 +264,19 @@ struct GameConfig
 
 	bool bPackageAssets{ false };
 
+	/* Pack the atlasable textures into atlas pages when packaging assets. */
+	bool bBakeTextureAtlases{ false };
+	int atlasMaxSize{ 2048 };
+	int atlasPadding{ 2 };
+
+	/* Split scenes into cells at package time and stream them around the camera at runtime. */
+	bool bStreamLevels{ false };
+	int streamCellSize{ 1024 };
+
 	AudioConfigInfo audioConfig{};
 
+	Scripting::LuaGCSettings luaGCSettings{};
+
 	void Reset()
 	{
 		sGameName.clear();
@@ -284,8 +296,16 @@ struct GameConfig
 		gravity = 9.8f;
 
 		audioConfig = {};
+		luaGCSettings = {};
 
 		bPackageAssets = false;
+
+		bBakeTextureAtlases = false;
+		atlasMaxSize = 2048;
+		atlasPadding = 2;
+
+		bStreamLevels = false;
+		streamCellSize = 1024;
 	}
 };
 
@@ -13,6 +13,8 @@
 #include "Relationship.h"
 #include "UIComponent.h"
 #include "PersistentComponent.h"
+#include "TweenComponent.h"
+#include "ParticleEmitterComponent.h"
 
 namespace Scion::Core::ECS
 {
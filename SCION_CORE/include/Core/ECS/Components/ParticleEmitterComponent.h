@@ -0,0 +1,64 @@
+#pragma once
+#include "Core/ECS/Components/SpriteComponent.h"
+#include <ScionUtilities/Tween.h>
+#include <sol/sol.hpp>
+
+namespace Scion::Core::ECS
+{
+/*
+ * ParticleEmitterComponent
+ * Emits particles from the position of the entity's transform. The particles themselves are not
+ * entities, they are simulated and drawn by the ParticleSystem.
+ */
+struct ParticleEmitterComponent
+{
+	/* The string name of the texture every particle uses. */
+	std::string sTextureName{};
+	/* The width of a particle in pixels at a scale of one. */
+	float width{ 8.f };
+	/* The height of a particle in pixels at a scale of one. */
+	float height{ 8.f };
+	/* The part of the texture to use. Defaults to the whole texture. */
+	UVs uvs{ .u = 0.f, .v = 0.f, .uv_width = 1.f, .uv_height = 1.f };
+	/* The offset of the emitter from the transform position. */
+	glm::vec2 offset{ 0.f };
+	/* The size of the box particles are spawned in, centered on the emitter. */
+	glm::vec2 spawnArea{ 0.f };
+	/* Particles emitted per second. */
+	float emissionRate{ 10.f };
+	/* The most particles of the emitter alive at once. */
+	int maxParticles{ 1000 };
+	/* The lifetime of a particle in seconds, picked between the min and max. */
+	float minLifetime{ 1.f };
+	float maxLifetime{ 1.f };
+	/* The start speed in pixels per second, picked between the min and max. */
+	float minSpeed{ 50.f };
+	float maxSpeed{ 100.f };
+	/* The direction particles are emitted in, in degrees. 0 is to the right and 90 is down. */
+	float direction{ 90.f };
+	/* Particles are emitted up to half the spread away from the direction, in degrees. */
+	float spread{ 0.f };
+	/* Added to the velocity every second. */
+	glm::vec2 gravity{ 0.f };
+	/* The color and scale of a particle at the start and end of its life. */
+	Scion::Rendering::Color startColor{ .r = 255, .g = 255, .b = 255, .a = 255 };
+	Scion::Rendering::Color endColor{ .r = 255, .g = 255, .b = 255, .a = 255 };
+	float startScale{ 1.f };
+	float endScale{ 1.f };
+	/* How the color and scale change over the life of a particle. */
+	Scion::Utilities::EEasingFunc eLifeEasing{ Scion::Utilities::EEasingFunc::LINEAR };
+	/* Rotates each particle to the direction it moves in. */
+	bool bAlignToVelocity{ false };
+	/* Particles hit the solid tile colliders, or the blocked cells of the navigation grid when one is built. */
+	bool bCollideWithTiles{ false };
+	/* The part of the speed kept when hitting a tile. Particles that keep none die. */
+	float bounce{ 0.f };
+	bool bEmitting{ true };
+	/* Particles to emit at once on the next update. */
+	int burstCount{ 0 };
+	/* The number of particles alive. Kept by the ParticleSystem. */
+	int numParticles{ 0 };
+
+	static void CreateLuaParticleEmitterBind( sol::state& lua );
+};
+} // namespace Scion::Core::ECS
@@ -44,6 +44,8 @@ struct PhysicsAttributes
 	/* Treat this body as high speed object that performs continuous collision detection against dynamic and kinematic bodies,
 	but not other bullet bodies.*/
 	bool bIsBullet{ false };
+	/* Can the collider of a static box tile be merged with the tiles around it? Turn off for tiles that need a body of their own. */
+	bool bMergeTileCollider{ true };
 	/* Do we want to actually use filters with this body? */
 	bool bUseFilters{ false };
 	/*
@@ -65,7 +67,8 @@ class PhysicsComponent
 {
   private:
 	std::shared_ptr<b2Body> m_pRigidBody;
-	std::shared_ptr<Scion::Physics::UserData> m_pUserData;
+	/* Owned by the UserDataPool and released together with the body. */
+	Scion::Physics::UserData* m_pUserData;
 	PhysicsAttributes m_InitialAttribs;
 
   public:
@@ -88,8 +91,16 @@ class PhysicsComponent
 
 	bool UseFilters() const { return m_InitialAttribs.bUseFilters;  }
 
+	/*
+	 * @brief Uses a body that is shared with other entities instead of creating one in Init.
+	 * Used for merged tile colliders, the body is destroyed when the last entity lets go of it.
+	 * @param The shared body.
+	 * @param The user data of the shared body. It is owned by the body.
+	 */
+	void SetSharedBody( std::shared_ptr<b2Body> pBody, Scion::Physics::UserData* pUserData );
+
 	inline b2Body* GetBody() { return m_pRigidBody.get(); }
-	inline Scion::Physics::UserData* GetUserData() { return m_pUserData.get(); }
+	inline Scion::Physics::UserData* GetUserData() { return m_pUserData; }
 	
 	/* The attributes may have changed. we need to make a function that will refill the attributes */
 	inline const PhysicsAttributes& GetAttributes() const { return m_InitialAttribs; }
@@ -0,0 +1,22 @@
+#pragma once
+#include <sol/sol.hpp>
+
+namespace Scion::Core::ECS
+{
+/*
+ * TweenComponent
+ * Controls the native tweens of an entity. The tweens themselves are kept by the TweenSystem,
+ * which adds this component to every entity it animates.
+ */
+struct TweenComponent
+{
+	/* Scales the time of every tween of the entity. */
+	float timeScale{ 1.f };
+	/* Paused tweens keep their progress. */
+	bool bPaused{ false };
+	/* The number of tweens running or waiting on the entity. Kept by the TweenSystem. */
+	int numTweens{ 0 };
+
+	static void CreateLuaTweenComponentBind( sol::state& lua );
+};
+} // namespace Scion::Core::ECS
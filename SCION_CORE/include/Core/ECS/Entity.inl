@@ -1,6 +1,7 @@
 #pragma once
 #include "Entity.h"
 #include "Logger/Logger.h"
+#include "Core/ECS/MetaUtilities.h"
 
 namespace Scion::Core::ECS
 {
@@ -104,5 +105,7 @@ inline void Entity::RegisterMetaComponent()
 		.template func<&get_component<TComponent>>( "get_component"_hs )
 		.template func<&copy_component<TComponent>>( "copy_component"_hs )
 		.template func<&remove_component<TComponent>>( "remove_component"_hs );
+
+	Scion::Core::Utils::InvalidateMetaFunctionCache();
 }
 } // namespace Scion::Core::ECS
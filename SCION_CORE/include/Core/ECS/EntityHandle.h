@@ -0,0 +1,40 @@
+#pragma once
+#include "Registry.h"
+#include <sol/sol.hpp>
+
+namespace Scion::Core::ECS
+{
+class Entity;
+
+/*
+ * EntityHandle
+ * A registry pointer and an entity id, handed to lua when iterating views. Unlike an Entity,
+ * making one does not copy the name and group of the entity. The full Entity is only made
+ * when it is asked for.
+ */
+class EntityHandle
+{
+  public:
+	EntityHandle() = default;
+	EntityHandle( Registry* registry, entt::entity entity );
+
+	inline bool IsValid() const { return m_pRegistry && m_pRegistry->IsValid( m_Entity ); }
+	inline entt::entity GetEntity() const { return m_Entity; }
+	inline Registry* GetRegistry() const { return m_pRegistry; }
+
+	/* @brief Points the handle at another entity of the same registry. */
+	inline void Reset( entt::entity entity ) { m_Entity = entity; }
+
+	/*
+	 * @brief Makes the full Entity of the handle.
+	 * @return Returns the Entity, with the name and group of its Identification.
+	 */
+	Entity ToEntity() const;
+
+	static void CreateLuaEntityHandleBind( sol::state& lua );
+
+  private:
+	Registry* m_pRegistry{ nullptr };
+	entt::entity m_Entity{ entt::null };
+};
+} // namespace Scion::Core::ECS
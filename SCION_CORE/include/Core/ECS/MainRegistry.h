@@ -33,6 +33,8 @@ class RenderUISystem;
 class RenderShapeSystem;
 class AnimationSystem;
 class PhysicsSystem;
+class SpatialQuerySystem;
+class ParticleSystem;
 } // namespace Scion::Core::Systems
 
 namespace Scion::Core::ECS
@@ -60,11 +62,19 @@ class MainRegistry
 		return m_pMainRegistry->GetContext<TContext>();
 	}
 
+	template <typename TContext>
+	TContext* TryGetContext()
+	{
+		return m_pMainRegistry->TryGetContext<TContext>();
+	}
+
 	Scion::Core::Systems::RenderSystem& GetRenderSystem();
 	Scion::Core::Systems::RenderUISystem& GetRenderUISystem();
 	Scion::Core::Systems::RenderShapeSystem& GetRenderShapeSystem();
 	Scion::Core::Systems::AnimationSystem& GetAnimationSystem();
 	Scion::Core::Systems::PhysicsSystem& GetPhysicsSystem();
+	Scion::Core::Systems::SpatialQuerySystem& GetSpatialQuerySystem();
+	Scion::Core::Systems::ParticleSystem& GetParticleSystem();
 	Registry* GetRegistry();
 
 	bool CleanUp();
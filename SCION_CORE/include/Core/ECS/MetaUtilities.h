@@ -7,8 +7,25 @@
 namespace Scion::Core::Utils
 {
 
+/*
+ * @brief Gets the type id of a lua type table by calling its type_id function.
+ * The id is cached per table in a weak keyed table in the lua registry, so the
+ * type_id function is only called the first time a table is seen.
+ */
 [[nodiscard]] entt::id_type GetIdType( const sol::table& comp );
 
+/*
+ * @brief Gets the meta function of the type. Resolved functions are cached per thread.
+ * @return Returns an invalid meta function if the type or the function is not registered.
+ */
+[[nodiscard]] entt::meta_func GetMetaFunction( entt::id_type id, entt::id_type func_id );
+
+/*
+ * @brief Clears the cached meta functions of every thread. Must be called after registering
+ * meta functions, since registering can move the meta data the cached functions point to.
+ */
+void InvalidateMetaFunctionCache();
+
 template <typename... Args>
 inline auto InvokeMetaFunction( entt::meta_type meta, entt::id_type func_id, Args&&... args )
 {
@@ -28,6 +45,10 @@ inline auto InvokeMetaFunction( entt::meta_type meta, entt::id_type func_id, Arg
 template <typename... Args>
 inline auto InvokeMetaFunction( entt::id_type id, entt::id_type func_id, Args&&... args )
 {
+	if ( auto meta_function = GetMetaFunction( id, func_id ); meta_function )
+		return meta_function.invoke( {}, std::forward<Args>( args )... );
+
+	// Let the uncached lookup report a missing type.
 	return InvokeMetaFunction( entt::resolve( id ), func_id, std::forward<Args>( args )... );
 }
 } // namespace Scion::Core::Utils
@@ -95,6 +95,22 @@ entt::runtime_view& add_component_to_view( Registry* registry, entt::runtime_vie
 template <typename TComponent>
 auto exclude_component_from_view( Registry* registry, entt::runtime_view* view );
 
+template <typename TComponent>
+bool has_entity_component( Registry* registry, entt::entity entity );
+
+template <typename TComponent>
+auto get_entity_component( Registry* registry, entt::entity entity, sol::this_state s );
+
+/*
+ * @brief Gets the components of a batch of entities at once. Each component is given to lua as a
+ * new userdata, so this allocates for every entity. The packed transform field getters do not.
+ * @param The entity ids, from 1 to count.
+ * @param The table to put the components in, at the same index as their entity. Entities
+ * without the component get nil.
+ */
+template <typename TComponent>
+void get_component_batch( Registry* registry, const sol::table& entities, int count, sol::table components );
+
 } // namespace Scion::Core::ECS
 
 #include "Registry.inl"
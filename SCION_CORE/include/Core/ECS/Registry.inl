@@ -1,4 +1,5 @@
 #include "Registry.h"
+#include "Core/ECS/MetaUtilities.h"
 
 namespace Scion::Core::ECS
 {
@@ -54,6 +55,33 @@ auto exclude_component_from_view( Registry* registry, entt::runtime_view* view )
 	view->exclude( registry->GetRegistry().storage<TComponent>() );
 }
 
+template <typename TComponent>
+bool has_entity_component( Registry* registry, entt::entity entity )
+{
+	return registry->GetRegistry().all_of<TComponent>( entity );
+}
+
+template <typename TComponent>
+auto get_entity_component( Registry* registry, entt::entity entity, sol::this_state s )
+{
+	auto* comp = registry->GetRegistry().try_get<TComponent>( entity );
+	return comp ? sol::make_reference( s, std::ref( *comp ) ) : sol::lua_nil_t{};
+}
+
+template <typename TComponent>
+void get_component_batch( Registry* registry, const sol::table& entities, int count, sol::table components )
+{
+	auto& storage = registry->GetRegistry().storage<TComponent>();
+	for ( int i = 1; i <= count; ++i )
+	{
+		const auto entity = static_cast<entt::entity>( entities.raw_get<std::uint32_t>( i ) );
+		if ( storage.contains( entity ) )
+			components.raw_set( i, std::ref( storage.get( entity ) ) );
+		else
+			components.raw_set( i, sol::lua_nil );
+	}
+}
+
 template <typename TComponent>
 void Registry::RegisterMetaComponent()
 {
@@ -61,6 +89,11 @@ void Registry::RegisterMetaComponent()
 	entt::meta_factory<TComponent>()
 		.type( entt::type_hash<TComponent>::value() )
 		.template func<&add_component_to_view<TComponent>>( "add_component_to_view"_hs )
-		.template func<&exclude_component_from_view<TComponent>>( "exclude_component_from_view"_hs );
+		.template func<&exclude_component_from_view<TComponent>>( "exclude_component_from_view"_hs )
+		.template func<&has_entity_component<TComponent>>( "has_entity_component"_hs )
+		.template func<&get_entity_component<TComponent>>( "get_entity_component"_hs )
+		.template func<&get_component_batch<TComponent>>( "get_component_batch"_hs );
+
+	Scion::Core::Utils::InvalidateMetaFunctionCache();
 }
 } // namespace Scion::Core::ECS
@@ -1,6 +1,8 @@
 #pragma once
 #include <sol/sol.hpp>
+#include <entt/entt.hpp>
 #include "Physics/UserData.h"
+#include "Physics/ContactListener.h"
 
 namespace Scion::Core::Events
 {
@@ -10,6 +12,16 @@ struct ContactEvent
 	Scion::Physics::ObjectData objectB{};
 };
 
+/*
+ * ContactBatchEvent
+ * Emitted once per physics step with every contact recorded during the step.
+ * The contacts are only valid while the event is being handled.
+ */
+struct ContactBatchEvent
+{
+	std::span<const Scion::Physics::ContactRecord> contacts{};
+};
+
 enum class EKeyEventType
 {
 	Pressed,
@@ -36,6 +48,20 @@ struct GamepadConnectEvent
 	int index{ 1 };
 };
 
+/*
+ * TweenEvent
+ * Emitted by the TweenSystem when a tween has finished. Stopped tweens do not emit it.
+ */
+struct TweenEvent
+{
+	entt::entity entity{ entt::null };
+	std::uint32_t tweenID{ 0 };
+	/* The id of the sequence the tween belongs to. A single tween is its own sequence. */
+	std::uint32_t sequenceID{ 0 };
+	/* True if this was the last tween of the sequence. */
+	bool bSequenceFinished{ true };
+};
+
 struct LuaEvent
 {
 	sol::object data{ sol::lua_nil };
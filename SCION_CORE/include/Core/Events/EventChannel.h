@@ -0,0 +1,106 @@
+#pragma once
+#include <entt/entt.hpp>
+#include <ScionUtilities/MPSCRingBuffer.h>
+
+namespace Scion::Core::Events
+{
+struct EventChannelStats
+{
+	/* Events that made it into the channel. */
+	std::uint64_t numSent{ 0 };
+	/* Events that were dropped because the channel was full. */
+	std::uint64_t numDropped{ 0 };
+	/* Events that have been triggered on the dispatcher. */
+	std::uint64_t numDelivered{ 0 };
+	/* Time from send to delivery of the events of the last drain. */
+	double averageLatencyMs{ 0.0 };
+	double maxLatencyMs{ 0.0 };
+};
+
+class IEventChannel
+{
+  public:
+	virtual ~IEventChannel() = default;
+	/* @brief Triggers every event that has been sent on the dispatcher. Main thread only. */
+	virtual size_t Drain( entt::dispatcher& dispatcher ) = 0;
+	virtual EventChannelStats GetStats() const = 0;
+	virtual std::string_view GetName() const = 0;
+};
+
+/*
+ * EventChannel
+ * Lets worker threads send events to the main thread without locking. The events are kept
+ * in a bounded ring buffer until the dispatcher drains its channels at the start of the frame,
+ * then they are delivered to the handlers like any other event.
+ * Sending to a full channel drops the event, the sender is never blocked.
+ */
+template <typename TEvent>
+class EventChannel : public IEventChannel
+{
+  public:
+	explicit EventChannel( size_t capacity );
+
+	/*
+	 * @brief Sends the event to the main thread. Safe to call from any thread.
+	 * @return false if the channel was full and the event has been dropped.
+	 */
+	bool Send( TEvent ev );
+
+	size_t Drain( entt::dispatcher& dispatcher ) override;
+	EventChannelStats GetStats() const override;
+	inline std::string_view GetName() const override { return entt::type_name<TEvent>::value(); }
+	inline size_t Capacity() const { return m_Messages.Capacity(); }
+
+  private:
+	struct Message
+	{
+		TEvent ev{};
+		std::chrono::steady_clock::time_point sendTime{};
+	};
+
+	Scion::Utilities::MPSCRingBuffer<Message> m_Messages;
+
+	/* Written by the senders. */
+	std::atomic<std::uint64_t> m_NumSent{ 0 };
+	std::atomic<std::uint64_t> m_NumDropped{ 0 };
+
+	/* Written by the main thread only. */
+	std::uint64_t m_NumDelivered{ 0 };
+	double m_AverageLatencyMs{ 0.0 };
+	double m_MaxLatencyMs{ 0.0 };
+};
+
+/*
+ * EventChannels
+ * The event channels of a dispatcher, one per event type.
+ * Channels are created on the main thread, the returned channel can then be given to any thread.
+ */
+class EventChannels
+{
+  public:
+	static constexpr size_t DEFAULT_CAPACITY{ 256 };
+
+	template <typename TEvent>
+	EventChannel<TEvent>& GetOrCreate( size_t capacity = DEFAULT_CAPACITY );
+
+	/*
+	 * @brief Drains every channel into the dispatcher.
+	 * @return The number of events that have been delivered.
+	 */
+	size_t DrainAll( entt::dispatcher& dispatcher );
+
+	/* @brief Events dropped by all the channels since they were created. */
+	std::uint64_t NumDropped() const;
+	/* @brief The highest latency of the last drain over all the channels. */
+	double MaxLatencyMs() const;
+
+	inline const std::vector<std::unique_ptr<IEventChannel>>& GetChannels() const { return m_Channels; }
+
+  private:
+	std::vector<std::unique_ptr<IEventChannel>> m_Channels;
+	std::unordered_map<entt::id_type, size_t> m_ChannelIndices;
+};
+
+} // namespace Scion::Core::Events
+
+#include "EventChannel.inl"
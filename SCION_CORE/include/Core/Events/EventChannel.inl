@@ -0,0 +1,95 @@
+#include "EventChannel.h"
+#include "Logger/Logger.h"
+
+namespace Scion::Core::Events
+{
+
+template <typename TEvent>
+EventChannel<TEvent>::EventChannel( size_t capacity )
+	: m_Messages{ capacity }
+{
+}
+
+template <typename TEvent>
+bool EventChannel<TEvent>::Send( TEvent ev )
+{
+	if ( !m_Messages.TryPush( Message{ .ev = std::move( ev ), .sendTime = std::chrono::steady_clock::now() } ) )
+	{
+		m_NumDropped.fetch_add( 1, std::memory_order_relaxed );
+		return false;
+	}
+
+	m_NumSent.fetch_add( 1, std::memory_order_relaxed );
+	return true;
+}
+
+template <typename TEvent>
+size_t EventChannel<TEvent>::Drain( entt::dispatcher& dispatcher )
+{
+	const auto now = std::chrono::steady_clock::now();
+	double totalLatencyMs{ 0.0 };
+	double maxLatencyMs{ 0.0 };
+	size_t numDrained{ 0 };
+
+	// Only what was in the channel when the drain started, events sent by the handlers wait for the next frame.
+	const size_t maxDrained = m_Messages.Capacity();
+	Message message{};
+	while ( numDrained < maxDrained && m_Messages.TryPop( message ) )
+	{
+		const double latencyMs = std::chrono::duration<double, std::milli>( now - message.sendTime ).count();
+		totalLatencyMs += std::max( latencyMs, 0.0 );
+		maxLatencyMs = std::max( maxLatencyMs, latencyMs );
+		++numDrained;
+
+		dispatcher.trigger( std::move( message.ev ) );
+	}
+
+	if ( numDrained > 0 )
+	{
+		m_NumDelivered += numDrained;
+		m_AverageLatencyMs = totalLatencyMs / static_cast<double>( numDrained );
+	}
+	else
+	{
+		m_AverageLatencyMs = 0.0;
+	}
+
+	m_MaxLatencyMs = maxLatencyMs;
+	return numDrained;
+}
+
+template <typename TEvent>
+EventChannelStats EventChannel<TEvent>::GetStats() const
+{
+	return EventChannelStats{ .numSent = m_NumSent.load( std::memory_order_relaxed ),
+							  .numDropped = m_NumDropped.load( std::memory_order_relaxed ),
+							  .numDelivered = m_NumDelivered,
+							  .averageLatencyMs = m_AverageLatencyMs,
+							  .maxLatencyMs = m_MaxLatencyMs };
+}
+
+template <typename TEvent>
+EventChannel<TEvent>& EventChannels::GetOrCreate( size_t capacity )
+{
+	const auto eventType = entt::type_hash<TEvent>::value();
+
+	auto itr = m_ChannelIndices.find( eventType );
+	if ( itr == m_ChannelIndices.end() )
+	{
+		itr = m_ChannelIndices.emplace( eventType, m_Channels.size() ).first;
+		m_Channels.push_back( std::make_unique<EventChannel<TEvent>>( capacity ) );
+	}
+
+	auto* pChannel = static_cast<EventChannel<TEvent>*>( m_Channels[ itr->second ].get() );
+	if ( pChannel->Capacity() < capacity )
+	{
+		SCION_WARN( "Event channel [{}] has already been created with a capacity of [{}]. Requested [{}].",
+					pChannel->GetName(),
+					pChannel->Capacity(),
+					capacity );
+	}
+
+	return *pChannel;
+}
+
+} // namespace Scion::Core::Events
@@ -2,6 +2,8 @@
 #include <entt/entt.hpp>
 #include <sol/sol.hpp>
 #include "Logger/Logger.h"
+#include "LuaEventBatcher.h"
+#include "EventChannel.h"
 
 namespace Scion::Core::Events
 {
@@ -84,9 +86,48 @@ class EventDispatcher
 
 	/*
 	 * @brief Update or deliver all pending events that have been queued.
+	 * The events collected for lua batch handlers are delivered after.
 	 */
 	void UpdateAll();
 
+	/*
+	 * @brief Adds a lua function that gets the events of the type as one array per flush.
+	 * Events that do not pass the filter are never given to lua.
+	 * @return The id of the subscription in the lua batcher.
+	 */
+	template <typename TEventType>
+	std::uint32_t AddLuaBatchHandler( const sol::function& callback, const LuaEventFilter& filter );
+
+	/*
+	 * @brief Delivers the events collected for the lua batch handlers.
+	 * The scripting system flushes the dispatchers of the scene every update.
+	 */
+	void FlushLuaEvents();
+
+	/*
+	 * @brief Ends every lua batch subscription. Batch handlers live until they are released,
+	 * so dispatchers that outlive a lua state must be cleared before the state is closed.
+	 */
+	void ClearLuaBatchHandlers();
+
+	/*
+	 * @brief Gets the channel that other threads can send events of the type through.
+	 * The channel is created the first time. Must be called on the main thread, the
+	 * returned channel can then be used from any thread for as long as the dispatcher lives.
+	 * @param capacity - The number of events the channel can hold between two drains.
+	 */
+	template <typename TEventType>
+	EventChannel<TEventType>& GetChannel( size_t capacity = EventChannels::DEFAULT_CAPACITY );
+
+	/*
+	 * @brief Delivers the events sent through the channels to the handlers.
+	 * Called by the application once per frame, before the systems are updated.
+	 * @return The number of events that have been delivered.
+	 */
+	size_t DrainChannels();
+
+	inline const EventChannels& GetChannels() const { return *m_pChannels; }
+
 	/*
 	* @brief Clears all events that have been queued.
 	*/
@@ -99,6 +140,9 @@ class EventDispatcher
 
   private:
 	std::shared_ptr<entt::dispatcher> m_pDispatcher;
+	/* Destroyed first, its queues disconnect from the dispatcher. */
+	std::shared_ptr<LuaEventBatcher> m_pLuaBatcher;
+	std::shared_ptr<EventChannels> m_pChannels;
 };
 
 template <typename TEvent>
@@ -139,6 +183,10 @@ void update_event( EventDispatcher& dispatcher );
 template <typename TEvent>
 bool has_handlers( EventDispatcher& dispatcher );
 
+template <typename TEvent>
+std::uint32_t add_batch_handler( EventDispatcher& dispatcher, const sol::function& callback,
+								 const LuaEventFilter& filter );
+
 } // namespace Scion::Core::Events
 
 #include "EventDispatcher.inl"
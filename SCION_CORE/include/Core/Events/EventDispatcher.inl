@@ -1,5 +1,6 @@
 #include "EventDispatcher.h"
 #include "Logger/Logger.h"
+#include "Core/ECS/MetaUtilities.h"
 
 namespace Scion::Core::Events
 {
@@ -64,6 +65,18 @@ void EventDispatcher::UpdateEvent()
 	m_pDispatcher->update<TEventType>();
 }
 
+template <typename TEventType>
+std::uint32_t EventDispatcher::AddLuaBatchHandler( const sol::function& callback, const LuaEventFilter& filter )
+{
+	return m_pLuaBatcher->Subscribe<TEventType>( *m_pDispatcher, callback, filter );
+}
+
+template <typename TEventType>
+EventChannel<TEventType>& EventDispatcher::GetChannel( size_t capacity )
+{
+	return m_pChannels->GetOrCreate<TEventType>( capacity );
+}
+
 template <typename TEvent>
 void add_handler( EventDispatcher& dispatcher, const sol::table& handler /*, LuaHandler<TEvent>& handler */ )
 {
@@ -125,6 +138,19 @@ bool has_handlers( EventDispatcher& dispatcher )
 	return dispatcher.HasHandlers<TEvent>();
 }
 
+template <typename TEvent>
+std::uint32_t add_batch_handler( EventDispatcher& dispatcher, const sol::function& callback,
+								 const LuaEventFilter& filter )
+{
+	if ( !callback.valid() )
+	{
+		SCION_ERROR( "Failed to add new batch handler. Callback was invalid." );
+		return 0;
+	}
+
+	return dispatcher.AddLuaBatchHandler<TEvent>( callback, filter );
+}
+
 template <typename TEvent>
 inline void EventDispatcher::RegisterMetaEventFuncs()
 {
@@ -136,7 +162,10 @@ inline void EventDispatcher::RegisterMetaEventFuncs()
 		.template func<&emit_event<TEvent>>( "emit_event"_hs )
 		.template func<&enqueue_event<TEvent>>( "enqueue_event"_hs )
 		.template func<&update_event<TEvent>>( "update_event"_hs )
-		.template func<&has_handlers<TEvent>>( "has_handlers"_hs );
+		.template func<&has_handlers<TEvent>>( "has_handlers"_hs )
+		.template func<&add_batch_handler<TEvent>>( "add_batch_handler"_hs );
+
+	Scion::Core::Utils::InvalidateMetaFunctionCache();
 }
 
 } // namespace Scion::Core::Events
@@ -0,0 +1,148 @@
+#pragma once
+#include <entt/entt.hpp>
+#include <sol/sol.hpp>
+
+namespace Scion::Core::Events
+{
+struct KeyEvent;
+struct ContactEvent;
+struct TweenEvent;
+
+/*
+ * LuaEventFilter
+ * Checked natively before an event is given to a lua batch handler. Fields that are not set
+ * let every event through. Fields that do not apply to the event type are ignored.
+ */
+struct LuaEventFilter
+{
+	/* Key events of the key only. */
+	int key{ -1 };
+	/* Key events of the EKeyEventType only. */
+	int keyType{ -1 };
+	/* Contact and tween events of the entity only. */
+	entt::entity entity{ entt::null };
+	/* Contact events with an object of the tag only. */
+	std::string sTag{};
+
+	/* @brief Creates the filter from a table of { key, type, entity, tag }. Anything else passes every event. */
+	static LuaEventFilter Create( const sol::object& filter );
+};
+
+template <typename TEvent>
+bool PassesFilter( const LuaEventFilter&, const TEvent& )
+{
+	return true;
+}
+
+bool PassesFilter( const LuaEventFilter& filter, const KeyEvent& ev );
+bool PassesFilter( const LuaEventFilter& filter, const ContactEvent& ev );
+bool PassesFilter( const LuaEventFilter& filter, const TweenEvent& ev );
+
+class ILuaEventQueue
+{
+  public:
+	virtual ~ILuaEventQueue() = default;
+	virtual void Unsubscribe( std::uint32_t id ) = 0;
+	virtual bool IsSubscribed( std::uint32_t id ) const = 0;
+	virtual void Flush() = 0;
+};
+
+/*
+ * LuaEventQueue
+ * Collects the events of one type while it has lua subscribers. The events are given to every
+ * subscriber as one array when the queue is flushed. Events emitted while flushing are kept
+ * for the next flush. An event is only made into a lua object once per flush, subscribers
+ * whose filters it passes get the same object.
+ */
+template <typename TEvent>
+class LuaEventQueue : public ILuaEventQueue
+{
+  public:
+	explicit LuaEventQueue( entt::dispatcher& dispatcher );
+	~LuaEventQueue() override;
+
+	LuaEventQueue( const LuaEventQueue& ) = delete;
+	LuaEventQueue& operator=( const LuaEventQueue& ) = delete;
+
+	void Subscribe( std::uint32_t id, const sol::function& callback, const LuaEventFilter& filter );
+	void Unsubscribe( std::uint32_t id ) override;
+	bool IsSubscribed( std::uint32_t id ) const override;
+	void Flush() override;
+
+	void HandleEvent( TEvent& ev );
+
+  private:
+	struct Subscriber
+	{
+		std::uint32_t id{ 0 };
+		sol::protected_function callback{};
+		LuaEventFilter filter{};
+		bool bRemoved{ false };
+	};
+
+	/* @brief Only stays connected to the dispatcher while there are subscribers, so nothing is collected for no one. */
+	void UpdateConnection();
+
+  private:
+	entt::dispatcher& m_Dispatcher;
+	entt::connection m_Connection{};
+	std::vector<TEvent> m_Events;
+	std::vector<TEvent> m_FlushingEvents;
+	/* The lua objects of the flushing events, made the first time an event passes a filter. */
+	std::vector<sol::object> m_EventObjects;
+	/* The indices of the flushing events that passed the filter of the current subscriber. */
+	std::vector<size_t> m_PassingEvents;
+	std::vector<Subscriber> m_Subscribers;
+	bool m_bFlushing{ false };
+};
+
+/*
+ * LuaEventBatcher
+ * The lua event queues of a dispatcher, one per event type.
+ */
+class LuaEventBatcher
+{
+  public:
+	template <typename TEvent>
+	std::uint32_t Subscribe( entt::dispatcher& dispatcher, const sol::function& callback,
+							 const LuaEventFilter& filter );
+	void Unsubscribe( entt::id_type eventType, std::uint32_t id );
+	bool IsSubscribed( entt::id_type eventType, std::uint32_t id ) const;
+
+	/* @brief Delivers the collected events of every queue. */
+	void Flush();
+
+	/* @brief Ends every subscription. Must not be called while flushing. */
+	void Clear();
+
+  private:
+	/* Kept in a vector, queues can be added by the handlers while flushing. */
+	std::vector<std::unique_ptr<ILuaEventQueue>> m_Queues;
+	std::unordered_map<entt::id_type, size_t> m_QueueIndices;
+	std::uint32_t m_NextID{ 1 };
+};
+
+/*
+ * LuaBatchHandler
+ * The lua handle of a subscription to a lua event queue. The subscription lasts until the
+ * handle is released or the dispatcher is destroyed. Dropping the handle does not end it,
+ * so handlers that are added without keeping the handle keep getting their events.
+ */
+class LuaBatchHandler
+{
+  public:
+	LuaBatchHandler() = default;
+	LuaBatchHandler( std::weak_ptr<LuaEventBatcher> pBatcher, entt::id_type eventType, std::uint32_t id );
+
+	void Release();
+	bool IsSubscribed() const;
+
+  private:
+	std::weak_ptr<LuaEventBatcher> m_pBatcher{};
+	entt::id_type m_EventType{ 0 };
+	std::uint32_t m_ID{ 0 };
+};
+
+} // namespace Scion::Core::Events
+
+#include "LuaEventBatcher.inl"
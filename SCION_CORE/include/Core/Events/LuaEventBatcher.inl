@@ -0,0 +1,151 @@
+#include "LuaEventBatcher.h"
+#include "Logger/Logger.h"
+
+namespace Scion::Core::Events
+{
+
+template <typename TEvent>
+LuaEventQueue<TEvent>::LuaEventQueue( entt::dispatcher& dispatcher )
+	: m_Dispatcher{ dispatcher }
+{
+}
+
+template <typename TEvent>
+LuaEventQueue<TEvent>::~LuaEventQueue()
+{
+	m_Connection.release();
+}
+
+template <typename TEvent>
+void LuaEventQueue<TEvent>::Subscribe( std::uint32_t id, const sol::function& callback, const LuaEventFilter& filter )
+{
+	m_Subscribers.push_back( Subscriber{ .id = id, .callback = callback, .filter = filter } );
+	UpdateConnection();
+}
+
+template <typename TEvent>
+void LuaEventQueue<TEvent>::Unsubscribe( std::uint32_t id )
+{
+	auto itr = std::ranges::find( m_Subscribers, id, &Subscriber::id );
+	if ( itr == m_Subscribers.end() )
+		return;
+
+	// The subscribers are being iterated, they are erased after the flush.
+	if ( m_bFlushing )
+	{
+		itr->bRemoved = true;
+		return;
+	}
+
+	m_Subscribers.erase( itr );
+	UpdateConnection();
+}
+
+template <typename TEvent>
+bool LuaEventQueue<TEvent>::IsSubscribed( std::uint32_t id ) const
+{
+	auto itr = std::ranges::find( m_Subscribers, id, &Subscriber::id );
+	return itr != m_Subscribers.end() && !itr->bRemoved;
+}
+
+template <typename TEvent>
+void LuaEventQueue<TEvent>::Flush()
+{
+	if ( m_Events.empty() || m_bFlushing )
+		return;
+
+	m_bFlushing = true;
+	std::swap( m_Events, m_FlushingEvents );
+
+	// Each event becomes a lua object once and is shared by every batch it passes the filter of.
+	m_EventObjects.clear();
+	m_EventObjects.resize( m_FlushingEvents.size() );
+
+	// Subscribers added by a callback do not get the events that were emitted before they subscribed.
+	const size_t numSubscribers = m_Subscribers.size();
+	for ( size_t i = 0; i < numSubscribers; ++i )
+	{
+		if ( m_Subscribers[ i ].bRemoved || !m_Subscribers[ i ].callback.valid() )
+			continue;
+
+		const auto& filter = m_Subscribers[ i ].filter;
+		m_PassingEvents.clear();
+		for ( size_t j = 0; j < m_FlushingEvents.size(); ++j )
+		{
+			if ( PassesFilter( filter, m_FlushingEvents[ j ] ) )
+				m_PassingEvents.push_back( j );
+		}
+
+		if ( m_PassingEvents.empty() )
+			continue;
+
+		sol::state_view lua{ m_Subscribers[ i ].callback.lua_state() };
+		const int count = static_cast<int>( m_PassingEvents.size() );
+		sol::table batch = lua.create_table( count, 0 );
+
+		for ( int j = 0; j < count; ++j )
+		{
+			auto& eventObject = m_EventObjects[ m_PassingEvents[ j ] ];
+			if ( !eventObject.valid() )
+				eventObject = sol::make_object( lua, m_FlushingEvents[ m_PassingEvents[ j ] ] );
+
+			batch.raw_set( j + 1, eventObject );
+		}
+
+		// Copied, the callback can subscribe to the queue and move the subscribers.
+		auto callback = m_Subscribers[ i ].callback;
+		auto result = callback( batch, count );
+		if ( !result.valid() )
+		{
+			sol::error error = result;
+			SCION_ERROR( "Failed to deliver lua event batch: {}", error.what() );
+		}
+	}
+
+	m_EventObjects.clear();
+	m_FlushingEvents.clear();
+	std::erase_if( m_Subscribers, []( const Subscriber& subscriber ) { return subscriber.bRemoved; } );
+	m_bFlushing = false;
+
+	UpdateConnection();
+}
+
+template <typename TEvent>
+void LuaEventQueue<TEvent>::HandleEvent( TEvent& ev )
+{
+	m_Events.push_back( ev );
+}
+
+template <typename TEvent>
+void LuaEventQueue<TEvent>::UpdateConnection()
+{
+	if ( m_Subscribers.empty() )
+	{
+		m_Connection.release();
+		m_Events.clear();
+	}
+	else if ( !m_Connection )
+	{
+		m_Connection = m_Dispatcher.sink<TEvent>().template connect<&LuaEventQueue<TEvent>::HandleEvent>( *this );
+	}
+}
+
+template <typename TEvent>
+std::uint32_t LuaEventBatcher::Subscribe( entt::dispatcher& dispatcher, const sol::function& callback,
+										  const LuaEventFilter& filter )
+{
+	const auto eventType = entt::type_hash<TEvent>::value();
+
+	auto itr = m_QueueIndices.find( eventType );
+	if ( itr == m_QueueIndices.end() )
+	{
+		itr = m_QueueIndices.emplace( eventType, m_Queues.size() ).first;
+		m_Queues.push_back( std::make_unique<LuaEventQueue<TEvent>>( dispatcher ) );
+	}
+
+	const std::uint32_t id = m_NextID++;
+	static_cast<LuaEventQueue<TEvent>*>( m_Queues[ itr->second ].get() )->Subscribe( id, callback, filter );
+	return id;
+}
+
+} // namespace Scion::Core::Events
@@ -0,0 +1,204 @@
+#pragma once
+#include <entt/entt.hpp>
+#include <glm/glm.hpp>
+#include <sol/sol.hpp>
+
+namespace Scion::Core
+{
+namespace ECS
+{
+class Registry;
+}
+} // namespace Scion::Core
+
+namespace Scion::Core::Loaders
+{
+
+struct LevelStreamingParams
+{
+	/* Width and height of a single cell in world units (pixels). Set from the manifest. */
+	int cellSize{ 1024 };
+	/* Cells within this many cells of any focus point will be loaded. */
+	int loadRadius{ 1 };
+	/*
+	 * Cells further than this many cells from every focus point will be unloaded.
+	 * Keeping this larger than the load radius prevents cells from thrashing when
+	 * a focus point sits on a cell border.
+	 */
+	int unloadRadius{ 2 };
+	/* The maximum number of cells that can be loaded or unloaded in a single frame. */
+	int maxCellsPerFrame{ 2 };
+	/* Soft time budget in milliseconds for streaming work in a single frame. */
+	double frameBudgetMs{ 2.0 };
+};
+
+enum class ECellState
+{
+	Unloaded,
+	Queued,
+	Loaded
+};
+
+struct StreamedCell
+{
+	int x{ 0 };
+	int y{ 0 };
+	std::string sFilename{};
+	/* Asset names of the textures referenced by the sprites in this cell. */
+	std::vector<std::string> textures{};
+	/* The entities that currently belong to this cell while it is loaded. */
+	std::vector<entt::entity> entities{};
+	ECellState eState{ ECellState::Unloaded };
+};
+
+/*
+ * Streams chunked levels in and out around one or more focus points.
+ *
+ * At export time the scene is partitioned into square cells, each written to its own
+ * JSON file alongside a manifest. Every exported entity is given a stream id that stays
+ * stable across loads, so scripts should hold onto stream ids rather than entity ids
+ * for anything that lives in a streamed cell.
+ *
+ * Cells reference textures by their asset name. Textures that are not in the asset manager
+ * when a cell loads are requested from the texture source, which packaged games point at the
+ * texture data they held back at startup. Only textures loaded that way are freed again.
+ */
+class LevelStreamer
+{
+  public:
+	/* Adds the named texture to the asset manager. Returns false if it is unknown. */
+	using TextureSource = std::function<bool( const std::string& sTextureName )>;
+
+	LevelStreamer();
+	~LevelStreamer() = default;
+
+	/**
+	 * @brief Partitions all tiles and game objects in the registry into cells and writes
+	 * each cell plus a manifest into the given directory.
+	 *
+	 * Children are always written to the cell of their root parent so hierarchies never
+	 * span more than one cell.
+	 *
+	 * Only names are read from the registry, so this is safe to call off the main thread
+	 * with a registry that is not shared.
+	 *
+	 * @param registry    The registry containing the scene to export.
+	 * @param sCellsDir   The directory the cell files will be written to. Created if missing.
+	 * @param cellSize    The width and height of each cell in world units.
+	 * @return true if all the cells and the manifest were written, false otherwise.
+	 */
+	static bool ExportCells( Scion::Core::ECS::Registry& registry, const std::string& sCellsDir, int cellSize );
+
+	/**
+	 * @brief Reads the manifest from a directory created with ExportCells.
+	 * Any currently loaded cells must be unloaded first.
+	 * @param sCellsDir  The directory containing the manifest and cell files.
+	 * @return true if the manifest was loaded, false otherwise.
+	 */
+	bool LoadManifest( const std::string& sCellsDir );
+
+	/*
+	 * @brief Unloads every cell and forgets the manifest. The streamer does nothing until
+	 * another manifest is loaded.
+	 */
+	void Reset( Scion::Core::ECS::Registry& registry );
+
+	/* @brief The directory the packager writes the cells of a scene to, relative to the game. */
+	static std::string GetCellsDirectory( const std::string& sSceneName );
+
+	/*
+	 * @brief Reads the names of the textures referenced by the cells of a manifest without loading it.
+	 * @return false if the manifest could not be read.
+	 */
+	static bool ReadStreamedTextures( const std::string& sCellsDir, std::set<std::string>& textures );
+
+	inline void SetTextureSource( TextureSource textureSource ) { m_TextureSource = std::move( textureSource ); }
+
+	/**
+	 * @brief Decides which cells need to be loaded or unloaded based on the focus points
+	 * and processes as many as the frame budget allows.
+	 */
+	void Update( Scion::Core::ECS::Registry& registry );
+
+	/**
+	 * @brief Loads every cell required by the current focus points, ignoring the frame budget.
+	 * Useful when starting a level so the player never sees an empty world.
+	 */
+	void LoadRequiredCells( Scion::Core::ECS::Registry& registry );
+
+	/*
+	 * @brief Unloads all of the loaded cells and clears the stream id map.
+	 */
+	void UnloadAll( Scion::Core::ECS::Registry& registry );
+
+	/*
+	 * @brief Adds a new focus point that cells will be streamed around.
+	 * @return Returns the id of the focus point.
+	 */
+	std::uint32_t AddFocusPoint( const glm::vec2& position );
+	bool SetFocusPoint( std::uint32_t focusID, const glm::vec2& position );
+	bool RemoveFocusPoint( std::uint32_t focusID );
+	inline void ClearFocusPoints() { m_mapFocusPoints.clear(); }
+
+	/*
+	 * @brief Gets the entity for a stream id.
+	 * @return Returns the entity if its cell is loaded, otherwise entt::null.
+	 */
+	entt::entity GetEntity( std::uint32_t streamID ) const;
+
+	/*
+	 * @brief Gets the stream id for an entity.
+	 * @return Returns the stream id or 0 if the entity was not streamed in.
+	 */
+	std::uint32_t GetStreamID( entt::entity entity ) const;
+
+	bool IsCellLoaded( int x, int y ) const;
+	std::pair<int, int> WorldToCell( const glm::vec2& position ) const;
+
+	inline bool HasManifest() const { return !m_mapCells.empty(); }
+	inline size_t NumLoadedCells() const { return m_NumLoadedCells; }
+	inline LevelStreamingParams& GetParams() { return m_Params; }
+
+	static void CreateLuaLevelStreamerBind( sol::state& lua, Scion::Core::ECS::Registry& registry );
+
+  private:
+	static std::int64_t CellKey( int x, int y );
+
+	/* Fills the load and unload queues. Returns true if something needs to be processed. */
+	void RefreshQueues();
+	bool IsCellRequired( const StreamedCell& cell, int radius ) const;
+
+	bool LoadCell( Scion::Core::ECS::Registry& registry, StreamedCell& cell );
+	void UnloadCell( Scion::Core::ECS::Registry& registry, StreamedCell& cell );
+
+	void AcquireTextures( const StreamedCell& cell );
+	void ReleaseTextures( const StreamedCell& cell );
+	void AcquireTexture( const std::string& sTextureName, const std::string& sCellFile );
+	void ReleaseTexture( const std::string& sTextureName );
+
+  private:
+	LevelStreamingParams m_Params;
+	std::string m_sCellsDir;
+
+	std::unordered_map<std::int64_t, StreamedCell> m_mapCells;
+	std::map<std::uint32_t, glm::vec2> m_mapFocusPoints;
+	std::uint32_t m_NextFocusID;
+
+	std::vector<std::int64_t> m_LoadQueue;
+	std::vector<std::int64_t> m_UnloadQueue;
+
+	/* Stable stream ids from the exported level to the entity currently representing them. */
+	std::unordered_map<std::uint32_t, entt::entity> m_mapStreamIDToEntity;
+	std::unordered_map<entt::entity, std::uint32_t> m_mapEntityToStreamID;
+
+	/*
+	 * Reference counts for textures used by loaded cells. Only textures that the streamer
+	 * had to load itself are tracked, so shared textures from the asset defs stay resident.
+	 */
+	std::unordered_map<std::string, int> m_mapTextureRefs;
+	TextureSource m_TextureSource;
+
+	size_t m_NumLoadedCells;
+};
+
+} // namespace Scion::Core::Loaders
@@ -9,6 +9,11 @@ class Registry;
 }
 } // namespace Scion::Core
 
+namespace Scion::Filesystem
+{
+class JSONSerializer;
+}
+
 namespace Scion::Core::Loaders
 {
 
@@ -68,6 +73,26 @@ class TilemapLoader
 	bool SaveGameObjects( Scion::Core::ECS::Registry& registry, const std::string& sObjectMapFile,
 						  bool bUseJSON = false );
 
+	/**
+	 * @brief Writes all tile entities in the registry into the serializer and ends the document.
+	 * Use with an in-memory serializer to take a snapshot of the tilemap that can be
+	 * written to disk on another thread.
+	 *
+	 * @param registry      The ECS registry containing tile entities.
+	 * @param serializer    A serializer that has not started a document yet.
+	 * @return true if the document was ended successfully, false otherwise.
+	 */
+	bool SerializeTilemapJSON( Scion::Core::ECS::Registry& registry, Scion::Filesystem::JSONSerializer& serializer );
+
+	/**
+	 * @brief Writes all game objects in the registry into the serializer and ends the document.
+	 *
+	 * @param registry      The ECS registry containing game objects.
+	 * @param serializer    A serializer that has not started a document yet.
+	 * @return true if the document was ended successfully, false otherwise.
+	 */
+	bool SerializeObjectMapJSON( Scion::Core::ECS::Registry& registry, Scion::Filesystem::JSONSerializer& serializer );
+
 	bool LoadTilemapFromLuaTable( Scion::Core::ECS::Registry& registry, const sol::table& sTilemapTable );
 	bool LoadGameObjectsFromLuaTable( Scion::Core::ECS::Registry& registry, const sol::table& sObjectTable );
 
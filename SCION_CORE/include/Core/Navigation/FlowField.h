@@ -0,0 +1,46 @@
+#pragma once
+#include "Core/Navigation/NavGrid.h"
+
+namespace Scion::Core::Navigation
+{
+/*
+ * FlowField
+ * Holds the direction to the next cell towards a single goal for every cell of the grid.
+ * It is built once and shared by every agent heading to the same goal, so each agent only
+ * needs to look up the cell it stands on.
+ */
+class FlowField
+{
+  public:
+	FlowField() = default;
+	~FlowField() = default;
+
+	/*
+	 * @brief Builds the path costs to the goal and the direction of every cell.
+	 * @return Returns false if the goal is not walkable.
+	 */
+	bool Build( const NavGrid& grid, const glm::ivec2& goal );
+
+	/*
+	 * @brief Gets the direction towards the goal, in cells. Returns a zero vector at the goal
+	 * and for cells that cannot reach it.
+	 */
+	glm::vec2 GetDirection( int x, int y ) const;
+
+	/* @brief Gets the path cost to the goal, or a negative value if the goal cannot be reached. */
+	float GetCost( int x, int y ) const;
+
+	inline const glm::ivec2& GetGoal() const { return m_Goal; }
+
+  private:
+	inline bool InBounds( int x, int y ) const { return x >= 0 && y >= 0 && x < m_Width && y < m_Height; }
+
+  private:
+	int m_Width{ 0 };
+	int m_Height{ 0 };
+	glm::ivec2 m_Goal{ 0 };
+	std::vector<float> m_Costs{};
+	/* The index of the step to take, or NO_DIRECTION. */
+	std::vector<std::uint8_t> m_Directions{};
+};
+} // namespace Scion::Core::Navigation
@@ -0,0 +1,36 @@
+#pragma once
+#include "Core/Navigation/NavGrid.h"
+#include <span>
+
+namespace Scion::Core::Navigation
+{
+/*
+ * @brief Finds the shortest path between two cells with A* and jump point search.
+ * Only the cells inside the bounds are searched. Steps are 8-directional without cutting corners.
+ * @param The grid to search.
+ * @param The start cell.
+ * @param The goal cell.
+ * @param The cells the search may visit.
+ * @param The jump points of the path from the start to the goal, both included.
+ * @param If not null, the length of the path in cells is written here.
+ * @return Returns true if a path was found.
+ */
+bool FindPathJPS( const NavGrid& grid, const glm::ivec2& start, const glm::ivec2& goal, const GridBounds& bounds,
+				  std::vector<glm::ivec2>& outPath, float* pOutCost = nullptr );
+
+/*
+ * @brief Gets the path cost from the start cell to every target cell inside the bounds.
+ * @param Resized to the number of targets. Unreachable targets have a negative cost.
+ */
+void GetPathCosts( const NavGrid& grid, int startCell, const GridBounds& bounds, std::span<const int> targets,
+				   std::vector<float>& outCosts );
+
+/*
+ * @brief Finds a path on the whole grid. Grids with more than one cluster are searched on the
+ * abstract graph first, and only the steps between its nodes are searched cell by cell.
+ * The result is close to the shortest path, but not always the shortest.
+ * @return Returns true if a path was found.
+ */
+bool FindPath( const NavGrid& grid, const glm::ivec2& start, const glm::ivec2& goal, std::vector<glm::ivec2>& outPath );
+
+} // namespace Scion::Core::Navigation
@@ -0,0 +1,111 @@
+#pragma once
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <vector>
+
+namespace Scion::Core::Navigation
+{
+/* The inclusive cell range a search is allowed to visit. */
+struct GridBounds
+{
+	int minX{ 0 };
+	int minY{ 0 };
+	int maxX{ 0 };
+	int maxY{ 0 };
+
+	inline bool Contains( int x, int y ) const { return x >= minX && y >= minY && x <= maxX && y <= maxY; }
+};
+
+/*
+ * NavGrid
+ * A uniform grid of walkable and blocked cells, split into square clusters.
+ * Every cluster keeps the entrances on its borders and the path costs between them. Together they
+ * form the abstract graph that is searched first on large maps, see FindPath.
+ * Changing a cell only marks its cluster dirty. RebuildDirtyClusters then updates the entrances
+ * and costs of the dirty clusters and their direct neighbours, the rest of the graph is kept.
+ */
+class NavGrid
+{
+  public:
+	struct AbstractEdge
+	{
+		/* The cell index of the node at the other end of the edge. */
+		int targetCell{ -1 };
+		float cost{ 0.f };
+		/* Intra edges connect the entrances of one cluster, inter edges cross a border. */
+		bool bIntra{ false };
+	};
+
+	struct AbstractNode
+	{
+		int cell{ -1 };
+		std::vector<AbstractEdge> edges{};
+	};
+
+	NavGrid( int width, int height, int clusterSize = 16 );
+	~NavGrid() = default;
+
+	inline bool InBounds( int x, int y ) const { return x >= 0 && y >= 0 && x < m_Width && y < m_Height; }
+	inline bool IsWalkable( int x, int y ) const { return InBounds( x, y ) && m_Cells[ ToIndex( x, y ) ] == 0; }
+	inline int ToIndex( int x, int y ) const { return y * m_Width + x; }
+	inline glm::ivec2 ToCoord( int index ) const { return glm::ivec2{ index % m_Width, index / m_Width }; }
+
+	/*
+	 * @brief Checks if a step from the cell to its neighbour is allowed.
+	 * Diagonal steps may not cut the corner of a blocked cell.
+	 */
+	bool CanStep( int x, int y, int dx, int dy ) const;
+
+	/*
+	 * @brief Blocks or unblocks the cell and marks its cluster dirty if it changed.
+	 */
+	void SetBlocked( int x, int y, bool bBlocked );
+
+	/*
+	 * @brief Rebuilds the entrances and costs of the dirty clusters and their neighbours.
+	 */
+	void RebuildDirtyClusters();
+
+	/* @brief Rebuilds the abstract graph of every cluster. */
+	void RebuildAllClusters();
+
+	inline bool HasDirtyClusters() const { return !m_DirtyClusters.empty(); }
+
+	int GetClusterIndex( int x, int y ) const;
+	GridBounds GetClusterBounds( int cluster ) const;
+	inline const std::vector<AbstractNode>& GetClusterNodes( int cluster ) const { return m_ClusterNodes[ cluster ]; }
+
+	/* @brief Gets the abstract node at the cell, or nullptr if the cell is not an entrance. */
+	const AbstractNode* FindNode( int cell ) const;
+
+	inline GridBounds GetBounds() const { return GridBounds{ 0, 0, m_Width - 1, m_Height - 1 }; }
+	inline int GetWidth() const { return m_Width; }
+	inline int GetHeight() const { return m_Height; }
+	inline int GetNumCells() const { return m_Width * m_Height; }
+	inline int GetClusterSize() const { return m_ClusterSize; }
+	inline int GetNumClusters() const { return m_NumClustersX * m_NumClustersY; }
+
+  private:
+	void MarkClusterDirty( int cluster );
+	/*
+	 * @brief Finds the entrances on the border between a cluster and its neighbour to the right or below.
+	 */
+	void BuildBorder( int cluster, int neighbour, bool bVertical );
+	void AddTransition( int cellA, int cellB );
+	AbstractNode& GetOrAddNode( int cell );
+	void BuildIntraEdges( int cluster );
+
+  private:
+	int m_Width;
+	int m_Height;
+	int m_ClusterSize;
+	int m_NumClustersX;
+	int m_NumClustersY;
+
+	/* Zero for walkable cells. */
+	std::vector<std::uint8_t> m_Cells;
+	std::vector<std::vector<AbstractNode>> m_ClusterNodes;
+	std::vector<std::uint8_t> m_ClusterDirty;
+	std::vector<int> m_DirtyClusters;
+};
+} // namespace Scion::Core::Navigation
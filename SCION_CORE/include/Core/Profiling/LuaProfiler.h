@@ -0,0 +1,126 @@
+#pragma once
+#include <sol/sol.hpp>
+
+#define LUA_PROFILER() Scion::Core::LuaProfiler::GetInstance()
+
+namespace Scion::Core
+{
+/** @brief A function in the sampled call tree. The path from the root is the call stack. */
+struct LuaProfileNode
+{
+	std::string sName{};
+	std::string sSource{};
+	int lineDefined{ 0 };
+	int parent{ -1 };
+	/** @brief Samples taken in this function or in the functions it called. */
+	std::uint64_t samples{ 0 };
+	/** @brief Samples taken in this function itself. */
+	std::uint64_t selfSamples{ 0 };
+	std::vector<int> children{};
+	/** @brief The samples by the line that was running, including time in the C functions it called. */
+	std::vector<std::pair<int, std::uint64_t>> lineSamples{};
+};
+
+/** @brief A line of a script and the samples taken while it was running */
+struct LuaHotLine
+{
+	std::string sSource{};
+	int line{ 0 };
+	std::uint64_t samples{ 0 };
+};
+
+/*
+ * LuaProfiler
+ * @brief Samples the call stack of a lua state with a count hook. The hook checks the clock every
+ * few instructions and takes a sample once the sample interval has passed, so the samples of a
+ * function are proportional to the time spent in it. Time spent in a C function is counted
+ * towards the lua stack the C function returns to.
+ * Samples are merged into a call tree that can be drawn as a flame graph.
+ */
+class LuaProfiler
+{
+  public:
+	static LuaProfiler& GetInstance()
+	{
+		static LuaProfiler instance{};
+		return instance;
+	}
+
+	LuaProfiler( const LuaProfiler& ) = delete;
+	LuaProfiler& operator=( const LuaProfiler& ) = delete;
+
+	/** @brief Sets the lua state to profile. The hook is installed if sampling is enabled. */
+	void Attach( lua_State* L );
+
+	/** @brief Removes the hook and ends any open zones. Must be called before the attached lua state is closed. */
+	void Detach();
+
+	void SetEnabled( bool bEnabled );
+	bool IsEnabled() const { return m_bEnabled; }
+
+	/** @brief Sets the time between samples in microseconds. */
+	void SetSampleInterval( int microseconds );
+	int GetSampleInterval() const { return static_cast<int>( m_SampleInterval.count() ); }
+
+	/** @brief Clears the call tree. */
+	void Reset();
+
+	/** @brief The call tree. The first node is the root and holds every sample. */
+	const std::vector<LuaProfileNode>& GetNodes() const { return m_Nodes; }
+	std::uint64_t GetTotalSamples() const { return m_Nodes.front().samples; }
+
+	/** @brief Gets the lines with the most self samples, highest first. */
+	std::vector<LuaHotLine> GetHotLines( int maxLines = 50 ) const;
+
+	/**
+	 * @brief Writes the call tree as folded stacks, one "root;caller;callee samples" line per
+	 * stack. This is the input format of the common flame graph tools.
+	 */
+	std::string ToFoldedStacks() const;
+
+	/*
+	 * @brief Adds the profile_begin( name ) and profile_end() zones to lua. Zones are recorded
+	 * by the ProfileCollector and by Tracy when it is enabled.
+	 */
+	static void CreateLuaProfilerBind( sol::state& lua );
+
+	/*
+	 * @brief Ends the zones that a script began and did not end, such as when the script
+	 * raised an error between profile_begin and profile_end.
+	 * @param The lua state that began the zones, used to end the Tracy zones.
+	 */
+	static void CloseOpenZones( lua_State* L );
+
+  private:
+	LuaProfiler();
+
+	struct StackFrame
+	{
+		const char* sName{ nullptr };
+		const char* sSource{ nullptr };
+		int lineDefined{ 0 };
+		int currentLine{ -1 };
+	};
+
+	static void Hook( lua_State* L, lua_Debug* ar );
+	void TakeSample( lua_State* L );
+	int GetChild( int node, const StackFrame& frame );
+	void InstallHook();
+
+  private:
+	/** @brief How many instructions run between clock checks. */
+	static constexpr int CHECK_INSTRUCTIONS = 100;
+	static constexpr int MAX_STACK_DEPTH = 64;
+
+	lua_State* m_pLuaState{ nullptr };
+	bool m_bEnabled{ false };
+	std::chrono::microseconds m_SampleInterval{ 1000 };
+	std::chrono::steady_clock::time_point m_LastSample{};
+
+	std::vector<LuaProfileNode> m_Nodes{};
+	/** @brief The frames of the sample being taken, from the innermost function out. */
+	std::vector<StackFrame> m_Stack{};
+	/** @brief Debug info of the sampled frames. Kept so the frame names stay valid during a sample. */
+	std::vector<lua_Debug> m_DebugInfo{};
+};
+} // namespace Scion::Core
@@ -24,11 +24,29 @@ struct ZoneStat
 	int depth{ 0 };
 };
 
+/** @brief A value set once per frame, such as the memory used by lua */
+struct ProfileCounter
+{
+	std::string name{};
+	double value{ 0.0 };
+};
+
+/** @brief Aggregated stats for a named counter, computed over the ring buffer window */
+struct CounterStat
+{
+	std::string name{};
+	double avg{ 0.0 };
+	double min{ 0.0 };
+	double max{ 0.0 };
+	double last{ 0.0 };
+};
+
 /** @brief One frame's complete profile snapshot */
 struct FrameProfile
 {
 	float totalMs{ 0.f };
 	std::vector<ProfileSample> samples{};
+	std::vector<ProfileCounter> counters{};
 };
 
 /** @brief Ring buffer size - how many frames of history to retain. */
@@ -62,6 +80,9 @@ class ProfileCollector
 	/** @brief Record the end of the zone identified by the token. */
 	void EndZone( int token );
 
+	/** @brief Set the value of a named counter for this frame. */
+	void SetCounter( const std::string& name, double value );
+
 	/** @brief Read-only access to the history ring buffer. */
 	const std::array<FrameProfile, PROFILE_HISTORY_SIZE>& GetHistory() const { return m_History; }
 
@@ -74,6 +95,9 @@ class ProfileCollector
 	/** @brief Compute aggregated stats from the last N frames. */
 	std::vector<ZoneStat> ComputeStats( int frameWindow = 60 ) const;
 
+	/** @brief Compute aggregated counter values from the last N frames. */
+	std::vector<CounterStat> ComputeCounterStats( int frameWindow = 60 ) const;
+
 	/** @brief Current FPS (rolling average). */
 	float GetFPS() const { return m_Fps; }
 
@@ -138,4 +162,12 @@ struct ScopedProfileZone
 * @brief Sub-system zone (depth 1)
 */
 #define SCION_SUBSYSTEM_ZONE(name)  SCION_PROFILE_SCOPE_EX( name, 1)
+
+/*
+* @brief Sets a counter in both Tracy and the in-editor ProfileCollector.
+* The name must be a string literal.
+*/
+#define SCION_PROFILE_COUNTER( name, value )						\
+	SCION_PROFILE_PLOT( name, static_cast<double>( value ) );		\
+	PROFILE_COLLECTOR().SetCounter( name, static_cast<double>( value ) )
 // clang-format on
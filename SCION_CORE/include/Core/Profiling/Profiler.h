@@ -9,6 +9,7 @@
 #define SCION_PROFILE_FRAME_N( name ) FrameMarkNamed( name )
 #define SCION_PROFILE_ALLOC( ptr, size ) TracyAlloc( ptr, size )
 #define SCION_PROFILE_FREE( ptr ) TracyFree( ptr )
+#define SCION_PROFILE_PLOT( name, value ) TracyPlot( name, value )
 
 #else
 
@@ -18,5 +19,6 @@
 #define SCION_PROFILE_FRAME_N( name )
 #define SCION_PROFILE_ALLOC( ptr, size )
 #define SCION_PROFILE_FREE( ptr )
+#define SCION_PROFILE_PLOT( name, value )
 
 #endif
@@ -14,6 +14,11 @@ namespace Scion::Core
 class Prefab;
 }
 
+namespace Scion::Filesystem
+{
+class DirectoryWatcher;
+}
+
 namespace Scion::Rendering
 {
 class Texture;
@@ -62,6 +67,28 @@ class AssetManager
 	 */
 	bool AddTextureFromMemory( const std::string& textureName, const unsigned char* imageData, size_t length,
 							   bool pixelArt = true, bool bTileset = false );
+
+	/*
+	 * @brief Adds a texture that has already been created, such as one finished by the async asset loader.
+	 * Textures created from a file are watched like the ones added by path.
+	 * @param std::string for the texture name to be used as the key.
+	 * @param The texture to take ownership of.
+	 * @return Returns true if the texture was added successfully, false otherwise.
+	 */
+	bool AddTexture( const std::string& textureName, std::unique_ptr<Scion::Rendering::Texture> pTexture );
+
+	/*
+	 * @brief Adds a texture that is a region of an atlas texture that has already been added. The texture
+	 * keeps the size of the original image, and uvs used with it are remapped into the atlas when rendering,
+	 * so anything that references the texture by name keeps working.
+	 * @param std::string for the texture name to be used as the key.
+	 * @param std::string for the name of the atlas texture.
+	 * @param The x, y position and width, height of the region in the atlas in pixels.
+	 * @return Returns true if the region was added successfully, false otherwise.
+	 */
+	bool AddTextureAtlasRegion( const std::string& textureName, const std::string& atlasName, int x, int y,
+								int width, int height );
+
 	/*
 	 * @brief Checks to see if the texture exists based on the name and returns a std::shared_ptr<Texture>.
 	 * @param An std::string for the texture name to lookup.
@@ -95,6 +122,14 @@ class AssetManager
 	 */
 	bool AddFontFromMemory( const std::string& fontName, unsigned char* fontData, float fontSize = 32.f );
 
+	/*
+	 * @brief Adds a font that has already been created, such as one finished by the async asset loader.
+	 * @param An std::string for the font name to be use as the key.
+	 * @param The font to take ownership of.
+	 * @return Returns true if the font was added successfully, false otherwise.
+	 */
+	bool AddFont( const std::string& fontName, std::unique_ptr<Scion::Rendering::Font> pFont );
+
 	/*
 	 * @brief Checks to see if the font exists based on the name and returns a std::shared_ptr<Font>.
 	 * @param An std::string for the font name to lookup.
@@ -132,6 +167,7 @@ class AssetManager
 	bool AddAudio( const std::string& audioName, const std::string& filepath, Scion::Sounds::AudioType eType );
 	bool AddAudioFromMemory( const std::string& audioName, const unsigned char* audioData, size_t dataSize,
 							 Scion::Sounds::AudioType eType );
+	bool AddAudio( const std::string& audioName, std::unique_ptr<Scion::Sounds::Audio> pAudio );
 
 	Scion::Sounds::Audio* GetAudio( const std::string& audioName );
 
@@ -225,20 +261,26 @@ class AssetManager
 	 */
 	static void CreateLuaAssetManager( sol::state& lua );
 
+	/*
+	 * @brief Reloads any watched assets whose files changed since the last call.
+	 * Should be called once per frame, changes are batched until then.
+	 */
 	void Update();
 
   private:
-	void FileWatcher();
-
 	struct AssetWatchParams
 	{
 		std::string sAssetName{};
 		std::string sFilepath{};
-		std::filesystem::file_time_type lastWrite;
+		/* Absolute, normalized path used to match directory watcher notifications. */
+		std::string sWatchPath{};
 		Scion::Utilities::AssetType eType{};
-		bool bDirty{ false };
 	};
 
+	void WatchAssetFile( const std::string& sAssetName, const std::string& sFilepath,
+						 Scion::Utilities::AssetType eType );
+	void OnAssetFileChanged( const std::filesystem::path& path, bool bModified );
+
 	void ReloadAsset( const AssetWatchParams& assetParams );
 	void ReloadTexture( const std::string& sTextureName );
 	void ReloadFont( const std::string& sFontName );
@@ -258,7 +300,10 @@ class AssetManager
 	std::vector<AssetWatchParams> m_FilewatchParams;
 
 	std::atomic<bool> m_bFileWatcherRunning;
-	std::jthread m_WatchThread;
+	/* One recursive watcher per directory that contains watched assets. */
+	std::unordered_map<std::string, std::unique_ptr<Scion::Filesystem::DirectoryWatcher>> m_mapDirectoryWatchers;
+	/* Files reported as changed by the watcher threads, guarded by m_CallbackMutex. */
+	std::unordered_set<std::string> m_PendingChanges;
 	std::mutex m_CallbackMutex;
 	std::shared_mutex m_AssetMutex;
 };
@@ -0,0 +1,189 @@
+#pragma once
+#include <sol/sol.hpp>
+#include <future>
+
+namespace Scion::Utilities
+{
+class ThreadPool;
+enum class AssetType;
+} // namespace Scion::Utilities
+
+namespace Scion::Sounds
+{
+enum class AudioType;
+}
+
+namespace Scion::Core::ECS
+{
+class Registry;
+}
+
+namespace SCION_RESOURCES
+{
+class AssetManager;
+struct AsyncLoadResult;
+
+enum class EAsyncLoadState
+{
+	/* Waiting for a worker thread. */
+	Queued,
+	/* Being read and decoded on a worker thread. */
+	Loading,
+	/* Decoded, waiting for the main thread to upload it and add it to the asset manager. */
+	Uploading,
+	Ready,
+	Failed
+};
+
+struct AsyncLoadParams
+{
+	std::string sPath{};
+	bool bPixelArt{ true };
+	bool bTileset{ false };
+	float fontSize{ 32.f };
+	Scion::Sounds::AudioType eAudioType{};
+};
+
+/*
+ * AsyncLoad
+ * The handle of an asset that is loaded in the background. A group load, such as a scene, waits
+ * for the loads it depends on and then runs its activation on the main thread.
+ */
+class AsyncLoad
+{
+  public:
+	AsyncLoad( std::uint32_t id, const std::string& sName, Scion::Utilities::AssetType eType );
+	~AsyncLoad();
+
+	AsyncLoad( const AsyncLoad& ) = delete;
+	AsyncLoad& operator=( const AsyncLoad& ) = delete;
+
+	inline std::uint32_t GetID() const { return m_ID; }
+	inline const std::string& GetName() const { return m_sName; }
+	inline Scion::Utilities::AssetType GetType() const { return m_eType; }
+	inline EAsyncLoadState GetState() const { return m_eState.load( std::memory_order_acquire ); }
+	inline bool IsReady() const { return GetState() == EAsyncLoadState::Ready; }
+	inline bool IsDone() const
+	{
+		const auto eState = GetState();
+		return eState == EAsyncLoadState::Ready || eState == EAsyncLoadState::Failed;
+	}
+
+	/* @brief How far along the load is, from 0 to 1. Group loads average the loads they depend on. */
+	float GetProgress() const;
+
+  private:
+	friend class AsyncAssetLoader;
+
+	std::uint32_t m_ID;
+	std::string m_sName;
+	Scion::Utilities::AssetType m_eType;
+	/* Set to loading and uploading by the worker, everything else happens on the main thread. */
+	std::atomic<EAsyncLoadState> m_eState{ EAsyncLoadState::Queued };
+
+	AsyncLoadParams m_Params{};
+	std::future<std::unique_ptr<AsyncLoadResult>> m_Result{};
+
+	std::vector<std::shared_ptr<AsyncLoad>> m_Dependencies{};
+	std::function<bool()> m_Activate{};
+	bool m_bGroup{ false };
+
+	std::vector<sol::protected_function> m_Callbacks{};
+};
+
+/*
+ * AsyncAssetLoader
+ * Loads textures, fonts, audio and prefabs without stalling the frame. Files are read and
+ * decoded on the shared thread pool. Everything that needs the GL context or changes the asset
+ * manager is done on the main thread in Update, which stops starting new work once the upload
+ * budget of the frame is used up. At least one load is finished every update.
+ *
+ * The loader lives in the context of the registry the lua state was bound with, since the
+ * completion callbacks are lua functions. It must be removed before the state is closed.
+ */
+class AsyncAssetLoader
+{
+  public:
+	AsyncAssetLoader( AssetManager& assetManager, std::shared_ptr<Scion::Utilities::ThreadPool> pThreadPool );
+	~AsyncAssetLoader();
+
+	AsyncAssetLoader( const AsyncAssetLoader& ) = delete;
+	AsyncAssetLoader& operator=( const AsyncAssetLoader& ) = delete;
+
+	/*
+	 * @brief Requests the asset. Requesting an asset that is already being loaded returns the same
+	 * handle, requesting one that already exists in the asset manager returns a ready handle.
+	 */
+	std::shared_ptr<AsyncLoad> LoadTexture( const std::string& sTextureName, const std::string& sTexturePath,
+											bool bPixelArt = true, bool bTileset = false );
+	std::shared_ptr<AsyncLoad> LoadFont( const std::string& sFontName, const std::string& sFontPath,
+										 float fontSize = 32.f );
+	std::shared_ptr<AsyncLoad> LoadAudio( const std::string& sAudioName, const std::string& sAudioPath,
+										  Scion::Sounds::AudioType eType );
+	std::shared_ptr<AsyncLoad> LoadPrefab( const std::string& sPrefabName, const std::string& sPrefabPath );
+
+	/*
+	 * @brief Creates a load that is done once all of its dependencies are. If they all succeeded,
+	 * the activation is called on the main thread and decides if the group succeeded.
+	 * @param The name and type of the group, such as a scene.
+	 */
+	std::shared_ptr<AsyncLoad> LoadGroup( const std::string& sName, Scion::Utilities::AssetType eType,
+										  std::vector<std::shared_ptr<AsyncLoad>> dependencies,
+										  std::function<bool()> activate = {} );
+
+	/*
+	 * @brief Requests every asset of an asset definitions table, the same tables scripts give to
+	 * the asset manager: { textures = {}, fonts = {}, music = {}, sound_fx = {}, prefabs = {} }.
+	 */
+	std::vector<std::shared_ptr<AsyncLoad>> LoadAssetDefs( const sol::table& assetDefs );
+
+	/* @brief Calls the function with the handle and if it succeeded once the load is done. */
+	void OnComplete( const std::shared_ptr<AsyncLoad>& pLoad, const sol::protected_function& callback );
+
+	/* @brief Finishes the loads that were decoded and calls their callbacks. Main thread only. */
+	void Update();
+
+	inline void SetUploadBudget( double budgetMs ) { m_UploadBudgetMs = std::max( budgetMs, 0.0 ); }
+	inline double GetUploadBudget() const { return m_UploadBudgetMs; }
+	inline size_t NumPendingLoads() const { return m_PendingLoads.size(); }
+
+	/*
+	 * @brief Loads the assets of a scene with the loader of the registry, then changes to the scene.
+	 * The change itself creates the entities, so it is run on the main thread once the assets are ready.
+	 * @param The registry the loader was bound to.
+	 * @param An optional asset definitions table of the assets the scene needs.
+	 * @param The function that changes to the scene, returns false if it could not.
+	 * @return The handle of the scene load, nullptr if there is no loader.
+	 */
+	static std::shared_ptr<AsyncLoad> LoadScene( Scion::Core::ECS::Registry& registry, const std::string& sSceneName,
+												 const sol::optional<sol::table>& optAssetDefs,
+												 std::function<bool( const std::string& )> changeScene );
+
+	/*
+	 * @brief Adds the async load functions to the AssetManager table in lua and the loader to
+	 * the context of the registry. Task.waitLoad( handle ) waits for a load inside a task.
+	 */
+	static void CreateLuaAsyncLoaderBind( sol::state& lua, Scion::Core::ECS::Registry& registry );
+
+  private:
+	std::shared_ptr<AsyncLoad> Request( const std::string& sName, Scion::Utilities::AssetType eType,
+										AsyncLoadParams params );
+	/* @brief Creates the asset from the decoded result and adds it to the asset manager. */
+	bool Finish( AsyncLoad& load, AsyncLoadResult& result );
+	void Complete( const std::shared_ptr<AsyncLoad>& pLoad, bool bSuccess );
+	static void CallCallback( const std::shared_ptr<AsyncLoad>& pLoad, const sol::protected_function& callback );
+
+  private:
+	AssetManager& m_AssetManager;
+	std::shared_ptr<Scion::Utilities::ThreadPool> m_pThreadPool;
+
+	/* In the order they were requested, so groups are checked after what they depend on. */
+	std::vector<std::shared_ptr<AsyncLoad>> m_PendingLoads;
+	/* Callbacks added to loads that were already done, called on the next update. */
+	std::vector<std::pair<std::shared_ptr<AsyncLoad>, sol::protected_function>> m_ReadyCallbacks;
+
+	std::uint32_t m_NextLoadID{ 1 };
+	double m_UploadBudgetMs{ 2.0 };
+};
+
+} // namespace SCION_RESOURCES
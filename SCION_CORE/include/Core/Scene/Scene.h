@@ -5,6 +5,12 @@
 #include "Core/Character/PlayerStart.h"
 #include "ScionUtilities/HelperUtilities.h"
 
+namespace Scion::Filesystem
+{
+class JSONSerializer;
+class AsyncFileWriter;
+} // namespace Scion::Filesystem
+
 namespace Scion::Core
 {
 struct Canvas
@@ -65,9 +71,21 @@ class Scene
 	/*
 	 * @brief Tries to save the scene. This differs from the unload function
 	 * because it does not set the loaded flag or clear the registry.
+	 * Loaded scenes are saved with the file writer of the main registry if there is one,
+	 * so only the snapshot is taken on the calling thread.
 	 * @return Returns true if successful, false otherwise.
 	 */
-	bool SaveScene( bool bOverride = false ) { return SaveSceneData( bOverride ); }
+	bool SaveScene( bool bOverride = false );
+
+	/*
+	 * @brief Takes a snapshot of the scene data, tilemap and game objects and hands them to
+	 * the file writer. Only the snapshot is taken on the calling thread, formatting and writing
+	 * the files happens on the writer's thread.
+	 * @param The file writer that will write the files.
+	 * @param Optional directory to write the files into instead of the scene's own files.
+	 * @return Returns true if the snapshot was taken and queued, false otherwise.
+	 */
+	bool SaveSceneAsync( Scion::Filesystem::AsyncFileWriter& fileWriter, const std::string& sDirectory = "" );
 
 	inline const std::string& GetDefaultMusicName() const { return m_sDefaultMusic; }
 	inline void SetDefaultMusic( const std::string& sDefaultMusic ) { m_sDefaultMusic = sDefaultMusic; }
@@ -96,6 +114,7 @@ class Scene
   protected:
 	bool LoadSceneData();
 	bool SaveSceneData(bool bOverride = false);
+	bool SerializeSceneData( Scion::Filesystem::JSONSerializer& serializer );
 	void SetCanvasOffset();
 	
   protected:
@@ -0,0 +1,64 @@
+#pragma once
+#include <sol/sol.hpp>
+
+namespace Scion::Core::Scripting
+{
+/*
+ * LazyLuaBindings
+ * Binds groups of lua globals the first time a script reads one of them. The globals table
+ * gets an __index function that looks up the group of a missing global, binds it and returns
+ * the global. Once bound, the globals are plain fields of the table and cost nothing more.
+ *
+ * A group must be bound before any of its types can be pushed to lua. Types that the engine
+ * pushes without a script reading their global first, such as entities and vectors, are bound
+ * eagerly. A group that uses the types of another lists it as a dependency.
+ */
+class LazyLuaBindings
+{
+  public:
+	using BindFunc = std::function<void( sol::state& )>;
+
+	explicit LazyLuaBindings( sol::state& lua );
+
+	/*
+	 * @brief Adds a group of globals that are bound by the function.
+	 * @param The name of the group.
+	 * @param The globals the function binds. Reading any of them binds the group.
+	 * @param The function that binds the globals.
+	 * @param The groups that must be bound first.
+	 */
+	void Add( const std::string& sGroup, std::vector<std::string> globals, BindFunc bindFunc,
+			  std::vector<std::string> dependencies = {} );
+
+	/* @brief Binds the group and its dependencies, if they are not bound yet. */
+	void Bind( const std::string& sGroup );
+	/* @brief Binds every group that has not been bound. */
+	void BindAll();
+
+	inline size_t NumGroups() const { return m_Groups.size(); }
+	size_t NumBoundGroups() const;
+
+	/*
+	 * @brief Sets the __index function of the globals table of the lua state. The lua state keeps
+	 * the bindings alive.
+	 */
+	static void Install( const std::shared_ptr<LazyLuaBindings>& pBindings );
+
+  private:
+	struct Group
+	{
+		std::string sName{};
+		BindFunc bindFunc{ nullptr };
+		std::vector<std::string> dependencies{};
+		bool bBound{ false };
+	};
+
+	void Bind( size_t groupIndex );
+
+  private:
+	sol::state& m_LuaState;
+	std::vector<Group> m_Groups;
+	std::unordered_map<std::string, size_t> m_GroupIndices;
+	std::unordered_map<std::string, size_t> m_GlobalGroups;
+};
+} // namespace Scion::Core::Scripting
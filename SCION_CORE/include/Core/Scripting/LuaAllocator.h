@@ -0,0 +1,89 @@
+#pragma once
+#include "LuaGCSettings.h"
+#include <sol/sol.hpp>
+
+namespace Scion::Core::Scripting
+{
+struct LuaMemoryStats
+{
+	/* The bytes lua is using. */
+	size_t bytesInUse{ 0 };
+	size_t peakBytesInUse{ 0 };
+	/* The bytes of the pages of the pools, used or free. */
+	size_t pooledBytes{ 0 };
+	/* Allocations that were too large for the pools. */
+	size_t largeAllocations{ 0 };
+	size_t totalAllocations{ 0 };
+};
+
+/*
+ * LuaAllocator
+ * The allocator of a lua state. Small blocks, which are most of what lua allocates, come from
+ * free lists of fixed size classes that are carved out of larger pages. Larger blocks use
+ * malloc. A lua state is only used by one thread at a time, so nothing is locked.
+ * The pages are only freed with the allocator, which must outlive its lua state.
+ */
+class LuaAllocator
+{
+  public:
+	LuaAllocator() = default;
+	~LuaAllocator();
+
+	LuaAllocator( const LuaAllocator& ) = delete;
+	LuaAllocator& operator=( const LuaAllocator& ) = delete;
+
+	/* @brief The lua_Alloc function. The user data is the allocator. */
+	static void* Allocate( void* ud, void* ptr, size_t osize, size_t nsize );
+
+	/* @brief Gets the allocator of the lua state, or nullptr if the state uses another allocator. */
+	static LuaAllocator* Get( lua_State* L );
+
+	inline const LuaMemoryStats& GetStats() const { return m_Stats; }
+
+  private:
+	struct PoolBlock
+	{
+		PoolBlock* pNext{ nullptr };
+	};
+
+	static constexpr size_t MAX_POOLED_SIZE = 256;
+	static constexpr size_t NUM_SIZE_CLASSES = 12;
+	static constexpr size_t POOL_PAGE_SIZE = 64 * 1024;
+
+	static int GetSizeClass( size_t size );
+	static size_t GetClassSize( int sizeClass );
+
+	void* AllocateBlock( size_t size );
+	void ReleaseBlock( void* ptr, size_t size );
+	void* ReallocateBlock( void* ptr, size_t osize, size_t nsize );
+	bool AddPage( int sizeClass );
+
+  private:
+	std::array<PoolBlock*, NUM_SIZE_CLASSES> m_FreeLists{};
+	std::vector<void*> m_Pages;
+	LuaMemoryStats m_Stats{};
+};
+
+struct LuaGCStepResult
+{
+	int steps{ 0 };
+	double elapsedMs{ 0.0 };
+	bool bCycleFinished{ false };
+};
+
+/*
+ * @brief Creates a lua state that uses its own LuaAllocator. The allocator is freed
+ * with the state.
+ */
+std::shared_ptr<sol::state> CreateLuaState();
+
+/* @brief Sets the mode and pacing of the garbage collector of the lua state. */
+void ApplyGCSettings( lua_State* L, const LuaGCSettings& settings );
+
+/*
+ * @brief Steps the garbage collector until the budget is used or a cycle finishes.
+ * In generational mode a step is a whole collection, so only one step is done.
+ */
+LuaGCStepResult StepGarbageCollector( lua_State* L, ELuaGCMode eMode, double budgetMs );
+
+} // namespace Scion::Core::Scripting
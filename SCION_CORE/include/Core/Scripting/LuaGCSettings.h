@@ -0,0 +1,45 @@
+#pragma once
+
+namespace Scion::Core::Scripting
+{
+enum class ELuaGCMode
+{
+	Incremental,
+	Generational
+};
+
+/*
+ * LuaGCSettings
+ * How the garbage collector of a lua state paces itself. The pacing values are passed
+ * straight to lua_gc, a value of 0 keeps lua's default.
+ */
+struct LuaGCSettings
+{
+	ELuaGCMode eMode{ ELuaGCMode::Incremental };
+
+	/* Incremental: how much the memory must grow before a new cycle starts, in percent. */
+	int pause{ 0 };
+	/* Incremental: how much work each step does relative to the memory allocated. */
+	int stepMultiplier{ 0 };
+	/* Incremental: the log2 of the bytes allocated between steps. */
+	int stepSize{ 0 };
+
+	/* Generational: how much the memory must grow before a minor collection, in percent. */
+	int minorMultiplier{ 0 };
+	/* Generational: how much the memory must grow before a major collection, in percent. */
+	int majorMultiplier{ 0 };
+
+	/* The most time spent stepping the collector in the spare time of a frame, in milliseconds. */
+	float idleBudgetMs{ 1.f };
+};
+
+inline std::string GetLuaGCModeStr( ELuaGCMode eMode )
+{
+	return eMode == ELuaGCMode::Generational ? "generational" : "incremental";
+}
+
+inline ELuaGCMode GetLuaGCModeFromStr( const std::string& sMode )
+{
+	return sMode == "generational" ? ELuaGCMode::Generational : ELuaGCMode::Incremental;
+}
+} // namespace Scion::Core::Scripting
@@ -0,0 +1,250 @@
+#pragma once
+#include <sol/sol.hpp>
+
+namespace Scion::Core::ECS
+{
+class Registry;
+}
+
+namespace SCION_RESOURCES
+{
+class AsyncLoad;
+}
+
+namespace Scion::Core::Scripting
+{
+/*
+ * TimerWheel
+ * Hashed timing wheel. An entry is put in the slot it expires in, with the number of full turns
+ * of the wheel it has to wait. Advancing only visits the slots that were passed, so waiting
+ * entries cost nothing until the wheel comes around to them.
+ */
+class TimerWheel
+{
+  public:
+	explicit TimerWheel( size_t numSlots );
+
+	/* @brief Adds an entry that expires after the ticks. Entries expire after at least one tick. */
+	void Schedule( std::uint32_t taskID, std::uint32_t serial, std::uint64_t ticks );
+
+	/*
+	 * @brief Moves the wheel forward and calls the function with the task id and serial of every
+	 * entry that expired.
+	 */
+	template <typename TFunc>
+	void Advance( std::uint64_t ticks, TFunc&& onExpired );
+
+	inline size_t Size() const { return m_Size; }
+	void Clear();
+
+  private:
+	struct Entry
+	{
+		std::uint32_t taskID{ 0 };
+		std::uint32_t serial{ 0 };
+		std::uint64_t rounds{ 0 };
+	};
+
+	std::vector<std::vector<Entry>> m_Slots;
+	size_t m_CurrentSlot{ 0 };
+	size_t m_Size{ 0 };
+};
+
+template <typename TFunc>
+void TimerWheel::Advance( std::uint64_t ticks, TFunc&& onExpired )
+{
+	for ( std::uint64_t tick = 0; tick < ticks && m_Size > 0; ++tick )
+	{
+		m_CurrentSlot = ( m_CurrentSlot + 1 ) % m_Slots.size();
+		auto& slot = m_Slots[ m_CurrentSlot ];
+
+		for ( size_t i = 0; i < slot.size(); )
+		{
+			if ( slot[ i ].rounds > 0 )
+			{
+				--slot[ i ].rounds;
+				++i;
+				continue;
+			}
+
+			const Entry expired = slot[ i ];
+			slot[ i ] = slot.back();
+			slot.pop_back();
+			--m_Size;
+
+			onExpired( expired.taskID, expired.serial );
+		}
+	}
+}
+
+enum class ETaskWait
+{
+	None,
+	Time,
+	Frames,
+	Event,
+	Scene,
+	Asset,
+	Load
+};
+
+/*
+ * LuaTaskScheduler
+ * Runs lua functions as coroutines and resumes them when what they wait for happens.
+ * Tasks waiting on time or frames are kept in timer wheels and tasks waiting on events or
+ * scenes in lists by name, so a waiting task costs no lua time until it is resumed.
+ * Only tasks waiting for an asset or an async load are checked every frame, and that check is native.
+ *
+ * Tasks are resumed from Update, before the main update script runs. A task that was woken
+ * by an event emitted during the update is resumed on the next update.
+ *
+ * The scheduler lives in the context of the registry the lua state was bound with. It only
+ * holds references into the lua state, so it must be removed before the state is closed.
+ */
+class LuaTaskScheduler
+{
+  public:
+	explicit LuaTaskScheduler( lua_State* L );
+	~LuaTaskScheduler() = default;
+
+	LuaTaskScheduler( const LuaTaskScheduler& ) = delete;
+	LuaTaskScheduler& operator=( const LuaTaskScheduler& ) = delete;
+
+	/*
+	 * @brief Advances the timers by the delta time and one frame, then resumes every task that
+	 * is ready.
+	 * @param The delta time of the frame in seconds.
+	 */
+	void Update( double deltaTime );
+
+	/*
+	 * @brief Wakes the tasks waiting for the event. The arguments are returned by their wait.
+	 * @param The name of the event.
+	 * @param A reference to a table packed with the arguments, or LUA_NOREF.
+	 */
+	void EmitEvent( const std::string& sEvent, int argsRef = LUA_NOREF );
+
+	/* @brief Wakes the tasks waiting for the scene. Called by the scene managers after a scene is loaded. */
+	void NotifySceneLoaded( const std::string& sSceneName );
+
+	/* @brief Stops the task. A task can cancel itself, it is stopped once it yields. */
+	void Cancel( std::uint32_t taskID );
+	bool IsAlive( std::uint32_t taskID ) const;
+	inline size_t NumTasks() const { return m_Tasks.size(); }
+
+	/*
+	 * @brief Adds the Task table to lua and the scheduler to the context of the registry.
+	 * Task.spawn( func, ... ) runs the function as a task right away, until its first wait.
+	 * Inside a task:
+	 *	Task.wait( seconds ), Task.waitFrames( frames ), Task.waitEvent( name ),
+	 *	Task.waitScene( sceneName ), Task.waitAsset( assetName, AssetType ) and Task.waitLoad( handle ).
+	 * Task.waitLoad returns true if the async load succeeded.
+	 * A plain coroutine.yield() inside a task waits one frame.
+	 */
+	static void CreateLuaTaskSchedulerBind( sol::state& lua, Scion::Core::ECS::Registry& registry );
+
+  private:
+	struct Task
+	{
+		std::uint32_t id{ 0 };
+		lua_State* pThread{ nullptr };
+		int threadRef{ LUA_NOREF };
+		/* The arguments of the first resume, already on the stack of the thread. */
+		int numStartArgs{ 0 };
+		ETaskWait eWait{ ETaskWait::None };
+		/* Changed every time the task waits. Wake ups for an older wait are ignored. */
+		std::uint32_t serial{ 0 };
+		bool bStarted{ false };
+		/* Set while the task is resumed, including while a task it spawned runs. */
+		bool bRunning{ false };
+		bool bCancelled{ false };
+	};
+
+	struct ReadyTask
+	{
+		std::uint32_t taskID{ 0 };
+		std::uint32_t serial{ 0 };
+		int argsRef{ LUA_NOREF };
+	};
+
+	struct AssetWait
+	{
+		std::uint32_t taskID{ 0 };
+		std::uint32_t serial{ 0 };
+		std::string sAssetName{};
+		int assetType{ 0 };
+	};
+
+	struct LoadWait
+	{
+		std::uint32_t taskID{ 0 };
+		std::uint32_t serial{ 0 };
+		std::shared_ptr<SCION_RESOURCES::AsyncLoad> pLoad{ nullptr };
+	};
+
+	using WaitList = std::vector<std::pair<std::uint32_t, std::uint32_t>>;
+
+	/*
+	 * The lua_State parameters are the thread that is calling into the scheduler. Registry
+	 * references are made and freed on its stack.
+	 */
+
+	/* @brief Creates a task from the function and arguments on top of the stack and starts it. */
+	std::uint32_t Spawn( lua_State* L, int numArgs );
+	void Resume( lua_State* L, const ReadyTask& readyTask );
+	void Finish( lua_State* L, std::uint32_t taskID );
+	void Cancel( lua_State* L, std::uint32_t taskID );
+	bool IsWaiting( std::uint32_t taskID, std::uint32_t serial ) const;
+
+	/* @brief Gets the task running on the lua thread, raises a lua error if there is none. */
+	Task& GetRunningTask( lua_State* L, const char* sFunction );
+	void BeginWait( Task& task, ETaskWait eWait );
+
+	void WaitSeconds( Task& task, double seconds );
+	void WaitFrames( Task& task, std::uint64_t frames );
+	void AddWaiter( WaitList& waiters, const Task& task );
+	void WakeWaiters( lua_State* L, std::unordered_map<std::string, WaitList>& waiters, const std::string& sKey,
+					  int argsRef );
+	void PollAssets();
+	void PollLoads();
+
+	static LuaTaskScheduler* GetScheduler( lua_State* L );
+	static int LuaSpawn( lua_State* L );
+	static int LuaWait( lua_State* L );
+	static int LuaWaitFrames( lua_State* L );
+	static int LuaWaitEvent( lua_State* L );
+	static int LuaWaitScene( lua_State* L );
+	static int LuaWaitAsset( lua_State* L );
+	static int LuaWaitLoad( lua_State* L );
+	static int LuaEmit( lua_State* L );
+	static int LuaCancel( lua_State* L );
+	static int LuaIsAlive( lua_State* L );
+	static int LuaCount( lua_State* L );
+
+  private:
+	/* Milliseconds per tick of the time wheel. */
+	static constexpr double TIME_TICK_MS = 1.0;
+	static constexpr size_t TIME_WHEEL_SLOTS = 1024;
+	static constexpr size_t FRAME_WHEEL_SLOTS = 64;
+
+	lua_State* m_pLuaState;
+	std::unordered_map<std::uint32_t, Task> m_Tasks;
+	std::uint32_t m_NextTaskID{ 1 };
+	/* The task being resumed, tasks can spawn tasks. */
+	std::uint32_t m_RunningTaskID{ 0 };
+
+	TimerWheel m_TimeWheel;
+	TimerWheel m_FrameWheel;
+	/* Time that has passed but is not a full tick yet, in ticks. */
+	double m_PartialTicks{ 0.0 };
+
+	std::unordered_map<std::string, WaitList> m_EventWaiters;
+	std::unordered_map<std::string, WaitList> m_SceneWaiters;
+	std::vector<AssetWait> m_AssetWaits;
+	std::vector<LoadWait> m_LoadWaits;
+
+	std::vector<ReadyTask> m_ReadyTasks;
+	std::vector<ReadyTask> m_ResumingTasks;
+};
+
+} // namespace Scion::Core::Scripting
@@ -0,0 +1,176 @@
+#pragma once
+#include <sol/sol.hpp>
+#include <future>
+
+namespace Scion::Utilities
+{
+class ThreadPool;
+}
+
+namespace Scion::Core::ECS
+{
+class Registry;
+}
+
+namespace Scion::Core::Scripting
+{
+/*
+ * JobValue
+ * A lua value copied out of one lua state so it can be pushed into another. Only plain data is
+ * copied. Module functions are copied as bytecode.
+ */
+struct JobValue
+{
+	enum class EType
+	{
+		Nil,
+		Boolean,
+		Integer,
+		Number,
+		String,
+		Table,
+		Function
+	};
+
+	EType eType{ EType::Nil };
+	bool bValue{ false };
+	lua_Integer integer{ 0 };
+	double number{ 0.0 };
+	/* The string, or the bytecode of a function. */
+	std::string sValue{};
+	/* The keys and values of a table, one after the other. */
+	std::vector<JobValue> fields{};
+};
+
+enum class EJobStatus
+{
+	Pending,
+	Done,
+	Failed,
+	Cancelled
+};
+
+/*
+ * LuaJob
+ * The handle of a job that was given to the worker pool. The results are taken from the
+ * future once the job is finished, by the pool update or by waiting on the job.
+ */
+struct LuaJob
+{
+	std::uint32_t id{ 0 };
+	EJobStatus eStatus{ EJobStatus::Pending };
+	std::vector<JobValue> results{};
+	std::string sError{};
+
+	struct Output
+	{
+		bool bSuccess{ false };
+		std::vector<JobValue> results{};
+		std::string sError{};
+	};
+
+	std::future<Output> output{};
+	std::shared_ptr<std::atomic<bool>> pCancelled{ std::make_shared<std::atomic<bool>>( false ) };
+
+	/* @brief Takes the output of the future if it is ready. Returns true if the job is no longer pending. */
+	bool Collect();
+	/* @brief Blocks until the job is finished and takes its output. */
+	void Wait();
+};
+
+/*
+ * LuaWorkerPool
+ * Runs lua functions on other threads. Every thread of the pool has its own lua state, which
+ * only has the standard libraries, the glm bindings and the declared modules. Worker states
+ * have no engine bindings, they can never reach the registry, entities or assets.
+ *
+ * A module is a table of functions and data declared from the main state. Its functions are
+ * copied as bytecode, so they cannot capture locals. In the workers the module is a global
+ * with the declared name, so its functions can call each other through it.
+ *
+ * The arguments and results of a job are copied between the states. Numbers, strings,
+ * booleans and tables of them can be copied. Entities are copied as their ids, vectors and
+ * transforms as tables.
+ */
+class LuaWorkerPool
+{
+  public:
+	explicit LuaWorkerPool( size_t numWorkers );
+	~LuaWorkerPool();
+
+	LuaWorkerPool( const LuaWorkerPool& ) = delete;
+	LuaWorkerPool& operator=( const LuaWorkerPool& ) = delete;
+
+	/*
+	 * @brief Copies the module on top of the stack so workers can load it. A module that was
+	 * declared with the same name is replaced.
+	 * @return true if the module could be copied.
+	 */
+	bool DeclareModule( lua_State* L, const std::string& sModule, int index );
+
+	/*
+	 * @brief Copies the arguments and gives the job to a worker.
+	 * @param The lua state the arguments are on, the index of the first and the number of arguments.
+	 * @return The job, or nullptr if the arguments could not be copied.
+	 */
+	std::shared_ptr<LuaJob> Run( lua_State* L, const std::string& sModule, const std::string& sFunction,
+								 int firstArg, int numArgs );
+
+	/* @brief Takes the results of the jobs that were finished. */
+	void Update();
+
+	inline size_t NumWorkers() const { return m_Workers.size(); }
+	inline size_t NumPendingJobs() const { return m_PendingJobs.size(); }
+
+	/*
+	 * @brief Copies the value at the index into the job value. Functions are only copied when
+	 * they are allowed. The error is set if the value cannot be copied.
+	 */
+	static bool ReadValue( lua_State* L, int index, JobValue& value, std::string& sError, bool bAllowFunctions,
+						   int depth = 0 );
+	/* @brief Pushes a copy of the value onto the stack. */
+	static void PushValue( lua_State* L, const JobValue& value );
+
+	/*
+	 * @brief Adds the Jobs table to lua and the pool to the context of the registry.
+	 * Jobs.declare( name, module ) declares a module for the workers.
+	 * Jobs.run( module, function, ... ) and run_job( module, function, ... ) return a LuaJob.
+	 */
+	static void CreateLuaWorkerPoolBind( sol::state& lua, Scion::Core::ECS::Registry& registry );
+
+  private:
+	struct Module
+	{
+		std::string sName{};
+		JobValue table{};
+	};
+
+	struct Worker
+	{
+		std::shared_ptr<sol::state> pLuaState{ nullptr };
+		std::uint64_t modulesVersion{ 0 };
+	};
+
+	Worker* AcquireWorker();
+	void ReleaseWorker( Worker* pWorker );
+	void LoadModules( Worker& worker );
+	LuaJob::Output RunJob( const std::string& sModule, const std::string& sFunction,
+						   const std::vector<JobValue>& args, const std::atomic<bool>& bCancelled );
+
+  private:
+	std::vector<std::unique_ptr<Worker>> m_Workers;
+	std::vector<Worker*> m_FreeWorkers;
+	std::mutex m_WorkerMutex;
+
+	std::vector<Module> m_Modules;
+	std::uint64_t m_ModulesVersion{ 0 };
+	std::mutex m_ModuleMutex;
+
+	std::vector<std::shared_ptr<LuaJob>> m_PendingJobs;
+	std::uint32_t m_NextJobID{ 1 };
+	std::atomic<bool> m_bStopping{ false };
+
+	/* Destroyed first, so running jobs finish before the workers are freed. */
+	std::unique_ptr<Scion::Utilities::ThreadPool> m_pThreadPool;
+};
+} // namespace Scion::Core::Scripting
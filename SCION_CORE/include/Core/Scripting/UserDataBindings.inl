@@ -1,6 +1,7 @@
 #include "Core/Scripting/UserDataBindings.h"
 #include <entt/entt.hpp>
 #include <Physics/UserData.h>
+#include "Core/ECS/MetaUtilities.h"
 
 using namespace Scion::Physics;
 
@@ -11,12 +12,8 @@ template <typename DATA>
 inline auto create_user_data( const sol::table& data, sol::this_state s )
 {
 	auto newData = data.valid() ? data.as<DATA>() : DATA{};
-
-	UserData userData{};
-	userData.userData = newData;
-	userData.type_id = entt::type_hash<DATA>::value();
-
-	return sol::make_reference( s, userData );
+	auto optUserData = newData.ToUserData();
+	return optUserData ? sol::make_reference( s, *optUserData ) : sol::make_reference( s, sol::lua_nil );
 }
 
 template <typename DATA>
@@ -24,18 +21,23 @@ inline auto set_user_data( Scion::Physics::UserData* pUserData, const sol::table
 {
 	auto newData = data.valid() ? data.as<DATA>() : DATA{};
 
-	pUserData->userData.reset();
-	pUserData->userData = newData;
-	pUserData->type_id = entt::type_hash<DATA>::value();
+	// The old data is kept if the new group could not be added.
+	auto optUserData = newData.ToUserData();
+	if ( !optUserData )
+		return sol::make_reference( s, DATA{ *pUserData, true } );
 
-	return sol::make_reference( s, std::any_cast<DATA>( pUserData->userData ) );
+	// The contacts belong to the body, not to the data being set.
+	const auto contactHead = pUserData->contactHead;
+	*pUserData = *optUserData;
+	pUserData->contactHead = contactHead;
+
+	return sol::make_reference( s, DATA{ *pUserData, true } );
 }
 
 template <typename DATA>
 inline auto get_user_data( Scion::Physics::UserData& userData, sol::this_state s )
 {
-	auto& data = userData.userData;
-	return sol::make_reference( s, std::any_cast<DATA>( data ) );
+	return sol::make_reference( s, DATA{ userData, true } );
 }
 
 template <typename DATA>
@@ -47,5 +49,7 @@ inline void UserDataBinder::register_meta_user_data()
 		.template func<&create_user_data<DATA>>( "create_user_data"_hs )
 		.template func<&set_user_data<DATA>>( "set_user_data"_hs )
 		.template func<&get_user_data<DATA>>( "get_user_data"_hs );
+
+	Scion::Core::Utils::InvalidateMetaFunctionCache();
 }
 } // namespace Scion::Core::Scripting
@@ -0,0 +1,153 @@
+#pragma once
+#include "Core/Navigation/NavGrid.h"
+#include "Core/Navigation/FlowField.h"
+#include <sol/sol.hpp>
+#include <entt/entt.hpp>
+#include <future>
+
+namespace Scion::Utilities
+{
+class ThreadPool;
+}
+
+namespace Scion::Core::ECS
+{
+class Registry;
+}
+
+namespace Scion::Core::Systems
+{
+enum class EPathStatus
+{
+	Pending,
+	Found,
+	NotFound,
+	Invalid
+};
+
+/*
+ * NavigationSystem
+ * Builds a navigation grid from the colliders of the tiles and answers path and flow field
+ * requests on it. Requests are solved on the shared thread pool when there is one, against a
+ * snapshot of the grid taken when the request was made.
+ * Tiles with a box collider block the cells they cover. When such tiles are added or removed,
+ * the grid is changed in Update and only the clusters around the changed cells are rebuilt.
+ *
+ * The system lives in the context of the registry it was built from.
+ */
+class NavigationSystem
+{
+  public:
+	NavigationSystem() = default;
+	~NavigationSystem() = default;
+
+	/*
+	 * @brief Builds the grid from the tiles of the registry. The grid covers every tile.
+	 * @param The registry with the tiles. The system must be in its context.
+	 * @param The size of a grid cell in pixels, usually the tile size of the map.
+	 * @param The width and height of a cluster in cells.
+	 * @return Returns true if there were any tiles to build the grid from.
+	 */
+	bool BuildFromTiles( Scion::Core::ECS::Registry& registry, const glm::vec2& cellSize, int clusterSize = 16 );
+
+	/*
+	 * @brief Applies the tile changes since the last update and collects finished requests.
+	 */
+	void Update( Scion::Core::ECS::Registry& registry );
+
+	/* @brief Blocks or unblocks the cell at the position, on top of the tile colliders. */
+	void SetBlocked( const glm::vec2& position, bool bBlocked );
+	bool IsWalkable( const glm::vec2& position ) const;
+
+	inline bool HasGrid() const { return m_pGrid != nullptr; }
+
+	/* @brief Checks if the position is in a blocked cell. Positions outside of the grid are not blocked. */
+	bool IsBlocked( const glm::vec2& position ) const;
+
+	/*
+	 * @brief Requests a path between two positions in pixels.
+	 * @return Returns the id of the request, or 0 if there is no grid.
+	 */
+	std::uint32_t RequestPath( const glm::vec2& start, const glm::vec2& goal );
+	EPathStatus GetPathStatus( std::uint32_t requestID ) const;
+
+	/*
+	 * @brief Gets the found path and forgets the request. A request that did not find a path is
+	 * forgotten as well. Finished requests that are never taken are forgotten after a few seconds
+	 * of updates, after which their status is invalid.
+	 * @param The centers of the path's cells in pixels, from the start to the goal.
+	 * @return Returns false if the request has not found a path (yet).
+	 */
+	bool TakePath( std::uint32_t requestID, std::vector<glm::vec2>& outPath );
+	void CancelPath( std::uint32_t requestID );
+
+	/*
+	 * @brief Gets a flow field towards the goal. Requests for the same goal cell share one field.
+	 * Every acquired field must be released.
+	 * @return Returns the id of the field, or 0 if there is no grid.
+	 */
+	std::uint32_t AcquireFlowField( const glm::vec2& goal );
+	void ReleaseFlowField( std::uint32_t fieldID );
+	bool IsFlowFieldReady( std::uint32_t fieldID ) const;
+
+	/* @brief Gets the direction to move in at the position. Zero until the field is ready. */
+	glm::vec2 GetFlowDirection( std::uint32_t fieldID, const glm::vec2& position ) const;
+
+	/* @brief Marks the tile to be added to or removed from the grid on the next update. */
+	void MarkTileDirty( entt::entity tile );
+
+	static void CreateNavigationLuaBind( sol::state& lua, Scion::Core::ECS::Registry& registry );
+
+  private:
+	struct PathRequest
+	{
+		EPathStatus eStatus{ EPathStatus::Pending };
+		std::future<std::vector<glm::ivec2>> result{};
+		std::vector<glm::ivec2> path{};
+		/* The updates since the request finished. */
+		std::uint32_t unreadUpdates{ 0 };
+	};
+
+	struct FlowFieldEntry
+	{
+		int goalCell{ -1 };
+		int refCount{ 0 };
+		std::shared_ptr<const Scion::Core::Navigation::FlowField> pField{ nullptr };
+		/* A field being built for the current grid. The old field is used until it is done. */
+		std::future<std::shared_ptr<const Scion::Core::Navigation::FlowField>> pending{};
+	};
+
+	glm::ivec2 ToCell( const glm::vec2& position ) const;
+	glm::vec2 ToPosition( const glm::ivec2& cell ) const;
+
+	/* @brief Gets the cells the tile's collider covers, or an empty optional if it does not block. */
+	std::optional<Scion::Core::Navigation::GridBounds> GetTileCells( entt::registry& registry, entt::entity tile ) const;
+	void AddBlocker( const Scion::Core::Navigation::GridBounds& cells, int amount );
+	void ApplyGridChanges();
+	void BuildFlowField( FlowFieldEntry& entry );
+	void SetupThreadPool();
+
+	template <typename TFunc>
+	auto RunTask( TFunc&& func ) -> std::future<std::invoke_result_t<TFunc>>;
+
+  private:
+	/* The grid that new requests use. It is copied before it is changed while requests still use it. */
+	std::shared_ptr<Scion::Core::Navigation::NavGrid> m_pGrid{ nullptr };
+	glm::vec2 m_Origin{ 0.f };
+	glm::vec2 m_CellSize{ 16.f };
+
+	/* How many tile colliders cover each cell. */
+	std::vector<std::uint16_t> m_Blockers;
+	std::vector<std::uint8_t> m_ManualBlocks;
+	std::unordered_map<entt::entity, Scion::Core::Navigation::GridBounds> m_TileCells;
+	std::vector<entt::entity> m_DirtyTiles;
+	std::vector<int> m_ChangedCells;
+
+	std::unordered_map<std::uint32_t, PathRequest> m_PathRequests;
+	std::unordered_map<std::uint32_t, FlowFieldEntry> m_FlowFields;
+	std::uint32_t m_NextRequestID{ 1 };
+
+	std::shared_ptr<Scion::Utilities::ThreadPool> m_pThreadPool{ nullptr };
+	bool m_bThreadPoolSet{ false };
+};
+} // namespace Scion::Core::Systems
@@ -0,0 +1,86 @@
+#pragma once
+#include <entt/entt.hpp>
+#include <glm/glm.hpp>
+#include <random>
+
+namespace Scion::Core::ECS
+{
+class Registry;
+struct ParticleEmitterComponent;
+} // namespace Scion::Core::ECS
+
+namespace Scion::Rendering
+{
+class Camera2D;
+class ParticleBatchRenderer;
+} // namespace Scion::Rendering
+
+namespace Scion::Core::Systems
+{
+class NavigationSystem;
+class TileColliderSystem;
+
+/*
+ * ParticleSystem
+ * Simulates the particles of every ParticleEmitterComponent and draws them with instancing.
+ * The particles of an emitter are kept in a pool with one array per field, so the update runs
+ * over packed floats and dead particles are swapped with the last live one. Particles are never
+ * entities, so emitting and killing them does not touch the registry.
+ *
+ * Emitters that collide with tiles use the navigation grid when a script has built one, and the
+ * tile colliders otherwise.
+ */
+class ParticleSystem
+{
+  public:
+	ParticleSystem();
+	~ParticleSystem();
+
+	/*
+	 * @brief Moves, ages and kills the particles, then emits new ones.
+	 * Pools of emitters that were removed are freed.
+	 * @param The delta time in seconds.
+	 */
+	void Update( Scion::Core::ECS::Registry& registry, double deltaTime );
+
+	/* @brief Draws the particles of every emitter. */
+	void Render( Scion::Core::ECS::Registry& registry, Scion::Rendering::Camera2D& camera );
+
+	/* @brief Removes every particle. */
+	void Clear();
+
+	inline size_t NumPools() const { return m_Pools.size(); }
+
+  private:
+	struct ParticlePool
+	{
+		std::vector<float> positionX{};
+		std::vector<float> positionY{};
+		std::vector<float> velocityX{};
+		std::vector<float> velocityY{};
+		std::vector<float> age{};
+		std::vector<float> lifetime{};
+		/* The live particles are the first count of every array. */
+		size_t count{ 0 };
+		/* Part of a particle that has not been emitted yet. */
+		float emitRemainder{ 0.f };
+
+		void Resize( size_t maxParticles );
+		void Kill( size_t index );
+	};
+
+	void Simulate( Scion::Core::ECS::Registry& registry, ParticlePool& pool,
+				   const Scion::Core::ECS::ParticleEmitterComponent& emitter, float dt,
+				   const NavigationSystem* pNavigation, const TileColliderSystem* pTileColliders );
+	void Emit( ParticlePool& pool, const Scion::Core::ECS::ParticleEmitterComponent& emitter,
+			   const glm::vec2& origin, size_t numParticles );
+	float RandomRange( float min, float max );
+
+  private:
+	std::unordered_map<entt::entity, ParticlePool> m_Pools;
+	std::unique_ptr<Scion::Rendering::ParticleBatchRenderer> m_pBatchRenderer;
+	std::mt19937 m_Random;
+	/* Set once an emitter wanted to collide with tiles and there was nothing to collide with. */
+	bool m_bWarnedNoTiles;
+};
+} // namespace Scion::Core::Systems
@@ -14,5 +14,12 @@ class PhysicsSystem
 	~PhysicsSystem() = default;
 
 	void Update( Scion::Core::ECS::Registry& registry );
+
+	/*
+	 * @brief Publishes the contacts of the last physics step and sends them to any event handlers.
+	 * Must be called once after every physics step.
+	 * @param The registry that holds the contact listener and event dispatcher in its context.
+	 */
+	void DispatchContacts( Scion::Core::ECS::Registry& registry );
 };
 } // namespace Scion::Core::Systems
@@ -26,6 +26,14 @@ class ScriptingSystem
 	void Update( Scion::Core::ECS::Registry& registry );
 	void Render( Scion::Core::ECS::Registry& registry );
 
+	/*
+	 * @brief Steps the lua garbage collector in the spare time of the frame, up to the idle
+	 * budget of the project's GC settings. Also sets the lua memory counters of the profiler.
+	 * @param The registry with the lua state in its context.
+	 * @param The time left in the frame in milliseconds.
+	 */
+	void CollectGarbage( Scion::Core::ECS::Registry& registry, double idleTimeMs );
+
 	static void RegisterLuaBindings( sol::state& lua, Scion::Core::ECS::Registry& registry );
 	static void RegisterLuaFunctions( sol::state& lua, Scion::Core::ECS::Registry& registry );
 	static void RegisterLuaEvents( sol::state& lua, Scion::Core::ECS::Registry& registry );
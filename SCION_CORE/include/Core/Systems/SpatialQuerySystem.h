@@ -0,0 +1,144 @@
+#pragma once
+#include <sol/sol.hpp>
+#include <glm/glm.hpp>
+#include <Physics/BatchQuery.h>
+
+namespace Scion::Core::ECS
+{
+class Registry;
+}
+
+namespace Scion::Core::Systems
+{
+/*
+ * SpatialQuerySystem
+ * Answers overlap and proximity queries in pixel space without walking every entity.
+ * Entities with a physics body are found through the Box2D broadphase. Entities with a box or
+ * circle collider but no body are kept in a uniform grid that is rebuilt every frame in Update.
+ * Results are written as packed entity ids into buffers owned by the caller.
+ *
+ * Queries can be limited to a group. Bodies are matched by the group of their physics object
+ * data, entities in the grid by the group of their identification.
+ */
+class SpatialQuerySystem
+{
+  public:
+	SpatialQuerySystem( float cellSize = 64.f );
+	~SpatialQuerySystem() = default;
+
+	/*
+	 * @brief Rebuilds the grid of the collider entities that do not have a physics body.
+	 * Should be called once per frame after the physics system has updated the transforms.
+	 */
+	void Update( Scion::Core::ECS::Registry& registry );
+
+	/*
+	 * @brief Gets the entities whose colliders overlap the box.
+	 * @param The registry that holds the physics world in its context.
+	 * @param The top left of the box in pixels.
+	 * @param The bottom right of the box in pixels.
+	 * @param The entity ids are written here. The buffer is cleared first.
+	 * @param If not empty, only entities in this group are returned.
+	 */
+	void QueryAABB( Scion::Core::ECS::Registry& registry, const glm::vec2& min, const glm::vec2& max,
+					std::vector<std::uint32_t>& outEntities, const std::string& sGroup = "" );
+
+	void QueryCircle( Scion::Core::ECS::Registry& registry, const glm::vec2& center, float radius,
+					  std::vector<std::uint32_t>& outEntities, const std::string& sGroup = "" );
+
+	/*
+	 * @brief Gets up to k entities within the radius, closest first.
+	 */
+	void QueryNearest( Scion::Core::ECS::Registry& registry, const glm::vec2& center, float radius, size_t k,
+					   std::vector<std::uint32_t>& outEntities, const std::string& sGroup = "" );
+
+	/*
+	 * @brief Gets every pair of overlapping entities. Each pair is written once as two
+	 * consecutive ids. Moving bodies and the entities of the grid query the broadphase for the
+	 * bodies they overlap, so pairs are found even when filters keep the bodies from colliding.
+	 * @param If not empty, both entities of a pair must be in this group.
+	 */
+	void QueryOverlapPairs( Scion::Core::ECS::Registry& registry, std::vector<std::uint32_t>& outPairs,
+							const std::string& sGroup = "" );
+
+	/*
+	 * @brief Casts every ray against the physics world and keeps the closest hit of each.
+	 * The rays are run in parallel on the shared thread pool, if there is one.
+	 * @param The registry that holds the physics world in its context.
+	 * @param The rays in pixels. The hit points of the results are in pixels as well.
+	 * @param Resized to the number of rays. The result of each ray is at the same index.
+	 */
+	void RayCastBatch( Scion::Core::ECS::Registry& registry, std::span<const Scion::Physics::RayQuery> rays,
+					   std::vector<Scion::Physics::RayQueryResult>& outResults );
+
+	/*
+	 * @brief Finds the bodies overlapping every box, in parallel on the shared thread pool if there is one.
+	 * @param The boxes in pixels.
+	 * @param Resized to the number of boxes. Each result is a range in the entity buffer.
+	 * @param The entities found by all boxes, packed one box after another.
+	 */
+	void BoxQueryBatch( Scion::Core::ECS::Registry& registry, std::span<const Scion::Physics::BoxQuery> boxes,
+						std::vector<Scion::Physics::BoxQueryResult>& outResults,
+						std::vector<std::uint32_t>& outEntities );
+
+	/* @brief Sets the size of the grid cells in pixels. The grid is rebuilt with the new size. */
+	void SetCellSize( float cellSize );
+	inline float GetCellSize() const { return m_CellSize; }
+
+	static void CreateSpatialQueryLuaBind( sol::state& lua, Scion::Core::ECS::Registry& registry );
+
+  private:
+	struct SpatialEntry
+	{
+		std::uint32_t entity{ 0 };
+		std::uint32_t groupHash{ 0 };
+		glm::vec2 min{ 0.f };
+		glm::vec2 max{ 0.f };
+		glm::vec2 center{ 0.f };
+		/* Zero for box colliders. */
+		float radius{ 0.f };
+	};
+
+	struct SpatialHit
+	{
+		std::uint32_t entity{ 0 };
+		float distanceSq{ 0.f };
+	};
+
+	/* @brief Adds the entry to the cells it touches, or to the large entries if it touches too many. */
+	void InsertEntry( std::uint32_t index );
+	void RebuildCells();
+	/* @brief Converts the position to a cell, clamped so huge or invalid positions cannot overflow. */
+	glm::ivec2 ToCell( const glm::vec2& position ) const;
+	/*
+	 * @brief Gets the indices of the entries that could overlap the box. Only the cells inside the
+	 * occupied bounds of the grid are visited, and if that is still more cells than there are
+	 * entries, every entry is returned instead. Entries can be returned more than once.
+	 */
+	void GatherCandidates( const glm::vec2& min, const glm::vec2& max );
+	void GatherCircle( Scion::Core::ECS::Registry& registry, const glm::vec2& center, float radius,
+					   const std::string& sGroup );
+
+	bool Overlaps( const SpatialEntry& a, const SpatialEntry& b ) const;
+	bool OverlapsCircle( const SpatialEntry& entry, const glm::vec2& center, float radius ) const;
+	void SetupThreadPool();
+
+  private:
+	float m_CellSize;
+	std::vector<SpatialEntry> m_Entries;
+	/* The cell key and entry index of every cell an entry touches, sorted by key. */
+	std::vector<std::pair<std::uint64_t, std::uint32_t>> m_Cells;
+	/* Entries that touch too many cells to be put in the grid. Every query tests them. */
+	std::vector<std::uint32_t> m_LargeEntries;
+	/* The bounds of the cells that hold at least one entry. */
+	glm::ivec2 m_MinCell{ 0 };
+	glm::ivec2 m_MaxCell{ -1 };
+	std::vector<std::uint32_t> m_Candidates;
+	/* Reused between queries so they do not allocate once warmed up. */
+	std::vector<SpatialHit> m_Hits;
+	std::vector<Scion::Physics::RayQuery> m_Rays;
+	std::vector<Scion::Physics::BoxQuery> m_Boxes;
+	Scion::Physics::BatchQuery m_BatchQuery;
+	bool m_bThreadPoolSet{ false };
+};
+} // namespace Scion::Core::Systems
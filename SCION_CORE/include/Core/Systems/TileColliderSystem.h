@@ -0,0 +1,144 @@
+#pragma once
+#include <Physics/Box2DWrappers.h>
+#include <Physics/UserData.h>
+#include <entt/entt.hpp>
+#include <glm/glm.hpp>
+
+namespace Scion::Core::ECS
+{
+class Registry;
+}
+
+namespace Scion::Core::Systems
+{
+struct TileMergeStats
+{
+	/* The number of tiles that were merged. */
+	size_t numTiles{ 0 };
+	/* The bodies and fixtures the tiles would have had on their own. */
+	size_t bodiesBefore{ 0 };
+	size_t fixturesBefore{ 0 };
+	/* The bodies and fixtures of the merged colliders. */
+	size_t bodiesAfter{ 0 };
+	size_t fixturesAfter{ 0 };
+};
+
+/*
+ * TileColliderSystem
+ * Merges the colliders of static box tiles into a few shared bodies.
+ * Tiles are grouped by layer, tile size and physics attributes, so every fixture of a group has
+ * the same filters. Each group becomes a single static body. The outlines of its solid cells are
+ * traced into chain loops, so there are no edges between neighbouring tiles for bodies sliding
+ * along a floor or wall to catch on. Tiles that do not line up with the grid keep a box fixture
+ * of their own, and those boxes can still catch. Every tile of a group shares the merged body.
+ *
+ * Chains are only edges, so a query that lies wholly inside a solid area does not hit them.
+ * Each fixture reports a tile of its own through its fixture data. A loop reports the tile of its
+ * first edge, so contacts, ray casts and queries that need the exact tile resolve it with
+ * GetTileAt or GetTilesIn. The spatial queries already do. Tiles whose physics attributes turn
+ * off bMergeTileCollider keep a body of their own.
+ *
+ * When tiles with physics are added, removed or changed, only the groups they belong to are
+ * merged again. Changes are only seen when they are made with patch or replace.
+ */
+class TileColliderSystem
+{
+  public:
+	TileColliderSystem() = default;
+	~TileColliderSystem() = default;
+
+	/*
+	 * @brief Merges all static box tiles of the registry. Must be called before the
+	 * physics components of the tiles are initialized, merged tiles already have a body.
+	 * @param The registry with the tiles. The system must be in its context.
+	 * @param The physics world to create the bodies in.
+	 * @param The width and height of the camera, used to place the bodies like PhysicsComponent::Init.
+	 * @return Returns the body and fixture counts before and after merging.
+	 */
+	TileMergeStats MergeTileColliders( Scion::Core::ECS::Registry& registry, Scion::Physics::PhysicsWorld pPhysicsWorld,
+									   int windowWidth, int windowHeight );
+
+	/*
+	 * @brief Merges the groups of any tiles that were added or removed since the last update.
+	 */
+	void Update( Scion::Core::ECS::Registry& registry );
+
+	/* @brief Marks the tile's group to be merged again on the next update. */
+	void MarkTileDirty( entt::entity tile );
+
+	/*
+	 * @brief Gets the merged tile at the position.
+	 * @param A merged tile, such as the entity a contact or query reported.
+	 * @param The position in pixels.
+	 * @return Returns the tile of the same group at the position, or the given tile if there is none.
+	 */
+	entt::entity GetTileAt( entt::entity tile, const glm::vec2& position ) const;
+
+	/*
+	 * @brief Adds the tiles of the tile's group that overlap the box, in pixels.
+	 * Adds the tile itself if it is not merged.
+	 */
+	void GetTilesIn( entt::entity tile, const glm::vec2& min, const glm::vec2& max,
+					 std::vector<std::uint32_t>& outTiles ) const;
+
+	/*
+	 * @brief Checks if the position, in pixels, is inside of a solid tile collider. Looks at the
+	 * cells of the merged groups, then at the boxes of the tiles that are not merged, such as
+	 * when merging is turned off. Sensors are not solid.
+	 * @param The registry with the tiles and the physics world.
+	 */
+	bool IsSolidAt( Scion::Core::ECS::Registry& registry, const glm::vec2& position ) const;
+
+	inline const TileMergeStats& GetStats() const { return m_Stats; }
+
+  private:
+	struct MergeKey
+	{
+		int layer{ 0 };
+		float tileWidth{ 0.f };
+		float tileHeight{ 0.f };
+		float density{ 0.f };
+		float friction{ 0.f };
+		float restitution{ 0.f };
+		float restitutionThreshold{ 0.f };
+		std::uint32_t tagID{ 0 };
+		std::uint32_t groupMask{ 0 };
+		std::uint8_t flags{ 0 };
+		bool bUseFilters{ false };
+		std::uint16_t filterCategory{ 0 };
+		std::uint16_t filterMask{ 0 };
+		std::int16_t groupIndex{ 0 };
+
+		auto operator<=>( const MergeKey& ) const = default;
+	};
+
+	struct MergeGroup
+	{
+		std::vector<entt::entity> tiles{};
+		/* The tiles that line up with the grid, by cell. */
+		std::unordered_map<std::uint64_t, entt::entity> cellTiles{};
+		/* The tiles that do not line up with the grid and have a box of their own. */
+		std::unordered_set<entt::entity> looseTiles{};
+		std::shared_ptr<b2Body> pBody{ nullptr };
+		size_t numFixtures{ 0 };
+	};
+
+	/* @brief Gets the merge key of the tile, or an empty optional if the tile cannot be merged. */
+	std::optional<MergeKey> GetMergeKey( entt::registry& registry, entt::entity tile ) const;
+
+	void AddTile( entt::registry& registry, entt::entity tile );
+	void RebuildGroup( entt::registry& registry, const MergeKey& key, MergeGroup& group );
+	void UpdateStats();
+
+  private:
+	Scion::Physics::PhysicsWorld m_pPhysicsWorld{ nullptr };
+	int m_WindowWidth{ 0 };
+	int m_WindowHeight{ 0 };
+
+	std::map<MergeKey, MergeGroup> m_Groups;
+	std::unordered_map<entt::entity, MergeKey> m_TileKeys;
+	std::vector<entt::entity> m_DirtyTiles;
+	std::set<MergeKey> m_DirtyGroups;
+	TileMergeStats m_Stats{};
+};
+} // namespace Scion::Core::Systems
@@ -0,0 +1,146 @@
+#pragma once
+#include <ScionUtilities/Tween.h>
+#include <sol/sol.hpp>
+#include <entt/entt.hpp>
+
+namespace Scion::Core::ECS
+{
+class Registry;
+}
+
+namespace Scion::Core::Systems
+{
+enum class ETweenProperty : std::uint8_t
+{
+	PositionX,
+	PositionY,
+	ScaleX,
+	ScaleY,
+	Rotation,
+	SpriteRed,
+	SpriteGreen,
+	SpriteBlue,
+	SpriteAlpha,
+	SpriteU,
+	SpriteV,
+	TextRed,
+	TextGreen,
+	TextBlue,
+	TextAlpha,
+	CameraX,
+	CameraY,
+	CameraScale
+};
+
+struct TweenParams
+{
+	ETweenProperty eProperty{ ETweenProperty::PositionX };
+	float to{ 0.f };
+	/* The start value. If not set, the value the property has when the tween starts is used. */
+	std::optional<float> from{ std::nullopt };
+	/* The length of one play in seconds. */
+	float duration{ 1.f };
+	/* The seconds to wait before starting. */
+	float delay{ 0.f };
+	Scion::Utilities::EEasingFunc eEasing{ Scion::Utilities::EEasingFunc::LINEAR };
+	/* How many times the tween plays again after the first play. -1 repeats forever. */
+	int repeats{ 0 };
+	/* Plays every other repeat backwards. */
+	bool bYoyo{ false };
+};
+
+/*
+ * TweenSystem
+ * Animates properties of transforms, sprites, texts and the camera without calling into lua.
+ * The running tweens are kept packed together. Each update first advances and eases all of them,
+ * then writes the values to the components, so scripts only start and stop tweens.
+ * The entities being animated get a TweenComponent that can pause them or scale their time.
+ *
+ * The system lives in the context of the registry it animates.
+ */
+class TweenSystem
+{
+  public:
+	TweenSystem() = default;
+	~TweenSystem() = default;
+
+	/*
+	 * @brief Starts a tween on the entity. Camera properties do not need an entity.
+	 * @return Returns the id of the tween, or 0 if the entity cannot be animated.
+	 */
+	std::uint32_t Start( Scion::Core::ECS::Registry& registry, entt::entity entity, const TweenParams& params );
+
+	/*
+	 * @brief Starts tweens that play one after the other. A step that has no start value starts
+	 * from where the step before it ended.
+	 * @return Returns the id of the sequence, which is also the id of its first tween.
+	 */
+	std::uint32_t StartSequence( Scion::Core::ECS::Registry& registry, entt::entity entity,
+								 const std::vector<TweenParams>& steps );
+
+	/*
+	 * @brief Stops a tween or a sequence. Stopping a tween of a sequence stops the sequence.
+	 * @param The registry the tweens animate.
+	 * @param The id of a tween or sequence.
+	 * @param If true, the running tween is set to its end value.
+	 */
+	void Stop( Scion::Core::ECS::Registry& registry, std::uint32_t tweenID, bool bComplete = false );
+	void StopAll( Scion::Core::ECS::Registry& registry, entt::entity entity );
+
+	bool IsPlaying( std::uint32_t tweenID ) const;
+	size_t NumTweens() const;
+
+	/*
+	 * @brief Advances every running tween and writes the values to the components.
+	 * Finished tweens emit a TweenEvent on the event dispatcher in the registry's context.
+	 * @param The delta time in seconds.
+	 */
+	void Update( Scion::Core::ECS::Registry& registry, double deltaTime );
+
+	static void CreateTweenLuaBind( sol::state& lua, Scion::Core::ECS::Registry& registry );
+
+  private:
+	struct TweenTrack
+	{
+		std::uint32_t id{ 0 };
+		std::uint32_t sequenceID{ 0 };
+		entt::entity entity{ entt::null };
+		ETweenProperty eProperty{ ETweenProperty::PositionX };
+		Scion::Utilities::EEasingFunc eEasing{ Scion::Utilities::EEasingFunc::LINEAR };
+		float from{ 0.f };
+		float to{ 0.f };
+		float duration{ 1.f };
+		float elapsed{ 0.f };
+		float delay{ 0.f };
+		int repeats{ 0 };
+		bool bYoyo{ false };
+		bool bReversed{ false };
+		bool bFromCurrent{ true };
+		bool bStarted{ false };
+		/* Set when the entity or its component is gone. The tween is removed without an event. */
+		bool bRemoved{ false };
+	};
+
+	TweenTrack CreateTrack( entt::entity entity, const TweenParams& params, std::uint32_t sequenceID );
+	bool CanAnimate( Scion::Core::ECS::Registry& registry, entt::entity entity, ETweenProperty eProperty ) const;
+	void ChangeTweenCount( Scion::Core::ECS::Registry& registry, entt::entity entity, int amount );
+
+	/* @brief Removes the waiting steps of the sequence. */
+	void ClearSequence( Scion::Core::ECS::Registry& registry, std::uint32_t sequenceID );
+	void RemoveTrack( Scion::Core::ECS::Registry& registry, size_t index );
+
+	static float ReadProperty( Scion::Core::ECS::Registry& registry, entt::entity entity, ETweenProperty eProperty );
+	static void WriteProperty( Scion::Core::ECS::Registry& registry, entt::entity entity, ETweenProperty eProperty,
+							   float value );
+
+  private:
+	/* The running tweens, including tweens waiting for their delay. */
+	std::vector<TweenTrack> m_Tracks;
+	/* The value of each running tween this update. */
+	std::vector<float> m_Values;
+	/* The steps of each sequence that have not started, the next step last. */
+	std::unordered_map<std::uint32_t, std::vector<TweenTrack>> m_Sequences;
+	std::vector<size_t> m_Finished;
+	std::uint32_t m_NextTweenID{ 1 };
+};
+} // namespace Scion::Core::Systems
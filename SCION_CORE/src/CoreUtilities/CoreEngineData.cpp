@@ -47,6 +47,7 @@ CoreEngineData::CoreEngineData()
 	, m_PositionIterations{ 8 }
 	, m_bPhysicsEnabled{ true }
 	, m_bPhysicsPaused{ false }
+	, m_bMergeTileColliders{ true }
 	, m_bRenderColliders{ false }
 	, m_bRenderAnimations{ false }
 {
@@ -140,6 +141,8 @@ void CoreEngineData::RegisterMetaFunctions()
 	Entity::RegisterMetaComponent<TileComponent>();
 	Entity::RegisterMetaComponent<Relationship>();
 	Entity::RegisterMetaComponent<UIComponent>();
+	Entity::RegisterMetaComponent<TweenComponent>();
+	Entity::RegisterMetaComponent<ParticleEmitterComponent>();
 
 	Registry::RegisterMetaComponent<Identification>();
 	Registry::RegisterMetaComponent<TransformComponent>();
@@ -153,6 +156,8 @@ void CoreEngineData::RegisterMetaFunctions()
 	Registry::RegisterMetaComponent<TileComponent>();
 	Registry::RegisterMetaComponent<Relationship>();
 	Registry::RegisterMetaComponent<UIComponent>();
+	Registry::RegisterMetaComponent<TweenComponent>();
+	Registry::RegisterMetaComponent<ParticleEmitterComponent>();
 
 	// Register User Data Types
 	Scion::Core::Scripting::UserDataBinder::register_meta_user_data<ObjectData>();
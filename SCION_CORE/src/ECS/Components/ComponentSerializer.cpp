@@ -146,6 +146,7 @@ void ComponentSerializer::SerializeComponent( Scion::Filesystem::JSONSerializer&
 		.AddKeyValuePair( "bBoxShape", attributes.bBoxShape )
 		.AddKeyValuePair( "bFixedRotation", attributes.bFixedRotation )
 		.AddKeyValuePair( "bIsSensor", attributes.bIsSensor )
+		.AddKeyValuePair( "bMergeTileCollider", attributes.bMergeTileCollider )
 		.AddKeyValuePair( "filterCategory", static_cast<unsigned>( attributes.filterCategory ) )
 		.AddKeyValuePair( "filterMask", static_cast<unsigned>( attributes.filterMask ) )
 		.AddKeyValuePair( "groupIndex", static_cast<int>( attributes.groupIndex ) )
@@ -305,6 +306,7 @@ void ComponentSerializer::DeserializeComponent( const rapidjson::Value& jsonValu
 			.bBoxShape = attr[ "bBoxShape" ].GetBool(),
 			.bFixedRotation = attr[ "bFixedRotation" ].GetBool(),
 			.bIsSensor = attr[ "bIsSensor" ].GetBool(),
+			.bMergeTileCollider = attr.HasMember( "bMergeTileCollider" ) ? attr[ "bMergeTileCollider" ].GetBool() : true,
 			.filterCategory = static_cast<uint16_t>( attr[ "filterCategory" ].GetUint() ),
 			.filterMask = static_cast<uint16_t>( attr[ "filterMask" ].GetUint() ),
 			.groupIndex = static_cast<int16_t>( attr[ "groupIndex" ].GetInt() ),
@@ -476,6 +478,7 @@ void ComponentSerializer::SerializeComponent( Scion::Filesystem::LuaSerializer&
 		.AddKeyValuePair( "bBoxShape", attributes.bBoxShape, false )
 		.AddKeyValuePair( "bFixedRotation", attributes.bFixedRotation, false )
 		.AddKeyValuePair( "bIsSensor", attributes.bIsSensor, false )
+		.AddKeyValuePair( "bMergeTileCollider", attributes.bMergeTileCollider, false )
 		.AddKeyValuePair( "filterCategory", static_cast<unsigned>( attributes.filterCategory, false ) )
 		.AddKeyValuePair( "filterMask", static_cast<unsigned>( attributes.filterMask, false ) )
 		.AddKeyValuePair( "groupIndex", static_cast<int>( attributes.groupIndex, false ) )
@@ -616,6 +619,7 @@ void ComponentSerializer::DeserializeComponent( const sol::table& table, Physics
 			.bBoxShape = attr[ "bBoxShape" ].get_or( false ),
 			.bFixedRotation = attr[ "bFixedRotation" ].get_or( false ),
 			.bIsSensor = attr[ "bIsSensor" ].get_or( false ),
+			.bMergeTileCollider = attr[ "bMergeTileCollider" ].get_or( true ),
 			.filterCategory = static_cast<uint16_t>( attr[ "filterCategory" ].get_or( 0U ) ),
 			.filterMask = static_cast<uint16_t>( attr[ "filterMask" ].get_or( 0U ) ),
 			.groupIndex = static_cast<int16_t>( attr[ "groupIndex" ].get_or( 0U ) ),
@@ -0,0 +1,71 @@
+#include "Core/ECS/Components/ParticleEmitterComponent.h"
+#include <entt/entt.hpp>
+
+namespace Scion::Core::ECS
+{
+void ParticleEmitterComponent::CreateLuaParticleEmitterBind( sol::state& lua )
+{
+	lua.new_usertype<ParticleEmitterComponent>(
+		"ParticleEmitter",
+		"type_id",
+		entt::type_hash<ParticleEmitterComponent>::value,
+		sol::call_constructor,
+		sol::factories( [] { return ParticleEmitterComponent{}; },
+						[]( const std::string& sTextureName, float width, float height ) {
+							return ParticleEmitterComponent{
+								.sTextureName = sTextureName, .width = width, .height = height };
+						} ),
+		"textureName",
+		&ParticleEmitterComponent::sTextureName,
+		"width",
+		&ParticleEmitterComponent::width,
+		"height",
+		&ParticleEmitterComponent::height,
+		"uvs",
+		&ParticleEmitterComponent::uvs,
+		"offset",
+		&ParticleEmitterComponent::offset,
+		"spawnArea",
+		&ParticleEmitterComponent::spawnArea,
+		"emissionRate",
+		&ParticleEmitterComponent::emissionRate,
+		"maxParticles",
+		&ParticleEmitterComponent::maxParticles,
+		"minLifetime",
+		&ParticleEmitterComponent::minLifetime,
+		"maxLifetime",
+		&ParticleEmitterComponent::maxLifetime,
+		"minSpeed",
+		&ParticleEmitterComponent::minSpeed,
+		"maxSpeed",
+		&ParticleEmitterComponent::maxSpeed,
+		"direction",
+		&ParticleEmitterComponent::direction,
+		"spread",
+		&ParticleEmitterComponent::spread,
+		"gravity",
+		&ParticleEmitterComponent::gravity,
+		"startColor",
+		&ParticleEmitterComponent::startColor,
+		"endColor",
+		&ParticleEmitterComponent::endColor,
+		"startScale",
+		&ParticleEmitterComponent::startScale,
+		"endScale",
+		&ParticleEmitterComponent::endScale,
+		"easing",
+		&ParticleEmitterComponent::eLifeEasing,
+		"bAlignToVelocity",
+		&ParticleEmitterComponent::bAlignToVelocity,
+		"bCollideWithTiles",
+		&ParticleEmitterComponent::bCollideWithTiles,
+		"bounce",
+		&ParticleEmitterComponent::bounce,
+		"bEmitting",
+		&ParticleEmitterComponent::bEmitting,
+		"numParticles",
+		sol::readonly( &ParticleEmitterComponent::numParticles ),
+		"burst",
+		[]( ParticleEmitterComponent& emitter, int count ) { emitter.burstCount += count; } );
+}
+} // namespace Scion::Core::ECS
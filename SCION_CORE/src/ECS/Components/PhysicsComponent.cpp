@@ -8,6 +8,22 @@
 
 using namespace Scion::Physics;
 
+namespace
+{
+/*
+ * Physics components created from lua may not have set the entity id of their object data.
+ * The physics system finds the entity of a body through its user data, so fill it in here.
+ */
+void SetPhysicsEntityID( entt::registry& registry, entt::entity entity )
+{
+	auto* pUserData = registry.get<Scion::Core::ECS::PhysicsComponent>( entity ).GetUserData();
+	if ( pUserData && pUserData->entityID == entt::null )
+	{
+		pUserData->entityID = static_cast<std::uint32_t>( entity );
+	}
+}
+} // namespace
+
 namespace Scion::Core::ECS
 {
 
@@ -45,15 +61,31 @@ void PhysicsComponent::Init( Scion::Physics::PhysicsWorld pPhysicsWorld, int win
 	bodyDef.gravityScale = m_InitialAttribs.gravityScale;
 	bodyDef.fixedRotation = m_InitialAttribs.bFixedRotation;
 
+	// Create the user data. Bodies in a group that could not be added are not created.
+	auto optUserData = m_InitialAttribs.objectData.ToUserData();
+	if ( !optUserData )
+	{
+		SCION_ERROR( "Failed to create the rigid body - Group [{}] could not be added.",
+					 m_InitialAttribs.objectData.group );
+		return;
+	}
+
+	auto* pUserData = UserDataPool::Acquire( *optUserData );
+	bodyDef.userData.pointer = reinterpret_cast<uintptr_t>( pUserData );
+
 	// Create the Rigid Body
-	m_pRigidBody = Scion::Physics::MakeSharedBody( pPhysicsWorld->CreateBody( &bodyDef ) );
+	auto* pBody = pPhysicsWorld->CreateBody( &bodyDef );
 
-	if ( !m_pRigidBody )
+	if ( !pBody )
 	{
 		SCION_ERROR( "Failed to create the rigid body" );
+		UserDataPool::Release( pUserData );
 		return;
 	}
 
+	m_pRigidBody = Scion::Physics::MakeSharedBody( pBody );
+	m_pUserData = pUserData;
+
 	// Create the shape
 	b2PolygonShape polyShape;
 	b2CircleShape circleShape;
@@ -85,11 +117,6 @@ void PhysicsComponent::Init( Scion::Physics::PhysicsWorld pPhysicsWorld, int win
 		polyShape.Set( vertices, 4 );
 	}
 
-	// Create the user data
-	m_pUserData = std::make_shared<UserData>();
-	m_pUserData->userData = m_InitialAttribs.objectData;
-	m_pUserData->type_id = entt::type_hash<ObjectData>::value();
-
 	// Create the fixture def
 	b2FixtureDef fixtureDef{};
 	if ( bCircle )
@@ -102,12 +129,14 @@ void PhysicsComponent::Init( Scion::Physics::PhysicsWorld pPhysicsWorld, int win
 	fixtureDef.restitution = m_InitialAttribs.restitution;
 	fixtureDef.restitutionThreshold = m_InitialAttribs.restitutionThreshold;
 	fixtureDef.isSensor = m_InitialAttribs.bIsSensor;
-	fixtureDef.userData.pointer = reinterpret_cast<uintptr_t>( m_pUserData.get() );
+	auto* pFixtureData = FixtureDataPool::Acquire( FixtureData{ .pUserData = m_pUserData, .fixtureIndex = 0 } );
+	fixtureDef.userData.pointer = reinterpret_cast<uintptr_t>( pFixtureData );
 
 	auto pFixture = m_pRigidBody->CreateFixture( &fixtureDef );
 	if ( !pFixture )
 	{
 		SCION_ERROR( "Failed to create the rigid body fixture!" );
+		FixtureDataPool::Release( pFixtureData );
 	}
 }
 
@@ -116,6 +145,12 @@ PhysicsComponent::PhysicsComponent()
 {
 }
 
+void PhysicsComponent::SetSharedBody( std::shared_ptr<b2Body> pBody, Scion::Physics::UserData* pUserData )
+{
+	m_pRigidBody = std::move( pBody );
+	m_pUserData = m_pRigidBody ? pUserData : nullptr;
+}
+
 const bool PhysicsComponent::IsSensor() const
 {
 	if ( !m_pRigidBody )
@@ -155,18 +190,12 @@ Scion::Physics::ObjectData PhysicsComponent::CastRay( const b2Vec2& point1, cons
 
 	if ( callback.IsHit() )
 	{
-		auto& userData = callback.HitFixture()->GetUserData();
-		if ( UserData* pData = reinterpret_cast<UserData*>( userData.pointer ) )
+		auto* pFixtureData = reinterpret_cast<FixtureData*>( callback.HitFixture()->GetUserData().pointer );
+		if ( pFixtureData && pFixtureData->pUserData )
 		{
-			try
-			{
-				auto objectData = std::any_cast<ObjectData>( pData->userData );
-				return objectData;
-			}
-			catch ( const std::bad_any_cast& ex )
-			{
-				SCION_ERROR( "Failed to cast to object data. Error: {}", ex.what() );
-			}
+			ObjectData objectData{ *pFixtureData->pUserData };
+			objectData.entityID = pFixtureData->GetEntity();
+			return objectData;
 		}
 	}
 
@@ -212,17 +241,9 @@ std::vector<Scion::Physics::ObjectData> PhysicsComponent::BoxTrace( const b2Vec2
 
 	for ( const auto pBody : hitBodies )
 	{
-		auto& userData = pBody->GetFixtureList()->GetUserData();
-		UserData* pData = reinterpret_cast<UserData*>( userData.pointer );
-
-		try
-		{
-			auto objectData = std::any_cast<ObjectData>( pData->userData );
-			objectDataVec.push_back( objectData );
-		}
-		catch ( const std::bad_any_cast& e )
+		if ( UserData* pData = reinterpret_cast<UserData*>( pBody->GetUserData().pointer ) )
 		{
-			SCION_ERROR( "Failed to cast to object data - " + std::string{ e.what() } );
+			objectDataVec.emplace_back( *pData );
 		}
 	}
 
@@ -238,21 +259,12 @@ Scion::Physics::ObjectData PhysicsComponent::GetCurrentObjectData()
 		return {};
 	}
 
-	auto& userData = m_pRigidBody->GetFixtureList()->GetUserData();
-
-	UserData* pData = reinterpret_cast<UserData*>( userData.pointer );
-
-	try
-	{
-		auto objectData = std::any_cast<ObjectData>( pData->userData );
-		return objectData;
-	}
-	catch ( const std::bad_any_cast& e )
+	if ( !m_pUserData )
 	{
-		SCION_ERROR( "Failed to cast to object data - {}", e.what() );
+		return {};
 	}
 
-	return {};
+	return ObjectData{ *m_pUserData, true };
 }
 
 void PhysicsComponent::SetFilterCategory( uint16_t category )
@@ -332,6 +344,8 @@ void PhysicsComponent::SetGroupIndex()
 
 void PhysicsComponent::CreatePhysicsLuaBind( sol::state& lua, entt::registry& registry )
 {
+	registry.on_construct<PhysicsComponent>().connect<&SetPhysicsEntityID>();
+
 	lua.new_usertype<ObjectData>(
 		"ObjectData",
 		"type_id",
@@ -366,9 +380,20 @@ void PhysicsComponent::CreatePhysicsLuaBind( sol::state& lua, entt::registry& re
 		&ObjectData::entityID,
 		"contactEntities", // This returns the vector directly. Use physics.contactEntites
 		sol::readonly_property( []( ObjectData& objData ) { return objData.GetContactEntities(); } ),
+		"tagID",
+		sol::readonly_property( []( const ObjectData& objData ) { return ObjectTags::GetTagID( objData.tag ); } ),
+		"groupMask",
+		sol::readonly_property( []( const ObjectData& objData ) { return ObjectTags::GetGroupMask( objData.group ); } ),
 		"to_string",
 		&ObjectData::to_string );
 
+	lua.create_named_table(
+		"PhysicsTags",
+		"getTagID",
+		[]( const std::string& sTag ) { return ObjectTags::GetTagID( sTag ); },
+		"getGroupMask",
+		[]( const std::string& sGroup ) { return ObjectTags::GetGroupMask( sGroup ); } );
+
 	lua.new_enum<RigidBodyType>( "BodyType",
 								 { { "Static", RigidBodyType::STATIC },
 								   { "Kinematic", RigidBodyType::KINEMATIC },
@@ -399,6 +424,7 @@ void PhysicsComponent::CreatePhysicsLuaBind( sol::state& lua, entt::registry& re
 								.bBoxShape = physAttr[ "bBoxShape" ].get_or( true ),
 								.bFixedRotation = physAttr[ "bFixedRotation" ].get_or( true ),
 								.bIsSensor = physAttr[ "bIsSensor" ].get_or( false ),
+								.bMergeTileCollider = physAttr[ "bMergeTileCollider" ].get_or( true ),
 								.filterCategory = physAttr[ "filterCategory" ].get_or( (uint16_t)0 ),
 								.filterMask = physAttr[ "filterMask" ].get_or( (uint16_t)0 ),
 								.objectData =
@@ -439,6 +465,8 @@ void PhysicsComponent::CreatePhysicsLuaBind( sol::state& lua, entt::registry& re
 		&PhysicsAttributes::bFixedRotation,
 		"bIsSensor",
 		&PhysicsAttributes::bIsSensor,
+		"bMergeTileCollider",
+		&PhysicsAttributes::bMergeTileCollider,
 		"objectData",
 		&PhysicsAttributes::objectData
 		// TODO: Add in filters and other properties as needed
@@ -509,6 +537,29 @@ void PhysicsComponent::CreatePhysicsLuaBind( sol::state& lua, entt::registry& re
 			const auto& linearVelocity = body->GetLinearVelocity();
 			return glm::vec2{ linearVelocity.x, linearVelocity.y };
 		},
+		"addLinearVelocity",
+		[]( PhysicsComponent& pc, float dx, float dy ) {
+			auto body = pc.GetBody();
+			if ( !body )
+			{
+				// TODO: Add Error
+				return;
+			}
+
+			body->SetLinearVelocity( body->GetLinearVelocity() + b2Vec2{ dx, dy } );
+		},
+		"getLinearVelocityXY", // Same as getLinearVelocity, without creating a vec2.
+		[]( PhysicsComponent& pc ) {
+			auto body = pc.GetBody();
+			if ( !body )
+			{
+				// TODO: Add Error
+				return std::make_tuple( 0.f, 0.f );
+			}
+
+			const auto& linearVelocity = body->GetLinearVelocity();
+			return std::make_tuple( linearVelocity.x, linearVelocity.y );
+		},
 		"setAngularVelocity",
 		[]( PhysicsComponent& pc, float angularVelocity ) {
 			auto body = pc.GetBody();
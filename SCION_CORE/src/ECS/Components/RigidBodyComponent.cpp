@@ -1,4 +1,5 @@
 #include "Core/ECS/Components/RigidBodyComponent.h"
+#include "Core/ECS/Components/TransformComponent.h"
 #include <entt/entt.hpp>
 
 std::string Scion::Core::ECS::RigidBodyComponent::to_string() const
@@ -22,6 +23,28 @@ void Scion::Core::ECS::RigidBodyComponent::CreateRigidBodyBind( sol::state& lua
 		&RigidBodyComponent::currentVelocity,
 		"maxVelocity",
 		&RigidBodyComponent::maxVelocity,
+		"addVelocity",
+		[]( RigidBodyComponent& rigidBody, float dx, float dy ) {
+			rigidBody.currentVelocity += glm::vec2{ dx, dy };
+
+			// An axis without a max velocity is not clamped.
+			const glm::vec2 maxVelocity = glm::abs( rigidBody.maxVelocity );
+			if ( maxVelocity.x > 0.f )
+				rigidBody.currentVelocity.x = std::clamp( rigidBody.currentVelocity.x, -maxVelocity.x, maxVelocity.x );
+			if ( maxVelocity.y > 0.f )
+				rigidBody.currentVelocity.y = std::clamp( rigidBody.currentVelocity.y, -maxVelocity.y, maxVelocity.y );
+		},
+		"setVelocity",
+		[]( RigidBodyComponent& rigidBody, float x, float y ) { rigidBody.currentVelocity = glm::vec2{ x, y }; },
+		"getVelocity",
+		[]( const RigidBodyComponent& rigidBody ) {
+			return std::make_tuple( rigidBody.currentVelocity.x, rigidBody.currentVelocity.y );
+		},
+		"move", // Moves the transform by the current velocity.
+		[]( const RigidBodyComponent& rigidBody, TransformComponent& transform, float dt ) {
+			transform.position += rigidBody.currentVelocity * dt;
+			transform.bDirty = true;
+		},
 		"to_string",
 		&RigidBodyComponent::to_string );
 }
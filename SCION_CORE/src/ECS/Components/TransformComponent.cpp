@@ -49,6 +49,20 @@ void Scion::Core::ECS::TransformComponent::CreateLuaTransformBind( sol::state& l
 			transform.rotation = rotation;
 			transform.bDirty = true;
 		},
+		// The position functions below take and return numbers, so they do not allocate a vec2.
+		"translate",
+		[]( TransformComponent& transform, float dx, float dy ) {
+			transform.position.x += dx;
+			transform.position.y += dy;
+			transform.bDirty = true;
+		},
+		"setPosition",
+		[]( TransformComponent& transform, float x, float y ) {
+			transform.position = glm::vec2{ x, y };
+			transform.bDirty = true;
+		},
+		"getPosition",
+		[]( const TransformComponent& transform ) { return std::make_tuple( transform.position.x, transform.position.y ); },
 		"toString",
 		&TransformComponent::to_string );
 }
@@ -0,0 +1,21 @@
+#include "Core/ECS/Components/TweenComponent.h"
+#include <entt/entt.hpp>
+
+namespace Scion::Core::ECS
+{
+void TweenComponent::CreateLuaTweenComponentBind( sol::state& lua )
+{
+	lua.new_usertype<TweenComponent>( "TweenComponent",
+									  "type_id",
+									  entt::type_hash<TweenComponent>::value,
+									  sol::call_constructor,
+									  sol::factories( [] { return TweenComponent{}; },
+													  []( float timeScale ) { return TweenComponent{ .timeScale = timeScale }; } ),
+									  "timeScale",
+									  &TweenComponent::timeScale,
+									  "bPaused",
+									  &TweenComponent::bPaused,
+									  "numTweens",
+									  sol::readonly( &TweenComponent::numTweens ) );
+}
+} // namespace Scion::Core::ECS
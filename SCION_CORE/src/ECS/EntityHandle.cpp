@@ -0,0 +1,59 @@
+#include "Core/ECS/EntityHandle.h"
+#include "Core/ECS/Entity.h"
+#include "Core/ECS/MetaUtilities.h"
+
+using namespace Scion::Core::Utils;
+
+namespace Scion::Core::ECS
+{
+
+EntityHandle::EntityHandle( Registry* registry, entt::entity entity )
+	: m_pRegistry{ registry }
+	, m_Entity{ entity }
+{
+}
+
+Entity EntityHandle::ToEntity() const
+{
+	return Entity{ m_pRegistry, m_Entity };
+}
+
+void EntityHandle::CreateLuaEntityHandleBind( sol::state& lua )
+{
+	using namespace entt::literals;
+	lua.new_usertype<EntityHandle>(
+		"EntityHandle",
+		sol::no_constructor,
+		"id",
+		[]( const EntityHandle& handle ) { return static_cast<std::uint32_t>( handle.GetEntity() ); },
+		"valid",
+		&EntityHandle::IsValid,
+		"entity",
+		[]( const EntityHandle& handle, sol::this_state s ) {
+			return handle.IsValid() ? sol::make_object( s, handle.ToEntity() ) : sol::lua_nil_t{};
+		},
+		"copy",
+		[]( const EntityHandle& handle ) { return EntityHandle{ handle }; },
+		"hasComponent",
+		[]( const EntityHandle& handle, const sol::table& comp ) {
+			if ( !handle.IsValid() )
+				return false;
+
+			const auto has_comp = InvokeMetaFunction(
+				GetIdType( comp ), "has_entity_component"_hs, handle.GetRegistry(), handle.GetEntity() );
+
+			return has_comp ? has_comp.cast<bool>() : false;
+		},
+		"getComponent",
+		[]( const EntityHandle& handle, const sol::table& comp, sol::this_state s ) -> sol::object {
+			if ( !handle.IsValid() )
+				return sol::lua_nil_t{};
+
+			const auto component = InvokeMetaFunction(
+				GetIdType( comp ), "get_entity_component"_hs, handle.GetRegistry(), handle.GetEntity(), s );
+
+			return component ? component.cast<sol::reference>() : sol::lua_nil_t{};
+		} );
+}
+
+} // namespace Scion::Core::ECS
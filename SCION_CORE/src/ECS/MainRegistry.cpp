@@ -7,6 +7,8 @@
 #include <Core/Systems/RenderShapeSystem.h>
 #include <Core/Systems/AnimationSystem.h>
 #include <Core/Systems/PhysicsSystem.h>
+#include <Core/Systems/SpatialQuerySystem.h>
+#include <Core/Systems/ParticleSystem.h>
 #include <Core/Events/EventDispatcher.h>
 #include <Rendering/Core/Renderer.h>
 #include <ScionUtilities/HelperUtilities.h>
@@ -112,9 +114,15 @@ bool MainRegistry::RegisterMainSystems()
 	AddToContext<std::shared_ptr<Scion::Core::Systems::PhysicsSystem>>(
 		std::make_shared<Scion::Core::Systems::PhysicsSystem>() );
 
+	AddToContext<std::shared_ptr<Scion::Core::Systems::SpatialQuerySystem>>(
+		std::make_shared<Scion::Core::Systems::SpatialQuerySystem>() );
+
 	AddToContext<std::shared_ptr<Scion::Core::Systems::AnimationSystem>>(
 		std::make_shared<Scion::Core::Systems::AnimationSystem>() );
 
+	AddToContext<std::shared_ptr<Scion::Core::Systems::ParticleSystem>>(
+		std::make_shared<Scion::Core::Systems::ParticleSystem>() );
+
 	AddToContext<std::shared_ptr<Scion::Core::Events::EventDispatcher>>(
 		std::make_shared<Scion::Core::Events::EventDispatcher>() );
 
@@ -181,6 +189,18 @@ Scion::Core::Systems::PhysicsSystem& MainRegistry::GetPhysicsSystem()
 	return *m_pMainRegistry->GetContext<std::shared_ptr<Scion::Core::Systems::PhysicsSystem>>();
 }
 
+Scion::Core::Systems::SpatialQuerySystem& MainRegistry::GetSpatialQuerySystem()
+{
+	SCION_ASSERT( m_bInitialized && "Main Registry must be initialized before use." );
+	return *m_pMainRegistry->GetContext<std::shared_ptr<Scion::Core::Systems::SpatialQuerySystem>>();
+}
+
+Scion::Core::Systems::ParticleSystem& MainRegistry::GetParticleSystem()
+{
+	SCION_ASSERT( m_bInitialized && "Main Registry must be initialized before use." );
+	return *m_pMainRegistry->GetContext<std::shared_ptr<Scion::Core::Systems::ParticleSystem>>();
+}
+
 Registry* MainRegistry::GetRegistry()
 {
 	if ( !m_pMainRegistry )
@@ -1,5 +1,41 @@
 #include "Core/ECS/MetaUtilities.h"
 
+namespace
+{
+/* The address is the key of the type id cache in the lua registry. */
+const char s_TypeIdCacheKey{ 0 };
+
+/* Bumped whenever meta functions are registered. Each thread clears its cache when it changes. */
+std::atomic<std::uint32_t> s_MetaCacheGeneration{ 0 };
+
+struct MetaFunctionCache
+{
+	std::uint32_t generation{ 0 };
+	std::unordered_map<std::uint64_t, entt::meta_func> functions;
+};
+
+thread_local MetaFunctionCache t_MetaFunctionCache;
+
+/* Pushes the type id cache of the lua state, creating it the first time. */
+void PushTypeIdCache( lua_State* L )
+{
+	if ( lua_rawgetp( L, LUA_REGISTRYINDEX, &s_TypeIdCacheKey ) == LUA_TTABLE )
+		return;
+
+	lua_pop( L, 1 );
+
+	// Weak keys, so type tables that are no longer used can still be collected.
+	lua_newtable( L );
+	lua_newtable( L );
+	lua_pushliteral( L, "k" );
+	lua_setfield( L, -2, "__mode" );
+	lua_setmetatable( L, -2 );
+
+	lua_pushvalue( L, -1 );
+	lua_rawsetp( L, LUA_REGISTRYINDEX, &s_TypeIdCacheKey );
+}
+} // namespace
+
 entt::id_type Scion::Core::Utils::GetIdType( const sol::table& comp )
 {
 	if ( !comp.valid() )
@@ -9,10 +45,67 @@ entt::id_type Scion::Core::Utils::GetIdType( const sol::table& comp )
 		return -1;
 	}
 
+	lua_State* L = comp.lua_state();
+	PushTypeIdCache( L );
+
+	comp.push( L );
+	if ( lua_rawget( L, -2 ) == LUA_TNUMBER )
+	{
+		const auto id = static_cast<entt::id_type>( lua_tointeger( L, -1 ) );
+		lua_pop( L, 2 );
+		return id;
+	}
+
+	lua_pop( L, 1 );
+
 	const auto func = comp[ "type_id" ].get<sol::function>();
 	assert( func.valid() && "[type_id()] - function has not been exposed to lua!"
 							"\nPlease ensure all components and types have a type_id function"
 							"\nwhen creating the new usertype" );
 
-	return func.valid() ? func().get<entt::id_type>() : -1;
+	if ( !func.valid() )
+	{
+		lua_pop( L, 1 );
+		return -1;
+	}
+
+	const auto id = func().get<entt::id_type>();
+
+	comp.push( L );
+	lua_pushinteger( L, static_cast<lua_Integer>( id ) );
+	lua_rawset( L, -3 );
+	lua_pop( L, 1 );
+
+	return id;
+}
+
+entt::meta_func Scion::Core::Utils::GetMetaFunction( entt::id_type id, entt::id_type func_id )
+{
+	auto& cache = t_MetaFunctionCache;
+
+	const auto generation = s_MetaCacheGeneration.load( std::memory_order_acquire );
+	if ( cache.generation != generation )
+	{
+		cache.functions.clear();
+		cache.generation = generation;
+	}
+
+	const std::uint64_t key = ( static_cast<std::uint64_t>( id ) << 32 ) | func_id;
+	if ( auto itr = cache.functions.find( key ); itr != cache.functions.end() )
+		return itr->second;
+
+	auto meta = entt::resolve( id );
+	if ( !meta )
+		return entt::meta_func{};
+
+	auto meta_function = meta.func( func_id );
+	if ( meta_function )
+		cache.functions.emplace( key, meta_function );
+
+	return meta_function;
+}
+
+void Scion::Core::Utils::InvalidateMetaFunctionCache()
+{
+	s_MetaCacheGeneration.fetch_add( 1, std::memory_order_release );
 }
@@ -1,11 +1,139 @@
 #include "Core/ECS/Registry.h"
 #include "Core/ECS/Entity.h"
+#include "Core/ECS/EntityHandle.h"
 #include "Core/ECS/MetaUtilities.h"
 #include "Core/ECS/ECSUtils.h"
 #include "Core/ECS/Components/PersistentComponent.h"
+#include "Core/ECS/Components/TransformComponent.h"
 
 using namespace Scion::Core::Utils;
 
+namespace
+{
+/*
+ * @brief Calls the callback with one handle for every entity of the view. The handle is
+ * pointed at the next entity before each call, so iterating does not make any garbage.
+ */
+void ForEachHandle( const entt::runtime_view& view,
+					Scion::Core::ECS::Registry& registry,
+					const sol::function& callback,
+					sol::this_state s )
+{
+	if ( !callback.valid() )
+		return;
+
+	auto handleObject = sol::make_object( s, Scion::Core::ECS::EntityHandle{ &registry, entt::null } );
+	auto& handle = handleObject.as<Scion::Core::ECS::EntityHandle&>();
+
+	for ( auto entity : view )
+	{
+		handle.Reset( entity );
+		callback( handleObject );
+	}
+}
+
+/*
+ * @brief Sets n of a reused table to count, like table.pack, and clears every value the last
+ * call left after it. Values can be nil in the middle, so the old n is used to know how far to clear.
+ */
+void TerminateTable( sol::table& table, int count )
+{
+	const int previousCount = table.raw_get_or( "n", 0 );
+	for ( int i = count + 1; i <= previousCount || table.raw_get<sol::object>( i ).valid(); ++i )
+	{
+		table.raw_set( i, sol::lua_nil );
+	}
+
+	table.raw_set( "n", count );
+}
+
+/*
+ * @brief Reads a field of the transforms of a batch into a packed table of numbers, Stride
+ * numbers per entity. Entities without a transform get zeros. Nothing is allocated once the
+ * reused table has grown to the size of the batch.
+ */
+template <size_t Stride, typename TGetField>
+sol::table GetTransformField( Scion::Core::ECS::Registry& reg, const sol::table& ids, int count,
+							  sol::optional<sol::table> outTable, sol::this_state s, TGetField&& getField )
+{
+	sol::state_view lua{ s };
+	auto values = outTable ? *outTable : lua.create_table( count * static_cast<int>( Stride ), 0 );
+	auto& transforms = reg.GetRegistry().storage<Scion::Core::ECS::TransformComponent>();
+
+	for ( int i = 0; i < count; ++i )
+	{
+		const auto entity = static_cast<entt::entity>( ids.raw_get<std::uint32_t>( i + 1 ) );
+		const std::array<float, Stride> field =
+			transforms.contains( entity ) ? getField( transforms.get( entity ) ) : std::array<float, Stride>{};
+
+		for ( size_t j = 0; j < Stride; ++j )
+		{
+			values.raw_set( i * static_cast<int>( Stride ) + static_cast<int>( j ) + 1, field[ j ] );
+		}
+	}
+
+	TerminateTable( values, count * static_cast<int>( Stride ) );
+	return values;
+}
+
+/*
+ * @brief Writes a packed table of numbers back into a field of the transforms of a batch.
+ * Missing numbers keep the current value of the field.
+ */
+template <size_t Stride, typename TGetField, typename TSetField>
+void SetTransformField( Scion::Core::ECS::Registry& reg, const sol::table& ids, int count, const sol::table& values,
+						TGetField&& getField, TSetField&& setField )
+{
+	auto& transforms = reg.GetRegistry().storage<Scion::Core::ECS::TransformComponent>();
+	for ( int i = 0; i < count; ++i )
+	{
+		const auto entity = static_cast<entt::entity>( ids.raw_get<std::uint32_t>( i + 1 ) );
+		if ( !transforms.contains( entity ) )
+			continue;
+
+		auto& transform = transforms.get( entity );
+		std::array<float, Stride> field = getField( transform );
+		for ( size_t j = 0; j < Stride; ++j )
+		{
+			field[ j ] = values.raw_get_or<float>( i * static_cast<int>( Stride ) + static_cast<int>( j ) + 1, field[ j ] );
+		}
+
+		setField( transform, field );
+		transform.bDirty = true;
+	}
+}
+
+std::array<float, 2> GetPosition( const Scion::Core::ECS::TransformComponent& transform )
+{
+	return { transform.position.x, transform.position.y };
+}
+
+void SetPosition( Scion::Core::ECS::TransformComponent& transform, const std::array<float, 2>& field )
+{
+	transform.position = glm::vec2{ field[ 0 ], field[ 1 ] };
+}
+
+std::array<float, 2> GetScale( const Scion::Core::ECS::TransformComponent& transform )
+{
+	return { transform.scale.x, transform.scale.y };
+}
+
+void SetScale( Scion::Core::ECS::TransformComponent& transform, const std::array<float, 2>& field )
+{
+	transform.scale = glm::vec2{ field[ 0 ], field[ 1 ] };
+}
+
+std::array<float, 1> GetRotation( const Scion::Core::ECS::TransformComponent& transform )
+{
+	return { transform.rotation };
+}
+
+void SetRotation( Scion::Core::ECS::TransformComponent& transform, const std::array<float, 1>& field )
+{
+	transform.rotation = field[ 0 ];
+}
+} // namespace
+
 namespace Scion::Core::ECS
 {
 
@@ -76,6 +204,37 @@ void Registry::CreateLuaRegistryBind( sol::state& lua, Registry& registry )
 					callback( ent );
 				}
 			} ),
+		"for_each_handle",
+		sol::overload(
+			[ & ]( const entt::runtime_view& view, const sol::function& callback, sol::this_state s ) {
+				ForEachHandle( view, registry, callback, s );
+			},
+			[]( const entt::runtime_view& view, Registry& reg, const sol::function& callback, sol::this_state s ) {
+				ForEachHandle( view, reg, callback, s );
+			} ),
+		"for_each_batch",
+		[]( const entt::runtime_view& view, int batchSize, const sol::function& callback, sol::this_state s ) {
+			if ( !callback.valid() || batchSize <= 0 )
+				return;
+
+			// The same table is filled for every batch, only the first count ids are from the batch.
+			sol::state_view lua{ s };
+			auto ids = lua.create_table( batchSize, 0 );
+			int count{ 0 };
+
+			for ( auto entity : view )
+			{
+				ids.raw_set( ++count, static_cast<std::uint32_t>( entity ) );
+				if ( count == batchSize )
+				{
+					callback( ids, count );
+					count = 0;
+				}
+			}
+
+			if ( count > 0 )
+				callback( ids, count );
+		},
 		"exclude",
 		[ &registry ]( entt::runtime_view& view, const sol::variadic_args& va ) {
 			Registry* pRegistry = &registry;
@@ -138,6 +297,57 @@ void Registry::CreateLuaRegistryBind( sol::state& lua, Registry& registry )
 					   []( Registry& reg, const std::string& sName, const std::string sGroup ) {
 						   return Entity{ &reg, sName, sGroup };
 					   } ),
+		// Makes one userdata per component, every call. Use the field functions below in hot loops.
+		"getComponents",
+		[]( Registry& reg,
+			const sol::table& comp,
+			const sol::table& ids,
+			int count,
+			sol::optional<sol::table> outTable,
+			sol::this_state s ) {
+			sol::state_view lua{ s };
+			auto components = outTable ? *outTable : lua.create_table( count, 0 );
+
+			const auto result =
+				InvokeMetaFunction( GetIdType( comp ), "get_component_batch"_hs, &reg, ids, count, components );
+
+			// Components that are not registered with the registry have no batch getter, nothing was written.
+			if ( !result )
+			{
+				SCION_ERROR( "Failed to get components - Component type has not been registered." );
+				TerminateTable( components, 0 );
+				return components;
+			}
+
+			TerminateTable( components, count );
+			return components;
+		},
+		// The field functions read and write packed numbers, so they do not make garbage once the
+		// reused table has grown. Packed as x1, y1, x2, y2, ... or one number per entity for rotations.
+		"getPositions",
+		[]( Registry& reg, const sol::table& ids, int count, sol::optional<sol::table> outTable, sol::this_state s ) {
+			return GetTransformField<2>( reg, ids, count, outTable, s, &GetPosition );
+		},
+		"setPositions",
+		[]( Registry& reg, const sol::table& ids, int count, const sol::table& positions ) {
+			SetTransformField<2>( reg, ids, count, positions, &GetPosition, &SetPosition );
+		},
+		"getScales",
+		[]( Registry& reg, const sol::table& ids, int count, sol::optional<sol::table> outTable, sol::this_state s ) {
+			return GetTransformField<2>( reg, ids, count, outTable, s, &GetScale );
+		},
+		"setScales",
+		[]( Registry& reg, const sol::table& ids, int count, const sol::table& scales ) {
+			SetTransformField<2>( reg, ids, count, scales, &GetScale, &SetScale );
+		},
+		"getRotations",
+		[]( Registry& reg, const sol::table& ids, int count, sol::optional<sol::table> outTable, sol::this_state s ) {
+			return GetTransformField<1>( reg, ids, count, outTable, s, &GetRotation );
+		},
+		"setRotations",
+		[]( Registry& reg, const sol::table& ids, int count, const sol::table& rotations ) {
+			SetTransformField<1>( reg, ids, count, rotations, &GetRotation, &SetRotation );
+		},
 		"clear",
 		[ & ]( Registry& reg ) { reg.GetRegistry().clear(); } );
 }
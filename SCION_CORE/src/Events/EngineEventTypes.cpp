@@ -54,6 +54,20 @@ void LuaEventBinder::CreateLuaEventBindings( sol::state& lua )
 										   "type",
 										   &GamepadConnectEvent::eConnectType );
 
+	lua.new_usertype<TweenEvent>( "TweenEvent",
+								  "type_id",
+								  &entt::type_hash<TweenEvent>::value,
+								  sol::call_constructor,
+								  sol::factories( [] { return TweenEvent{}; } ),
+								  "entity",
+								  &TweenEvent::entity,
+								  "tweenID",
+								  &TweenEvent::tweenID,
+								  "sequenceID",
+								  &TweenEvent::sequenceID,
+								  "bSequenceFinished",
+								  &TweenEvent::bSequenceFinished );
+
 	lua.new_usertype<LuaEvent>(
 		"LuaEvent",
 		"type_id",
@@ -97,6 +111,17 @@ void LuaEventBinder::CreateLuaEventBindings( sol::state& lua )
 													   "release",
 													   &LuaHandler<GamepadConnectEvent>::ReleaseConnection );
 
+	lua.new_usertype<LuaHandler<TweenEvent>>(
+		"TweenEventHandler",
+		"type_id",
+		&entt::type_hash<LuaHandler<TweenEvent>>::value,
+		"event_type",
+		&entt::type_hash<TweenEvent>::value,
+		sol::call_constructor,
+		sol::factories( []( const sol::function& func ) { return LuaHandler<TweenEvent>{ .callback = func }; } ),
+		"release",
+		&LuaHandler<TweenEvent>::ReleaseConnection );
+
 	lua.new_usertype<LuaHandler<LuaEvent>>(
 		"LuaEventHandler",
 		"type_id",
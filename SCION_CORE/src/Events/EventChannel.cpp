@@ -0,0 +1,41 @@
+#include "Core/Events/EventChannel.h"
+
+namespace Scion::Core::Events
+{
+
+size_t EventChannels::DrainAll( entt::dispatcher& dispatcher )
+{
+	size_t numDrained{ 0 };
+
+	// Indexed, a handler can create a new channel while draining.
+	for ( size_t i = 0; i < m_Channels.size(); ++i )
+	{
+		numDrained += m_Channels[ i ]->Drain( dispatcher );
+	}
+
+	return numDrained;
+}
+
+std::uint64_t EventChannels::NumDropped() const
+{
+	std::uint64_t numDropped{ 0 };
+	for ( const auto& pChannel : m_Channels )
+	{
+		numDropped += pChannel->GetStats().numDropped;
+	}
+
+	return numDropped;
+}
+
+double EventChannels::MaxLatencyMs() const
+{
+	double maxLatencyMs{ 0.0 };
+	for ( const auto& pChannel : m_Channels )
+	{
+		maxLatencyMs = std::max( maxLatencyMs, pChannel->GetStats().maxLatencyMs );
+	}
+
+	return maxLatencyMs;
+}
+
+} // namespace Scion::Core::Events
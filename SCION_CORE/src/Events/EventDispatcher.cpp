@@ -1,5 +1,6 @@
 #include "Core/Events/EventDispatcher.h"
 #include "Core/ECS/MetaUtilities.h"
+#include "Core/Profiling/ProfileCollector.h"
 
 using namespace Scion::Core::Utils;
 
@@ -15,6 +16,8 @@ enum class EDispatcherType
 
 EventDispatcher::EventDispatcher()
 	: m_pDispatcher{ std::make_shared<entt::dispatcher>() }
+	, m_pLuaBatcher{ std::make_shared<LuaEventBatcher>() }
+	, m_pChannels{ std::make_shared<EventChannels>() }
 {
 }
 
@@ -25,6 +28,32 @@ EventDispatcher::~EventDispatcher()
 void EventDispatcher::UpdateAll()
 {
 	m_pDispatcher->update();
+	FlushLuaEvents();
+}
+
+void EventDispatcher::FlushLuaEvents()
+{
+	m_pLuaBatcher->Flush();
+}
+
+void EventDispatcher::ClearLuaBatchHandlers()
+{
+	m_pLuaBatcher->Clear();
+}
+
+size_t EventDispatcher::DrainChannels()
+{
+	if ( m_pChannels->GetChannels().empty() )
+		return 0;
+
+	SCION_SUBSYSTEM_ZONE( "Drain Event Channels" );
+	const size_t numDrained = m_pChannels->DrainAll( *m_pDispatcher );
+
+	SCION_PROFILE_COUNTER( "Channel Events", numDrained );
+	SCION_PROFILE_COUNTER( "Channel Events Dropped", m_pChannels->NumDropped() );
+	SCION_PROFILE_COUNTER( "Channel Latency (ms)", m_pChannels->MaxLatencyMs() );
+
+	return numDrained;
 }
 
 void EventDispatcher::ClearQueue()
@@ -42,6 +71,13 @@ void EventDispatcher::CreateEventDispatcherLuaBind( sol::state& lua, EventDispat
 									   { "Scion", EDispatcherType::SCION_DISPATCHER },
 								   } );
 
+	lua.new_usertype<LuaBatchHandler>( "EventBatchHandler",
+									   sol::no_constructor,
+									   "release",
+									   &LuaBatchHandler::Release,
+									   "isSubscribed",
+									   &LuaBatchHandler::IsSubscribed );
+
 	lua.new_usertype<EventDispatcher>(
 		"EventDispatcher",
 		sol::call_constructor,
@@ -68,6 +104,19 @@ void EventDispatcher::CreateEventDispatcherLuaBind( sol::state& lua, EventDispat
 		[]( EventDispatcher& eventDispatcher, const sol::table& event ) {
 			const auto ev = InvokeMetaFunction( GetIdType( event ), "enqueue_event"_hs, eventDispatcher, event );
 		},
+		"addBatchHandler",
+		[]( EventDispatcher& eventDispatcher,
+			const sol::object& type,
+			const sol::function& callback,
+			const sol::object& filter ) {
+			const auto eventType = GetIdType( type );
+			const auto id = InvokeMetaFunction(
+				eventType, "add_batch_handler"_hs, eventDispatcher, callback, LuaEventFilter::Create( filter ) );
+
+			return LuaBatchHandler{ eventDispatcher.m_pLuaBatcher, eventType, id ? id.cast<std::uint32_t>() : 0 };
+		},
+		"flush",
+		[]( EventDispatcher& eventDispatcher ) { eventDispatcher.FlushLuaEvents(); },
 		"hasHandlers",
 		[]( EventDispatcher& eventDispatcher, const sol::table& event ) {
 			const auto has_handlers = InvokeMetaFunction( GetIdType( event ), "has_handlers"_hs, eventDispatcher );
@@ -0,0 +1,106 @@
+#include "Core/Events/LuaEventBatcher.h"
+#include "Core/Events/EngineEventTypes.h"
+#include "Core/ECS/Entity.h"
+
+namespace Scion::Core::Events
+{
+
+LuaEventFilter LuaEventFilter::Create( const sol::object& filter )
+{
+	LuaEventFilter eventFilter{};
+	if ( filter.get_type() != sol::type::table )
+		return eventFilter;
+
+	sol::table filterTable = filter.as<sol::table>();
+	eventFilter.key = filterTable.get_or( "key", -1 );
+	eventFilter.sTag = filterTable.get_or( "tag", std::string{} );
+
+	if ( sol::optional<EKeyEventType> optKeyType = filterTable[ "type" ] )
+		eventFilter.keyType = static_cast<int>( *optKeyType );
+
+	sol::object entity = filterTable[ "entity" ];
+	if ( entity.is<Scion::Core::ECS::Entity>() )
+		eventFilter.entity = entity.as<Scion::Core::ECS::Entity&>().GetEntity();
+	else if ( entity.get_type() == sol::type::number )
+		eventFilter.entity = static_cast<entt::entity>( entity.as<std::uint32_t>() );
+
+	return eventFilter;
+}
+
+bool PassesFilter( const LuaEventFilter& filter, const KeyEvent& ev )
+{
+	return ( filter.key < 0 || filter.key == ev.key ) &&
+		   ( filter.keyType < 0 || filter.keyType == static_cast<int>( ev.eType ) );
+}
+
+bool PassesFilter( const LuaEventFilter& filter, const ContactEvent& ev )
+{
+	if ( filter.entity != entt::null )
+	{
+		const auto entityID = entt::to_integral( filter.entity );
+		if ( ev.objectA.entityID != entityID && ev.objectB.entityID != entityID )
+			return false;
+	}
+
+	return filter.sTag.empty() || ev.objectA.tag == filter.sTag || ev.objectB.tag == filter.sTag;
+}
+
+bool PassesFilter( const LuaEventFilter& filter, const TweenEvent& ev )
+{
+	return filter.entity == entt::null || filter.entity == ev.entity;
+}
+
+void LuaEventBatcher::Unsubscribe( entt::id_type eventType, std::uint32_t id )
+{
+	if ( auto itr = m_QueueIndices.find( eventType ); itr != m_QueueIndices.end() )
+		m_Queues[ itr->second ]->Unsubscribe( id );
+}
+
+bool LuaEventBatcher::IsSubscribed( entt::id_type eventType, std::uint32_t id ) const
+{
+	auto itr = m_QueueIndices.find( eventType );
+	return itr != m_QueueIndices.end() && m_Queues[ itr->second ]->IsSubscribed( id );
+}
+
+void LuaEventBatcher::Flush()
+{
+	for ( size_t i = 0; i < m_Queues.size(); ++i )
+	{
+		m_Queues[ i ]->Flush();
+	}
+}
+
+void LuaEventBatcher::Clear()
+{
+	m_Queues.clear();
+	m_QueueIndices.clear();
+}
+
+LuaBatchHandler::LuaBatchHandler( std::weak_ptr<LuaEventBatcher> pBatcher, entt::id_type eventType, std::uint32_t id )
+	: m_pBatcher{ std::move( pBatcher ) }
+	, m_EventType{ eventType }
+	, m_ID{ id }
+{
+}
+
+void LuaBatchHandler::Release()
+{
+	if ( m_ID == 0 )
+		return;
+
+	if ( auto pBatcher = m_pBatcher.lock() )
+		pBatcher->Unsubscribe( m_EventType, m_ID );
+
+	m_ID = 0;
+}
+
+bool LuaBatchHandler::IsSubscribed() const
+{
+	if ( m_ID == 0 )
+		return false;
+
+	auto pBatcher = m_pBatcher.lock();
+	return pBatcher && pBatcher->IsSubscribed( m_EventType, m_ID );
+}
+
+} // namespace Scion::Core::Events
@@ -0,0 +1,928 @@
+#include "Core/Loaders/LevelStreamer.h"
+#include "Core/ECS/Components/ComponentSerializer.h"
+#include "Core/ECS/MainRegistry.h"
+#include "Core/ECS/Registry.h"
+#include "Core/ECS/Entity.h"
+#include "Core/CoreUtilities/CoreEngineData.h"
+#include "Core/Resources/AssetManager.h"
+#include "Core/Profiling/ProfileCollector.h"
+#include "ScionFilesystem/Serializers/JSONSerializer.h"
+#include "ScionUtilities/ScionUtilities.h"
+#include "ScionUtilities/HelperUtilities.h"
+#include "Physics/Box2DWrappers.h"
+#include "Rendering/Core/Camera2D.h"
+#include "Logger/Logger.h"
+#include <rapidjson/error/en.h>
+
+using namespace Scion::Filesystem;
+using namespace Scion::Core::ECS;
+
+namespace
+{
+constexpr const char* LEVEL_MANIFEST_FILE = "level_cells.json";
+
+struct ExportCell
+{
+	int x{ 0 };
+	int y{ 0 };
+	std::vector<entt::entity> tiles{};
+	std::vector<entt::entity> objects{};
+	std::set<std::string> textures{};
+};
+
+int FloorDiv( float value, int cellSize )
+{
+	return static_cast<int>( std::floor( value / static_cast<float>( cellSize ) ) );
+}
+
+std::uint32_t GetMappedID( const std::unordered_map<entt::entity, std::uint32_t>& mapIDs, entt::entity entity )
+{
+	if ( entity == entt::null )
+		return 0;
+
+	auto idItr = mapIDs.find( entity );
+	return idItr != mapIDs.end() ? idItr->second : 0;
+}
+
+void SerializeStreamedEntity( JSONSerializer& serializer, Registry& registry, entt::entity entity,
+							  const std::unordered_map<entt::entity, std::uint32_t>& mapIDs )
+{
+	Entity ent{ &registry, entity };
+
+	serializer.StartNewObject();
+	serializer.AddKeyValuePair( "stream_id", GetMappedID( mapIDs, entity ) );
+	serializer.StartNewObject( "components" );
+
+	if ( const auto* id = ent.TryGetComponent<Identification>() )
+	{
+		SERIALIZE_COMPONENT( serializer, *id );
+	}
+
+	if ( const auto* transform = ent.TryGetComponent<TransformComponent>() )
+	{
+		SERIALIZE_COMPONENT( serializer, *transform );
+	}
+
+	if ( const auto* sprite = ent.TryGetComponent<SpriteComponent>() )
+	{
+		SERIALIZE_COMPONENT( serializer, *sprite );
+	}
+
+	if ( const auto* boxCollider = ent.TryGetComponent<BoxColliderComponent>() )
+	{
+		SERIALIZE_COMPONENT( serializer, *boxCollider );
+	}
+
+	if ( const auto* circleCollider = ent.TryGetComponent<CircleColliderComponent>() )
+	{
+		SERIALIZE_COMPONENT( serializer, *circleCollider );
+	}
+
+	if ( const auto* animation = ent.TryGetComponent<AnimationComponent>() )
+	{
+		SERIALIZE_COMPONENT( serializer, *animation );
+	}
+
+	if ( const auto* physics = ent.TryGetComponent<PhysicsComponent>() )
+	{
+		SERIALIZE_COMPONENT( serializer, *physics );
+	}
+
+	if ( const auto* text = ent.TryGetComponent<TextComponent>() )
+	{
+		SERIALIZE_COMPONENT( serializer, *text );
+	}
+
+	if ( const auto* ui = ent.TryGetComponent<UIComponent>() )
+	{
+		SERIALIZE_COMPONENT( serializer, *ui );
+	}
+
+	// Relationships are stored as stream ids so they can be remapped when the cell is loaded.
+	if ( const auto* relations = ent.TryGetComponent<Relationship>() )
+	{
+		serializer.StartNewObject( "relationship" )
+			.AddKeyValuePair( "parent", GetMappedID( mapIDs, relations->parent ) )
+			.AddKeyValuePair( "nextSibling", GetMappedID( mapIDs, relations->nextSibling ) )
+			.AddKeyValuePair( "prevSibling", GetMappedID( mapIDs, relations->prevSibling ) )
+			.AddKeyValuePair( "firstChild", GetMappedID( mapIDs, relations->firstChild ) )
+			.EndObject(); // Relationship
+	}
+
+	serializer.EndObject(); // Components
+	serializer.EndObject(); // Entity
+}
+
+void InitStreamedPhysics( Registry& registry, entt::entity entity )
+{
+	auto& mainRegistry = MAIN_REGISTRY();
+	auto* pPhysicsWorld = mainRegistry.TryGetContext<Scion::Physics::PhysicsWorld>();
+	auto* pCamera = mainRegistry.TryGetContext<std::shared_ptr<Scion::Rendering::Camera2D>>();
+	if ( !pPhysicsWorld || !*pPhysicsWorld || !pCamera || !*pCamera )
+	{
+		SCION_ERROR( "Failed to initialize streamed physics entity. Physics world or camera is not set." );
+		return;
+	}
+
+	Entity ent{ &registry, entity };
+	auto* pBoxCollider = ent.TryGetComponent<BoxColliderComponent>();
+	auto* pCircleCollider = ent.TryGetComponent<CircleColliderComponent>();
+
+	if ( !pBoxCollider && !pCircleCollider )
+	{
+		SCION_ERROR( "Entity must have a box or circle collider component to initialize physics on it." );
+		return;
+	}
+
+	auto& physics = ent.GetComponent<PhysicsComponent>();
+	auto& physicsAttributes = physics.GetChangableAttributes();
+
+	if ( pBoxCollider )
+	{
+		physicsAttributes.boxSize = glm::vec2{ pBoxCollider->width, pBoxCollider->height };
+		physicsAttributes.offset = pBoxCollider->offset;
+	}
+	else
+	{
+		physicsAttributes.radius = pCircleCollider->radius;
+		physicsAttributes.offset = pCircleCollider->offset;
+	}
+
+	const auto& transform = ent.GetComponent<TransformComponent>();
+	physicsAttributes.position = transform.position;
+	physicsAttributes.scale = transform.scale;
+	physicsAttributes.objectData.entityID = static_cast<std::int32_t>( entity );
+
+	physics.Init( *pPhysicsWorld, ( *pCamera )->GetWidth(), ( *pCamera )->GetHeight() );
+
+	if ( physics.UseFilters() )
+	{
+		physics.SetFilterCategory();
+		physics.SetFilterMask();
+		physics.SetGroupIndex();
+	}
+}
+
+} // namespace
+
+namespace Scion::Core::Loaders
+{
+
+LevelStreamer::LevelStreamer()
+	: m_Params{}
+	, m_sCellsDir{}
+	, m_mapCells{}
+	, m_mapFocusPoints{}
+	, m_NextFocusID{ 1 }
+	, m_LoadQueue{}
+	, m_UnloadQueue{}
+	, m_mapStreamIDToEntity{}
+	, m_mapEntityToStreamID{}
+	, m_mapTextureRefs{}
+	, m_NumLoadedCells{ 0 }
+{
+}
+
+bool LevelStreamer::ExportCells( Scion::Core::ECS::Registry& registry, const std::string& sCellsDir, int cellSize )
+{
+	if ( cellSize <= 0 )
+	{
+		SCION_ERROR( "Failed to export level cells. Cell size [{}] must be greater than zero.", cellSize );
+		return false;
+	}
+
+	fs::path cellsPath{ sCellsDir };
+	std::error_code ec;
+	if ( !fs::exists( cellsPath ) && !fs::create_directories( cellsPath, ec ) )
+	{
+		SCION_ERROR( "Failed to export level cells. Unable to create directory [{}] - {}", sCellsDir, ec.message() );
+		return false;
+	}
+
+	auto& enttRegistry = registry.GetRegistry();
+
+	// Stream ids are assigned in export order and start at 1 so 0 can mean "no entity".
+	std::unordered_map<entt::entity, std::uint32_t> mapIDs;
+	std::uint32_t nextStreamID{ 1 };
+
+	auto tiles = enttRegistry.view<TileComponent, TransformComponent>();
+	for ( auto tile : tiles )
+	{
+		mapIDs.emplace( tile, nextStreamID++ );
+	}
+
+	auto gameObjects =
+		enttRegistry.view<TransformComponent>( entt::exclude<TileComponent, UneditableComponent> );
+	for ( auto object : gameObjects )
+	{
+		mapIDs.emplace( object, nextStreamID++ );
+	}
+
+	std::map<std::pair<int, int>, ExportCell> mapCells;
+
+	auto getCell = [ & ]( const glm::vec2& position ) -> ExportCell& {
+		int x = FloorDiv( position.x, cellSize );
+		int y = FloorDiv( position.y, cellSize );
+		auto [ itr, bInserted ] = mapCells.try_emplace( std::make_pair( x, y ) );
+		itr->second.x = x;
+		itr->second.y = y;
+		return itr->second;
+	};
+
+	auto addTexture = [ & ]( ExportCell& cell, entt::entity entity ) {
+		if ( const auto* pSprite = enttRegistry.try_get<SpriteComponent>( entity );
+			 pSprite && !pSprite->sTextureName.empty() )
+		{
+			cell.textures.insert( pSprite->sTextureName );
+		}
+	};
+
+	for ( auto tile : tiles )
+	{
+		auto& cell = getCell( tiles.get<TransformComponent>( tile ).position );
+		cell.tiles.push_back( tile );
+		addTexture( cell, tile );
+	}
+
+	for ( auto object : gameObjects )
+	{
+		// Children follow their root parent so relationships never cross cells.
+		entt::entity root{ object };
+		while ( const auto* pRelations = enttRegistry.try_get<Relationship>( root ) )
+		{
+			if ( pRelations->parent == entt::null )
+				break;
+
+			root = pRelations->parent;
+		}
+
+		auto& cell = getCell( enttRegistry.get<TransformComponent>( root ).position );
+		cell.objects.push_back( object );
+		addTexture( cell, object );
+	}
+
+	std::unique_ptr<JSONSerializer> pManifest{ nullptr };
+
+	try
+	{
+		pManifest = std::make_unique<JSONSerializer>( ( cellsPath / LEVEL_MANIFEST_FILE ).string() );
+	}
+	catch ( const std::exception& ex )
+	{
+		SCION_ERROR( "Failed to export level manifest [{}] - [{}]", sCellsDir, ex.what() );
+		return false;
+	}
+
+	pManifest->StartDocument();
+	pManifest->AddKeyValuePair( "cellSize", cellSize );
+	pManifest->StartNewArray( "cells" );
+
+	for ( const auto& [ coords, cell ] : mapCells )
+	{
+		const std::string sCellFile{ fmt::format( "cell_{}_{}.json", cell.x, cell.y ) };
+
+		try
+		{
+			// Cells are only ever read by the runtime, keep them compact.
+			JSONSerializer cellSerializer{ ( cellsPath / sCellFile ).string(), -1, false };
+			cellSerializer.StartDocument();
+
+			cellSerializer.StartNewArray( "tilemap" );
+			for ( auto tile : cell.tiles )
+			{
+				SerializeStreamedEntity( cellSerializer, registry, tile, mapIDs );
+			}
+			cellSerializer.EndArray(); // Tilemap
+
+			cellSerializer.StartNewArray( "game_objects" );
+			for ( auto object : cell.objects )
+			{
+				SerializeStreamedEntity( cellSerializer, registry, object, mapIDs );
+			}
+			cellSerializer.EndArray(); // Game Objects
+
+			if ( !cellSerializer.EndDocument() )
+			{
+				SCION_ERROR( "Failed to export level cell [{}]", sCellFile );
+				return false;
+			}
+		}
+		catch ( const std::exception& ex )
+		{
+			SCION_ERROR( "Failed to export level cell [{}] - [{}]", sCellFile, ex.what() );
+			return false;
+		}
+
+		pManifest->StartNewObject()
+			.AddKeyValuePair( "x", cell.x )
+			.AddKeyValuePair( "y", cell.y )
+			.AddKeyValuePair( "file", sCellFile )
+			.StartNewArray( "textures" );
+
+		// The names are the packaged asset names, the runtime loads the textures from the packaged data.
+		for ( const auto& sTextureName : cell.textures )
+		{
+			pManifest->StartNewObject().AddKeyValuePair( "name", sTextureName ).EndObject();
+		}
+
+		pManifest->EndArray()  // Textures
+			.EndObject(); // Cell
+	}
+
+	pManifest->EndArray(); // Cells
+
+	SCION_LOG( "Exported [{}] level cells to [{}]", mapCells.size(), sCellsDir );
+
+	return pManifest->EndDocument();
+}
+
+bool LevelStreamer::LoadManifest( const std::string& sCellsDir )
+{
+	if ( m_NumLoadedCells > 0 )
+	{
+		SCION_ERROR( "Failed to load level manifest. Unload the current cells first." );
+		return false;
+	}
+
+	const fs::path manifestPath{ fs::path{ sCellsDir } / LEVEL_MANIFEST_FILE };
+	std::ifstream manifestFile{ manifestPath };
+	if ( !manifestFile.is_open() )
+	{
+		SCION_ERROR( "Failed to open level manifest [{}]", manifestPath.string() );
+		return false;
+	}
+
+	std::stringstream ss;
+	ss << manifestFile.rdbuf();
+	std::string contents = ss.str();
+	rapidjson::StringStream jsonStr{ contents.c_str() };
+
+	rapidjson::Document doc;
+	doc.ParseStream( jsonStr );
+
+	if ( doc.HasParseError() || !doc.IsObject() || !doc.HasMember( "cells" ) || !doc[ "cells" ].IsArray() )
+	{
+		SCION_ERROR( "Failed to load level manifest: File: [{}] is not valid. - {} - {}",
+					 manifestPath.string(),
+					 rapidjson::GetParseError_En( doc.GetParseError() ),
+					 doc.GetErrorOffset() );
+		return false;
+	}
+
+	m_mapCells.clear();
+	m_LoadQueue.clear();
+	m_UnloadQueue.clear();
+	m_sCellsDir = sCellsDir;
+	m_Params.cellSize = doc.HasMember( "cellSize" ) ? doc[ "cellSize" ].GetInt() : m_Params.cellSize;
+
+	for ( const auto& jsonCell : doc[ "cells" ].GetArray() )
+	{
+		StreamedCell cell{ .x = jsonCell[ "x" ].GetInt(),
+						   .y = jsonCell[ "y" ].GetInt(),
+						   .sFilename = jsonCell[ "file" ].GetString() };
+
+		if ( jsonCell.HasMember( "textures" ) )
+		{
+			for ( const auto& jsonTexture : jsonCell[ "textures" ].GetArray() )
+			{
+				cell.textures.emplace_back( jsonTexture[ "name" ].GetString() );
+			}
+		}
+
+		m_mapCells.emplace( CellKey( cell.x, cell.y ), std::move( cell ) );
+	}
+
+	return true;
+}
+
+void LevelStreamer::Reset( Scion::Core::ECS::Registry& registry )
+{
+	UnloadAll( registry );
+
+	m_mapCells.clear();
+	m_sCellsDir.clear();
+	m_NumLoadedCells = 0;
+}
+
+std::string LevelStreamer::GetCellsDirectory( const std::string& sSceneName )
+{
+	return fmt::format( "assets{}levels{}{}_cells", PATH_SEPARATOR, PATH_SEPARATOR, sSceneName );
+}
+
+bool LevelStreamer::ReadStreamedTextures( const std::string& sCellsDir, std::set<std::string>& textures )
+{
+	const fs::path manifestPath{ fs::path{ sCellsDir } / LEVEL_MANIFEST_FILE };
+	std::ifstream manifestFile{ manifestPath };
+	if ( !manifestFile.is_open() )
+		return false;
+
+	std::stringstream ss;
+	ss << manifestFile.rdbuf();
+	std::string contents = ss.str();
+	rapidjson::StringStream jsonStr{ contents.c_str() };
+
+	rapidjson::Document doc;
+	doc.ParseStream( jsonStr );
+
+	if ( doc.HasParseError() || !doc.IsObject() || !doc.HasMember( "cells" ) || !doc[ "cells" ].IsArray() )
+		return false;
+
+	for ( const auto& jsonCell : doc[ "cells" ].GetArray() )
+	{
+		if ( !jsonCell.HasMember( "textures" ) )
+			continue;
+
+		for ( const auto& jsonTexture : jsonCell[ "textures" ].GetArray() )
+		{
+			textures.insert( jsonTexture[ "name" ].GetString() );
+		}
+	}
+
+	return true;
+}
+
+void LevelStreamer::Update( Scion::Core::ECS::Registry& registry )
+{
+	if ( m_mapCells.empty() )
+		return;
+
+	SCION_SYSTEM_ZONE( "LevelStreamer" );
+	RefreshQueues();
+
+	const auto startTime = std::chrono::steady_clock::now();
+	auto budgetExceeded = [ & ] {
+		const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - startTime;
+		return elapsed.count() >= m_Params.frameBudgetMs;
+	};
+
+	int numProcessed{ 0 };
+
+	// Unloading first frees the bodies and textures before new cells are loaded.
+	while ( !m_UnloadQueue.empty() && numProcessed < m_Params.maxCellsPerFrame && !budgetExceeded() )
+	{
+		auto cellItr = m_mapCells.find( m_UnloadQueue.back() );
+		m_UnloadQueue.pop_back();
+
+		if ( cellItr != m_mapCells.end() )
+		{
+			UnloadCell( registry, cellItr->second );
+			++numProcessed;
+		}
+	}
+
+	while ( !m_LoadQueue.empty() && numProcessed < m_Params.maxCellsPerFrame && !budgetExceeded() )
+	{
+		auto cellItr = m_mapCells.find( m_LoadQueue.back() );
+		m_LoadQueue.pop_back();
+
+		if ( cellItr != m_mapCells.end() )
+		{
+			LoadCell( registry, cellItr->second );
+			++numProcessed;
+		}
+	}
+}
+
+void LevelStreamer::LoadRequiredCells( Scion::Core::ECS::Registry& registry )
+{
+	RefreshQueues();
+
+	for ( auto cellKey : m_LoadQueue )
+	{
+		if ( auto cellItr = m_mapCells.find( cellKey ); cellItr != m_mapCells.end() )
+		{
+			LoadCell( registry, cellItr->second );
+		}
+	}
+
+	m_LoadQueue.clear();
+}
+
+void LevelStreamer::UnloadAll( Scion::Core::ECS::Registry& registry )
+{
+	for ( auto& [ key, cell ] : m_mapCells )
+	{
+		if ( cell.eState == ECellState::Loaded )
+		{
+			UnloadCell( registry, cell );
+		}
+
+		cell.eState = ECellState::Unloaded;
+	}
+
+	m_LoadQueue.clear();
+	m_UnloadQueue.clear();
+	m_mapStreamIDToEntity.clear();
+	m_mapEntityToStreamID.clear();
+}
+
+std::uint32_t LevelStreamer::AddFocusPoint( const glm::vec2& position )
+{
+	const auto focusID = m_NextFocusID++;
+	m_mapFocusPoints.emplace( focusID, position );
+	return focusID;
+}
+
+bool LevelStreamer::SetFocusPoint( std::uint32_t focusID, const glm::vec2& position )
+{
+	auto focusItr = m_mapFocusPoints.find( focusID );
+	if ( focusItr == m_mapFocusPoints.end() )
+	{
+		SCION_ERROR( "Failed to set focus point. Focus point [{}] does not exist.", focusID );
+		return false;
+	}
+
+	focusItr->second = position;
+	return true;
+}
+
+bool LevelStreamer::RemoveFocusPoint( std::uint32_t focusID )
+{
+	return m_mapFocusPoints.erase( focusID ) > 0;
+}
+
+entt::entity LevelStreamer::GetEntity( std::uint32_t streamID ) const
+{
+	auto entityItr = m_mapStreamIDToEntity.find( streamID );
+	return entityItr != m_mapStreamIDToEntity.end() ? entityItr->second : entt::entity{ entt::null };
+}
+
+std::uint32_t LevelStreamer::GetStreamID( entt::entity entity ) const
+{
+	auto idItr = m_mapEntityToStreamID.find( entity );
+	return idItr != m_mapEntityToStreamID.end() ? idItr->second : 0;
+}
+
+bool LevelStreamer::IsCellLoaded( int x, int y ) const
+{
+	auto cellItr = m_mapCells.find( CellKey( x, y ) );
+	return cellItr != m_mapCells.end() && cellItr->second.eState == ECellState::Loaded;
+}
+
+std::pair<int, int> LevelStreamer::WorldToCell( const glm::vec2& position ) const
+{
+	return { FloorDiv( position.x, m_Params.cellSize ), FloorDiv( position.y, m_Params.cellSize ) };
+}
+
+std::int64_t LevelStreamer::CellKey( int x, int y )
+{
+	return ( static_cast<std::int64_t>( x ) << 32 ) | static_cast<std::uint32_t>( y );
+}
+
+void LevelStreamer::RefreshQueues()
+{
+	m_LoadQueue.clear();
+	m_UnloadQueue.clear();
+
+	const int unloadRadius = std::max( m_Params.unloadRadius, m_Params.loadRadius );
+
+	for ( auto& [ key, cell ] : m_mapCells )
+	{
+		if ( cell.eState != ECellState::Loaded && IsCellRequired( cell, m_Params.loadRadius ) )
+		{
+			cell.eState = ECellState::Queued;
+			m_LoadQueue.push_back( key );
+		}
+		else if ( cell.eState == ECellState::Loaded && !IsCellRequired( cell, unloadRadius ) )
+		{
+			m_UnloadQueue.push_back( key );
+		}
+		else if ( cell.eState == ECellState::Queued )
+		{
+			cell.eState = ECellState::Unloaded;
+		}
+	}
+
+	if ( m_LoadQueue.size() < 2 || m_mapFocusPoints.empty() )
+		return;
+
+	// Process the cells closest to a focus point first. The queues are consumed from the back.
+	auto distanceToFocus = [ this ]( std::int64_t key ) {
+		const auto& cell = m_mapCells.at( key );
+		int closest{ std::numeric_limits<int>::max() };
+		for ( const auto& [ id, focus ] : m_mapFocusPoints )
+		{
+			auto [ focusX, focusY ] = WorldToCell( focus );
+			closest = std::min( closest, std::max( std::abs( cell.x - focusX ), std::abs( cell.y - focusY ) ) );
+		}
+		return closest;
+	};
+
+	std::ranges::sort( m_LoadQueue, [ & ]( std::int64_t a, std::int64_t b ) {
+		return distanceToFocus( a ) > distanceToFocus( b );
+	} );
+}
+
+bool LevelStreamer::IsCellRequired( const StreamedCell& cell, int radius ) const
+{
+	for ( const auto& [ id, focus ] : m_mapFocusPoints )
+	{
+		auto [ focusX, focusY ] = WorldToCell( focus );
+		if ( std::abs( cell.x - focusX ) <= radius && std::abs( cell.y - focusY ) <= radius )
+			return true;
+	}
+
+	return false;
+}
+
+bool LevelStreamer::LoadCell( Scion::Core::ECS::Registry& registry, StreamedCell& cell )
+{
+	SCION_SUBSYSTEM_ZONE( "LevelStreamer::LoadCell" );
+
+	const fs::path cellPath{ fs::path{ m_sCellsDir } / cell.sFilename };
+	std::ifstream cellFile{ cellPath };
+	if ( !cellFile.is_open() )
+	{
+		SCION_ERROR( "Failed to open level cell [{}]", cellPath.string() );
+		cell.eState = ECellState::Unloaded;
+		return false;
+	}
+
+	std::stringstream ss;
+	ss << cellFile.rdbuf();
+	std::string contents = ss.str();
+	rapidjson::StringStream jsonStr{ contents.c_str() };
+
+	rapidjson::Document doc;
+	doc.ParseStream( jsonStr );
+
+	if ( doc.HasParseError() || !doc.IsObject() )
+	{
+		SCION_ERROR( "Failed to load level cell: File: [{}] is not valid JSON. - {} - {}",
+					 cellPath.string(),
+					 rapidjson::GetParseError_En( doc.GetParseError() ),
+					 doc.GetErrorOffset() );
+		cell.eState = ECellState::Unloaded;
+		return false;
+	}
+
+	AcquireTextures( cell );
+
+	const bool bPhysicsEnabled{ CORE_GLOBALS().IsPhysicsEnabled() };
+	std::vector<std::pair<entt::entity, const rapidjson::Value*>> relationships;
+
+	auto loadEntities = [ & ]( const char* sArrayName, bool bTiles ) {
+		if ( !doc.HasMember( sArrayName ) || !doc[ sArrayName ].IsArray() )
+			return;
+
+		for ( const auto& jsonEntity : doc[ sArrayName ].GetArray() )
+		{
+			Entity newEntity{ &registry, "", "" };
+			const auto& components = jsonEntity[ "components" ];
+
+			if ( components.HasMember( "id" ) )
+			{
+				auto& id = newEntity.GetComponent<Identification>();
+				DESERIALIZE_COMPONENT( components[ "id" ], id );
+				id.entity_id = static_cast<std::uint32_t>( newEntity.GetEntity() );
+				newEntity.ChangeName( id.name );
+			}
+
+			auto& transform = newEntity.AddComponent<TransformComponent>();
+			DESERIALIZE_COMPONENT( components[ "transform" ], transform );
+
+			if ( components.HasMember( "sprite" ) )
+			{
+				auto& sprite = newEntity.AddComponent<SpriteComponent>();
+				DESERIALIZE_COMPONENT( components[ "sprite" ], sprite );
+			}
+
+			if ( components.HasMember( "boxCollider" ) )
+			{
+				auto& boxCollider = newEntity.AddComponent<BoxColliderComponent>();
+				DESERIALIZE_COMPONENT( components[ "boxCollider" ], boxCollider );
+			}
+
+			if ( components.HasMember( "circleCollider" ) )
+			{
+				auto& circleCollider = newEntity.AddComponent<CircleColliderComponent>();
+				DESERIALIZE_COMPONENT( components[ "circleCollider" ], circleCollider );
+			}
+
+			if ( components.HasMember( "animation" ) )
+			{
+				auto& animation = newEntity.AddComponent<AnimationComponent>();
+				DESERIALIZE_COMPONENT( components[ "animation" ], animation );
+			}
+
+			if ( components.HasMember( "physics" ) )
+			{
+				auto& physics = newEntity.AddComponent<PhysicsComponent>();
+				DESERIALIZE_COMPONENT( components[ "physics" ], physics );
+			}
+
+			if ( components.HasMember( "text" ) )
+			{
+				auto& text = newEntity.AddComponent<TextComponent>();
+				DESERIALIZE_COMPONENT( components[ "text" ], text );
+			}
+
+			if ( components.HasMember( "ui" ) )
+			{
+				auto& ui = newEntity.AddComponent<UIComponent>();
+				DESERIALIZE_COMPONENT( components[ "ui" ], ui );
+			}
+
+			if ( bTiles )
+			{
+				newEntity.AddComponent<TileComponent>(
+					TileComponent{ .id = static_cast<uint32_t>( newEntity.GetEntity() ) } );
+			}
+
+			if ( components.HasMember( "relationship" ) )
+			{
+				relationships.emplace_back( newEntity.GetEntity(), &components[ "relationship" ] );
+			}
+
+			const std::uint32_t streamID{ jsonEntity.HasMember( "stream_id" ) ? jsonEntity[ "stream_id" ].GetUint()
+																			   : 0 };
+			if ( streamID != 0 )
+			{
+				m_mapStreamIDToEntity[ streamID ] = newEntity.GetEntity();
+				m_mapEntityToStreamID[ newEntity.GetEntity() ] = streamID;
+			}
+
+			if ( bPhysicsEnabled && newEntity.HasComponent<PhysicsComponent>() )
+			{
+				InitStreamedPhysics( registry, newEntity.GetEntity() );
+			}
+
+			cell.entities.push_back( newEntity.GetEntity() );
+		}
+	};
+
+	loadEntities( "tilemap", true );
+	loadEntities( "game_objects", false );
+
+	// Hierarchies never span cells, so every stream id referenced here has just been mapped.
+	for ( auto& [ entity, pJsonRelations ] : relationships )
+	{
+		auto& relations = registry.GetRegistry().get<Relationship>( entity );
+		relations.parent = GetEntity( ( *pJsonRelations )[ "parent" ].GetUint() );
+		relations.nextSibling = GetEntity( ( *pJsonRelations )[ "nextSibling" ].GetUint() );
+		relations.prevSibling = GetEntity( ( *pJsonRelations )[ "prevSibling" ].GetUint() );
+		relations.firstChild = GetEntity( ( *pJsonRelations )[ "firstChild" ].GetUint() );
+	}
+
+	cell.eState = ECellState::Loaded;
+	++m_NumLoadedCells;
+
+	return true;
+}
+
+void LevelStreamer::UnloadCell( Scion::Core::ECS::Registry& registry, StreamedCell& cell )
+{
+	SCION_SUBSYSTEM_ZONE( "LevelStreamer::UnloadCell" );
+
+	for ( auto entity : cell.entities )
+	{
+		if ( auto idItr = m_mapEntityToStreamID.find( entity ); idItr != m_mapEntityToStreamID.end() )
+		{
+			m_mapStreamIDToEntity.erase( idItr->second );
+			m_mapEntityToStreamID.erase( idItr );
+		}
+
+		// Scripts may have already destroyed the entity.
+		if ( registry.IsValid( entity ) )
+		{
+			registry.AddToPendingDestruction( entity );
+		}
+	}
+
+	cell.entities.clear();
+	ReleaseTextures( cell );
+
+	cell.eState = ECellState::Unloaded;
+	if ( m_NumLoadedCells > 0 )
+		--m_NumLoadedCells;
+}
+
+void LevelStreamer::AcquireTextures( const StreamedCell& cell )
+{
+	for ( const auto& sTextureName : cell.textures )
+	{
+		AcquireTexture( sTextureName, cell.sFilename );
+	}
+}
+
+void LevelStreamer::ReleaseTextures( const StreamedCell& cell )
+{
+	for ( const auto& sTextureName : cell.textures )
+	{
+		ReleaseTexture( sTextureName );
+	}
+}
+
+void LevelStreamer::AcquireTexture( const std::string& sTextureName, const std::string& sCellFile )
+{
+	if ( auto refItr = m_mapTextureRefs.find( sTextureName ); refItr != m_mapTextureRefs.end() )
+	{
+		++refItr->second;
+		return;
+	}
+
+	// Textures that are already resident belong to the asset defs.
+	if ( MAIN_REGISTRY().GetAssetManager().CheckHasAsset( sTextureName, Scion::Utilities::AssetType::TEXTURE ) )
+		return;
+
+	if ( !m_TextureSource || !m_TextureSource( sTextureName ) )
+	{
+		SCION_ERROR( "Failed to stream in texture [{}] for level cell [{}]", sTextureName, sCellFile );
+		return;
+	}
+
+	m_mapTextureRefs.emplace( sTextureName, 1 );
+}
+
+void LevelStreamer::ReleaseTexture( const std::string& sTextureName )
+{
+	auto refItr = m_mapTextureRefs.find( sTextureName );
+	if ( refItr == m_mapTextureRefs.end() )
+		return;
+
+	if ( --refItr->second <= 0 )
+	{
+		MAIN_REGISTRY().GetAssetManager().DeleteAsset( sTextureName, Scion::Utilities::AssetType::TEXTURE );
+		m_mapTextureRefs.erase( refItr );
+	}
+}
+
+void LevelStreamer::CreateLuaLevelStreamerBind( sol::state& lua, Scion::Core::ECS::Registry& registry )
+{
+	auto getStreamer = [ &registry ]() -> LevelStreamer* {
+		if ( auto* pStreamer = registry.TryGetContext<std::shared_ptr<LevelStreamer>>() )
+			return pStreamer->get();
+
+		SCION_ERROR( "Level streamer has not been added to the registry context." );
+		return nullptr;
+	};
+
+	lua.new_usertype<LevelStreamer>(
+		"LevelStreamer",
+		sol::no_constructor,
+		"addFocusPoint",
+		[ = ]( const glm::vec2& position ) {
+			auto* pStreamer = getStreamer();
+			return pStreamer ? pStreamer->AddFocusPoint( position ) : 0U;
+		},
+		"setFocusPoint",
+		[ = ]( std::uint32_t focusID, const glm::vec2& position ) {
+			auto* pStreamer = getStreamer();
+			return pStreamer && pStreamer->SetFocusPoint( focusID, position );
+		},
+		"removeFocusPoint",
+		[ = ]( std::uint32_t focusID ) {
+			auto* pStreamer = getStreamer();
+			return pStreamer && pStreamer->RemoveFocusPoint( focusID );
+		},
+		"getEntity", // Returns the entity for a stream id or nil if its cell is not loaded.
+		[ =, &registry ]( std::uint32_t streamID, sol::this_state s ) -> sol::object {
+			auto* pStreamer = getStreamer();
+			if ( !pStreamer )
+				return sol::lua_nil;
+
+			auto entity = pStreamer->GetEntity( streamID );
+			if ( entity == entt::null || !registry.IsValid( entity ) )
+				return sol::lua_nil;
+
+			return sol::make_object( s, Entity{ &registry, entity } );
+		},
+		"getStreamID",
+		[ = ]( Entity& entity ) {
+			auto* pStreamer = getStreamer();
+			return pStreamer ? pStreamer->GetStreamID( entity.GetEntity() ) : 0U;
+		},
+		"isCellLoaded",
+		[ = ]( int x, int y ) {
+			auto* pStreamer = getStreamer();
+			return pStreamer && pStreamer->IsCellLoaded( x, y );
+		},
+		"worldToCell",
+		[ = ]( const glm::vec2& position ) {
+			auto* pStreamer = getStreamer();
+			return pStreamer ? pStreamer->WorldToCell( position ) : std::make_pair( 0, 0 );
+		},
+		"numLoadedCells",
+		[ = ] {
+			auto* pStreamer = getStreamer();
+			return pStreamer ? pStreamer->NumLoadedCells() : 0;
+		},
+		"setRadius", // Sets the load and unload radius in cells.
+		[ = ]( int loadRadius, int unloadRadius ) {
+			if ( auto* pStreamer = getStreamer() )
+			{
+				pStreamer->GetParams().loadRadius = std::max( 0, loadRadius );
+				pStreamer->GetParams().unloadRadius = std::max( loadRadius, unloadRadius );
+			}
+		},
+		"setBudget", // Sets the maximum cells per frame and the time budget in milliseconds.
+		[ = ]( int maxCellsPerFrame, double frameBudgetMs ) {
+			if ( auto* pStreamer = getStreamer() )
+			{
+				pStreamer->GetParams().maxCellsPerFrame = std::max( 1, maxCellsPerFrame );
+				pStreamer->GetParams().frameBudgetMs = frameBudgetMs;
+			}
+		} );
+}
+
+} // namespace Scion::Core::Loaders
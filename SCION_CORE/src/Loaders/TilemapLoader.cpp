@@ -36,53 +36,58 @@ bool TilemapLoader::SaveTilemapJSON( Scion::Core::ECS::Registry& registry, const
 		return false;
 	}
 
-	pSerializer->StartDocument();
-	pSerializer->StartNewArray( "tilemap" );
+	return SerializeTilemapJSON( registry, *pSerializer );
+}
+
+bool TilemapLoader::SerializeTilemapJSON( Scion::Core::ECS::Registry& registry, JSONSerializer& serializer )
+{
+	serializer.StartDocument();
+	serializer.StartNewArray( "tilemap" );
 
 	auto tiles = registry.GetRegistry().view<TileComponent>();
 
 	for ( auto tile : tiles )
 	{
-		pSerializer->StartNewObject();
-		pSerializer->StartNewObject( "components" );
+		serializer.StartNewObject();
+		serializer.StartNewObject( "components" );
 		auto tileEnt{ Entity{ &registry, tile } };
 
 		const auto& transform = tileEnt.GetComponent<TransformComponent>();
-		SERIALIZE_COMPONENT( *pSerializer, transform );
+		SERIALIZE_COMPONENT( serializer, transform );
 
 		const auto& sprite = tileEnt.GetComponent<SpriteComponent>();
-		SERIALIZE_COMPONENT( *pSerializer, sprite );
+		SERIALIZE_COMPONENT( serializer, sprite );
 
 		if ( tileEnt.HasComponent<BoxColliderComponent>() )
 		{
 			const auto& boxCollider = tileEnt.GetComponent<BoxColliderComponent>();
-			SERIALIZE_COMPONENT( *pSerializer, boxCollider );
+			SERIALIZE_COMPONENT( serializer, boxCollider );
 		}
 
 		if ( tileEnt.HasComponent<CircleColliderComponent>() )
 		{
 			const auto& circleCollider = tileEnt.GetComponent<CircleColliderComponent>();
-			SERIALIZE_COMPONENT( *pSerializer, circleCollider );
+			SERIALIZE_COMPONENT( serializer, circleCollider );
 		}
 
 		if ( tileEnt.HasComponent<AnimationComponent>() )
 		{
 			const auto& animation = tileEnt.GetComponent<AnimationComponent>();
-			SERIALIZE_COMPONENT( *pSerializer, animation );
+			SERIALIZE_COMPONENT( serializer, animation );
 		}
 
 		if ( tileEnt.HasComponent<PhysicsComponent>() )
 		{
 			const auto& physics = tileEnt.GetComponent<PhysicsComponent>();
-			SERIALIZE_COMPONENT( *pSerializer, physics );
+			SERIALIZE_COMPONENT( serializer, physics );
 		}
 
-		pSerializer->EndObject(); // Components object
-		pSerializer->EndObject(); // tile object
+		serializer.EndObject(); // Components object
+		serializer.EndObject(); // tile object
 	}
 
-	pSerializer->EndArray(); // Tilemap array
-	return pSerializer->EndDocument();
+	serializer.EndArray(); // Tilemap array
+	return serializer.EndDocument();
 }
 
 bool TilemapLoader::LoadTilemapJSON( Scion::Core::ECS::Registry& registry, const std::string& sTilemapFile )
@@ -199,119 +204,124 @@ bool TilemapLoader::SaveObjectMapJSON( Scion::Core::ECS::Registry& registry, con
 		return false;
 	}
 
-	pSerializer->StartDocument();
-	pSerializer->StartNewArray( "game_objects" );
+	return SerializeObjectMapJSON( registry, *pSerializer );
+}
+
+bool TilemapLoader::SerializeObjectMapJSON( Scion::Core::ECS::Registry& registry, JSONSerializer& serializer )
+{
+	serializer.StartDocument();
+	serializer.StartNewArray( "game_objects" );
 
 	auto gameObjects = registry.GetRegistry().view<entt::entity>( entt::exclude<TileComponent, UneditableComponent> );
 
 	for ( auto object : gameObjects )
 	{
-		pSerializer->StartNewObject();
-		pSerializer->StartNewObject( "components" );
+		serializer.StartNewObject();
+		serializer.StartNewObject( "components" );
 		auto objectEnt{ Entity{ &registry, object } };
 
 		if ( const auto* id = objectEnt.TryGetComponent<Identification>() )
 		{
-			SERIALIZE_COMPONENT( *pSerializer, *id );
+			SERIALIZE_COMPONENT( serializer, *id );
 		}
 
 		if ( const auto* transform = objectEnt.TryGetComponent<TransformComponent>() )
 		{
-			SERIALIZE_COMPONENT( *pSerializer, *transform );
+			SERIALIZE_COMPONENT( serializer, *transform );
 		}
 
 		if ( const auto* sprite = objectEnt.TryGetComponent<SpriteComponent>() )
 		{
-			SERIALIZE_COMPONENT( *pSerializer, *sprite );
+			SERIALIZE_COMPONENT( serializer, *sprite );
 		}
 
 		if ( objectEnt.HasComponent<BoxColliderComponent>() )
 		{
 			const auto& boxCollider = objectEnt.GetComponent<BoxColliderComponent>();
-			SERIALIZE_COMPONENT( *pSerializer, boxCollider );
+			SERIALIZE_COMPONENT( serializer, boxCollider );
 		}
 
 		if ( objectEnt.HasComponent<CircleColliderComponent>() )
 		{
 			const auto& circleCollider = objectEnt.GetComponent<CircleColliderComponent>();
-			SERIALIZE_COMPONENT( *pSerializer, circleCollider );
+			SERIALIZE_COMPONENT( serializer, circleCollider );
 		}
 
 		if ( objectEnt.HasComponent<AnimationComponent>() )
 		{
 			const auto& animation = objectEnt.GetComponent<AnimationComponent>();
-			SERIALIZE_COMPONENT( *pSerializer, animation );
+			SERIALIZE_COMPONENT( serializer, animation );
 		}
 
 		if ( objectEnt.HasComponent<PhysicsComponent>() )
 		{
 			const auto& physics = objectEnt.GetComponent<PhysicsComponent>();
-			SERIALIZE_COMPONENT( *pSerializer, physics );
+			SERIALIZE_COMPONENT( serializer, physics );
 		}
 
 		if ( objectEnt.HasComponent<TextComponent>() )
 		{
 			const auto& text = objectEnt.GetComponent<TextComponent>();
-			SERIALIZE_COMPONENT( *pSerializer, text );
+			SERIALIZE_COMPONENT( serializer, text );
 		}
 
 		if ( objectEnt.HasComponent<UIComponent>() )
 		{
 			const auto& ui = objectEnt.GetComponent<UIComponent>();
-			SERIALIZE_COMPONENT( *pSerializer, ui );
+			SERIALIZE_COMPONENT( serializer, ui );
 		}
 
 		if ( auto* relations = objectEnt.TryGetComponent<Relationship>() )
 		{
-			pSerializer->StartNewObject( "relationship" );
+			serializer.StartNewObject( "relationship" );
 			if ( relations->parent != entt::null )
 			{
 				Entity parent{ &registry, relations->parent };
-				pSerializer->AddKeyValuePair( "parent", parent.GetName() );
+				serializer.AddKeyValuePair( "parent", parent.GetName() );
 			}
 			else
 			{
-				pSerializer->AddKeyValuePair( "parent", std::string{} );
+				serializer.AddKeyValuePair( "parent", std::string{} );
 			}
 
 			if ( relations->nextSibling != entt::null )
 			{
 				Entity nextSibling{ &registry, relations->nextSibling };
-				pSerializer->AddKeyValuePair( "nextSibling", nextSibling.GetName() );
+				serializer.AddKeyValuePair( "nextSibling", nextSibling.GetName() );
 			}
 			else
 			{
-				pSerializer->AddKeyValuePair( "nextSibling", std::string{} );
+				serializer.AddKeyValuePair( "nextSibling", std::string{} );
 			}
 
 			if ( relations->prevSibling != entt::null )
 			{
 				Entity prevSibling{ &registry, relations->prevSibling };
-				pSerializer->AddKeyValuePair( "prevSibling", prevSibling.GetName() );
+				serializer.AddKeyValuePair( "prevSibling", prevSibling.GetName() );
 			}
 			else
 			{
-				pSerializer->AddKeyValuePair( "prevSibling", std::string{} );
+				serializer.AddKeyValuePair( "prevSibling", std::string{} );
 			}
 
 			if ( relations->firstChild != entt::null )
 			{
 				Entity firstChild{ &registry, relations->firstChild };
-				pSerializer->AddKeyValuePair( "firstChild", firstChild.GetName() );
+				serializer.AddKeyValuePair( "firstChild", firstChild.GetName() );
 			}
 			else
 			{
-				pSerializer->AddKeyValuePair( "firstChild", std::string{} );
+				serializer.AddKeyValuePair( "firstChild", std::string{} );
 			}
-			pSerializer->EndObject(); // Relationship Object
+			serializer.EndObject(); // Relationship Object
 		}
 
-		pSerializer->EndObject(); // Components object
-		pSerializer->EndObject(); // Ent GameObject object
+		serializer.EndObject(); // Components object
+		serializer.EndObject(); // Ent GameObject object
 	}
 
-	pSerializer->EndArray(); // GameObjects array
-	return pSerializer->EndDocument();
+	serializer.EndArray(); // GameObjects array
+	return serializer.EndDocument();
 }
 
 bool TilemapLoader::LoadObjectMapJSON( Scion::Core::ECS::Registry& registry, const std::string& sObjectMapFile )
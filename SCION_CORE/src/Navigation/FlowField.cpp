@@ -0,0 +1,115 @@
+#include "Core/Navigation/FlowField.h"
+
+namespace
+{
+constexpr float SQRT2 = 1.41421356f;
+constexpr std::uint8_t NO_DIRECTION = 0xFF;
+
+constexpr int STEP_X[ 8 ] = { 1, -1, 0, 0, 1, 1, -1, -1 };
+constexpr int STEP_Y[ 8 ] = { 0, 0, 1, -1, 1, -1, 1, -1 };
+
+struct OpenEntry
+{
+	float cost{ 0.f };
+	int cell{ -1 };
+};
+
+struct OpenCompare
+{
+	bool operator()( const OpenEntry& a, const OpenEntry& b ) const { return a.cost > b.cost; }
+};
+} // namespace
+
+namespace Scion::Core::Navigation
+{
+
+bool FlowField::Build( const NavGrid& grid, const glm::ivec2& goal )
+{
+	m_Width = grid.GetWidth();
+	m_Height = grid.GetHeight();
+	m_Goal = goal;
+
+	m_Costs.assign( static_cast<size_t>( grid.GetNumCells() ), -1.f );
+	m_Directions.assign( m_Costs.size(), NO_DIRECTION );
+
+	if ( !grid.IsWalkable( goal.x, goal.y ) )
+		return false;
+
+	// Spread the path costs out from the goal. Steps are symmetric, so the cost from the goal to a
+	// cell is the cost from that cell to the goal.
+	std::vector<OpenEntry> open;
+	const int goalCell = grid.ToIndex( goal.x, goal.y );
+	m_Costs[ goalCell ] = 0.f;
+	open.push_back( OpenEntry{ .cost = 0.f, .cell = goalCell } );
+
+	while ( !open.empty() )
+	{
+		std::ranges::pop_heap( open, OpenCompare{} );
+		const auto [ cost, cell ] = open.back();
+		open.pop_back();
+
+		if ( cost > m_Costs[ cell ] )
+			continue;
+
+		const auto coord = grid.ToCoord( cell );
+		for ( int i = 0; i < 8; ++i )
+		{
+			if ( !grid.CanStep( coord.x, coord.y, STEP_X[ i ], STEP_Y[ i ] ) )
+				continue;
+
+			const int neighbour = grid.ToIndex( coord.x + STEP_X[ i ], coord.y + STEP_Y[ i ] );
+			const float newCost = cost + ( ( STEP_X[ i ] != 0 && STEP_Y[ i ] != 0 ) ? SQRT2 : 1.f );
+
+			if ( m_Costs[ neighbour ] >= 0.f && newCost >= m_Costs[ neighbour ] )
+				continue;
+
+			m_Costs[ neighbour ] = newCost;
+			open.push_back( OpenEntry{ .cost = newCost, .cell = neighbour } );
+			std::ranges::push_heap( open, OpenCompare{} );
+		}
+	}
+
+	// Every reached cell points at the neighbour closest to the goal.
+	for ( int cell = 0; cell < grid.GetNumCells(); ++cell )
+	{
+		if ( cell == goalCell || m_Costs[ cell ] < 0.f )
+			continue;
+
+		const auto coord = grid.ToCoord( cell );
+		float bestCost = m_Costs[ cell ];
+
+		for ( int i = 0; i < 8; ++i )
+		{
+			if ( !grid.CanStep( coord.x, coord.y, STEP_X[ i ], STEP_Y[ i ] ) )
+				continue;
+
+			const float neighbourCost = m_Costs[ grid.ToIndex( coord.x + STEP_X[ i ], coord.y + STEP_Y[ i ] ) ];
+			if ( neighbourCost >= 0.f && neighbourCost < bestCost )
+			{
+				bestCost = neighbourCost;
+				m_Directions[ cell ] = static_cast<std::uint8_t>( i );
+			}
+		}
+	}
+
+	return true;
+}
+
+glm::vec2 FlowField::GetDirection( int x, int y ) const
+{
+	if ( !InBounds( x, y ) )
+		return glm::vec2{ 0.f };
+
+	const auto direction = m_Directions[ y * m_Width + x ];
+	if ( direction == NO_DIRECTION )
+		return glm::vec2{ 0.f };
+
+	return glm::normalize( glm::vec2{ STEP_X[ direction ], STEP_Y[ direction ] } );
+}
+
+float FlowField::GetCost( int x, int y ) const
+{
+	return InBounds( x, y ) ? m_Costs[ y * m_Width + x ] : -1.f;
+}
+
+} // namespace Scion::Core::Navigation
@@ -0,0 +1,517 @@
+#include "Core/Navigation/GridPathfinder.h"
+
+namespace
+{
+using namespace Scion::Core::Navigation;
+
+constexpr float SQRT2 = 1.41421356f;
+
+constexpr int STEP_X[ 8 ] = { 1, -1, 0, 0, 1, 1, -1, -1 };
+constexpr int STEP_Y[ 8 ] = { 0, 0, 1, -1, 1, -1, 1, -1 };
+
+float Octile( int dx, int dy )
+{
+	dx = std::abs( dx );
+	dy = std::abs( dy );
+	return static_cast<float>( std::max( dx, dy ) ) + ( SQRT2 - 1.f ) * static_cast<float>( std::min( dx, dy ) );
+}
+
+struct OpenEntry
+{
+	float f{ 0.f };
+	int cell{ -1 };
+};
+
+struct OpenCompare
+{
+	bool operator()( const OpenEntry& a, const OpenEntry& b ) const { return a.f > b.f; }
+};
+
+/*
+ * The per cell search data, kept per thread so path requests solved on worker threads do not
+ * allocate. Generation stamps mark which cells belong to the current search, so nothing needs clearing.
+ */
+class SearchScratch
+{
+  public:
+	void Begin( int numCells )
+	{
+		const auto size = static_cast<size_t>( numCells );
+		if ( m_Costs.size() < size )
+		{
+			m_Costs.resize( size );
+			m_Parents.resize( size );
+			m_Visited.resize( size, 0 );
+			m_Closed.resize( size, 0 );
+		}
+
+		if ( ++m_Generation == 0 )
+		{
+			std::ranges::fill( m_Visited, 0 );
+			std::ranges::fill( m_Closed, 0 );
+			m_Generation = 1;
+		}
+
+		m_Open.clear();
+	}
+
+	inline bool IsVisited( int cell ) const { return m_Visited[ cell ] == m_Generation; }
+	inline bool IsClosed( int cell ) const { return m_Closed[ cell ] == m_Generation; }
+	inline void Close( int cell ) { m_Closed[ cell ] = m_Generation; }
+	inline float GetCost( int cell ) const { return m_Costs[ cell ]; }
+	inline int GetParent( int cell ) const { return m_Parents[ cell ]; }
+
+	/* @brief Opens the cell if it was not visited yet or the new cost is lower. */
+	void Relax( int cell, int parent, float cost, float heuristic )
+	{
+		if ( IsVisited( cell ) && cost >= m_Costs[ cell ] )
+			return;
+
+		m_Visited[ cell ] = m_Generation;
+		m_Costs[ cell ] = cost;
+		m_Parents[ cell ] = parent;
+
+		m_Open.push_back( OpenEntry{ .f = cost + heuristic, .cell = cell } );
+		std::ranges::push_heap( m_Open, OpenCompare{} );
+	}
+
+	/* @brief Pops the open cell with the lowest cost, or -1 once the open list is empty. */
+	int PopOpen()
+	{
+		while ( !m_Open.empty() )
+		{
+			std::ranges::pop_heap( m_Open, OpenCompare{} );
+			const int cell = m_Open.back().cell;
+			m_Open.pop_back();
+
+			if ( !IsClosed( cell ) )
+			{
+				Close( cell );
+				return cell;
+			}
+		}
+
+		return -1;
+	}
+
+  private:
+	std::vector<float> m_Costs;
+	std::vector<int> m_Parents;
+	std::vector<std::uint32_t> m_Visited;
+	std::vector<std::uint32_t> m_Closed;
+	std::vector<OpenEntry> m_Open;
+	std::uint32_t m_Generation{ 0 };
+};
+
+thread_local SearchScratch s_Scratch;
+
+struct BoundedGrid
+{
+	const NavGrid& grid;
+	const GridBounds& bounds;
+
+	inline bool IsWalkable( int x, int y ) const { return bounds.Contains( x, y ) && grid.IsWalkable( x, y ); }
+};
+
+/*
+ * Moves from the cell in the direction until a jump point is found: the goal, or a cell with a
+ * neighbour that can only be reached optimally through it. Returns the cell index or -1.
+ */
+int Jump( const BoundedGrid& grid, int x, int y, int dx, int dy, const glm::ivec2& goal )
+{
+	while ( true )
+	{
+		if ( !grid.IsWalkable( x, y ) )
+			return -1;
+
+		if ( x == goal.x && y == goal.y )
+			return grid.grid.ToIndex( x, y );
+
+		if ( dx != 0 && dy != 0 )
+		{
+			if ( Jump( grid, x + dx, y, dx, 0, goal ) >= 0 || Jump( grid, x, y + dy, 0, dy, goal ) >= 0 )
+				return grid.grid.ToIndex( x, y );
+
+			// Diagonal steps may not cut corners.
+			if ( !grid.IsWalkable( x + dx, y ) || !grid.IsWalkable( x, y + dy ) )
+				return -1;
+		}
+		else if ( dx != 0 )
+		{
+			if ( ( grid.IsWalkable( x, y - 1 ) && !grid.IsWalkable( x - dx, y - 1 ) ) ||
+				 ( grid.IsWalkable( x, y + 1 ) && !grid.IsWalkable( x - dx, y + 1 ) ) )
+			{
+				return grid.grid.ToIndex( x, y );
+			}
+		}
+		else
+		{
+			if ( ( grid.IsWalkable( x - 1, y ) && !grid.IsWalkable( x - 1, y - dy ) ) ||
+				 ( grid.IsWalkable( x + 1, y ) && !grid.IsWalkable( x + 1, y - dy ) ) )
+			{
+				return grid.grid.ToIndex( x, y );
+			}
+		}
+
+		x += dx;
+		y += dy;
+	}
+}
+
+/* Gets the directions worth searching from the cell, based on the direction it was reached from. */
+int PruneNeighbours( const BoundedGrid& grid, int x, int y, int parent, glm::ivec2 ( &outDirs )[ 8 ] )
+{
+	int count{ 0 };
+	auto add = [ & ]( int dx, int dy ) { outDirs[ count++ ] = glm::ivec2{ dx, dy }; };
+
+	if ( parent < 0 )
+	{
+		for ( int i = 0; i < 8; ++i )
+		{
+			if ( grid.IsWalkable( x + STEP_X[ i ], y + STEP_Y[ i ] ) )
+				add( STEP_X[ i ], STEP_Y[ i ] );
+		}
+
+		return count;
+	}
+
+	const auto parentCoord = grid.grid.ToCoord( parent );
+	const int dx = glm::sign( x - parentCoord.x );
+	const int dy = glm::sign( y - parentCoord.y );
+
+	if ( dx != 0 && dy != 0 )
+	{
+		const bool bVertical = grid.IsWalkable( x, y + dy );
+		const bool bHorizontal = grid.IsWalkable( x + dx, y );
+
+		if ( bVertical )
+			add( 0, dy );
+		if ( bHorizontal )
+			add( dx, 0 );
+		if ( bVertical && bHorizontal )
+			add( dx, dy );
+	}
+	else if ( dx != 0 )
+	{
+		const bool bNext = grid.IsWalkable( x + dx, y );
+		const bool bUp = grid.IsWalkable( x, y - 1 );
+		const bool bDown = grid.IsWalkable( x, y + 1 );
+
+		if ( bNext )
+		{
+			add( dx, 0 );
+			if ( bUp )
+				add( dx, -1 );
+			if ( bDown )
+				add( dx, 1 );
+		}
+
+		if ( bUp )
+			add( 0, -1 );
+		if ( bDown )
+			add( 0, 1 );
+	}
+	else
+	{
+		const bool bNext = grid.IsWalkable( x, y + dy );
+		const bool bLeft = grid.IsWalkable( x - 1, y );
+		const bool bRight = grid.IsWalkable( x + 1, y );
+
+		if ( bNext )
+		{
+			add( 0, dy );
+			if ( bLeft )
+				add( -1, dy );
+			if ( bRight )
+				add( 1, dy );
+		}
+
+		if ( bLeft )
+			add( -1, 0 );
+		if ( bRight )
+			add( 1, 0 );
+	}
+
+	return count;
+}
+
+GridBounds Union( const GridBounds& a, const GridBounds& b )
+{
+	return GridBounds{ .minX = std::min( a.minX, b.minX ),
+					   .minY = std::min( a.minY, b.minY ),
+					   .maxX = std::max( a.maxX, b.maxX ),
+					   .maxY = std::max( a.maxY, b.maxY ) };
+}
+
+} // namespace
+
+namespace Scion::Core::Navigation
+{
+
+bool FindPathJPS( const NavGrid& grid, const glm::ivec2& start, const glm::ivec2& goal, const GridBounds& bounds,
+				  std::vector<glm::ivec2>& outPath, float* pOutCost )
+{
+	outPath.clear();
+
+	const BoundedGrid boundedGrid{ grid, bounds };
+	if ( !boundedGrid.IsWalkable( start.x, start.y ) || !boundedGrid.IsWalkable( goal.x, goal.y ) )
+		return false;
+
+	if ( start == goal )
+	{
+		outPath.push_back( start );
+		if ( pOutCost )
+			*pOutCost = 0.f;
+
+		return true;
+	}
+
+	const int startCell = grid.ToIndex( start.x, start.y );
+	const int goalCell = grid.ToIndex( goal.x, goal.y );
+
+	auto& scratch = s_Scratch;
+	scratch.Begin( grid.GetNumCells() );
+	scratch.Relax( startCell, -1, 0.f, Octile( goal.x - start.x, goal.y - start.y ) );
+
+	glm::ivec2 dirs[ 8 ];
+
+	for ( int cell = scratch.PopOpen(); cell >= 0; cell = scratch.PopOpen() )
+	{
+		if ( cell == goalCell )
+		{
+			for ( int current = goalCell; current >= 0; current = scratch.GetParent( current ) )
+			{
+				outPath.push_back( grid.ToCoord( current ) );
+			}
+
+			std::ranges::reverse( outPath );
+
+			if ( pOutCost )
+				*pOutCost = scratch.GetCost( goalCell );
+
+			return true;
+		}
+
+		const auto coord = grid.ToCoord( cell );
+		const int parent = cell == startCell ? -1 : scratch.GetParent( cell );
+		const int numDirs = PruneNeighbours( boundedGrid, coord.x, coord.y, parent, dirs );
+
+		for ( int i = 0; i < numDirs; ++i )
+		{
+			const auto& dir = dirs[ i ];
+
+			// The first diagonal step may not cut corners either.
+			if ( dir.x != 0 && dir.y != 0 &&
+				 ( !boundedGrid.IsWalkable( coord.x + dir.x, coord.y ) ||
+				   !boundedGrid.IsWalkable( coord.x, coord.y + dir.y ) ) )
+			{
+				continue;
+			}
+
+			const int jumpPoint = Jump( boundedGrid, coord.x + dir.x, coord.y + dir.y, dir.x, dir.y, goal );
+			if ( jumpPoint < 0 || scratch.IsClosed( jumpPoint ) )
+				continue;
+
+			const auto jumpCoord = grid.ToCoord( jumpPoint );
+			const float cost = scratch.GetCost( cell ) + Octile( jumpCoord.x - coord.x, jumpCoord.y - coord.y );
+
+			scratch.Relax( jumpPoint, cell, cost, Octile( goal.x - jumpCoord.x, goal.y - jumpCoord.y ) );
+		}
+	}
+
+	return false;
+}
+
+void GetPathCosts( const NavGrid& grid, int startCell, const GridBounds& bounds, std::span<const int> targets,
+				   std::vector<float>& outCosts )
+{
+	outCosts.assign( targets.size(), -1.f );
+
+	const auto start = grid.ToCoord( startCell );
+	if ( !bounds.Contains( start.x, start.y ) || !grid.IsWalkable( start.x, start.y ) )
+		return;
+
+	auto& scratch = s_Scratch;
+	scratch.Begin( grid.GetNumCells() );
+	scratch.Relax( startCell, -1, 0.f, 0.f );
+
+	size_t numFound{ 0 };
+
+	for ( int cell = scratch.PopOpen(); cell >= 0 && numFound < targets.size(); cell = scratch.PopOpen() )
+	{
+		for ( size_t i = 0; i < targets.size(); ++i )
+		{
+			if ( targets[ i ] == cell )
+			{
+				outCosts[ i ] = scratch.GetCost( cell );
+				++numFound;
+			}
+		}
+
+		const auto coord = grid.ToCoord( cell );
+		for ( int i = 0; i < 8; ++i )
+		{
+			const int x = coord.x + STEP_X[ i ];
+			const int y = coord.y + STEP_Y[ i ];
+
+			if ( !bounds.Contains( x, y ) || !grid.CanStep( coord.x, coord.y, STEP_X[ i ], STEP_Y[ i ] ) )
+				continue;
+
+			const float step = ( STEP_X[ i ] != 0 && STEP_Y[ i ] != 0 ) ? SQRT2 : 1.f;
+			scratch.Relax( grid.ToIndex( x, y ), cell, scratch.GetCost( cell ) + step, 0.f );
+		}
+	}
+}
+
+bool FindPath( const NavGrid& grid, const glm::ivec2& start, const glm::ivec2& goal, std::vector<glm::ivec2>& outPath )
+{
+	outPath.clear();
+
+	if ( !grid.IsWalkable( start.x, start.y ) || !grid.IsWalkable( goal.x, goal.y ) )
+		return false;
+
+	if ( grid.GetNumClusters() <= 1 )
+		return FindPathJPS( grid, start, goal, grid.GetBounds(), outPath );
+
+	const int startCluster = grid.GetClusterIndex( start.x, start.y );
+	const int goalCluster = grid.GetClusterIndex( goal.x, goal.y );
+
+	// Paths that stay inside one cluster do not need the abstract graph.
+	if ( startCluster == goalCluster &&
+		 FindPathJPS( grid, start, goal, grid.GetClusterBounds( startCluster ), outPath ) )
+	{
+		return true;
+	}
+
+	const int startCell = grid.ToIndex( start.x, start.y );
+	const int goalCell = grid.ToIndex( goal.x, goal.y );
+
+	// Connect the start and goal to the entrances of their clusters.
+	const auto& startNodes = grid.GetClusterNodes( startCluster );
+	const auto& goalNodes = grid.GetClusterNodes( goalCluster );
+
+	std::vector<int> targets;
+	std::vector<float> startCosts;
+	std::vector<float> goalCosts;
+
+	for ( const auto& node : startNodes )
+		targets.push_back( node.cell );
+	GetPathCosts( grid, startCell, grid.GetClusterBounds( startCluster ), targets, startCosts );
+
+	targets.clear();
+	for ( const auto& node : goalNodes )
+		targets.push_back( node.cell );
+	GetPathCosts( grid, goalCell, grid.GetClusterBounds( goalCluster ), targets, goalCosts );
+
+	// The abstract graph is small, so its search data is kept in maps keyed by the cell index.
+	struct AbstractSearchNode
+	{
+		float cost{ 0.f };
+		int parent{ -1 };
+		bool bClosed{ false };
+	};
+
+	std::unordered_map<int, AbstractSearchNode> searchNodes;
+	std::vector<OpenEntry> open;
+
+	auto relax = [ & ]( int from, int to, float stepCost ) {
+		const float cost = ( from < 0 ? 0.f : searchNodes[ from ].cost ) + stepCost;
+		auto [ itr, bInserted ] = searchNodes.try_emplace( to, AbstractSearchNode{ .cost = cost, .parent = from } );
+		if ( !bInserted )
+		{
+			if ( itr->second.bClosed || cost >= itr->second.cost )
+				return;
+
+			itr->second.cost = cost;
+			itr->second.parent = from;
+		}
+
+		const auto coord = grid.ToCoord( to );
+		open.push_back( OpenEntry{ .f = cost + Octile( goal.x - coord.x, goal.y - coord.y ), .cell = to } );
+		std::ranges::push_heap( open, OpenCompare{} );
+	};
+
+	relax( -1, startCell, 0.f );
+
+	bool bFound{ false };
+	while ( !open.empty() )
+	{
+		std::ranges::pop_heap( open, OpenCompare{} );
+		const int cell = open.back().cell;
+		open.pop_back();
+
+		auto& searchNode = searchNodes[ cell ];
+		if ( searchNode.bClosed )
+			continue;
+
+		searchNode.bClosed = true;
+
+		if ( cell == goalCell )
+		{
+			bFound = true;
+			break;
+		}
+
+		if ( cell == startCell )
+		{
+			for ( size_t i = 0; i < startNodes.size(); ++i )
+			{
+				if ( startCosts[ i ] >= 0.f )
+					relax( cell, startNodes[ i ].cell, startCosts[ i ] );
+			}
+		}
+
+		if ( const auto* pNode = grid.FindNode( cell ) )
+		{
+			for ( const auto& edge : pNode->edges )
+			{
+				relax( cell, edge.targetCell, edge.cost );
+			}
+		}
+
+		const auto coord = grid.ToCoord( cell );
+		if ( grid.GetClusterIndex( coord.x, coord.y ) == goalCluster )
+		{
+			for ( size_t i = 0; i < goalNodes.size(); ++i )
+			{
+				if ( goalNodes[ i ].cell == cell && goalCosts[ i ] >= 0.f )
+					relax( cell, goalCell, goalCosts[ i ] );
+			}
+		}
+	}
+
+	if ( !bFound )
+		return false;
+
+	std::vector<int> abstractPath;
+	for ( int cell = goalCell; cell >= 0; cell = searchNodes[ cell ].parent )
+	{
+		abstractPath.push_back( cell );
+	}
+
+	std::ranges::reverse( abstractPath );
+
+	// Refine every step of the abstract path inside the clusters it connects.
+	std::vector<glm::ivec2> segment;
+	for ( size_t i = 1; i < abstractPath.size(); ++i )
+	{
+		const auto from = grid.ToCoord( abstractPath[ i - 1 ] );
+		const auto to = grid.ToCoord( abstractPath[ i ] );
+
+		const auto bounds = Union( grid.GetClusterBounds( grid.GetClusterIndex( from.x, from.y ) ),
+								   grid.GetClusterBounds( grid.GetClusterIndex( to.x, to.y ) ) );
+
+		if ( !FindPathJPS( grid, from, to, bounds, segment ) )
+		{
+			outPath.clear();
+			return false;
+		}
+
+		const size_t first = outPath.empty() ? 0 : 1;
+		outPath.insert( outPath.end(), segment.begin() + first, segment.end() );
+	}
+
+	return true;
+}
+
+} // namespace Scion::Core::Navigation
@@ -0,0 +1,281 @@
+#include "Core/Navigation/NavGrid.h"
+#include "Core/Navigation/GridPathfinder.h"
+
+namespace
+{
+/* Entrances longer than this get a transition at both ends instead of one in the middle. */
+constexpr int LONG_ENTRANCE = 6;
+} // namespace
+
+namespace Scion::Core::Navigation
+{
+
+NavGrid::NavGrid( int width, int height, int clusterSize )
+	: m_Width{ std::max( width, 1 ) }
+	, m_Height{ std::max( height, 1 ) }
+	, m_ClusterSize{ std::max( clusterSize, 2 ) }
+	, m_NumClustersX{ ( m_Width + m_ClusterSize - 1 ) / m_ClusterSize }
+	, m_NumClustersY{ ( m_Height + m_ClusterSize - 1 ) / m_ClusterSize }
+	, m_Cells( static_cast<size_t>( m_Width ) * m_Height, 0 )
+	, m_ClusterNodes( static_cast<size_t>( m_NumClustersX ) * m_NumClustersY )
+	, m_ClusterDirty( m_ClusterNodes.size(), 0 )
+{
+}
+
+bool NavGrid::CanStep( int x, int y, int dx, int dy ) const
+{
+	if ( !IsWalkable( x + dx, y + dy ) )
+		return false;
+
+	if ( dx != 0 && dy != 0 )
+		return IsWalkable( x + dx, y ) && IsWalkable( x, y + dy );
+
+	return true;
+}
+
+void NavGrid::SetBlocked( int x, int y, bool bBlocked )
+{
+	if ( !InBounds( x, y ) )
+		return;
+
+	auto& cell = m_Cells[ ToIndex( x, y ) ];
+	const std::uint8_t value = bBlocked ? 1 : 0;
+	if ( cell == value )
+		return;
+
+	cell = value;
+	MarkClusterDirty( GetClusterIndex( x, y ) );
+}
+
+void NavGrid::RebuildDirtyClusters()
+{
+	if ( m_DirtyClusters.empty() )
+		return;
+
+	// The entrances of a cluster are shared with its neighbours, so they are rebuilt as well.
+	std::vector<std::uint8_t> affected( m_ClusterNodes.size(), 0 );
+	std::vector<int> affectedClusters;
+	affectedClusters.reserve( m_DirtyClusters.size() * 5 );
+
+	auto addAffected = [ & ]( int cx, int cy ) {
+		if ( cx < 0 || cy < 0 || cx >= m_NumClustersX || cy >= m_NumClustersY )
+			return;
+
+		const int cluster = cy * m_NumClustersX + cx;
+		if ( affected[ cluster ] )
+			return;
+
+		affected[ cluster ] = 1;
+		affectedClusters.push_back( cluster );
+	};
+
+	for ( int cluster : m_DirtyClusters )
+	{
+		const int cx = cluster % m_NumClustersX;
+		const int cy = cluster / m_NumClustersX;
+
+		addAffected( cx, cy );
+		addAffected( cx - 1, cy );
+		addAffected( cx + 1, cy );
+		addAffected( cx, cy - 1 );
+		addAffected( cx, cy + 1 );
+
+		m_ClusterDirty[ cluster ] = 0;
+	}
+
+	m_DirtyClusters.clear();
+
+	for ( int cluster : affectedClusters )
+	{
+		m_ClusterNodes[ cluster ].clear();
+	}
+
+	// Borders with unaffected clusters are found again as well. Their nodes on the other side are
+	// placed the same way every time, so those clusters keep their nodes and intra edges.
+	for ( int cluster : affectedClusters )
+	{
+		const int cx = cluster % m_NumClustersX;
+		const int cy = cluster / m_NumClustersX;
+
+		if ( cx + 1 < m_NumClustersX )
+			BuildBorder( cluster, cluster + 1, true );
+
+		if ( cy + 1 < m_NumClustersY )
+			BuildBorder( cluster, cluster + m_NumClustersX, false );
+
+		if ( cx > 0 && !affected[ cluster - 1 ] )
+			BuildBorder( cluster - 1, cluster, true );
+
+		if ( cy > 0 && !affected[ cluster - m_NumClustersX ] )
+			BuildBorder( cluster - m_NumClustersX, cluster, false );
+	}
+
+	for ( int cluster : affectedClusters )
+	{
+		BuildIntraEdges( cluster );
+	}
+}
+
+void NavGrid::RebuildAllClusters()
+{
+	for ( int cluster = 0; cluster < GetNumClusters(); ++cluster )
+	{
+		MarkClusterDirty( cluster );
+	}
+
+	RebuildDirtyClusters();
+}
+
+int NavGrid::GetClusterIndex( int x, int y ) const
+{
+	return ( y / m_ClusterSize ) * m_NumClustersX + ( x / m_ClusterSize );
+}
+
+GridBounds NavGrid::GetClusterBounds( int cluster ) const
+{
+	const int minX = ( cluster % m_NumClustersX ) * m_ClusterSize;
+	const int minY = ( cluster / m_NumClustersX ) * m_ClusterSize;
+
+	return GridBounds{ .minX = minX,
+					   .minY = minY,
+					   .maxX = std::min( minX + m_ClusterSize, m_Width ) - 1,
+					   .maxY = std::min( minY + m_ClusterSize, m_Height ) - 1 };
+}
+
+const NavGrid::AbstractNode* NavGrid::FindNode( int cell ) const
+{
+	const auto coord = ToCoord( cell );
+	for ( const auto& node : m_ClusterNodes[ GetClusterIndex( coord.x, coord.y ) ] )
+	{
+		if ( node.cell == cell )
+			return &node;
+	}
+
+	return nullptr;
+}
+
+void NavGrid::MarkClusterDirty( int cluster )
+{
+	if ( m_ClusterDirty[ cluster ] )
+		return;
+
+	m_ClusterDirty[ cluster ] = 1;
+	m_DirtyClusters.push_back( cluster );
+}
+
+void NavGrid::BuildBorder( int cluster, int neighbour, bool bVertical )
+{
+	const auto bounds = GetClusterBounds( cluster );
+
+	// Walk along the border and add a transition for every run of cells open on both sides.
+	const int first = bVertical ? bounds.minY : bounds.minX;
+	const int last = bVertical ? bounds.maxY : bounds.maxX;
+
+	auto cellsAt = [ & ]( int i ) {
+		return bVertical ? std::pair{ glm::ivec2{ bounds.maxX, i }, glm::ivec2{ bounds.maxX + 1, i } }
+						 : std::pair{ glm::ivec2{ i, bounds.maxY }, glm::ivec2{ i, bounds.maxY + 1 } };
+	};
+
+	auto addEntrance = [ & ]( int start, int end ) {
+		const int length = end - start + 1;
+		auto addAt = [ & ]( int i ) {
+			const auto [ a, b ] = cellsAt( i );
+			AddTransition( ToIndex( a.x, a.y ), ToIndex( b.x, b.y ) );
+		};
+
+		if ( length < LONG_ENTRANCE )
+		{
+			addAt( start + length / 2 );
+		}
+		else
+		{
+			addAt( start );
+			addAt( end );
+		}
+	};
+
+	int runStart{ -1 };
+	for ( int i = first; i <= last + 1; ++i )
+	{
+		bool bOpen{ false };
+		if ( i <= last )
+		{
+			const auto [ a, b ] = cellsAt( i );
+			bOpen = IsWalkable( a.x, a.y ) && IsWalkable( b.x, b.y );
+		}
+
+		if ( bOpen && runStart < 0 )
+		{
+			runStart = i;
+		}
+		else if ( !bOpen && runStart >= 0 )
+		{
+			addEntrance( runStart, i - 1 );
+			runStart = -1;
+		}
+	}
+}
+
+void NavGrid::AddTransition( int cellA, int cellB )
+{
+	auto addEdge = []( AbstractNode& node, int target ) {
+		for ( const auto& edge : node.edges )
+		{
+			if ( edge.targetCell == target && !edge.bIntra )
+				return;
+		}
+
+		node.edges.push_back( AbstractEdge{ .targetCell = target, .cost = 1.f, .bIntra = false } );
+	};
+
+	// The nodes are in different clusters, so adding one does not move the other.
+	auto& nodeA = GetOrAddNode( cellA );
+	auto& nodeB = GetOrAddNode( cellB );
+
+	addEdge( nodeA, cellB );
+	addEdge( nodeB, cellA );
+}
+
+NavGrid::AbstractNode& NavGrid::GetOrAddNode( int cell )
+{
+	const auto coord = ToCoord( cell );
+	auto& nodes = m_ClusterNodes[ GetClusterIndex( coord.x, coord.y ) ];
+
+	for ( auto& node : nodes )
+	{
+		if ( node.cell == cell )
+			return node;
+	}
+
+	return nodes.emplace_back( AbstractNode{ .cell = cell } );
+}
+
+void NavGrid::BuildIntraEdges( int cluster )
+{
+	auto& nodes = m_ClusterNodes[ cluster ];
+	const auto bounds = GetClusterBounds( cluster );
+
+	std::vector<int> targets;
+	targets.reserve( nodes.size() );
+	for ( auto& node : nodes )
+	{
+		std::erase_if( node.edges, []( const AbstractEdge& edge ) { return edge.bIntra; } );
+		targets.push_back( node.cell );
+	}
+
+	std::vector<float> costs;
+	for ( size_t i = 0; i < nodes.size(); ++i )
+	{
+		GetPathCosts( *this, nodes[ i ].cell, bounds, targets, costs );
+
+		for ( size_t j = 0; j < nodes.size(); ++j )
+		{
+			if ( i == j || costs[ j ] < 0.f )
+				continue;
+
+			nodes[ i ].edges.push_back( AbstractEdge{ .targetCell = nodes[ j ].cell, .cost = costs[ j ], .bIntra = true } );
+		}
+	}
+}
+
+} // namespace Scion::Core::Navigation
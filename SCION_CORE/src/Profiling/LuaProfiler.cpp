@@ -0,0 +1,268 @@
+#include "Core/Profiling/LuaProfiler.h"
+#include "Core/Profiling/ProfileCollector.h"
+#include "Logger/Logger.h"
+
+#ifdef TRACY_ENABLE
+#include <tracy/TracyLua.hpp>
+#endif
+
+namespace
+{
+/* Tokens of the open profile_begin zones, innermost last. */
+std::vector<int> s_OpenZones;
+
+/* Lua zones are drawn under the engine systems and sub-systems in the profiler. */
+constexpr int LUA_ZONE_DEPTH = 2;
+
+int LuaProfileBegin( lua_State* L )
+{
+	const char* sName = luaL_checkstring( L, 1 );
+	s_OpenZones.push_back( PROFILE_COLLECTOR().BeginZone( sName, LUA_ZONE_DEPTH ) );
+
+#ifdef TRACY_ENABLE
+	return tracy::detail::LuaZoneBeginN( L );
+#else
+	return 0;
+#endif
+}
+
+int LuaProfileEnd( lua_State* L )
+{
+	if ( s_OpenZones.empty() )
+		return luaL_error( L, "profile_end() was called without a matching profile_begin()." );
+
+	PROFILE_COLLECTOR().EndZone( s_OpenZones.back() );
+	s_OpenZones.pop_back();
+
+#ifdef TRACY_ENABLE
+	return tracy::detail::LuaZoneEnd( L );
+#else
+	return 0;
+#endif
+}
+
+void WriteFoldedStacks( const std::vector<Scion::Core::LuaProfileNode>& nodes, int node, const std::string& sPath,
+						std::string& sOut )
+{
+	const auto& current = nodes[ node ];
+	const std::string sNodePath =
+		sPath.empty() ? current.sName : fmt::format( "{};{} ({}:{})", sPath, current.sName, current.sSource, current.lineDefined );
+
+	if ( current.selfSamples > 0 && node != 0 )
+	{
+		sOut += fmt::format( "{} {}\n", sNodePath, current.selfSamples );
+	}
+
+	for ( int child : current.children )
+	{
+		WriteFoldedStacks( nodes, child, sNodePath, sOut );
+	}
+}
+} // namespace
+
+namespace Scion::Core
+{
+
+LuaProfiler::LuaProfiler()
+{
+	Reset();
+	m_Stack.reserve( MAX_STACK_DEPTH );
+	m_DebugInfo.resize( MAX_STACK_DEPTH );
+}
+
+void LuaProfiler::Attach( lua_State* L )
+{
+	Detach();
+	m_pLuaState = L;
+
+	if ( m_bEnabled )
+		InstallHook();
+}
+
+void LuaProfiler::Detach()
+{
+	if ( m_pLuaState )
+	{
+		lua_sethook( m_pLuaState, nullptr, 0, 0 );
+	}
+
+	CloseOpenZones( m_pLuaState );
+	m_pLuaState = nullptr;
+}
+
+void LuaProfiler::SetEnabled( bool bEnabled )
+{
+	m_bEnabled = bEnabled;
+	if ( !m_pLuaState )
+		return;
+
+	if ( m_bEnabled )
+	{
+		InstallHook();
+	}
+	else
+	{
+		lua_sethook( m_pLuaState, nullptr, 0, 0 );
+	}
+}
+
+void LuaProfiler::SetSampleInterval( int microseconds )
+{
+	m_SampleInterval = std::chrono::microseconds{ std::max( microseconds, 1 ) };
+}
+
+void LuaProfiler::Reset()
+{
+	m_Nodes.clear();
+	m_Nodes.push_back( LuaProfileNode{ .sName = "lua" } );
+}
+
+std::vector<LuaHotLine> LuaProfiler::GetHotLines( int maxLines ) const
+{
+	std::map<std::pair<std::string, int>, std::uint64_t> lines;
+	for ( const auto& node : m_Nodes )
+	{
+		for ( const auto& [ line, samples ] : node.lineSamples )
+		{
+			lines[ { node.sSource, line } ] += samples;
+		}
+	}
+
+	std::vector<LuaHotLine> hotLines;
+	hotLines.reserve( lines.size() );
+	for ( const auto& [ key, samples ] : lines )
+	{
+		hotLines.push_back( LuaHotLine{ .sSource = key.first, .line = key.second, .samples = samples } );
+	}
+
+	std::ranges::sort( hotLines, std::greater{}, &LuaHotLine::samples );
+	if ( hotLines.size() > static_cast<size_t>( maxLines ) )
+		hotLines.resize( maxLines );
+
+	return hotLines;
+}
+
+std::string LuaProfiler::ToFoldedStacks() const
+{
+	std::string sFolded;
+	WriteFoldedStacks( m_Nodes, 0, "", sFolded );
+	return sFolded;
+}
+
+void LuaProfiler::CreateLuaProfilerBind( sol::state& lua )
+{
+	lua.set_function( "profile_begin", &LuaProfileBegin );
+	lua.set_function( "profile_end", &LuaProfileEnd );
+}
+
+void LuaProfiler::CloseOpenZones( lua_State* L )
+{
+	while ( !s_OpenZones.empty() )
+	{
+		PROFILE_COLLECTOR().EndZone( s_OpenZones.back() );
+		s_OpenZones.pop_back();
+
+#ifdef TRACY_ENABLE
+		if ( L )
+			tracy::detail::LuaZoneEnd( L );
+#endif
+	}
+}
+
+void LuaProfiler::Hook( lua_State* L, lua_Debug* ar )
+{
+	auto& profiler = GetInstance();
+
+	// Threads made while the hook was installed keep it after the profiler is disabled.
+	if ( !profiler.m_bEnabled )
+		return;
+
+	const auto now = std::chrono::steady_clock::now();
+	if ( now - profiler.m_LastSample < profiler.m_SampleInterval )
+		return;
+
+	profiler.m_LastSample = now;
+	profiler.TakeSample( L );
+}
+
+void LuaProfiler::TakeSample( lua_State* L )
+{
+	m_Stack.clear();
+	for ( int level = 0; level < MAX_STACK_DEPTH; ++level )
+	{
+		auto& info = m_DebugInfo[ level ];
+		if ( !lua_getstack( L, level, &info ) )
+			break;
+
+		lua_getinfo( L, "Sln", &info );
+		m_Stack.push_back( StackFrame{ .sName = info.name ? info.name : ( *info.what == 'm' ? "main chunk" : "?" ),
+									   .sSource = info.short_src,
+									   .lineDefined = info.linedefined,
+									   .currentLine = info.currentline } );
+	}
+
+	if ( m_Stack.empty() )
+		return;
+
+	int node{ 0 };
+	++m_Nodes[ node ].samples;
+
+	for ( auto itr = m_Stack.rbegin(); itr != m_Stack.rend(); ++itr )
+	{
+		node = GetChild( node, *itr );
+		++m_Nodes[ node ].samples;
+	}
+
+	++m_Nodes[ node ].selfSamples;
+
+	// A C function has no current line, the line belongs to the lua function that called it.
+	size_t frame{ 0 };
+	while ( frame < m_Stack.size() && m_Stack[ frame ].currentLine < 0 )
+	{
+		node = m_Nodes[ node ].parent;
+		++frame;
+	}
+
+	if ( frame == m_Stack.size() )
+		return;
+
+	const int currentLine = m_Stack[ frame ].currentLine;
+	auto& lineSamples = m_Nodes[ node ].lineSamples;
+	auto lineItr = std::ranges::find( lineSamples, currentLine, &std::pair<int, std::uint64_t>::first );
+	if ( lineItr != lineSamples.end() )
+	{
+		++lineItr->second;
+	}
+	else
+	{
+		lineSamples.emplace_back( currentLine, 1 );
+	}
+}
+
+int LuaProfiler::GetChild( int node, const StackFrame& frame )
+{
+	for ( int child : m_Nodes[ node ].children )
+	{
+		const auto& childNode = m_Nodes[ child ];
+		if ( childNode.lineDefined == frame.lineDefined && childNode.sSource == frame.sSource &&
+			 childNode.sName == frame.sName )
+		{
+			return child;
+		}
+	}
+
+	const int child = static_cast<int>( m_Nodes.size() );
+	m_Nodes.push_back( LuaProfileNode{
+		.sName = frame.sName, .sSource = frame.sSource, .lineDefined = frame.lineDefined, .parent = node } );
+	m_Nodes[ node ].children.push_back( child );
+
+	return child;
+}
+
+void LuaProfiler::InstallHook()
+{
+	m_LastSample = std::chrono::steady_clock::now();
+	lua_sethook( m_pLuaState, &LuaProfiler::Hook, LUA_MASKCOUNT, CHECK_INSTRUCTIONS );
+}
+
+} // namespace Scion::Core
@@ -53,6 +53,18 @@ void ProfileCollector::EndZone( int token )
 	m_CurrentFrame.samples.push_back( { pz.name.empty() ? "?" : pz.name, ms, pz.depth } );
 }
 
+void ProfileCollector::SetCounter( const std::string& name, double value )
+{
+	auto itr = std::ranges::find( m_CurrentFrame.counters, name, &ProfileCounter::name );
+	if ( itr != m_CurrentFrame.counters.end() )
+	{
+		itr->value = value;
+		return;
+	}
+
+	m_CurrentFrame.counters.push_back( { name, value } );
+}
+
 std::vector<ZoneStat> ProfileCollector::ComputeStats( int frameWindow ) const
 {
 	std::unordered_map<std::string, std::vector<float>> buckets;
@@ -98,4 +110,47 @@ std::vector<ZoneStat> ProfileCollector::ComputeStats( int frameWindow ) const
 	return stats;
 }
 
+std::vector<CounterStat> ProfileCollector::ComputeCounterStats( int frameWindow ) const
+{
+	std::vector<CounterStat> stats;
+	std::unordered_map<std::string, int> counts;
+
+	int count = std::min( frameWindow, m_FrameCount );
+	int start = m_CurrentIndex;
+
+	for ( int i = 0; i < count; ++i )
+	{
+		int idx = ( start - i + PROFILE_HISTORY_SIZE ) % PROFILE_HISTORY_SIZE;
+		for ( const auto& counter : m_History[ idx ].counters )
+		{
+			auto itr = std::ranges::find( stats, counter.name, &CounterStat::name );
+			if ( itr == stats.end() )
+			{
+				// The newest frame comes first, so the first value seen is the last value.
+				stats.push_back( CounterStat{ .name = counter.name,
+											  .avg = counter.value,
+											  .min = counter.value,
+											  .max = counter.value,
+											  .last = counter.value } );
+				counts[ counter.name ] = 1;
+				continue;
+			}
+
+			itr->avg += counter.value;
+			itr->min = std::min( itr->min, counter.value );
+			itr->max = std::max( itr->max, counter.value );
+			++counts[ counter.name ];
+		}
+	}
+
+	for ( auto& stat : stats )
+	{
+		stat.avg /= static_cast<double>( counts[ stat.name ] );
+	}
+
+	std::ranges::sort( stats, {}, &CounterStat::name );
+
+	return stats;
+}
+
 } // namespace Scion::Core
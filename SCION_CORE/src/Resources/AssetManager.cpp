@@ -16,6 +16,8 @@
 
 #include <ScionUtilities/ScionUtilities.h>
 #include <ScionUtilities/SDL_Wrappers.h>
+#include <ScionUtilities/HelperUtilities.h>
+#include <ScionFilesystem/Utilities/DirectoryWatcher.h>
 #include <Logger/Logger.h>
 #include <SDL3_image/SDL_image.h>
 
@@ -24,14 +26,20 @@ using namespace std::chrono_literals;
 
 namespace SCION_RESOURCES
 {
+namespace
+{
+/* Watched files are compared by their absolute path, since assets can be added with relative paths. */
+std::string NormalizeWatchPath( const fs::path& path )
+{
+	std::error_code ec;
+	auto absolutePath = fs::absolute( path, ec );
+	return ( ec ? path : absolutePath ).lexically_normal().string();
+}
+} // namespace
+
 AssetManager::AssetManager( bool bEnableFilewatcher )
 	: m_bFileWatcherRunning{ bEnableFilewatcher }
 {
-	if ( bEnableFilewatcher )
-	{
-		m_WatchThread = std::jthread( &AssetManager::FileWatcher, this );
-	}
-
 #ifdef IN_SCION_EDITOR
 	m_mapCursors.emplace( "default", MakeSharedFromSDLType<Cursor>( SDL_GetDefaultCursor() ) );
 #endif
@@ -40,10 +48,8 @@ AssetManager::AssetManager( bool bEnableFilewatcher )
 AssetManager::~AssetManager()
 {
 	m_bFileWatcherRunning = false;
-	if ( m_WatchThread.joinable() )
-	{
-		m_WatchThread.join();
-	}
+	// Stop the watcher threads before the pending changes they write to are destroyed.
+	m_mapDirectoryWatchers.clear();
 }
 
 bool AssetManager::CreateDefaultFonts()
@@ -86,22 +92,29 @@ bool AssetManager::AddTexture( const std::string& textureName, const std::string
 		return false;
 	}
 
-	auto [ itr, bSuccess ] = m_mapTextures.emplace( textureName, std::move( pTexture ) );
+	return AddTexture( textureName, std::move( pTexture ) );
+}
 
-	if ( m_bFileWatcherRunning && bSuccess )
+bool AssetManager::AddTexture( const std::string& textureName, std::unique_ptr<Scion::Rendering::Texture> pTexture )
+{
+	if ( !pTexture )
 	{
-		std::lock_guard lock{ m_AssetMutex };
+		SCION_ERROR( "Failed to add texture [{0}] -- Texture is invalid!", textureName );
+		return false;
+	}
 
-		fs::path path{ texturePath };
-		auto lastWrite = fs::last_write_time( path );
-		if ( Scion::Utilities::CheckContainsValue(
-				 m_FilewatchParams, [ & ]( const auto& params ) { return params.sFilepath == texturePath; } ) )
-		{
-			m_FilewatchParams.emplace_back( AssetWatchParams{ .sAssetName = textureName,
-															  .sFilepath = texturePath,
-															  .lastWrite = lastWrite,
-															  .eType = Scion::Utilities::AssetType::TEXTURE } );
-		}
+	if ( m_mapTextures.contains( textureName ) )
+	{
+		SCION_ERROR( "Failed to add texture [{0}] -- Already exists!", textureName );
+		return false;
+	}
+
+	const std::string sTexturePath{ pTexture->GetPath() };
+	auto [ itr, bSuccess ] = m_mapTextures.emplace( textureName, std::move( pTexture ) );
+
+	if ( m_bFileWatcherRunning && bSuccess && !sTexturePath.empty() )
+	{
+		WatchAssetFile( textureName, sTexturePath, Scion::Utilities::AssetType::TEXTURE );
 	}
 
 	return bSuccess;
@@ -132,6 +145,43 @@ bool AssetManager::AddTextureFromMemory( const std::string& textureName, const u
 	return bSuccess;
 }
 
+bool AssetManager::AddTextureAtlasRegion( const std::string& textureName, const std::string& atlasName, int x, int y,
+										  int width, int height )
+{
+	if ( m_mapTextures.contains( textureName ) )
+	{
+		SCION_ERROR( "AssetManager: Texture [{}] -- Already exists!", textureName );
+		return false;
+	}
+
+	auto atlasItr = m_mapTextures.find( atlasName );
+	if ( atlasItr == m_mapTextures.end() )
+	{
+		SCION_ERROR( "Failed to add atlas region [{}] -- Atlas [{}] does not exist!", textureName, atlasName );
+		return false;
+	}
+
+	const auto& pAtlas = atlasItr->second;
+	const float atlasWidth = static_cast<float>( pAtlas->GetWidth() );
+	const float atlasHeight = static_cast<float>( pAtlas->GetHeight() );
+
+	if ( width <= 0 || height <= 0 || x < 0 || y < 0 || x + width > pAtlas->GetWidth() ||
+		 y + height > pAtlas->GetHeight() )
+	{
+		SCION_ERROR( "Failed to add atlas region [{}] -- Region is outside of atlas [{}].", textureName, atlasName );
+		return false;
+	}
+
+	auto pTexture = std::make_unique<Scion::Rendering::Texture>(
+		pAtlas->GetID(), width, height, pAtlas->GetType(), pAtlas->GetPath(), pAtlas->IsTileset() );
+
+	pTexture->SetAtlasRegion( glm::vec4{ x / atlasWidth, y / atlasHeight, width / atlasWidth, height / atlasHeight } );
+
+	auto [ itr, bSuccess ] = m_mapTextures.emplace( textureName, std::move( pTexture ) );
+
+	return bSuccess;
+}
+
 Scion::Rendering::Texture* AssetManager::GetTexture( const std::string& textureName )
 {
 	auto texItr = m_mapTextures.find( textureName );
@@ -165,22 +215,29 @@ bool AssetManager::AddFont( const std::string& fontName, const std::string& font
 		return false;
 	}
 
-	auto [ itr, bSuccess ] = m_mapFonts.emplace( fontName, std::move( pFont ) );
+	return AddFont( fontName, std::move( pFont ) );
+}
 
-	if ( m_bFileWatcherRunning && bSuccess )
+bool AssetManager::AddFont( const std::string& fontName, std::unique_ptr<Scion::Rendering::Font> pFont )
+{
+	if ( !pFont )
 	{
-		std::lock_guard lock{ m_AssetMutex };
+		SCION_ERROR( "Failed to add font [{0}] -- Font is invalid!", fontName );
+		return false;
+	}
 
-		fs::path path{ fontPath };
-		auto lastWrite = fs::last_write_time( path );
-		if ( Scion::Utilities::CheckContainsValue(
-				 m_FilewatchParams, [ & ]( const auto& params ) { return params.sFilepath == fontPath; } ) )
-		{
-			m_FilewatchParams.emplace_back( AssetWatchParams{ .sAssetName = fontName,
-															  .sFilepath = fontPath,
-															  .lastWrite = lastWrite,
-															  .eType = Scion::Utilities::AssetType::FONT } );
-		}
+	if ( m_mapFonts.contains( fontName ) )
+	{
+		SCION_ERROR( "Failed to add font [{0}] -- Already Exists!", fontName );
+		return false;
+	}
+
+	const std::string sFontPath{ pFont->GetFilename() };
+	auto [ itr, bSuccess ] = m_mapFonts.emplace( fontName, std::move( pFont ) );
+
+	if ( m_bFileWatcherRunning && bSuccess && !sFontPath.empty() )
+	{
+		WatchAssetFile( fontName, sFontPath, Scion::Utilities::AssetType::FONT );
 	}
 
 	return bSuccess;
@@ -246,29 +303,8 @@ bool AssetManager::AddShader( const std::string& shaderName, const std::string&
 
 	if ( m_bFileWatcherRunning && bSuccess )
 	{
-		std::lock_guard lock{ m_AssetMutex };
-
-		fs::path pathVert{ vertexPath };
-		auto lastWriteVert = fs::last_write_time( pathVert );
-		if ( Scion::Utilities::CheckContainsValue(
-				 m_FilewatchParams, [ & ]( const auto& params ) { return params.sFilepath == vertexPath; } ) )
-		{
-			m_FilewatchParams.emplace_back( AssetWatchParams{ .sAssetName = shaderName + "_vert",
-															  .sFilepath = vertexPath,
-															  .lastWrite = lastWriteVert,
-															  .eType = Scion::Utilities::AssetType::SHADER } );
-		}
-
-		fs::path pathFrag{ fragmentPath };
-		auto lastWriteFrag = fs::last_write_time( pathFrag );
-		if ( Scion::Utilities::CheckContainsValue(
-				 m_FilewatchParams, [ & ]( const auto& params ) { return params.sFilepath == fragmentPath; } ) )
-		{
-			m_FilewatchParams.emplace_back( AssetWatchParams{ .sAssetName = shaderName + "_frag",
-															  .sFilepath = fragmentPath,
-															  .lastWrite = lastWriteFrag,
-															  .eType = Scion::Utilities::AssetType::SHADER } );
-		}
+		WatchAssetFile( shaderName + "_vert", vertexPath, Scion::Utilities::AssetType::SHADER );
+		WatchAssetFile( shaderName + "_frag", fragmentPath, Scion::Utilities::AssetType::SHADER );
 	}
 	return bSuccess;
 }
@@ -347,6 +383,23 @@ bool AssetManager::AddAudioFromMemory( const std::string& audioName, const unsig
 		.second;
 }
 
+bool AssetManager::AddAudio( const std::string& audioName, std::unique_ptr<Scion::Sounds::Audio> pAudio )
+{
+	if ( !pAudio )
+	{
+		SCION_ERROR( "Failed to add Audio [{0}] -- Audio is invalid!", audioName );
+		return false;
+	}
+
+	if ( m_mapAudio.contains( audioName ) )
+	{
+		SCION_ERROR( "Failed to add Audio [{0}] -- Already Exists!", audioName );
+		return false;
+	}
+
+	return m_mapAudio.emplace( audioName, std::move( pAudio ) ).second;
+}
+
 Scion::Sounds::Audio* AssetManager::GetAudio( const std::string& audioName )
 {
 	auto audioItr = m_mapAudio.find( audioName );
@@ -643,6 +696,10 @@ void AssetManager::CreateLuaAssetManager( sol::state& lua )
 			[ & ]( const std::string& assetName, const std::string& filepath, bool pixel_art, bool bTileset ) {
 				return assetManager.AddTexture( assetName, filepath, pixel_art, bTileset );
 			} ),
+		"addTextureAtlasRegion",
+		[ & ]( const std::string& assetName, const std::string& atlasName, int x, int y, int width, int height ) {
+			return assetManager.AddTextureAtlasRegion( assetName, atlasName, x, y, width, height );
+		},
 		"addAudio",
 		[ & ]( const std::string& audioName, const std::string& filename ) {
 			return assetManager.AddAudio( audioName, filename, Scion::Sounds::AudioType::None );
@@ -654,42 +711,84 @@ void AssetManager::CreateLuaAssetManager( sol::state& lua )
 }
 void AssetManager::Update()
 {
-	std::shared_lock sharedLock{ m_AssetMutex };
-	auto dirtyView = m_FilewatchParams | std::views::filter( []( const auto& param ) { return param.bDirty; } );
+	// Take all of the changes reported since the last frame and reload them as one batch.
+	std::unordered_set<std::string> changedFiles;
+	{
+		std::lock_guard lock{ m_CallbackMutex };
+		if ( m_PendingChanges.empty() )
+			return;
+
+		changedFiles.swap( m_PendingChanges );
+	}
 
-	if ( !dirtyView.empty() )
+	std::vector<AssetWatchParams> dirtyAssets;
 	{
-		sharedLock.unlock();
-		std::unique_lock lock{ m_AssetMutex };
-		for ( auto& param : dirtyView )
+		std::shared_lock sharedLock{ m_AssetMutex };
+		for ( const auto& param : m_FilewatchParams )
 		{
-			ReloadAsset( param );
-			param.bDirty = false;
+			if ( changedFiles.contains( param.sWatchPath ) )
+			{
+				dirtyAssets.push_back( param );
+			}
 		}
 	}
+
+	// Reloading can add and remove watch params, so it must happen without holding the lock.
+	for ( const auto& param : dirtyAssets )
+	{
+		ReloadAsset( param );
+	}
 }
 
-void AssetManager::FileWatcher()
+void AssetManager::WatchAssetFile( const std::string& sAssetName, const std::string& sFilepath,
+								   Scion::Utilities::AssetType eType )
 {
-	while ( m_bFileWatcherRunning )
-	{
-		std::this_thread::sleep_for( 2s );
+	const std::string sWatchPath{ NormalizeWatchPath( fs::path{ sFilepath } ) };
 
-		for ( auto& fileParam : m_FilewatchParams )
+	{
+		std::lock_guard lock{ m_AssetMutex };
+		if ( Scion::Utilities::CheckContainsValue(
+				 m_FilewatchParams, [ & ]( const auto& params ) { return params.sWatchPath == sWatchPath; } ) )
 		{
-			std::shared_lock sharedLock{ m_AssetMutex };
-			fs::path path{ fileParam.sFilepath };
-			if ( !fs::exists( path ) )
-				continue;
-
-			if ( fileParam.lastWrite != fs::last_write_time( path ) )
-			{
-				sharedLock.unlock();
-				std::unique_lock lock{ m_AssetMutex };
-				fileParam.bDirty = true;
-			}
+			return;
 		}
+
+		m_FilewatchParams.emplace_back( AssetWatchParams{
+			.sAssetName = sAssetName, .sFilepath = sFilepath, .sWatchPath = sWatchPath, .eType = eType } );
+	}
+
+	// Directory watchers are recursive, so only add one if no existing watcher covers this directory.
+	const fs::path directory{ fs::path{ sWatchPath }.parent_path() };
+	const std::string sDirectory{ directory.string() };
+
+	bool bCovered = std::ranges::any_of( m_mapDirectoryWatchers, [ & ]( const auto& pair ) {
+		return sDirectory == pair.first || sDirectory.starts_with( pair.first + PATH_SEPARATOR );
+	} );
+
+	if ( bCovered || !fs::exists( directory ) )
+		return;
+
+	try
+	{
+		m_mapDirectoryWatchers.emplace(
+			sDirectory,
+			std::make_unique<Scion::Filesystem::DirectoryWatcher>(
+				directory, [ this ]( const fs::path& path, bool bModified ) { OnAssetFileChanged( path, bModified ); } ) );
 	}
+	catch ( const std::exception& ex )
+	{
+		SCION_ERROR( "Failed to watch asset directory [{}] - {}", sDirectory, ex.what() );
+	}
+}
+
+void AssetManager::OnAssetFileChanged( const fs::path& path, bool bModified )
+{
+	// Called from the watcher threads. Removed files keep their last loaded version.
+	if ( !bModified || !m_bFileWatcherRunning )
+		return;
+
+	std::lock_guard lock{ m_CallbackMutex };
+	m_PendingChanges.insert( NormalizeWatchPath( path ) );
 }
 
 void AssetManager::ReloadAsset( const AssetWatchParams& assetParams )
@@ -713,19 +812,29 @@ void AssetManager::ReloadTexture( const std::string& sTextureName )
 		return;
 	}
 
-	// We are assuming that the texture is in the map.
-	// Could potentially cause a crash, will look more into this.
-	auto& pTexture = m_mapTextures[ sTextureName ];
+	auto textureItr = m_mapTextures.find( sTextureName );
+	if ( textureItr == m_mapTextures.end() )
+	{
+		SCION_ERROR( "Failed to reload texture [{}] -- Does not exist!", sTextureName );
+		return;
+	}
 
-	fileParamItr->lastWrite = fs::last_write_time( fs::path{ pTexture->GetPath() } );
-	// Delete the old texture and then reload
-	auto id = pTexture->GetID();
-	glDeleteTextures( 1, &id );
+	auto& pTexture = textureItr->second;
 
+	// Load the new texture first. If the file is still being written or fails to decode, the old one stays valid.
 	auto pNewTexture =
 		Scion::Rendering::TextureLoader::Create( pTexture->GetType(), pTexture->GetPath(), pTexture->IsTileset() );
 
-	pTexture = std::move(pNewTexture);
+	if ( !pNewTexture )
+	{
+		SCION_ERROR( "Failed to reload texture [{}]", sTextureName );
+		return;
+	}
+
+	auto id = pTexture->GetID();
+	glDeleteTextures( 1, &id );
+
+	pTexture = std::move( pNewTexture );
 	SCION_LOG( "Reloaded texture: {}", sTextureName );
 }
 
@@ -741,10 +850,17 @@ void AssetManager::ReloadFont( const std::string& sFontName )
 		return;
 	}
 
-	fileParamItr->lastWrite = fs::last_write_time( fs::path{ fileParamItr->sFilepath } );
+	// Deleting the font removes its watch params, copy the path first.
+	const std::string sFontPath{ fileParamItr->sFilepath };
+
+	auto fontItr = m_mapFonts.find( sFontName );
+	if ( fontItr == m_mapFonts.end() )
+	{
+		SCION_ERROR( "Failed to reload font [{}] -- Does not exist!", sFontName );
+		return;
+	}
 
-	auto& pFont = m_mapFonts[ sFontName ];
-	float fontSize = pFont->GetFontSize();
+	float fontSize = fontItr->second->GetFontSize();
 
 	if ( !DeleteAsset( sFontName, Scion::Utilities::AssetType::FONT ) )
 	{
@@ -752,7 +868,7 @@ void AssetManager::ReloadFont( const std::string& sFontName )
 		return;
 	}
 
-	if ( !AddFont( sFontName, fileParamItr->sFilepath, fontSize ) )
+	if ( !AddFont( sFontName, sFontPath, fontSize ) )
 	{
 		SCION_ERROR( "Failed to Reload SoundFx: {}", sFontName );
 		return;
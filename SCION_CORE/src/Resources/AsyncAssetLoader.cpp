@@ -0,0 +1,521 @@
+#include "Core/Resources/AsyncAssetLoader.h"
+#include "Core/Resources/AssetManager.h"
+#include "Core/ECS/MainRegistry.h"
+#include "Core/ECS/Registry.h"
+#include "Core/CoreUtilities/Prefab.h"
+#include "Core/Profiling/ProfileCollector.h"
+
+#include <Rendering/Essentials/TextureLoader.h>
+#include <Rendering/Essentials/FontLoader.h>
+#include <Rendering/Essentials/Texture.h>
+#include <Rendering/Essentials/Font.h>
+
+#include <Sounds/Essentials/Audio.hpp>
+
+#include <ScionUtilities/ScionUtilities.h>
+#include <ScionUtilities/ThreadPool.h>
+#include <Logger/Logger.h>
+
+using namespace Scion::Utilities;
+
+namespace SCION_RESOURCES
+{
+/* What a worker thread produced for a load. Only the main thread turns it into an asset. */
+struct AsyncLoadResult
+{
+	Scion::Rendering::DecodedImage image{};
+	Scion::Rendering::BakedFont font{};
+	std::unique_ptr<Scion::Sounds::Audio> pAudio{ nullptr };
+	std::unique_ptr<Scion::Core::Prefab> pPrefab{ nullptr };
+	bool bSuccess{ false };
+};
+
+namespace
+{
+/*
+ * @brief Does the part of a load that does not need the GL context or the asset manager.
+ * Runs on a worker thread, so it only uses the copy of the params it was given.
+ */
+std::unique_ptr<AsyncLoadResult> LoadOnWorker( AssetType eType, const AsyncLoadParams& params )
+{
+	auto pResult = std::make_unique<AsyncLoadResult>();
+
+	switch ( eType )
+	{
+	case AssetType::TEXTURE:
+		pResult->bSuccess = Scion::Rendering::TextureLoader::DecodeImage( params.sPath, pResult->image );
+		break;
+	case AssetType::FONT:
+		pResult->bSuccess = Scion::Rendering::FontLoader::Bake( params.sPath, pResult->font, params.fontSize );
+		break;
+	case AssetType::MUSIC:
+	case AssetType::SOUNDFX: {
+		MIX_Audio* pAudio = MIX_LoadAudio( nullptr, params.sPath.c_str(), false );
+		if ( !pAudio )
+		{
+			SCION_ERROR( "Failed to load audio [{}] asynchronously. Error: {}", params.sPath, SDL_GetError() );
+			break;
+		}
+
+		pResult->pAudio = std::make_unique<Scion::Sounds::Audio>( pAudio, params.eAudioType, params.sPath );
+		pResult->bSuccess = true;
+		break;
+	}
+	case AssetType::PREFAB:
+		pResult->pPrefab = Scion::Core::PrefabCreator::CreatePrefab( params.sPath );
+		pResult->bSuccess = pResult->pPrefab != nullptr;
+		break;
+	default: SCION_ERROR( "Failed to load [{}] asynchronously. Asset type is not supported.", params.sPath ); break;
+	}
+
+	return pResult;
+}
+
+float GetStateProgress( EAsyncLoadState eState )
+{
+	switch ( eState )
+	{
+	case EAsyncLoadState::Queued: return 0.f;
+	case EAsyncLoadState::Loading: return 0.25f;
+	case EAsyncLoadState::Uploading: return 0.75f;
+	default: return 1.f;
+	}
+}
+
+} // namespace
+
+AsyncLoad::AsyncLoad( std::uint32_t id, const std::string& sName, AssetType eType )
+	: m_ID{ id }
+	, m_sName{ sName }
+	, m_eType{ eType }
+{
+}
+
+AsyncLoad::~AsyncLoad() = default;
+
+float AsyncLoad::GetProgress() const
+{
+	if ( IsDone() || !m_bGroup )
+		return GetStateProgress( GetState() );
+
+	if ( m_Dependencies.empty() )
+		return 0.f;
+
+	float progress{ 0.f };
+	for ( const auto& pDependency : m_Dependencies )
+	{
+		progress += pDependency->GetProgress();
+	}
+
+	progress /= static_cast<float>( m_Dependencies.size() );
+
+	// Leave room for the activation, which is the last thing a group does.
+	return m_Activate ? progress * 0.9f : progress;
+}
+
+AsyncAssetLoader::AsyncAssetLoader( AssetManager& assetManager, std::shared_ptr<ThreadPool> pThreadPool )
+	: m_AssetManager{ assetManager }
+	, m_pThreadPool{ std::move( pThreadPool ) }
+{
+}
+
+AsyncAssetLoader::~AsyncAssetLoader()
+{
+	// Results that are still being loaded hold audio and prefabs, they must not be freed after the loader is gone.
+	for ( auto& pLoad : m_PendingLoads )
+	{
+		if ( pLoad->m_Result.valid() )
+			pLoad->m_Result.wait();
+	}
+}
+
+std::shared_ptr<AsyncLoad> AsyncAssetLoader::LoadTexture( const std::string& sTextureName,
+														  const std::string& sTexturePath, bool bPixelArt,
+														  bool bTileset )
+{
+	return Request( sTextureName,
+					AssetType::TEXTURE,
+					AsyncLoadParams{ .sPath = sTexturePath, .bPixelArt = bPixelArt, .bTileset = bTileset } );
+}
+
+std::shared_ptr<AsyncLoad> AsyncAssetLoader::LoadFont( const std::string& sFontName, const std::string& sFontPath,
+													   float fontSize )
+{
+	return Request( sFontName, AssetType::FONT, AsyncLoadParams{ .sPath = sFontPath, .fontSize = fontSize } );
+}
+
+std::shared_ptr<AsyncLoad> AsyncAssetLoader::LoadAudio( const std::string& sAudioName, const std::string& sAudioPath,
+														Scion::Sounds::AudioType eType )
+{
+	return Request( sAudioName,
+					eType == Scion::Sounds::AudioType::Music ? AssetType::MUSIC : AssetType::SOUNDFX,
+					AsyncLoadParams{ .sPath = sAudioPath, .eAudioType = eType } );
+}
+
+std::shared_ptr<AsyncLoad> AsyncAssetLoader::LoadPrefab( const std::string& sPrefabName,
+														 const std::string& sPrefabPath )
+{
+	return Request( sPrefabName, AssetType::PREFAB, AsyncLoadParams{ .sPath = sPrefabPath } );
+}
+
+std::shared_ptr<AsyncLoad> AsyncAssetLoader::LoadGroup( const std::string& sName, AssetType eType,
+														std::vector<std::shared_ptr<AsyncLoad>> dependencies,
+														std::function<bool()> activate )
+{
+	auto pLoad = std::make_shared<AsyncLoad>( m_NextLoadID++, sName, eType );
+	pLoad->m_bGroup = true;
+	pLoad->m_Dependencies = std::move( dependencies );
+	pLoad->m_Activate = std::move( activate );
+	pLoad->m_eState.store( EAsyncLoadState::Loading, std::memory_order_release );
+
+	// Even a group without dependencies waits for the update, so the activation is always on the main thread.
+	m_PendingLoads.push_back( pLoad );
+	return pLoad;
+}
+
+std::vector<std::shared_ptr<AsyncLoad>> AsyncAssetLoader::LoadAssetDefs( const sol::table& assetDefs )
+{
+	std::vector<std::shared_ptr<AsyncLoad>> loads;
+
+	auto forEachDef = [ & ]( const char* sGroup, auto&& load ) {
+		sol::optional<sol::table> optDefs = assetDefs[ sGroup ];
+		if ( !optDefs )
+			return;
+
+		for ( const auto& [ _, def ] : *optDefs )
+		{
+			if ( def.get_type() != sol::type::table )
+				continue;
+
+			sol::table defTable = def.as<sol::table>();
+			sol::optional<std::string> optName = defTable[ "name" ];
+			sol::optional<std::string> optPath = defTable[ "path" ];
+			if ( !optName || !optPath )
+			{
+				SCION_ERROR( "Failed to load asset in [{}] asynchronously. Assets need a name and a path.", sGroup );
+				continue;
+			}
+
+			if ( auto pLoad = load( *optName, *optPath, defTable ) )
+				loads.push_back( std::move( pLoad ) );
+		}
+	};
+
+	forEachDef( "textures", [ this ]( const std::string& sName, const std::string& sPath, const sol::table& def ) {
+		return LoadTexture( sName, sPath, def.get_or( "pixel_art", true ), def.get_or( "bTileset", false ) );
+	} );
+
+	forEachDef( "fonts", [ this ]( const std::string& sName, const std::string& sPath, const sol::table& def ) {
+		return LoadFont( sName, sPath, def.get_or( "font_size", 32.f ) );
+	} );
+
+	forEachDef( "music", [ this ]( const std::string& sName, const std::string& sPath, const sol::table& ) {
+		return LoadAudio( sName, sPath, Scion::Sounds::AudioType::Music );
+	} );
+
+	forEachDef( "sound_fx", [ this ]( const std::string& sName, const std::string& sPath, const sol::table& ) {
+		return LoadAudio( sName, sPath, Scion::Sounds::AudioType::Soundfx );
+	} );
+
+	forEachDef( "prefabs", [ this ]( const std::string& sName, const std::string& sPath, const sol::table& ) {
+		return LoadPrefab( sName, sPath );
+	} );
+
+	return loads;
+}
+
+void AsyncAssetLoader::OnComplete( const std::shared_ptr<AsyncLoad>& pLoad, const sol::protected_function& callback )
+{
+	if ( !pLoad || !callback.valid() )
+		return;
+
+	if ( pLoad->IsDone() )
+		m_ReadyCallbacks.emplace_back( pLoad, callback );
+	else
+		pLoad->m_Callbacks.push_back( callback );
+}
+
+void AsyncAssetLoader::Update()
+{
+	SCION_PROFILE_COUNTER( "Async Loads", m_PendingLoads.size() );
+
+	if ( !m_ReadyCallbacks.empty() )
+	{
+		auto readyCallbacks = std::move( m_ReadyCallbacks );
+		m_ReadyCallbacks.clear();
+		for ( const auto& [ pLoad, callback ] : readyCallbacks )
+		{
+			CallCallback( pLoad, callback );
+		}
+	}
+
+	const auto start = std::chrono::steady_clock::now();
+	auto outOfBudget = [ & ] {
+		const std::chrono::duration<double, std::milli> elapsed = std::chrono::steady_clock::now() - start;
+		return elapsed.count() >= m_UploadBudgetMs;
+	};
+
+	bool bFinishedAny{ false };
+	size_t index{ 0 };
+
+	// Callbacks can request new loads, so the loads are indexed rather than iterated.
+	while ( index < m_PendingLoads.size() )
+	{
+		auto pLoad = m_PendingLoads[ index ];
+		bool bSuccess{ false };
+
+		if ( pLoad->m_bGroup )
+		{
+			if ( !std::ranges::all_of( pLoad->m_Dependencies, []( const auto& pDep ) { return pDep->IsDone(); } ) )
+			{
+				++index;
+				continue;
+			}
+
+			if ( bFinishedAny && outOfBudget() )
+				break;
+
+			bSuccess = std::ranges::all_of( pLoad->m_Dependencies, []( const auto& pDep ) { return pDep->IsReady(); } );
+			if ( !bSuccess )
+				SCION_ERROR( "Failed to load [{}] asynchronously. Not all of its assets could be loaded.", pLoad->m_sName );
+			else if ( pLoad->m_Activate )
+				bSuccess = pLoad->m_Activate();
+		}
+		else
+		{
+			if ( pLoad->m_Result.wait_for( std::chrono::seconds{ 0 } ) != std::future_status::ready )
+			{
+				++index;
+				continue;
+			}
+
+			if ( bFinishedAny && outOfBudget() )
+				break;
+
+			auto pResult = pLoad->m_Result.get();
+			bSuccess = pResult && pResult->bSuccess && Finish( *pLoad, *pResult );
+		}
+
+		m_PendingLoads.erase( m_PendingLoads.begin() + index );
+		Complete( pLoad, bSuccess );
+		bFinishedAny = true;
+	}
+}
+
+std::shared_ptr<AsyncLoad> AsyncAssetLoader::Request( const std::string& sName, AssetType eType,
+													  AsyncLoadParams params )
+{
+	if ( auto itr = std::ranges::find_if(
+			 m_PendingLoads,
+			 [ & ]( const auto& pLoad ) { return !pLoad->m_bGroup && pLoad->m_eType == eType && pLoad->m_sName == sName; } );
+		 itr != m_PendingLoads.end() )
+	{
+		return *itr;
+	}
+
+	auto pLoad = std::make_shared<AsyncLoad>( m_NextLoadID++, sName, eType );
+	pLoad->m_Params = std::move( params );
+
+	if ( m_AssetManager.CheckHasAsset( sName, eType ) )
+	{
+		pLoad->m_eState.store( EAsyncLoadState::Ready, std::memory_order_release );
+		return pLoad;
+	}
+
+	// The job gets its own copy of the params and a weak handle only used to report progress.
+	auto job = [ eType, params = pLoad->m_Params, pWeakLoad = std::weak_ptr<AsyncLoad>{ pLoad } ] {
+		if ( auto pLoad = pWeakLoad.lock() )
+			pLoad->m_eState.store( EAsyncLoadState::Loading, std::memory_order_release );
+
+		auto pResult = LoadOnWorker( eType, params );
+
+		if ( auto pLoad = pWeakLoad.lock(); pLoad && pResult->bSuccess )
+			pLoad->m_eState.store( EAsyncLoadState::Uploading, std::memory_order_release );
+
+		return pResult;
+	};
+
+	if ( m_pThreadPool )
+	{
+		pLoad->m_Result = m_pThreadPool->Enqueue( std::move( job ) );
+	}
+	else
+	{
+		// Without a thread pool the work is done when requested and only the upload waits for the update.
+		std::promise<std::unique_ptr<AsyncLoadResult>> result;
+		pLoad->m_Result = result.get_future();
+		result.set_value( job() );
+	}
+
+	m_PendingLoads.push_back( pLoad );
+	return pLoad;
+}
+
+bool AsyncAssetLoader::Finish( AsyncLoad& load, AsyncLoadResult& result )
+{
+	SCION_SUBSYSTEM_ZONE( "Async Upload" );
+
+	// Someone added the asset while it was loading, keep the one that is there.
+	if ( m_AssetManager.CheckHasAsset( load.m_sName, load.m_eType ) )
+		return true;
+
+	switch ( load.m_eType )
+	{
+	case AssetType::TEXTURE: {
+		auto pTexture = Scion::Rendering::TextureLoader::CreateFromDecoded(
+			load.m_Params.bPixelArt ? Scion::Rendering::Texture::TextureType::PIXEL
+									: Scion::Rendering::Texture::TextureType::BLENDED,
+			result.image,
+			load.m_Params.sPath,
+			load.m_Params.bTileset );
+
+		return pTexture && m_AssetManager.AddTexture( load.m_sName, std::move( pTexture ) );
+	}
+	case AssetType::FONT: {
+		auto pFont = Scion::Rendering::FontLoader::CreateFromBaked( result.font );
+		return pFont && m_AssetManager.AddFont( load.m_sName, std::move( pFont ) );
+	}
+	case AssetType::MUSIC:
+	case AssetType::SOUNDFX: return m_AssetManager.AddAudio( load.m_sName, std::move( result.pAudio ) );
+	case AssetType::PREFAB: return m_AssetManager.AddPrefab( load.m_sName, std::move( result.pPrefab ) );
+	default: return false;
+	}
+}
+
+void AsyncAssetLoader::Complete( const std::shared_ptr<AsyncLoad>& pLoad, bool bSuccess )
+{
+	pLoad->m_eState.store( bSuccess ? EAsyncLoadState::Ready : EAsyncLoadState::Failed, std::memory_order_release );
+	pLoad->m_Dependencies.clear();
+	pLoad->m_Activate = nullptr;
+
+	auto callbacks = std::move( pLoad->m_Callbacks );
+	pLoad->m_Callbacks.clear();
+	for ( const auto& callback : callbacks )
+	{
+		CallCallback( pLoad, callback );
+	}
+}
+
+void AsyncAssetLoader::CallCallback( const std::shared_ptr<AsyncLoad>& pLoad, const sol::protected_function& callback )
+{
+	auto result = callback( pLoad, pLoad->IsReady() );
+	if ( !result.valid() )
+	{
+		sol::error error = result;
+		SCION_ERROR( "Failed to call the completion callback of [{}]. Error: {}", pLoad->m_sName, error.what() );
+	}
+}
+
+std::shared_ptr<AsyncLoad> AsyncAssetLoader::LoadScene( Scion::Core::ECS::Registry& registry,
+														const std::string& sSceneName,
+														const sol::optional<sol::table>& optAssetDefs,
+														std::function<bool( const std::string& )> changeScene )
+{
+	auto* pAsyncLoader = registry.TryGetContext<std::shared_ptr<AsyncAssetLoader>>();
+	if ( !pAsyncLoader || !*pAsyncLoader )
+	{
+		SCION_ERROR( "Failed to load scene [{}] asynchronously. The async asset loader has not been bound.",
+					 sSceneName );
+		return nullptr;
+	}
+
+	auto dependencies =
+		optAssetDefs ? ( *pAsyncLoader )->LoadAssetDefs( *optAssetDefs ) : std::vector<std::shared_ptr<AsyncLoad>>{};
+
+	return ( *pAsyncLoader )
+		->LoadGroup( sSceneName,
+					 AssetType::SCENE,
+					 std::move( dependencies ),
+					 [ sSceneName, changeScene = std::move( changeScene ) ] { return changeScene( sSceneName ); } );
+}
+
+void AsyncAssetLoader::CreateLuaAsyncLoaderBind( sol::state& lua, Scion::Core::ECS::Registry& registry )
+{
+	auto* pThreadPool = MAIN_REGISTRY().TryGetContext<SharedThreadPool>();
+	auto pLoader = registry.AddToContext<std::shared_ptr<AsyncAssetLoader>>(
+		std::make_shared<AsyncAssetLoader>( ASSET_MANAGER(), pThreadPool ? *pThreadPool : nullptr ) );
+
+	lua.new_enum<EAsyncLoadState>( "AsyncLoadState",
+								   { { "Queued", EAsyncLoadState::Queued },
+									 { "Loading", EAsyncLoadState::Loading },
+									 { "Uploading", EAsyncLoadState::Uploading },
+									 { "Ready", EAsyncLoadState::Ready },
+									 { "Failed", EAsyncLoadState::Failed } } );
+
+	AsyncAssetLoader* pAsyncLoader = pLoader.get();
+
+	lua.new_usertype<AsyncLoad>(
+		"AsyncLoad",
+		sol::no_constructor,
+		"id",
+		sol::readonly_property( &AsyncLoad::GetID ),
+		"name",
+		sol::readonly_property( &AsyncLoad::GetName ),
+		"type",
+		sol::readonly_property( &AsyncLoad::GetType ),
+		"state",
+		sol::readonly_property( &AsyncLoad::GetState ),
+		"isReady",
+		&AsyncLoad::IsReady,
+		"isDone",
+		&AsyncLoad::IsDone,
+		"failed",
+		[]( const AsyncLoad& load ) { return load.GetState() == EAsyncLoadState::Failed; },
+		"progress",
+		&AsyncLoad::GetProgress,
+		"onComplete",
+		[ pAsyncLoader ]( const std::shared_ptr<AsyncLoad>& pLoad, const sol::protected_function& callback ) {
+			pAsyncLoader->OnComplete( pLoad, callback );
+		} );
+
+	sol::usertype<AssetManager> assetManagerType = lua[ "AssetManager" ];
+	if ( !assetManagerType.valid() )
+	{
+		SCION_ERROR( "Failed to bind async asset loading. The AssetManager has not been bound to lua." );
+		return;
+	}
+
+	assetManagerType.set_function( "loadTextureAsync",
+								   [ pAsyncLoader ]( const std::string& sTextureName,
+													 const std::string& sTexturePath,
+													 sol::optional<bool> optPixelArt,
+													 sol::optional<bool> optTileset ) {
+									   return pAsyncLoader->LoadTexture( sTextureName,
+																		 sTexturePath,
+																		 optPixelArt.value_or( true ),
+																		 optTileset.value_or( false ) );
+								   } );
+
+	assetManagerType.set_function(
+		"loadFontAsync",
+		[ pAsyncLoader ]( const std::string& sFontName, const std::string& sFontPath, sol::optional<float> optFontSize ) {
+			return pAsyncLoader->LoadFont( sFontName, sFontPath, optFontSize.value_or( 32.f ) );
+		} );
+
+	assetManagerType.set_function(
+		"loadMusicAsync", [ pAsyncLoader ]( const std::string& sMusicName, const std::string& sMusicPath ) {
+			return pAsyncLoader->LoadAudio( sMusicName, sMusicPath, Scion::Sounds::AudioType::Music );
+		} );
+
+	assetManagerType.set_function(
+		"loadSoundFxAsync", [ pAsyncLoader ]( const std::string& sSoundName, const std::string& sSoundPath ) {
+			return pAsyncLoader->LoadAudio( sSoundName, sSoundPath, Scion::Sounds::AudioType::Soundfx );
+		} );
+
+	assetManagerType.set_function(
+		"loadPrefabAsync", [ pAsyncLoader ]( const std::string& sPrefabName, const std::string& sPrefabPath ) {
+			return pAsyncLoader->LoadPrefab( sPrefabName, sPrefabPath );
+		} );
+
+	assetManagerType.set_function( "loadAssetsAsync", [ pAsyncLoader ]( const sol::table& assetDefs ) {
+		return pAsyncLoader->LoadGroup( "assets", AssetType::NO_TYPE, pAsyncLoader->LoadAssetDefs( assetDefs ) );
+	} );
+
+	assetManagerType.set_function( "setAsyncUploadBudget",
+								   [ pAsyncLoader ]( double budgetMs ) { pAsyncLoader->SetUploadBudget( budgetMs ); } );
+
+	assetManagerType.set_function( "numAsyncLoads",
+								   [ pAsyncLoader ] { return pAsyncLoader->NumPendingLoads(); } );
+}
+
+} // namespace SCION_RESOURCES
@@ -3,6 +3,7 @@
 
 #include "ScionUtilities/ScionUtilities.h"
 #include "ScionFilesystem/Serializers/JSONSerializer.h"
+#include "ScionFilesystem/Utilities/AsyncFileWriter.h"
 
 #include "Core/CoreUtilities/ProjectInfo.h"
 #include "Core/ECS/Components/AllComponents.h"
@@ -106,6 +107,12 @@ bool Scene::LoadScene()
 		return false;
 	}
 
+	// An explicit save of the scene could still be queued, make sure it has landed before reading.
+	if ( auto* pFileWriter = MAIN_REGISTRY().TryGetContext<std::shared_ptr<AsyncFileWriter>>() )
+	{
+		( *pFileWriter )->Flush();
+	}
+
 	if ( !LoadSceneData() )
 	{
 		SCION_ERROR( "Failed to load scene data" );
@@ -340,6 +347,20 @@ bool Scene::LoadSceneData()
 	return true;
 }
 
+bool Scene::SaveScene( bool bOverride )
+{
+	if ( m_bSceneLoaded )
+	{
+		auto* pFileWriter = MAIN_REGISTRY().TryGetContext<std::shared_ptr<AsyncFileWriter>>();
+		if ( pFileWriter && *pFileWriter )
+		{
+			return SaveSceneAsync( **pFileWriter );
+		}
+	}
+
+	return SaveSceneData( bOverride );
+}
+
 bool Scene::SaveSceneData( bool bOverride )
 {
 	/*
@@ -351,6 +372,12 @@ bool Scene::SaveSceneData( bool bOverride )
 		return true;
 	}
 
+	// Make sure an older background save cannot land on top of this one.
+	if ( auto* pFileWriter = MAIN_REGISTRY().TryGetContext<std::shared_ptr<AsyncFileWriter>>() )
+	{
+		( *pFileWriter )->Flush();
+	}
+
 	// Check to see if the scene data exists
 	fs::path tilemapPath{ m_sSceneDataPath };
 	if ( !fs::exists( tilemapPath ) )
@@ -371,15 +398,39 @@ bool Scene::SaveSceneData( bool bOverride )
 		return false;
 	}
 
-	pSerializer->StartDocument();
-	pSerializer->StartNewObject( "scene_data" );
+	bool bSuccess{ true };
+	if ( !SerializeSceneData( *pSerializer ) )
+	{
+		bSuccess = false;
+	}
+
+	// Try to Save the tilemap
+	auto pTilemapLoader = std::make_unique<TilemapLoader>();
+	if ( !pTilemapLoader->SaveTilemap( m_Registry, m_sTilemapPath, true ) )
+	{
+		bSuccess = false;
+	}
+
+	// Try to Save scene game objects
+	if ( !pTilemapLoader->SaveGameObjects( m_Registry, m_sObjectPath, true ) )
+	{
+		bSuccess = false;
+	}
+
+	return bSuccess;
+}
+
+bool Scene::SerializeSceneData( Scion::Filesystem::JSONSerializer& serializer )
+{
+	serializer.StartDocument();
+	serializer.StartNewObject( "scene_data" );
 
 	std::string sTilemapPath = m_sTilemapPath.substr( m_sTilemapPath.find( m_sSceneName ) );
 	std::string sObjectPath = m_sObjectPath.substr( m_sObjectPath.find( m_sSceneName ) );
 
 	glm::vec2 playerStartPosition = m_bUsePlayerStart ? m_PlayerStart.GetPosition() : glm::vec2{ 0.f };
 
-	pSerializer->AddKeyValuePair( "name", m_sSceneName )
+	serializer.AddKeyValuePair( "name", m_sSceneName )
 		.AddKeyValuePair( "tilemapPath", sTilemapPath )
 		.AddKeyValuePair( "objectmapPath", sObjectPath )
 		.AddKeyValuePair( "defaultMusic", m_sDefaultMusic )
@@ -403,35 +454,50 @@ bool Scene::SaveSceneData( bool bOverride )
 
 	for ( const auto& layer : m_LayerParams )
 	{
-		pSerializer->StartNewObject()
+		serializer.StartNewObject()
 			.AddKeyValuePair( "layerName", layer.sLayerName )
 			.AddKeyValuePair( "bVisible", layer.bVisible )
 			.EndObject();
 	}
 
-	pSerializer->EndArray();  // Sprite Layers
-	pSerializer->EndObject(); // Scene  data
+	serializer.EndArray();  // Sprite Layers
+	serializer.EndObject(); // Scene  data
 
-	bool bSuccess{ true };
-	if ( !pSerializer->EndDocument() )
+	return serializer.EndDocument();
+}
+
+bool Scene::SaveSceneAsync( Scion::Filesystem::AsyncFileWriter& fileWriter, const std::string& sDirectory )
+{
+	if ( !m_bSceneLoaded )
 	{
-		bSuccess = false;
+		SCION_ERROR( "Failed to save scene [{}] - Scene is not loaded.", m_sSceneName );
+		return false;
 	}
 
-	// Try to Save the tilemap
+	auto getDestination = [ &sDirectory ]( const std::string& sFilepath ) {
+		return sDirectory.empty() ? sFilepath : ( fs::path{ sDirectory } / fs::path{ sFilepath }.filename() ).string();
+	};
+
+	// Only the snapshot is taken here. The documents are written compact, the writer will format them.
+	JSONSerializer sceneDataSerializer{ -1, false };
+	JSONSerializer tilemapSerializer{ -1, false };
+	JSONSerializer objectSerializer{ -1, false };
+
 	auto pTilemapLoader = std::make_unique<TilemapLoader>();
-	if ( !pTilemapLoader->SaveTilemap( m_Registry, m_sTilemapPath, true ) )
+	if ( !SerializeSceneData( sceneDataSerializer ) ||
+		 !pTilemapLoader->SerializeTilemapJSON( m_Registry, tilemapSerializer ) ||
+		 !pTilemapLoader->SerializeObjectMapJSON( m_Registry, objectSerializer ) )
 	{
-		bSuccess = false;
+		SCION_ERROR( "Failed to save scene [{}] - Failed to serialize scene.", m_sSceneName );
+		return false;
 	}
 
-	// Try to Save scene game objects
-	if ( !pTilemapLoader->SaveGameObjects( m_Registry, m_sObjectPath, true ) )
-	{
-		bSuccess = false;
-	}
+	fileWriter.Write(
+		getDestination( m_sSceneDataPath ), sceneDataSerializer.GetString(), EAsyncWriteFormat::PrettyJSON );
+	fileWriter.Write( getDestination( m_sTilemapPath ), tilemapSerializer.GetString(), EAsyncWriteFormat::PrettyJSON );
+	fileWriter.Write( getDestination( m_sObjectPath ), objectSerializer.GetString(), EAsyncWriteFormat::PrettyJSON );
 
-	return bSuccess;
+	return true;
 }
 
 void Scene::SetCanvasOffset()
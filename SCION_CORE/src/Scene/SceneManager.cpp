@@ -5,6 +5,9 @@
 #include "Core/ECS/Components/AllComponents.h"
 #include "Core/ECS/Registry.h"
 #include "Core/Loaders/TilemapLoader.h"
+#include "Core/Loaders/LevelStreamer.h"
+#include "Core/Scripting/LuaTaskScheduler.h"
+#include "Core/Resources/AsyncAssetLoader.h"
 
 using namespace Scion::Core::ECS;
 
@@ -100,6 +103,53 @@ bool SceneManager::ChangeSceneName( const std::string& sOldName, const std::stri
 
 void SceneManager::CreateLuaBind( sol::state& lua, ECS::Registry& registry )
 {
+	// Shared by changeScene and changeSceneAsync, which runs it once the assets of the scene are loaded.
+	auto changeScene = [ &lua, &registry ]( const std::string& sSceneName ) {
+		auto* pSceneManagerData = registry.TryGetContext<std::shared_ptr<SceneManagerData>>();
+		if ( !pSceneManagerData )
+		{
+			SCION_ERROR( "Scene manager data was not set correctly." );
+			return false;
+		}
+
+		( *pSceneManagerData )->sSceneName = sSceneName;
+
+		sol::optional<sol::table> optSceneData = lua[ sSceneName + "_data" ];
+		if ( optSceneData )
+		{
+			( *pSceneManagerData )->sDefaultMusic = ( *optSceneData )[ "default_music" ].get_or( std::string{} );
+		}
+
+		// The cells of the old scene must not keep streaming into the new one.
+		auto* pLevelStreamer = registry.TryGetContext<std::shared_ptr<Scion::Core::Loaders::LevelStreamer>>();
+		if ( pLevelStreamer && *pLevelStreamer )
+			( *pLevelStreamer )->Reset( registry );
+
+		registry.DestroyEntities();
+
+		// Scenes packaged with cells are streamed, the others are loaded whole. Without a manifest the streamer stays idle.
+		const std::string sCellsDir{ Scion::Core::Loaders::LevelStreamer::GetCellsDirectory( sSceneName ) };
+		if ( pLevelStreamer && *pLevelStreamer && std::filesystem::exists( sCellsDir ) &&
+			 ( *pLevelStreamer )->LoadManifest( sCellsDir ) )
+		{
+			( *pLevelStreamer )->LoadRequiredCells( registry );
+		}
+		else
+		{
+			Scion::Core::Loaders::TilemapLoader tl{};
+
+			tl.LoadTilemapFromLuaTable( registry, lua[ sSceneName + "_tilemap" ] );
+			tl.LoadGameObjectsFromLuaTable( registry, lua[ sSceneName + "_objects" ] );
+		}
+
+		if ( auto* pScheduler = registry.TryGetContext<std::shared_ptr<Scion::Core::Scripting::LuaTaskScheduler>>() )
+		{
+			( *pScheduler )->NotifySceneLoaded( sSceneName );
+		}
+
+		return true;
+	};
+
 	lua.new_usertype<SceneManager>(
 		"SceneManager",
 		sol::no_constructor,
@@ -116,30 +166,10 @@ void SceneManager::CreateLuaBind( sol::state& lua, ECS::Registry& registry )
 			(*pSceneManagerData)->sSceneName = sSceneName;
 		},
 		"changeScene",
-		[ & ]( const std::string& sSceneName ) {
-			auto* pSceneManagerData = registry.TryGetContext<std::shared_ptr<SceneManagerData>>();
-			if ( !pSceneManagerData )
-			{
-				SCION_ERROR( "Scene manager data was not set correctly." );
-				return false;
-			}
-
-			( *pSceneManagerData )->sSceneName = sSceneName;
-
-			sol::optional<sol::table> optSceneData = lua[ sSceneName + "_data" ];
-			if ( optSceneData )
-			{
-				( *pSceneManagerData )->sDefaultMusic = ( *optSceneData )[ "default_music" ].get_or( std::string{} );
-			}
-
-			registry.DestroyEntities();
-
-			Scion::Core::Loaders::TilemapLoader tl{};
-
-			tl.LoadTilemapFromLuaTable( registry, lua[ sSceneName + "_tilemap" ] );
-			tl.LoadGameObjectsFromLuaTable( registry, lua[ sSceneName + "_objects" ] );
-
-			return true;
+		changeScene,
+		"changeSceneAsync",
+		[ &registry, changeScene ]( const std::string& sSceneName, sol::optional<sol::table> optAssetDefs ) {
+			return SCION_RESOURCES::AsyncAssetLoader::LoadScene( registry, sSceneName, optAssetDefs, changeScene );
 		},
 		"getCanvas", // Returns the canvas of the current scene or an empty canvas object.
 		[ & ] {
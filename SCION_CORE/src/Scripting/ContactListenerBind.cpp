@@ -1,11 +1,9 @@
 #include "Core/Scripting/ContactListenerBind.h"
 #include <Physics/ContactListener.h>
-#include "Core/ECS/MetaUtilities.h"
+#include "Core/Scripting/UserDataBindings.h"
 #include <Physics/UserData.h>
 #include <Logger/Logger.h>
 
-using namespace Scion::Core::Utils;
-
 namespace Scion::Core::Scripting
 {
 
@@ -18,20 +16,8 @@ std::tuple<sol::object, sol::object> ContactListenerBinder::GetUserData(
 	if ( !pUserDataA || !pUserDataB )
 		return std::make_tuple( sol::lua_nil_t{}, sol::lua_nil_t{} );
 
-	SCION_ASSERT( pUserDataA->type_id != 0 && pUserDataB->type_id != 0 && "User Data Type id must be set!" );
-
-	using namespace entt::literals;
-
-	const auto maybe_any_a =
-		InvokeMetaFunction( static_cast<entt::id_type>( pUserDataA->type_id ), "get_user_data"_hs, *pUserDataA, s );
-
-	const auto maybe_any_b =
-		InvokeMetaFunction( static_cast<entt::id_type>( pUserDataB->type_id ), "get_user_data"_hs, *pUserDataB, s );
-
-	if ( !maybe_any_a || !maybe_any_b )
-		return std::make_tuple( sol::lua_nil_t{}, sol::lua_nil_t{} );
-
-	return std::make_tuple( maybe_any_a.cast<sol::reference>(), maybe_any_b.cast<sol::reference>() );
+	return std::make_tuple( sol::object{ get_user_data<Scion::Physics::ObjectData>( *pUserDataA, s ) },
+							sol::object{ get_user_data<Scion::Physics::ObjectData>( *pUserDataB, s ) } );
 }
 
 void ContactListenerBinder::CreateLuaContactListener( sol::state& lua, entt::registry& registry )
@@ -43,9 +29,41 @@ void ContactListenerBinder::CreateLuaContactListener( sol::state& lua, entt::reg
 		return;
 	}
 
+	lua.new_enum<Scion::Physics::EContactType>( "ContactType",
+												 {
+													 { "Begin", Scion::Physics::EContactType::Begin },
+													 { "End", Scion::Physics::EContactType::End },
+													 { "PreSolve", Scion::Physics::EContactType::PreSolve },
+													 { "PostSolve", Scion::Physics::EContactType::PostSolve },
+												 } );
+
 	lua.new_usertype<Scion::Physics::ContactListener>(
-		"ContactListener", sol::no_constructor, "getUserData", [ & ]( sol::this_state s ) {
-			return GetUserData( *contactListener, s );
-		} );
+		"ContactListener",
+		sol::no_constructor,
+		"getUserData",
+		[ & ]( sol::this_state s ) { return GetUserData( *contactListener, s ); },
+		"numContacts",
+		[ & ] { return contactListener->GetContacts().size(); },
+		// Only numbers are passed to the callback so iterating the contacts creates no garbage.
+		"forEachContact",
+		[ & ]( const sol::protected_function& callback ) {
+			for ( const auto& contact : contactListener->GetContacts() )
+			{
+				auto result = callback( contact.eType,
+										contact.entityA,
+										contact.entityB,
+										contact.normal.x,
+										contact.normal.y,
+										contact.normalImpulse );
+				if ( !result.valid() )
+				{
+					sol::error error = result;
+					SCION_ERROR( "Failed to run forEachContact callback: {}", error.what() );
+					return;
+				}
+			}
+		},
+		"recordSolveContacts",
+		[ & ]( bool bRecord ) { contactListener->SetRecordSolveContacts( bRecord ); } );
 }
 } // namespace Scion::Core::Scripting
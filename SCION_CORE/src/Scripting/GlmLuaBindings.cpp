@@ -10,6 +10,26 @@
 namespace Scion::Core::Scripting
 {
 
+/*
+ * The operators of the vector types return a new vector, which lua has to allocate as a full
+ * userdata and collect later. These functions change the vector they are called on instead,
+ * so hot loops like position updates do not allocate.
+ */
+template <typename TVec>
+static void AddInPlaceFunctions( sol::usertype<TVec>& vecType )
+{
+	vecType[ "copy" ] = []( TVec& v, const TVec& other ) { v = other; };
+	vecType[ "scale" ] = []( TVec& v, float value ) { v *= value; };
+	vecType[ "mul" ] = []( TVec& v, const TVec& other ) { v *= other; };
+	// v = v + other * value, the common position += velocity * dt.
+	vecType[ "addScaled" ] = []( TVec& v, const TVec& other, float value ) { v += other * value; };
+	vecType[ "normalizeSelf" ] = []( TVec& v ) {
+		const float lengthSq = glm::length2( v );
+		if ( lengthSq > 0.f )
+			v *= 1.f / std::sqrt( lengthSq );
+	};
+}
+
 // glm::vec2
 static void CreateVec2Bind( sol::state& lua )
 {
@@ -34,7 +54,7 @@ static void CreateVec2Bind( sol::state& lua )
 													 []( float value, const glm::vec2& v1 ) { return v1 - value; } );
 
 	// create vec2 usertype
-	lua.new_usertype<glm::vec2>(
+	auto vec2Type = lua.new_usertype<glm::vec2>(
 		"vec2",
 		sol::call_constructor,
 		sol::constructors<glm::vec2( float ), glm::vec2( float, float )>(),
@@ -62,6 +82,14 @@ static void CreateVec2Bind( sol::state& lua )
 		[]( const glm::vec2& v ) { return glm::epsilonEqual( v.x, 0.f, 0.001f ); },
 		"nearly_zero_y",
 		[]( const glm::vec2& v ) { return glm::epsilonEqual( v.y, 0.f, 0.001f ); } );
+
+	AddInPlaceFunctions( vec2Type );
+	vec2Type[ "set" ] = []( glm::vec2& v, float x, float y ) { v = glm::vec2{ x, y }; };
+	vec2Type[ "add" ] = sol::overload( []( glm::vec2& v, const glm::vec2& other ) { v += other; },
+									   []( glm::vec2& v, float x, float y ) { v += glm::vec2{ x, y }; } );
+	vec2Type[ "sub" ] = sol::overload( []( glm::vec2& v, const glm::vec2& other ) { v -= other; },
+									   []( glm::vec2& v, float x, float y ) { v -= glm::vec2{ x, y }; } );
+	vec2Type[ "unpack" ] = []( const glm::vec2& v ) { return std::make_tuple( v.x, v.y ); };
 }
 
 // glm::vec3
@@ -88,7 +116,7 @@ static void CreateVec3Bind( sol::state& lua )
 													 []( float value, const glm::vec3& v1 ) { return v1 - value; } );
 
 	// create vec3 usertype
-	lua.new_usertype<glm::vec3>(
+	auto vec3Type = lua.new_usertype<glm::vec3>(
 		"vec3",
 		sol::call_constructor,
 		sol::constructors<glm::vec3( float ), glm::vec3( float, float, float )>(),
@@ -120,6 +148,14 @@ static void CreateVec3Bind( sol::state& lua )
 		[]( const glm::vec3& v ) { return glm::epsilonEqual( v.y, 0.f, 0.001f ); },
 		"nearly_zero_z",
 		[]( const glm::vec3& v ) { return glm::epsilonEqual( v.z, 0.f, 0.001f ); } );
+
+	AddInPlaceFunctions( vec3Type );
+	vec3Type[ "set" ] = []( glm::vec3& v, float x, float y, float z ) { v = glm::vec3{ x, y, z }; };
+	vec3Type[ "add" ] = sol::overload( []( glm::vec3& v, const glm::vec3& other ) { v += other; },
+									   []( glm::vec3& v, float x, float y, float z ) { v += glm::vec3{ x, y, z }; } );
+	vec3Type[ "sub" ] = sol::overload( []( glm::vec3& v, const glm::vec3& other ) { v -= other; },
+									   []( glm::vec3& v, float x, float y, float z ) { v -= glm::vec3{ x, y, z }; } );
+	vec3Type[ "unpack" ] = []( const glm::vec3& v ) { return std::make_tuple( v.x, v.y, v.z ); };
 }
 
 // glm::vec4
@@ -146,7 +182,7 @@ static void CreateVec4Bind( sol::state& lua )
 													 []( float value, const glm::vec4& v1 ) { return v1 - value; } );
 
 	// create vec4 usertype
-	lua.new_usertype<glm::vec4>(
+	auto vec4Type = lua.new_usertype<glm::vec4>(
 		"vec4",
 		sol::call_constructor,
 		sol::constructors<glm::vec4( float ), glm::vec4( float, float, float, float )>(),
@@ -182,6 +218,16 @@ static void CreateVec4Bind( sol::state& lua )
 		[]( const glm::vec4& v ) { return glm::epsilonEqual( v.z, 0.f, 0.001f ); },
 		"nearly_zero_w",
 		[]( const glm::vec4& v ) { return glm::epsilonEqual( v.w, 0.f, 0.001f ); } );
+
+	AddInPlaceFunctions( vec4Type );
+	vec4Type[ "set" ] = []( glm::vec4& v, float x, float y, float z, float w ) { v = glm::vec4{ x, y, z, w }; };
+	vec4Type[ "add" ] =
+		sol::overload( []( glm::vec4& v, const glm::vec4& other ) { v += other; },
+					   []( glm::vec4& v, float x, float y, float z, float w ) { v += glm::vec4{ x, y, z, w }; } );
+	vec4Type[ "sub" ] =
+		sol::overload( []( glm::vec4& v, const glm::vec4& other ) { v -= other; },
+					   []( glm::vec4& v, float x, float y, float z, float w ) { v -= glm::vec4{ x, y, z, w }; } );
+	vec4Type[ "unpack" ] = []( const glm::vec4& v ) { return std::make_tuple( v.x, v.y, v.z, v.w ); };
 }
 
 static void CreateQuaternionLuaBind( sol::state& lua )
@@ -217,7 +263,39 @@ static void MathFreeFunctions( sol::state& lua )
 	lua.set_function( "S2D_distance",
 					  sol::overload( []( glm::vec2& a, glm::vec2& b ) { return glm::distance( a, b ); },
 									 []( glm::vec3& a, glm::vec3& b ) { return glm::distance( a, b ); },
-									 []( glm::vec4& a, glm::vec4& b ) { return glm::distance( a, b ); } ) );
+									 []( glm::vec4& a, glm::vec4& b ) { return glm::distance( a, b ); },
+									 []( float x1, float y1, float x2, float y2 ) {
+										 return glm::distance( glm::vec2{ x1, y1 }, glm::vec2{ x2, y2 } );
+									 } ) );
+
+	// Scalar versions of the vector functions. They take and return plain numbers, so nothing is allocated.
+	lua.set_function( "S2D_length",
+					  sol::overload( []( float x, float y ) { return glm::length( glm::vec2{ x, y } ); },
+									 []( float x, float y, float z ) { return glm::length( glm::vec3{ x, y, z } ); } ) );
+
+	lua.set_function( "S2D_normalize",
+					  sol::overload(
+						  []( float x, float y ) {
+							  const float length = glm::length( glm::vec2{ x, y } );
+							  if ( length <= 0.f )
+								  return std::make_tuple( 0.f, 0.f );
+
+							  return std::make_tuple( x / length, y / length );
+						  },
+						  []( float x, float y, float z ) {
+							  const float length = glm::length( glm::vec3{ x, y, z } );
+							  if ( length <= 0.f )
+								  return std::make_tuple( 0.f, 0.f, 0.f );
+
+							  return std::make_tuple( x / length, y / length, z / length );
+						  } ) );
+
+	lua.set_function( "S2D_rotate", []( float x, float y, float degrees ) {
+		const float radians = glm::radians( degrees );
+		const float c = std::cos( radians );
+		const float s = std::sin( radians );
+		return std::make_tuple( x * c - y * s, x * s + y * c );
+	} );
 
 	lua.set_function( "S2D_lerp", []( float a, float b, float t ) { return std::lerp( a, b, t ); } );
 	lua.set_function(
@@ -239,7 +317,8 @@ static void MathFreeFunctions( sol::state& lua )
 	lua.set_function( "S2D_dot_product",
 					  sol::overload( []( const glm::vec2& v1, const glm::vec2& v2 ) { return glm::dot( v1, v2 ); },
 									 []( const glm::vec3& v1, const glm::vec3& v2 ) { return glm::dot( v1, v2 ); },
-									 []( const glm::vec4& v1, const glm::vec4& v2 ) { return glm::dot( v1, v2 ); } ) );
+									 []( const glm::vec4& v1, const glm::vec4& v2 ) { return glm::dot( v1, v2 ); },
+									 []( float x1, float y1, float x2, float y2 ) { return x1 * x2 + y1 * y2; } ) );
 
 	lua.set_function(
 		"S2D_cross_product",
@@ -0,0 +1,96 @@
+#include "Core/Scripting/LazyLuaBindings.h"
+#include "Core/Profiling/ProfileCollector.h"
+#include <Logger/Logger.h>
+
+namespace Scion::Core::Scripting
+{
+
+LazyLuaBindings::LazyLuaBindings( sol::state& lua )
+	: m_LuaState{ lua }
+{
+}
+
+void LazyLuaBindings::Add( const std::string& sGroup, std::vector<std::string> globals, BindFunc bindFunc,
+						   std::vector<std::string> dependencies )
+{
+	if ( m_GroupIndices.contains( sGroup ) )
+	{
+		SCION_ERROR( "Failed to add lazy lua bindings [{}]. The group has already been added.", sGroup );
+		return;
+	}
+
+	const size_t groupIndex = m_Groups.size();
+	m_Groups.push_back(
+		Group{ .sName = sGroup, .bindFunc = std::move( bindFunc ), .dependencies = std::move( dependencies ) } );
+	m_GroupIndices.emplace( sGroup, groupIndex );
+
+	for ( auto& sGlobal : globals )
+	{
+		m_GlobalGroups.emplace( std::move( sGlobal ), groupIndex );
+	}
+}
+
+void LazyLuaBindings::Bind( const std::string& sGroup )
+{
+	auto itr = m_GroupIndices.find( sGroup );
+	if ( itr == m_GroupIndices.end() )
+	{
+		SCION_ERROR( "Failed to bind lazy lua bindings [{}]. The group does not exist.", sGroup );
+		return;
+	}
+
+	Bind( itr->second );
+}
+
+void LazyLuaBindings::BindAll()
+{
+	for ( size_t i = 0; i < m_Groups.size(); ++i )
+	{
+		Bind( i );
+	}
+}
+
+size_t LazyLuaBindings::NumBoundGroups() const
+{
+	return static_cast<size_t>( std::ranges::count_if( m_Groups, &Group::bBound ) );
+}
+
+void LazyLuaBindings::Bind( size_t groupIndex )
+{
+	// Marked first, so groups that depend on each other and globals read while binding do not recurse.
+	if ( m_Groups[ groupIndex ].bBound )
+		return;
+
+	m_Groups[ groupIndex ].bBound = true;
+
+	for ( const auto& sDependency : m_Groups[ groupIndex ].dependencies )
+	{
+		Bind( sDependency );
+	}
+
+	SCION_SUBSYSTEM_ZONE( "Lazy Lua Bind" );
+	m_Groups[ groupIndex ].bindFunc( m_LuaState );
+}
+
+void LazyLuaBindings::Install( const std::shared_ptr<LazyLuaBindings>& pBindings )
+{
+	auto& lua = pBindings->m_LuaState;
+	sol::table globalsMeta = lua.create_table();
+
+	globalsMeta[ sol::meta_function::index ] =
+		[ pBindings ]( sol::table globals, sol::stack_object key ) -> sol::object {
+		if ( key.get_type() != sol::type::string )
+			return sol::lua_nil;
+
+		auto itr = pBindings->m_GlobalGroups.find( key.as<std::string>() );
+		if ( itr == pBindings->m_GlobalGroups.end() )
+			return sol::lua_nil;
+
+		pBindings->Bind( itr->second );
+		return globals.raw_get<sol::object>( key );
+	};
+
+	lua.globals()[ sol::metatable_key ] = globalsMeta;
+}
+
+} // namespace Scion::Core::Scripting
@@ -0,0 +1,189 @@
+#include "Core/Scripting/LuaAllocator.h"
+#include <cstdlib>
+#include <cstring>
+
+namespace Scion::Core::Scripting
+{
+
+LuaAllocator::~LuaAllocator()
+{
+	for ( void* pPage : m_Pages )
+	{
+		std::free( pPage );
+	}
+}
+
+void* LuaAllocator::Allocate( void* ud, void* ptr, size_t osize, size_t nsize )
+{
+	auto* pAllocator = static_cast<LuaAllocator*>( ud );
+	auto& stats = pAllocator->m_Stats;
+
+	// When there is no block yet, osize is the type of the new object instead of a size.
+	const size_t oldSize = ptr ? osize : 0;
+
+	if ( nsize == 0 )
+	{
+		if ( ptr )
+		{
+			pAllocator->ReleaseBlock( ptr, oldSize );
+			stats.bytesInUse -= oldSize;
+		}
+
+		return nullptr;
+	}
+
+	void* pBlock = ptr ? pAllocator->ReallocateBlock( ptr, oldSize, nsize ) : pAllocator->AllocateBlock( nsize );
+	if ( !pBlock )
+		return nullptr;
+
+	if ( !ptr )
+	{
+		++stats.totalAllocations;
+		if ( nsize > MAX_POOLED_SIZE )
+			++stats.largeAllocations;
+	}
+
+	stats.bytesInUse = stats.bytesInUse - oldSize + nsize;
+	stats.peakBytesInUse = std::max( stats.peakBytesInUse, stats.bytesInUse );
+
+	return pBlock;
+}
+
+LuaAllocator* LuaAllocator::Get( lua_State* L )
+{
+	void* ud{ nullptr };
+	if ( lua_getallocf( L, &ud ) != &LuaAllocator::Allocate )
+		return nullptr;
+
+	return static_cast<LuaAllocator*>( ud );
+}
+
+int LuaAllocator::GetSizeClass( size_t size )
+{
+	// 16 byte steps up to 128 bytes, then 32 byte steps up to 256 bytes.
+	if ( size <= 128 )
+		return static_cast<int>( ( size + 15 ) / 16 ) - 1;
+
+	return 8 + static_cast<int>( ( size - 129 ) / 32 );
+}
+
+size_t LuaAllocator::GetClassSize( int sizeClass )
+{
+	return sizeClass < 8 ? static_cast<size_t>( sizeClass + 1 ) * 16 : 128 + static_cast<size_t>( sizeClass - 7 ) * 32;
+}
+
+void* LuaAllocator::AllocateBlock( size_t size )
+{
+	if ( size > MAX_POOLED_SIZE )
+		return std::malloc( size );
+
+	const int sizeClass = GetSizeClass( size );
+	if ( !m_FreeLists[ sizeClass ] && !AddPage( sizeClass ) )
+		return nullptr;
+
+	PoolBlock* pBlock = m_FreeLists[ sizeClass ];
+	m_FreeLists[ sizeClass ] = pBlock->pNext;
+
+	return pBlock;
+}
+
+void LuaAllocator::ReleaseBlock( void* ptr, size_t size )
+{
+	if ( size > MAX_POOLED_SIZE )
+	{
+		std::free( ptr );
+		return;
+	}
+
+	const int sizeClass = GetSizeClass( size );
+	auto* pBlock = static_cast<PoolBlock*>( ptr );
+	pBlock->pNext = m_FreeLists[ sizeClass ];
+	m_FreeLists[ sizeClass ] = pBlock;
+}
+
+void* LuaAllocator::ReallocateBlock( void* ptr, size_t osize, size_t nsize )
+{
+	if ( osize > MAX_POOLED_SIZE && nsize > MAX_POOLED_SIZE )
+		return std::realloc( ptr, nsize );
+
+	// The block is already large enough.
+	if ( osize <= MAX_POOLED_SIZE && nsize <= MAX_POOLED_SIZE && GetSizeClass( osize ) == GetSizeClass( nsize ) )
+		return ptr;
+
+	void* pBlock = AllocateBlock( nsize );
+	if ( !pBlock )
+		return nullptr;
+
+	std::memcpy( pBlock, ptr, std::min( osize, nsize ) );
+	ReleaseBlock( ptr, osize );
+
+	return pBlock;
+}
+
+bool LuaAllocator::AddPage( int sizeClass )
+{
+	auto* pPage = static_cast<std::byte*>( std::malloc( POOL_PAGE_SIZE ) );
+	if ( !pPage )
+		return false;
+
+	m_Pages.push_back( pPage );
+	m_Stats.pooledBytes += POOL_PAGE_SIZE;
+
+	const size_t blockSize = GetClassSize( sizeClass );
+	const size_t numBlocks = POOL_PAGE_SIZE / blockSize;
+
+	// Link the blocks in address order so they are handed out in that order.
+	for ( size_t i = numBlocks; i > 0; --i )
+	{
+		auto* pBlock = reinterpret_cast<PoolBlock*>( pPage + ( i - 1 ) * blockSize );
+		pBlock->pNext = m_FreeLists[ sizeClass ];
+		m_FreeLists[ sizeClass ] = pBlock;
+	}
+
+	return true;
+}
+
+std::shared_ptr<sol::state> CreateLuaState()
+{
+	auto pAllocator = std::make_unique<LuaAllocator>();
+	auto pLuaState = std::make_unique<sol::state>( sol::default_at_panic, &LuaAllocator::Allocate, pAllocator.get() );
+
+	// The state is closed before its allocator is freed.
+	return std::shared_ptr<sol::state>( pLuaState.release(), [ pAllocator = pAllocator.release() ]( sol::state* pLua ) {
+		delete pLua;
+		delete pAllocator;
+	} );
+}
+
+void ApplyGCSettings( lua_State* L, const LuaGCSettings& settings )
+{
+	if ( settings.eMode == ELuaGCMode::Generational )
+	{
+		lua_gc( L, LUA_GCGEN, settings.minorMultiplier, settings.majorMultiplier );
+	}
+	else
+	{
+		lua_gc( L, LUA_GCINC, settings.pause, settings.stepMultiplier, settings.stepSize );
+	}
+}
+
+LuaGCStepResult StepGarbageCollector( lua_State* L, ELuaGCMode eMode, double budgetMs )
+{
+	LuaGCStepResult result{};
+
+	// Leave the collector alone if a script has stopped it.
+	if ( budgetMs <= 0.0 || lua_gc( L, LUA_GCISRUNNING ) == 0 )
+		return result;
+
+	const auto start = std::chrono::steady_clock::now();
+	do
+	{
+		++result.steps;
+		result.bCycleFinished = lua_gc( L, LUA_GCSTEP, 0 ) != 0;
+		result.elapsedMs = std::chrono::duration<double, std::milli>( std::chrono::steady_clock::now() - start ).count();
+	} while ( eMode == ELuaGCMode::Incremental && !result.bCycleFinished && result.elapsedMs < budgetMs );
+
+	return result;
+}
+
+} // namespace Scion::Core::Scripting
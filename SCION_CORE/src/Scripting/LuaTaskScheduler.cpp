@@ -0,0 +1,526 @@
+#include "Core/Scripting/LuaTaskScheduler.h"
+#include "Core/ECS/Registry.h"
+#include "Core/ECS/MainRegistry.h"
+#include "Core/Resources/AssetManager.h"
+#include "Core/Resources/AsyncAssetLoader.h"
+#include "Core/Profiling/ProfileCollector.h"
+
+#include <ScionUtilities/ScionUtilities.h>
+#include <Logger/Logger.h>
+
+using namespace Scion::Utilities;
+
+namespace Scion::Core::Scripting
+{
+
+TimerWheel::TimerWheel( size_t numSlots )
+	: m_Slots( std::max( numSlots, size_t{ 1 } ) )
+{
+}
+
+void TimerWheel::Schedule( std::uint32_t taskID, std::uint32_t serial, std::uint64_t ticks )
+{
+	ticks = std::max( ticks, std::uint64_t{ 1 } );
+	const size_t numSlots = m_Slots.size();
+
+	// The slot is passed once every turn, the entry expires on the turn its ticks are used up.
+	m_Slots[ ( m_CurrentSlot + ticks ) % numSlots ].push_back(
+		Entry{ .taskID = taskID, .serial = serial, .rounds = ( ticks - 1 ) / numSlots } );
+	++m_Size;
+}
+
+void TimerWheel::Clear()
+{
+	for ( auto& slot : m_Slots )
+	{
+		slot.clear();
+	}
+
+	m_Size = 0;
+}
+
+LuaTaskScheduler::LuaTaskScheduler( lua_State* L )
+	: m_pLuaState{ L }
+	, m_TimeWheel{ TIME_WHEEL_SLOTS }
+	, m_FrameWheel{ FRAME_WHEEL_SLOTS }
+{
+}
+
+void LuaTaskScheduler::Update( double deltaTime )
+{
+	auto onExpired = [ this ]( std::uint32_t taskID, std::uint32_t serial ) {
+		m_ReadyTasks.push_back( ReadyTask{ .taskID = taskID, .serial = serial } );
+	};
+
+	m_FrameWheel.Advance( 1, onExpired );
+
+	m_PartialTicks += deltaTime * 1000.0 / TIME_TICK_MS;
+	const auto ticks = static_cast<std::uint64_t>( m_PartialTicks );
+	m_PartialTicks -= static_cast<double>( ticks );
+	m_TimeWheel.Advance( ticks, onExpired );
+
+	PollAssets();
+	PollLoads();
+
+	// Tasks woken while these run are resumed on the next update.
+	std::swap( m_ResumingTasks, m_ReadyTasks );
+	for ( const auto& readyTask : m_ResumingTasks )
+	{
+		Resume( m_pLuaState, readyTask );
+	}
+
+	SCION_PROFILE_COUNTER( "Lua Tasks", m_Tasks.size() );
+	SCION_PROFILE_COUNTER( "Lua Tasks Resumed", m_ResumingTasks.size() );
+	m_ResumingTasks.clear();
+}
+
+void LuaTaskScheduler::EmitEvent( const std::string& sEvent, int argsRef )
+{
+	WakeWaiters( m_pLuaState, m_EventWaiters, sEvent, argsRef );
+}
+
+void LuaTaskScheduler::NotifySceneLoaded( const std::string& sSceneName )
+{
+	WakeWaiters( m_pLuaState, m_SceneWaiters, sSceneName, LUA_NOREF );
+}
+
+void LuaTaskScheduler::Cancel( std::uint32_t taskID )
+{
+	Cancel( m_pLuaState, taskID );
+}
+
+bool LuaTaskScheduler::IsAlive( std::uint32_t taskID ) const
+{
+	auto itr = m_Tasks.find( taskID );
+	return itr != m_Tasks.end() && !itr->second.bCancelled;
+}
+
+std::uint32_t LuaTaskScheduler::Spawn( lua_State* L, int numArgs )
+{
+	lua_State* pThread = lua_newthread( L );
+	const int threadRef = luaL_ref( L, LUA_REGISTRYINDEX );
+
+	// The function and its arguments wait on the thread for the first resume.
+	lua_xmove( L, pThread, numArgs + 1 );
+
+	const std::uint32_t taskID = m_NextTaskID++;
+	m_Tasks.emplace( taskID, Task{ .id = taskID, .pThread = pThread, .threadRef = threadRef, .numStartArgs = numArgs } );
+
+	Resume( L, ReadyTask{ .taskID = taskID } );
+	return taskID;
+}
+
+void LuaTaskScheduler::Resume( lua_State* L, const ReadyTask& readyTask )
+{
+	auto itr = m_Tasks.find( readyTask.taskID );
+	if ( itr == m_Tasks.end() || itr->second.serial != readyTask.serial || itr->second.bCancelled )
+	{
+		luaL_unref( L, LUA_REGISTRYINDEX, readyTask.argsRef );
+		return;
+	}
+
+	// Tasks are stored by node, the reference stays valid while the task spawns other tasks.
+	auto& task = itr->second;
+	lua_State* pThread = task.pThread;
+
+	int numArgs{ 0 };
+	if ( !task.bStarted )
+	{
+		numArgs = task.numStartArgs;
+		task.bStarted = true;
+	}
+	else if ( readyTask.argsRef != LUA_NOREF )
+	{
+		lua_rawgeti( pThread, LUA_REGISTRYINDEX, readyTask.argsRef );
+		luaL_unref( pThread, LUA_REGISTRYINDEX, readyTask.argsRef );
+
+		const int argsIndex = lua_gettop( pThread );
+		lua_getfield( pThread, argsIndex, "n" );
+		numArgs = static_cast<int>( lua_tointeger( pThread, -1 ) );
+		lua_pop( pThread, 1 );
+
+		if ( !lua_checkstack( pThread, numArgs ) )
+		{
+			SCION_ERROR( "Failed to resume lua task [{}] - Too many event arguments.", task.id );
+			lua_settop( pThread, argsIndex - 1 );
+			numArgs = 0;
+		}
+		else
+		{
+			for ( int i = 1; i <= numArgs; ++i )
+			{
+				lua_rawgeti( pThread, argsIndex, i );
+			}
+
+			lua_remove( pThread, argsIndex );
+		}
+	}
+
+	task.eWait = ETaskWait::None;
+	task.bRunning = true;
+
+	const std::uint32_t previousTaskID = m_RunningTaskID;
+	m_RunningTaskID = task.id;
+
+	int numResults{ 0 };
+	const int status = lua_resume( pThread, L, numArgs, &numResults );
+
+	m_RunningTaskID = previousTaskID;
+	task.bRunning = false;
+
+	if ( status == LUA_YIELD )
+	{
+		lua_pop( pThread, numResults );
+
+		if ( task.bCancelled )
+		{
+			Finish( L, task.id );
+		}
+		else if ( task.eWait == ETaskWait::None )
+		{
+			// A plain coroutine.yield() waits for the next frame.
+			WaitFrames( task, 1 );
+		}
+
+		return;
+	}
+
+	if ( status != LUA_OK )
+	{
+		luaL_traceback( pThread, pThread, lua_tostring( pThread, -1 ), 0 );
+		SCION_ERROR( "Lua task [{}] failed: {}", task.id, lua_tostring( pThread, -1 ) );
+	}
+
+	Finish( L, task.id );
+}
+
+void LuaTaskScheduler::Finish( lua_State* L, std::uint32_t taskID )
+{
+	auto itr = m_Tasks.find( taskID );
+	if ( itr == m_Tasks.end() )
+		return;
+
+	// Timers and waiters of the task are dropped when they come up.
+	luaL_unref( L, LUA_REGISTRYINDEX, itr->second.threadRef );
+	m_Tasks.erase( itr );
+}
+
+void LuaTaskScheduler::Cancel( lua_State* L, std::uint32_t taskID )
+{
+	auto itr = m_Tasks.find( taskID );
+	if ( itr == m_Tasks.end() )
+		return;
+
+	if ( itr->second.bRunning )
+	{
+		itr->second.bCancelled = true;
+		return;
+	}
+
+	Finish( L, taskID );
+}
+
+bool LuaTaskScheduler::IsWaiting( std::uint32_t taskID, std::uint32_t serial ) const
+{
+	auto itr = m_Tasks.find( taskID );
+	return itr != m_Tasks.end() && itr->second.serial == serial;
+}
+
+LuaTaskScheduler::Task& LuaTaskScheduler::GetRunningTask( lua_State* L, const char* sFunction )
+{
+	auto itr = m_Tasks.find( m_RunningTaskID );
+	if ( itr == m_Tasks.end() || itr->second.pThread != L )
+	{
+		luaL_error( L, "%s can only be called from a task started with Task.spawn.", sFunction );
+	}
+
+	return itr->second;
+}
+
+void LuaTaskScheduler::BeginWait( Task& task, ETaskWait eWait )
+{
+	task.eWait = eWait;
+	++task.serial;
+}
+
+void LuaTaskScheduler::WaitSeconds( Task& task, double seconds )
+{
+	BeginWait( task, ETaskWait::Time );
+
+	// The wheel is behind the current time by the partial tick.
+	const double ticks = std::ceil( m_PartialTicks + std::max( seconds, 0.0 ) * 1000.0 / TIME_TICK_MS );
+	m_TimeWheel.Schedule( task.id, task.serial, static_cast<std::uint64_t>( ticks ) );
+}
+
+void LuaTaskScheduler::WaitFrames( Task& task, std::uint64_t frames )
+{
+	BeginWait( task, ETaskWait::Frames );
+	m_FrameWheel.Schedule( task.id, task.serial, frames );
+}
+
+void LuaTaskScheduler::AddWaiter( WaitList& waiters, const Task& task )
+{
+	// Drop the waits of tasks that were cancelled or finished before they were woken.
+	std::erase_if( waiters, [ this ]( const auto& waiter ) { return !IsWaiting( waiter.first, waiter.second ); } );
+	waiters.emplace_back( task.id, task.serial );
+}
+
+void LuaTaskScheduler::WakeWaiters( lua_State* L, std::unordered_map<std::string, WaitList>& waiters,
+									const std::string& sKey, int argsRef )
+{
+	auto itr = waiters.find( sKey );
+	if ( itr != waiters.end() )
+	{
+		for ( const auto& [ taskID, serial ] : itr->second )
+		{
+			if ( !IsWaiting( taskID, serial ) )
+				continue;
+
+			// Every task gets its own reference to the arguments.
+			int taskArgsRef{ LUA_NOREF };
+			if ( argsRef != LUA_NOREF )
+			{
+				lua_rawgeti( L, LUA_REGISTRYINDEX, argsRef );
+				taskArgsRef = luaL_ref( L, LUA_REGISTRYINDEX );
+			}
+
+			m_ReadyTasks.push_back( ReadyTask{ .taskID = taskID, .serial = serial, .argsRef = taskArgsRef } );
+		}
+
+		waiters.erase( itr );
+	}
+
+	luaL_unref( L, LUA_REGISTRYINDEX, argsRef );
+}
+
+void LuaTaskScheduler::PollAssets()
+{
+	if ( m_AssetWaits.empty() )
+		return;
+
+	auto& assetManager = ASSET_MANAGER();
+	std::erase_if( m_AssetWaits, [ & ]( const AssetWait& wait ) {
+		if ( !IsWaiting( wait.taskID, wait.serial ) )
+			return true;
+
+		if ( !assetManager.CheckHasAsset( wait.sAssetName, static_cast<AssetType>( wait.assetType ) ) )
+			return false;
+
+		m_ReadyTasks.push_back( ReadyTask{ .taskID = wait.taskID, .serial = wait.serial } );
+		return true;
+	} );
+}
+
+void LuaTaskScheduler::PollLoads()
+{
+	if ( m_LoadWaits.empty() )
+		return;
+
+	lua_State* L = m_pLuaState;
+	std::erase_if( m_LoadWaits, [ & ]( const LoadWait& wait ) {
+		if ( !IsWaiting( wait.taskID, wait.serial ) )
+			return true;
+
+		if ( !wait.pLoad->IsDone() )
+			return false;
+
+		// The wait returns if the load succeeded.
+		lua_createtable( L, 1, 1 );
+		lua_pushboolean( L, wait.pLoad->IsReady() );
+		lua_rawseti( L, -2, 1 );
+		lua_pushinteger( L, 1 );
+		lua_setfield( L, -2, "n" );
+
+		m_ReadyTasks.push_back(
+			ReadyTask{ .taskID = wait.taskID, .serial = wait.serial, .argsRef = luaL_ref( L, LUA_REGISTRYINDEX ) } );
+		return true;
+	} );
+}
+
+LuaTaskScheduler* LuaTaskScheduler::GetScheduler( lua_State* L )
+{
+	return static_cast<LuaTaskScheduler*>( lua_touserdata( L, lua_upvalueindex( 1 ) ) );
+}
+
+int LuaTaskScheduler::LuaSpawn( lua_State* L )
+{
+	luaL_checktype( L, 1, LUA_TFUNCTION );
+
+	const std::uint32_t taskID = GetScheduler( L )->Spawn( L, lua_gettop( L ) - 1 );
+	lua_pushinteger( L, taskID );
+	return 1;
+}
+
+int LuaTaskScheduler::LuaWait( lua_State* L )
+{
+	auto* pScheduler = GetScheduler( L );
+	auto& task = pScheduler->GetRunningTask( L, "Task.wait" );
+
+	pScheduler->WaitSeconds( task, luaL_checknumber( L, 1 ) );
+	return lua_yield( L, 0 );
+}
+
+int LuaTaskScheduler::LuaWaitFrames( lua_State* L )
+{
+	auto* pScheduler = GetScheduler( L );
+	auto& task = pScheduler->GetRunningTask( L, "Task.waitFrames" );
+
+	pScheduler->WaitFrames( task, static_cast<std::uint64_t>( std::max( luaL_optinteger( L, 1, 1 ), lua_Integer{ 1 } ) ) );
+	return lua_yield( L, 0 );
+}
+
+int LuaTaskScheduler::LuaWaitEvent( lua_State* L )
+{
+	auto* pScheduler = GetScheduler( L );
+	auto& task = pScheduler->GetRunningTask( L, "Task.waitEvent" );
+	const char* sEvent = luaL_checkstring( L, 1 );
+
+	pScheduler->BeginWait( task, ETaskWait::Event );
+	pScheduler->AddWaiter( pScheduler->m_EventWaiters[ sEvent ], task );
+
+	// The arguments of the emit are the results of the wait.
+	return lua_yield( L, 0 );
+}
+
+int LuaTaskScheduler::LuaWaitScene( lua_State* L )
+{
+	auto* pScheduler = GetScheduler( L );
+	auto& task = pScheduler->GetRunningTask( L, "Task.waitScene" );
+	const char* sSceneName = luaL_checkstring( L, 1 );
+
+	pScheduler->BeginWait( task, ETaskWait::Scene );
+	pScheduler->AddWaiter( pScheduler->m_SceneWaiters[ sSceneName ], task );
+
+	return lua_yield( L, 0 );
+}
+
+int LuaTaskScheduler::LuaWaitAsset( lua_State* L )
+{
+	auto* pScheduler = GetScheduler( L );
+	auto& task = pScheduler->GetRunningTask( L, "Task.waitAsset" );
+	const char* sAssetName = luaL_checkstring( L, 1 );
+	const auto assetType = static_cast<AssetType>( luaL_checkinteger( L, 2 ) );
+
+	switch ( assetType )
+	{
+	case AssetType::TEXTURE:
+	case AssetType::FONT:
+	case AssetType::SOUNDFX:
+	case AssetType::MUSIC:
+	case AssetType::PREFAB: break;
+	default: return luaL_argerror( L, 2, "the asset type cannot be waited for" );
+	}
+
+	// Nothing to wait for if the asset is already loaded.
+	if ( ASSET_MANAGER().CheckHasAsset( sAssetName, assetType ) )
+		return 0;
+
+	pScheduler->BeginWait( task, ETaskWait::Asset );
+	pScheduler->m_AssetWaits.push_back( AssetWait{ .taskID = task.id,
+												   .serial = task.serial,
+												   .sAssetName = sAssetName,
+												   .assetType = static_cast<int>( assetType ) } );
+
+	return lua_yield( L, 0 );
+}
+
+int LuaTaskScheduler::LuaWaitLoad( lua_State* L )
+{
+	auto* pScheduler = GetScheduler( L );
+	auto& task = pScheduler->GetRunningTask( L, "Task.waitLoad" );
+
+	auto optLoad = sol::stack::check_get<std::shared_ptr<SCION_RESOURCES::AsyncLoad>>( L, 1 );
+	if ( !optLoad || !*optLoad )
+		return luaL_argerror( L, 1, "expected an async load handle" );
+
+	// Nothing to wait for if the load is already done.
+	if ( ( *optLoad )->IsDone() )
+	{
+		lua_pushboolean( L, ( *optLoad )->IsReady() );
+		return 1;
+	}
+
+	pScheduler->BeginWait( task, ETaskWait::Load );
+	pScheduler->m_LoadWaits.push_back(
+		LoadWait{ .taskID = task.id, .serial = task.serial, .pLoad = std::move( *optLoad ) } );
+
+	return lua_yield( L, 0 );
+}
+
+int LuaTaskScheduler::LuaEmit( lua_State* L )
+{
+	auto* pScheduler = GetScheduler( L );
+	const char* sEvent = luaL_checkstring( L, 1 );
+	const int numArgs = lua_gettop( L ) - 1;
+
+	int argsRef{ LUA_NOREF };
+	if ( numArgs > 0 )
+	{
+		lua_createtable( L, numArgs, 1 );
+		for ( int i = 1; i <= numArgs; ++i )
+		{
+			lua_pushvalue( L, i + 1 );
+			lua_rawseti( L, -2, i );
+		}
+
+		lua_pushinteger( L, numArgs );
+		lua_setfield( L, -2, "n" );
+		argsRef = luaL_ref( L, LUA_REGISTRYINDEX );
+	}
+
+	pScheduler->WakeWaiters( L, pScheduler->m_EventWaiters, sEvent, argsRef );
+	return 0;
+}
+
+int LuaTaskScheduler::LuaCancel( lua_State* L )
+{
+	GetScheduler( L )->Cancel( L, static_cast<std::uint32_t>( luaL_checkinteger( L, 1 ) ) );
+	return 0;
+}
+
+int LuaTaskScheduler::LuaIsAlive( lua_State* L )
+{
+	lua_pushboolean( L, GetScheduler( L )->IsAlive( static_cast<std::uint32_t>( luaL_checkinteger( L, 1 ) ) ) );
+	return 1;
+}
+
+int LuaTaskScheduler::LuaCount( lua_State* L )
+{
+	lua_pushinteger( L, static_cast<lua_Integer>( GetScheduler( L )->NumTasks() ) );
+	return 1;
+}
+
+void LuaTaskScheduler::CreateLuaTaskSchedulerBind( sol::state& lua, Scion::Core::ECS::Registry& registry )
+{
+	auto pScheduler = registry.AddToContext<std::shared_ptr<LuaTaskScheduler>>(
+		std::make_shared<LuaTaskScheduler>( lua.lua_state() ) );
+
+	lua.new_enum<AssetType>( "AssetType",
+							 { { "Texture", AssetType::TEXTURE },
+							   { "Font", AssetType::FONT },
+							   { "SoundFx", AssetType::SOUNDFX },
+							   { "Music", AssetType::MUSIC },
+							   { "Prefab", AssetType::PREFAB } } );
+
+	// The wait functions yield, so the Task functions are plain lua C functions with the scheduler as upvalue.
+	static constexpr luaL_Reg taskFunctions[] = { { "spawn", &LuaTaskScheduler::LuaSpawn },
+												  { "wait", &LuaTaskScheduler::LuaWait },
+												  { "waitFrames", &LuaTaskScheduler::LuaWaitFrames },
+												  { "waitEvent", &LuaTaskScheduler::LuaWaitEvent },
+												  { "waitScene", &LuaTaskScheduler::LuaWaitScene },
+												  { "waitAsset", &LuaTaskScheduler::LuaWaitAsset },
+												  { "waitLoad", &LuaTaskScheduler::LuaWaitLoad },
+												  { "emit", &LuaTaskScheduler::LuaEmit },
+												  { "cancel", &LuaTaskScheduler::LuaCancel },
+												  { "isAlive", &LuaTaskScheduler::LuaIsAlive },
+												  { "count", &LuaTaskScheduler::LuaCount },
+												  { nullptr, nullptr } };
+
+	lua_State* L = lua.lua_state();
+	luaL_newlibtable( L, taskFunctions );
+	lua_pushlightuserdata( L, pScheduler.get() );
+	luaL_setfuncs( L, taskFunctions, 1 );
+	lua_setglobal( L, "Task" );
+}
+
+} // namespace Scion::Core::Scripting
@@ -0,0 +1,548 @@
+#include "Core/Scripting/LuaWorkerPool.h"
+#include "Core/Scripting/LuaAllocator.h"
+#include "Core/Scripting/GlmLuaBindings.h"
+#include "Core/ECS/Registry.h"
+#include "Core/ECS/Entity.h"
+#include "Core/ECS/Components/TransformComponent.h"
+#include "Core/Profiling/ProfileCollector.h"
+
+#include <ScionUtilities/ThreadPool.h>
+#include <Logger/Logger.h>
+#include <format>
+
+using namespace Scion::Core::ECS;
+
+namespace
+{
+constexpr int MAX_VALUE_DEPTH = 32;
+
+int WriteBytecode( lua_State*, const void* pData, size_t size, void* pBuffer )
+{
+	static_cast<std::string*>( pBuffer )->append( static_cast<const char*>( pData ), size );
+	return 0;
+}
+
+Scion::Core::Scripting::JobValue MakeNumber( double number )
+{
+	return Scion::Core::Scripting::JobValue{ .eType = Scion::Core::Scripting::JobValue::EType::Number,
+											 .number = number };
+}
+
+Scion::Core::Scripting::JobValue MakeString( const std::string& sValue )
+{
+	return Scion::Core::Scripting::JobValue{ .eType = Scion::Core::Scripting::JobValue::EType::String,
+											 .sValue = sValue };
+}
+
+/* @brief Makes a table of the named numbers, { x = 1, y = 2 }. */
+Scion::Core::Scripting::JobValue MakeVectorTable( std::initializer_list<std::pair<const char*, float>> components )
+{
+	Scion::Core::Scripting::JobValue table{ .eType = Scion::Core::Scripting::JobValue::EType::Table };
+	for ( const auto& [ sName, value ] : components )
+	{
+		table.fields.push_back( MakeString( sName ) );
+		table.fields.push_back( MakeNumber( value ) );
+	}
+
+	return table;
+}
+
+/* @brief Copies the engine userdata the jobs understand. Returns false for anything else. */
+bool ReadUserData( lua_State* L, int index, Scion::Core::Scripting::JobValue& value )
+{
+	if ( sol::stack::check<Entity>( L, index, sol::no_panic ) )
+	{
+		auto& entity = sol::stack::get<Entity&>( L, index );
+		value = Scion::Core::Scripting::JobValue{ .eType = Scion::Core::Scripting::JobValue::EType::Integer,
+												  .integer = static_cast<lua_Integer>(
+													  entt::to_integral( entity.GetEntity() ) ) };
+		return true;
+	}
+
+	if ( sol::stack::check<glm::vec2>( L, index, sol::no_panic ) )
+	{
+		const auto& vec = sol::stack::get<glm::vec2&>( L, index );
+		value = MakeVectorTable( { { "x", vec.x }, { "y", vec.y } } );
+		return true;
+	}
+
+	if ( sol::stack::check<glm::vec3>( L, index, sol::no_panic ) )
+	{
+		const auto& vec = sol::stack::get<glm::vec3&>( L, index );
+		value = MakeVectorTable( { { "x", vec.x }, { "y", vec.y }, { "z", vec.z } } );
+		return true;
+	}
+
+	if ( sol::stack::check<glm::vec4>( L, index, sol::no_panic ) )
+	{
+		const auto& vec = sol::stack::get<glm::vec4&>( L, index );
+		value = MakeVectorTable( { { "x", vec.x }, { "y", vec.y }, { "z", vec.z }, { "w", vec.w } } );
+		return true;
+	}
+
+	if ( sol::stack::check<TransformComponent>( L, index, sol::no_panic ) )
+	{
+		const auto& transform = sol::stack::get<TransformComponent&>( L, index );
+		value = Scion::Core::Scripting::JobValue{ .eType = Scion::Core::Scripting::JobValue::EType::Table };
+		value.fields.push_back( MakeString( "position" ) );
+		value.fields.push_back( MakeVectorTable( { { "x", transform.position.x }, { "y", transform.position.y } } ) );
+		value.fields.push_back( MakeString( "scale" ) );
+		value.fields.push_back( MakeVectorTable( { { "x", transform.scale.x }, { "y", transform.scale.y } } ) );
+		value.fields.push_back( MakeString( "rotation" ) );
+		value.fields.push_back( MakeNumber( transform.rotation ) );
+		return true;
+	}
+
+	return false;
+}
+
+/* @brief Pushes the values as lua objects, so they can be returned as multiple results. */
+sol::variadic_results ToResults( lua_State* L, const std::vector<Scion::Core::Scripting::JobValue>& values )
+{
+	sol::variadic_results results;
+	for ( const auto& value : values )
+	{
+		Scion::Core::Scripting::LuaWorkerPool::PushValue( L, value );
+		results.push_back( sol::object{ L, -1 } );
+		lua_pop( L, 1 );
+	}
+
+	return results;
+}
+} // namespace
+
+namespace Scion::Core::Scripting
+{
+
+bool LuaJob::Collect()
+{
+	if ( eStatus != EJobStatus::Pending )
+		return true;
+
+	if ( !output.valid() || output.wait_for( std::chrono::seconds{ 0 } ) != std::future_status::ready )
+		return false;
+
+	auto jobOutput = output.get();
+	if ( pCancelled->load() )
+	{
+		eStatus = EJobStatus::Cancelled;
+		return true;
+	}
+
+	eStatus = jobOutput.bSuccess ? EJobStatus::Done : EJobStatus::Failed;
+	results = std::move( jobOutput.results );
+	sError = std::move( jobOutput.sError );
+	return true;
+}
+
+void LuaJob::Wait()
+{
+	if ( eStatus == EJobStatus::Pending && output.valid() )
+		output.wait();
+
+	Collect();
+}
+
+LuaWorkerPool::LuaWorkerPool( size_t numWorkers )
+{
+	numWorkers = std::max( numWorkers, size_t{ 1 } );
+
+	for ( size_t i = 0; i < numWorkers; ++i )
+	{
+		auto pWorker = std::make_unique<Worker>();
+		pWorker->pLuaState = CreateLuaState();
+
+		auto& lua = *pWorker->pLuaState;
+		lua.open_libraries(
+			sol::lib::base, sol::lib::math, sol::lib::string, sol::lib::table, sol::lib::utf8, sol::lib::coroutine );
+		GLMBindings::CreateGLMBindings( lua );
+
+		m_FreeWorkers.push_back( pWorker.get() );
+		m_Workers.push_back( std::move( pWorker ) );
+	}
+
+	m_pThreadPool = std::make_unique<Scion::Utilities::ThreadPool>( numWorkers );
+}
+
+LuaWorkerPool::~LuaWorkerPool()
+{
+	// Jobs that have not started are skipped, the thread pool waits for the running ones.
+	m_bStopping = true;
+	m_pThreadPool.reset();
+}
+
+bool LuaWorkerPool::DeclareModule( lua_State* L, const std::string& sModule, int index )
+{
+	if ( !lua_istable( L, index ) )
+	{
+		SCION_ERROR( "Failed to declare job module [{}]. A module must be a table.", sModule );
+		return false;
+	}
+
+	Module module{ .sName = sModule };
+	std::string sError{};
+	if ( !ReadValue( L, index, module.table, sError, true ) )
+	{
+		SCION_ERROR( "Failed to declare job module [{}]: {}", sModule, sError );
+		return false;
+	}
+
+	std::lock_guard lock( m_ModuleMutex );
+	auto itr = std::ranges::find( m_Modules, sModule, &Module::sName );
+	if ( itr != m_Modules.end() )
+		*itr = std::move( module );
+	else
+		m_Modules.push_back( std::move( module ) );
+
+	++m_ModulesVersion;
+	return true;
+}
+
+std::shared_ptr<LuaJob> LuaWorkerPool::Run( lua_State* L, const std::string& sModule, const std::string& sFunction,
+											int firstArg, int numArgs )
+{
+	std::vector<JobValue> args( static_cast<size_t>( std::max( numArgs, 0 ) ) );
+	std::string sError{};
+
+	for ( int i = 0; i < numArgs; ++i )
+	{
+		if ( !ReadValue( L, firstArg + i, args[ i ], sError, false ) )
+		{
+			SCION_ERROR( "Failed to run job [{}.{}]. Argument {}: {}", sModule, sFunction, i + 1, sError );
+			return nullptr;
+		}
+	}
+
+	auto pJob = std::make_shared<LuaJob>();
+	pJob->id = m_NextJobID++;
+
+	try
+	{
+		pJob->output = m_pThreadPool->Enqueue(
+			[ this, sModule, sFunction, args = std::move( args ), pCancelled = pJob->pCancelled ] {
+				return RunJob( sModule, sFunction, args, *pCancelled );
+			} );
+	}
+	catch ( const std::exception& ex )
+	{
+		SCION_ERROR( "Failed to enqueue job [{}.{}]: {}", sModule, sFunction, ex.what() );
+		return nullptr;
+	}
+
+	m_PendingJobs.push_back( pJob );
+	return pJob;
+}
+
+void LuaWorkerPool::Update()
+{
+	std::erase_if( m_PendingJobs, []( const auto& pJob ) { return pJob->Collect(); } );
+	SCION_PROFILE_COUNTER( "Lua Jobs", m_PendingJobs.size() );
+}
+
+LuaWorkerPool::Worker* LuaWorkerPool::AcquireWorker()
+{
+	// There is a worker for every thread of the pool, so one is always free.
+	std::lock_guard lock( m_WorkerMutex );
+	SCION_ASSERT( !m_FreeWorkers.empty() && "There must be a free lua worker for every job thread." );
+	auto* pWorker = m_FreeWorkers.back();
+	m_FreeWorkers.pop_back();
+	return pWorker;
+}
+
+void LuaWorkerPool::ReleaseWorker( Worker* pWorker )
+{
+	std::lock_guard lock( m_WorkerMutex );
+	m_FreeWorkers.push_back( pWorker );
+}
+
+void LuaWorkerPool::LoadModules( Worker& worker )
+{
+	std::vector<Module> modules;
+
+	{
+		std::lock_guard lock( m_ModuleMutex );
+		if ( worker.modulesVersion == m_ModulesVersion )
+			return;
+
+		modules = m_Modules;
+		worker.modulesVersion = m_ModulesVersion;
+	}
+
+	lua_State* L = worker.pLuaState->lua_state();
+	for ( const auto& module : modules )
+	{
+		PushValue( L, module.table );
+		lua_setglobal( L, module.sName.c_str() );
+	}
+}
+
+LuaJob::Output LuaWorkerPool::RunJob( const std::string& sModule, const std::string& sFunction,
+									  const std::vector<JobValue>& args, const std::atomic<bool>& bCancelled )
+{
+	LuaJob::Output output{};
+	if ( m_bStopping || bCancelled )
+	{
+		output.sError = "The job was cancelled.";
+		return output;
+	}
+
+	auto* pWorker = AcquireWorker();
+	LoadModules( *pWorker );
+
+	lua_State* L = pWorker->pLuaState->lua_state();
+	const int top = lua_gettop( L );
+
+	lua_pushcfunction( L, []( lua_State* L ) {
+		luaL_traceback( L, L, lua_tostring( L, 1 ), 1 );
+		return 1;
+	} );
+	const int handler = lua_gettop( L );
+
+	if ( lua_getglobal( L, sModule.c_str() ) != LUA_TTABLE )
+	{
+		output.sError = std::format( "Module [{}] has not been declared.", sModule );
+	}
+	else if ( lua_getfield( L, -1, sFunction.c_str() ) != LUA_TFUNCTION )
+	{
+		output.sError = std::format( "Module [{}] has no function [{}].", sModule, sFunction );
+	}
+	else
+	{
+		for ( const auto& arg : args )
+		{
+			PushValue( L, arg );
+		}
+
+		const int funcIndex = lua_gettop( L ) - static_cast<int>( args.size() );
+		if ( lua_pcall( L, static_cast<int>( args.size() ), LUA_MULTRET, handler ) != LUA_OK )
+		{
+			output.sError = lua_tostring( L, -1 ) ? lua_tostring( L, -1 ) : "Unknown error.";
+		}
+		else
+		{
+			output.bSuccess = true;
+			const int numResults = lua_gettop( L ) - funcIndex + 1;
+			output.results.resize( static_cast<size_t>( numResults ) );
+
+			for ( int i = 0; i < numResults && output.bSuccess; ++i )
+			{
+				std::string sError{};
+				if ( !ReadValue( L, funcIndex + i, output.results[ i ], sError, false ) )
+				{
+					output.bSuccess = false;
+					output.sError = std::format( "Result {}: {}", i + 1, sError );
+					output.results.clear();
+				}
+			}
+		}
+	}
+
+	lua_settop( L, top );
+	ReleaseWorker( pWorker );
+	return output;
+}
+
+bool LuaWorkerPool::ReadValue( lua_State* L, int index, JobValue& value, std::string& sError, bool bAllowFunctions,
+							   int depth )
+{
+	index = lua_absindex( L, index );
+
+	switch ( lua_type( L, index ) )
+	{
+	case LUA_TNIL: value = JobValue{}; return true;
+	case LUA_TBOOLEAN:
+		value = JobValue{ .eType = JobValue::EType::Boolean, .bValue = lua_toboolean( L, index ) != 0 };
+		return true;
+	case LUA_TNUMBER:
+		if ( lua_isinteger( L, index ) )
+			value = JobValue{ .eType = JobValue::EType::Integer, .integer = lua_tointeger( L, index ) };
+		else
+			value = MakeNumber( lua_tonumber( L, index ) );
+		return true;
+	case LUA_TSTRING: {
+		size_t length{ 0 };
+		const char* pString = lua_tolstring( L, index, &length );
+		value = JobValue{ .eType = JobValue::EType::String, .sValue = std::string{ pString, length } };
+		return true;
+	}
+	case LUA_TTABLE: {
+		if ( depth >= MAX_VALUE_DEPTH )
+		{
+			sError = "Tables are nested too deep, or contain themselves.";
+			return false;
+		}
+
+		value = JobValue{ .eType = JobValue::EType::Table };
+		lua_pushnil( L );
+		while ( lua_next( L, index ) )
+		{
+			const int keyType = lua_type( L, -2 );
+			if ( keyType != LUA_TNUMBER && keyType != LUA_TSTRING && keyType != LUA_TBOOLEAN )
+			{
+				sError = std::format( "Table keys of type [{}] cannot be copied.", luaL_typename( L, -2 ) );
+				lua_pop( L, 2 );
+				return false;
+			}
+
+			JobValue& key = value.fields.emplace_back();
+			ReadValue( L, -2, key, sError, false, depth + 1 );
+
+			// Keep the key on the stack for lua_next.
+			JobValue& field = value.fields.emplace_back();
+			if ( !ReadValue( L, -1, field, sError, bAllowFunctions, depth + 1 ) )
+			{
+				lua_pop( L, 2 );
+				return false;
+			}
+
+			lua_pop( L, 1 );
+		}
+
+		return true;
+	}
+	case LUA_TFUNCTION: {
+		if ( !bAllowFunctions )
+		{
+			sError = "Functions can only be copied in modules.";
+			return false;
+		}
+
+		if ( lua_iscfunction( L, index ) )
+		{
+			sError = "Native functions cannot be copied.";
+			return false;
+		}
+
+		// The only upvalue a copied function can keep is the globals table, which is set when it is loaded.
+		// Stripped bytecode has no upvalue names.
+		for ( int n = 1; const char* sUpvalue = lua_getupvalue( L, index, n ); ++n )
+		{
+			lua_pop( L, 1 );
+			const std::string_view sName{ sUpvalue };
+			if ( n > 1 || ( sName != "_ENV" && sName != "(no name)" && !sName.empty() ) )
+			{
+				sError = std::format( "Module functions cannot use locals from outside, found [{}].", sUpvalue );
+				return false;
+			}
+		}
+
+		value = JobValue{ .eType = JobValue::EType::Function };
+		lua_pushvalue( L, index );
+		lua_dump( L, &WriteBytecode, &value.sValue, 0 );
+		lua_pop( L, 1 );
+		return true;
+	}
+	case LUA_TUSERDATA:
+		if ( ReadUserData( L, index, value ) )
+			return true;
+		[[fallthrough]];
+	default:
+		sError = std::format( "Values of type [{}] cannot be copied.", luaL_typename( L, index ) );
+		return false;
+	}
+}
+
+void LuaWorkerPool::PushValue( lua_State* L, const JobValue& value )
+{
+	switch ( value.eType )
+	{
+	case JobValue::EType::Nil: lua_pushnil( L ); break;
+	case JobValue::EType::Boolean: lua_pushboolean( L, value.bValue ); break;
+	case JobValue::EType::Integer: lua_pushinteger( L, value.integer ); break;
+	case JobValue::EType::Number: lua_pushnumber( L, value.number ); break;
+	case JobValue::EType::String: lua_pushlstring( L, value.sValue.data(), value.sValue.size() ); break;
+	case JobValue::EType::Table: {
+		lua_createtable( L, 0, static_cast<int>( value.fields.size() / 2 ) );
+		for ( size_t i = 0; i + 1 < value.fields.size(); i += 2 )
+		{
+			PushValue( L, value.fields[ i ] );
+			PushValue( L, value.fields[ i + 1 ] );
+			lua_rawset( L, -3 );
+		}
+		break;
+	}
+	case JobValue::EType::Function:
+		if ( luaL_loadbufferx( L, value.sValue.data(), value.sValue.size(), "=job", "b" ) != LUA_OK )
+		{
+			SCION_ERROR( "Failed to load job function: {}", lua_tostring( L, -1 ) );
+			lua_pop( L, 1 );
+			lua_pushnil( L );
+		}
+		break;
+	}
+}
+
+void LuaWorkerPool::CreateLuaWorkerPoolBind( sol::state& lua, Scion::Core::ECS::Registry& registry )
+{
+	// Leave threads for the main thread and the shared thread pool.
+	const size_t numWorkers = std::clamp( std::thread::hardware_concurrency() / 2, 1u, 4u );
+	auto pWorkerPool =
+		registry.AddToContext<std::shared_ptr<LuaWorkerPool>>( std::make_shared<LuaWorkerPool>( numWorkers ) );
+
+	lua.new_enum<EJobStatus>( "JobStatus",
+							  { { "Pending", EJobStatus::Pending },
+								{ "Done", EJobStatus::Done },
+								{ "Failed", EJobStatus::Failed },
+								{ "Cancelled", EJobStatus::Cancelled } } );
+
+	lua.new_usertype<LuaJob>(
+		"LuaJob",
+		sol::no_constructor,
+		"id",
+		sol::readonly( &LuaJob::id ),
+		"status",
+		[]( LuaJob& job ) {
+			job.Collect();
+			return job.eStatus;
+		},
+		"isDone",
+		[]( LuaJob& job ) { return job.Collect(); },
+		"wait",
+		[]( LuaJob& job ) {
+			job.Wait();
+			return job.eStatus;
+		},
+		"get",
+		[]( LuaJob& job, sol::this_state s ) {
+			job.Collect();
+			return ToResults( s, job.results );
+		},
+		"error",
+		[]( LuaJob& job ) {
+			job.Collect();
+			return job.sError;
+		},
+		"cancel",
+		[]( LuaJob& job ) {
+			job.pCancelled->store( true );
+			if ( job.eStatus == EJobStatus::Pending )
+				job.eStatus = EJobStatus::Cancelled;
+		} );
+
+	auto runJob = [ pPool = pWorkerPool.get() ]( const std::string& sModule,
+												 const std::string& sFunction,
+												 sol::variadic_args args,
+												 sol::this_state s ) {
+		return pPool->Run( s, sModule, sFunction, args.stack_index(), static_cast<int>( args.size() ) );
+	};
+
+	lua.create_named_table(
+		"Jobs",
+		"declare",
+		[ pPool = pWorkerPool.get() ]( const std::string& sModule, const sol::table& module, sol::this_state s ) {
+			module.push( s );
+			const bool bDeclared = pPool->DeclareModule( s, sModule, -1 );
+			lua_pop( s, 1 );
+			return bDeclared;
+		},
+		"run",
+		runJob,
+		"pending",
+		[ pPool = pWorkerPool.get() ] { return pPool->NumPendingJobs(); },
+		"workers",
+		[ pPool = pWorkerPool.get() ] { return pPool->NumWorkers(); } );
+
+	lua.set_function( "run_job", runJob );
+}
+
+} // namespace Scion::Core::Scripting
@@ -39,10 +39,11 @@ void Scion::Core::Scripting::UserDataBinder::CreateLuaUserData( sol::state& lua
 			return maybe_any ? maybe_any.cast<sol::reference>() : sol::lua_nil_t{};
 		},
 		"getUserData",
-		[]( UserData& userData, sol::this_state s ) {
-			const auto maybe_any =
-				InvokeMetaFunction( static_cast<entt::id_type>( userData.type_id ), "get_user_data"_hs, userData, s );
-
-			return maybe_any ? maybe_any.cast<sol::reference>() : sol::lua_nil_t{};
-		} );
+		[]( UserData& userData, sol::this_state s ) { return get_user_data<ObjectData>( userData, s ); },
+		"entityID",
+		sol::readonly( &UserData::entityID ),
+		"tagID",
+		sol::readonly( &UserData::tagID ),
+		"groupMask",
+		sol::readonly( &UserData::groupMask ) );
 }
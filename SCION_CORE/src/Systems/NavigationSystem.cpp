@@ -0,0 +1,525 @@
+#include "Core/Systems/NavigationSystem.h"
+#include "Core/Navigation/GridPathfinder.h"
+#include "Core/ECS/Registry.h"
+#include "Core/ECS/MainRegistry.h"
+#include "Core/ECS/Components/TileComponent.h"
+#include "Core/ECS/Components/TransformComponent.h"
+#include "Core/ECS/Components/BoxColliderComponent.h"
+#include "Core/ECS/Components/PhysicsComponent.h"
+
+#include <ScionUtilities/ThreadPool.h>
+#include <Logger/Logger.h>
+
+using namespace Scion::Core::ECS;
+using namespace Scion::Core::Navigation;
+
+namespace
+{
+/* Finished requests that nobody took are forgotten after this many updates. */
+constexpr std::uint32_t MAX_UNREAD_UPDATES = 300;
+
+void OnNavigationTileChanged( entt::registry& registry, entt::entity entity )
+{
+	if ( !registry.all_of<TileComponent>( entity ) )
+		return;
+
+	if ( auto* pNavigation = registry.ctx().find<std::shared_ptr<Scion::Core::Systems::NavigationSystem>>() )
+	{
+		( *pNavigation )->MarkTileDirty( entity );
+	}
+}
+
+bool IsReady( const auto& future )
+{
+	return future.valid() && future.wait_for( std::chrono::seconds{ 0 } ) == std::future_status::ready;
+}
+
+} // namespace
+
+namespace Scion::Core::Systems
+{
+
+template <typename TFunc>
+auto NavigationSystem::RunTask( TFunc&& func ) -> std::future<std::invoke_result_t<TFunc>>
+{
+	SetupThreadPool();
+
+	if ( m_pThreadPool )
+	{
+		try
+		{
+			return m_pThreadPool->Enqueue( func );
+		}
+		catch ( const std::exception& ex )
+		{
+			SCION_ERROR( "Failed to enqueue navigation task: {}", ex.what() );
+		}
+	}
+
+	// Without a thread pool the task is solved right away.
+	std::promise<std::invoke_result_t<TFunc>> promise;
+	promise.set_value( func() );
+	return promise.get_future();
+}
+
+bool NavigationSystem::BuildFromTiles( Scion::Core::ECS::Registry& registry, const glm::vec2& cellSize,
+									   int clusterSize )
+{
+	auto& enttRegistry = registry.GetRegistry();
+	m_CellSize = glm::max( cellSize, glm::vec2{ 1.f } );
+
+	glm::vec2 min{ std::numeric_limits<float>::max() };
+	glm::vec2 max{ std::numeric_limits<float>::lowest() };
+
+	auto tiles = enttRegistry.view<TileComponent, TransformComponent>();
+	for ( auto tile : tiles )
+	{
+		const auto& transform = tiles.get<TransformComponent>( tile );
+		min = glm::min( min, transform.position );
+		max = glm::max( max, transform.position + m_CellSize );
+	}
+
+	if ( min.x > max.x )
+	{
+		SCION_ERROR( "Failed to build the navigation grid - There are no tiles." );
+		return false;
+	}
+
+	m_Origin = min;
+
+	const int width = static_cast<int>( std::ceil( ( max.x - min.x ) / m_CellSize.x ) );
+	const int height = static_cast<int>( std::ceil( ( max.y - min.y ) / m_CellSize.y ) );
+
+	m_pGrid = std::make_shared<NavGrid>( width, height, clusterSize );
+	m_Blockers.assign( static_cast<size_t>( m_pGrid->GetNumCells() ), 0 );
+	m_ManualBlocks.assign( m_Blockers.size(), 0 );
+	m_TileCells.clear();
+	m_DirtyTiles.clear();
+	m_ChangedCells.clear();
+
+	// The goal cells of the old flow fields do not match the new grid.
+	m_FlowFields.clear();
+
+	// Tiles get their components one at a time, so listen for both of them.
+	enttRegistry.on_construct<TileComponent>().connect<&OnNavigationTileChanged>();
+	enttRegistry.on_destroy<TileComponent>().connect<&OnNavigationTileChanged>();
+	enttRegistry.on_construct<BoxColliderComponent>().connect<&OnNavigationTileChanged>();
+	enttRegistry.on_destroy<BoxColliderComponent>().connect<&OnNavigationTileChanged>();
+
+	auto colliderTiles = enttRegistry.view<TileComponent, BoxColliderComponent, TransformComponent>();
+	for ( auto tile : colliderTiles )
+	{
+		if ( auto optCells = GetTileCells( enttRegistry, tile ) )
+		{
+			m_TileCells.emplace( tile, *optCells );
+			AddBlocker( *optCells, 1 );
+		}
+	}
+
+	for ( int cell : m_ChangedCells )
+	{
+		const auto coord = m_pGrid->ToCoord( cell );
+		m_pGrid->SetBlocked( coord.x, coord.y, m_Blockers[ cell ] > 0 );
+	}
+
+	m_ChangedCells.clear();
+	m_pGrid->RebuildAllClusters();
+
+	SCION_LOG( "Built navigation grid [{}x{}] with [{}] clusters from [{}] tile colliders.",
+			   width,
+			   height,
+			   m_pGrid->GetNumClusters(),
+			   m_TileCells.size() );
+
+	return true;
+}
+
+void NavigationSystem::Update( Scion::Core::ECS::Registry& registry )
+{
+	if ( !m_pGrid )
+		return;
+
+	auto& enttRegistry = registry.GetRegistry();
+
+	for ( auto tile : m_DirtyTiles )
+	{
+		if ( auto itr = m_TileCells.find( tile ); itr != m_TileCells.end() )
+		{
+			AddBlocker( itr->second, -1 );
+			m_TileCells.erase( itr );
+		}
+
+		if ( auto optCells = GetTileCells( enttRegistry, tile ) )
+		{
+			m_TileCells.emplace( tile, *optCells );
+			AddBlocker( *optCells, 1 );
+		}
+	}
+
+	m_DirtyTiles.clear();
+	ApplyGridChanges();
+
+	std::erase_if( m_PathRequests, []( auto& idRequest ) {
+		auto& request = idRequest.second;
+		if ( request.eStatus != EPathStatus::Pending )
+			return ++request.unreadUpdates > MAX_UNREAD_UPDATES;
+
+		if ( IsReady( request.result ) )
+		{
+			request.path = request.result.get();
+			request.eStatus = request.path.empty() ? EPathStatus::NotFound : EPathStatus::Found;
+		}
+
+		return false;
+	} );
+
+	for ( auto& [ id, entry ] : m_FlowFields )
+	{
+		if ( !IsReady( entry.pending ) )
+			continue;
+
+		if ( auto pField = entry.pending.get() )
+			entry.pField = std::move( pField );
+	}
+}
+
+void NavigationSystem::SetBlocked( const glm::vec2& position, bool bBlocked )
+{
+	if ( !m_pGrid )
+		return;
+
+	const auto cell = ToCell( position );
+	if ( !m_pGrid->InBounds( cell.x, cell.y ) )
+		return;
+
+	const int index = m_pGrid->ToIndex( cell.x, cell.y );
+	m_ManualBlocks[ index ] = bBlocked ? 1 : 0;
+	m_ChangedCells.push_back( index );
+}
+
+bool NavigationSystem::IsWalkable( const glm::vec2& position ) const
+{
+	if ( !m_pGrid )
+		return false;
+
+	const auto cell = ToCell( position );
+	return m_pGrid->IsWalkable( cell.x, cell.y );
+}
+
+bool NavigationSystem::IsBlocked( const glm::vec2& position ) const
+{
+	if ( !m_pGrid )
+		return false;
+
+	const auto cell = ToCell( position );
+	return m_pGrid->InBounds( cell.x, cell.y ) && !m_pGrid->IsWalkable( cell.x, cell.y );
+}
+
+std::uint32_t NavigationSystem::RequestPath( const glm::vec2& start, const glm::vec2& goal )
+{
+	if ( !m_pGrid )
+	{
+		SCION_ERROR( "Failed to request path - The navigation grid has not been built." );
+		return 0;
+	}
+
+	const std::uint32_t requestID = m_NextRequestID++;
+	if ( m_NextRequestID == 0 )
+		m_NextRequestID = 1;
+
+	// The request keeps the grid alive, so later changes are made to a copy.
+	std::shared_ptr<const NavGrid> pGrid{ m_pGrid };
+	const auto startCell = ToCell( start );
+	const auto goalCell = ToCell( goal );
+
+	m_PathRequests[ requestID ].result = RunTask( [ pGrid, startCell, goalCell ] {
+		std::vector<glm::ivec2> path;
+		FindPath( *pGrid, startCell, goalCell, path );
+		return path;
+	} );
+
+	return requestID;
+}
+
+EPathStatus NavigationSystem::GetPathStatus( std::uint32_t requestID ) const
+{
+	auto itr = m_PathRequests.find( requestID );
+	return itr != m_PathRequests.end() ? itr->second.eStatus : EPathStatus::Invalid;
+}
+
+bool NavigationSystem::TakePath( std::uint32_t requestID, std::vector<glm::vec2>& outPath )
+{
+	outPath.clear();
+
+	auto itr = m_PathRequests.find( requestID );
+	if ( itr == m_PathRequests.end() || itr->second.eStatus == EPathStatus::Pending )
+		return false;
+
+	// There is nothing more to learn from a failed request.
+	if ( itr->second.eStatus != EPathStatus::Found )
+	{
+		m_PathRequests.erase( itr );
+		return false;
+	}
+
+	outPath.reserve( itr->second.path.size() );
+	for ( const auto& cell : itr->second.path )
+	{
+		outPath.push_back( ToPosition( cell ) );
+	}
+
+	m_PathRequests.erase( itr );
+	return true;
+}
+
+void NavigationSystem::CancelPath( std::uint32_t requestID )
+{
+	// A request that is still being solved finishes on its own, the result is dropped.
+	m_PathRequests.erase( requestID );
+}
+
+std::uint32_t NavigationSystem::AcquireFlowField( const glm::vec2& goal )
+{
+	if ( !m_pGrid )
+	{
+		SCION_ERROR( "Failed to acquire flow field - The navigation grid has not been built." );
+		return 0;
+	}
+
+	const auto cell = ToCell( goal );
+	if ( !m_pGrid->InBounds( cell.x, cell.y ) )
+	{
+		SCION_ERROR( "Failed to acquire flow field - The goal is outside of the navigation grid." );
+		return 0;
+	}
+
+	const int goalCell = m_pGrid->ToIndex( cell.x, cell.y );
+
+	for ( auto& [ id, entry ] : m_FlowFields )
+	{
+		if ( entry.goalCell == goalCell )
+		{
+			++entry.refCount;
+			return id;
+		}
+	}
+
+	const std::uint32_t fieldID = m_NextRequestID++;
+	if ( m_NextRequestID == 0 )
+		m_NextRequestID = 1;
+
+	auto& entry = m_FlowFields[ fieldID ];
+	entry.goalCell = goalCell;
+	entry.refCount = 1;
+	BuildFlowField( entry );
+
+	return fieldID;
+}
+
+void NavigationSystem::ReleaseFlowField( std::uint32_t fieldID )
+{
+	auto itr = m_FlowFields.find( fieldID );
+	if ( itr == m_FlowFields.end() )
+		return;
+
+	if ( --itr->second.refCount <= 0 )
+		m_FlowFields.erase( itr );
+}
+
+bool NavigationSystem::IsFlowFieldReady( std::uint32_t fieldID ) const
+{
+	auto itr = m_FlowFields.find( fieldID );
+	return itr != m_FlowFields.end() && itr->second.pField;
+}
+
+glm::vec2 NavigationSystem::GetFlowDirection( std::uint32_t fieldID, const glm::vec2& position ) const
+{
+	auto itr = m_FlowFields.find( fieldID );
+	if ( itr == m_FlowFields.end() || !itr->second.pField )
+		return glm::vec2{ 0.f };
+
+	const auto cell = ToCell( position );
+	return itr->second.pField->GetDirection( cell.x, cell.y );
+}
+
+void NavigationSystem::MarkTileDirty( entt::entity tile )
+{
+	m_DirtyTiles.push_back( tile );
+}
+
+glm::ivec2 NavigationSystem::ToCell( const glm::vec2& position ) const
+{
+	return glm::ivec2{ glm::floor( ( position - m_Origin ) / m_CellSize ) };
+}
+
+glm::vec2 NavigationSystem::ToPosition( const glm::ivec2& cell ) const
+{
+	return m_Origin + ( glm::vec2{ cell } + 0.5f ) * m_CellSize;
+}
+
+std::optional<GridBounds> NavigationSystem::GetTileCells( entt::registry& registry, entt::entity tile ) const
+{
+	if ( !m_pGrid || !registry.valid( tile ) ||
+		 !registry.all_of<TileComponent, BoxColliderComponent, TransformComponent>( tile ) )
+	{
+		return std::nullopt;
+	}
+
+	// Sensors do not stop anything from walking through them.
+	if ( auto* pPhysics = registry.try_get<PhysicsComponent>( tile ); pPhysics && pPhysics->GetAttributes().bIsSensor )
+		return std::nullopt;
+
+	const auto& transform = registry.get<TransformComponent>( tile );
+	const auto& boxCollider = registry.get<BoxColliderComponent>( tile );
+
+	const glm::vec2 min = transform.position + boxCollider.offset;
+	const glm::vec2 size{ boxCollider.width * transform.scale.x, boxCollider.height * transform.scale.y };
+
+	if ( size.x <= 0.f || size.y <= 0.f )
+		return std::nullopt;
+
+	const auto minCell = ToCell( min );
+	const auto maxCell = glm::ivec2{ glm::ceil( ( min + size - m_Origin ) / m_CellSize ) } - 1;
+
+	GridBounds cells{ .minX = std::max( minCell.x, 0 ),
+					  .minY = std::max( minCell.y, 0 ),
+					  .maxX = std::min( maxCell.x, m_pGrid->GetWidth() - 1 ),
+					  .maxY = std::min( maxCell.y, m_pGrid->GetHeight() - 1 ) };
+
+	if ( cells.minX > cells.maxX || cells.minY > cells.maxY )
+		return std::nullopt;
+
+	return cells;
+}
+
+void NavigationSystem::AddBlocker( const GridBounds& cells, int amount )
+{
+	for ( int y = cells.minY; y <= cells.maxY; ++y )
+	{
+		for ( int x = cells.minX; x <= cells.maxX; ++x )
+		{
+			const int index = m_pGrid->ToIndex( x, y );
+			m_Blockers[ index ] = static_cast<std::uint16_t>( std::max( m_Blockers[ index ] + amount, 0 ) );
+			m_ChangedCells.push_back( index );
+		}
+	}
+}
+
+void NavigationSystem::ApplyGridChanges()
+{
+	if ( m_ChangedCells.empty() )
+		return;
+
+	// Requests that are still being solved use the current grid.
+	if ( m_pGrid.use_count() > 1 )
+		m_pGrid = std::make_shared<NavGrid>( *m_pGrid );
+
+	for ( int cell : m_ChangedCells )
+	{
+		const auto coord = m_pGrid->ToCoord( cell );
+		m_pGrid->SetBlocked( coord.x, coord.y, m_Blockers[ cell ] > 0 || m_ManualBlocks[ cell ] != 0 );
+	}
+
+	m_ChangedCells.clear();
+
+	if ( !m_pGrid->HasDirtyClusters() )
+		return;
+
+	m_pGrid->RebuildDirtyClusters();
+
+	for ( auto& [ id, entry ] : m_FlowFields )
+	{
+		BuildFlowField( entry );
+	}
+}
+
+void NavigationSystem::BuildFlowField( FlowFieldEntry& entry )
+{
+	std::shared_ptr<const NavGrid> pGrid{ m_pGrid };
+	const auto goal = pGrid->ToCoord( entry.goalCell );
+
+	entry.pending = RunTask( [ pGrid, goal ]() -> std::shared_ptr<const FlowField> {
+		auto pField = std::make_shared<FlowField>();
+		pField->Build( *pGrid, goal );
+		return pField;
+	} );
+}
+
+void NavigationSystem::SetupThreadPool()
+{
+	if ( m_bThreadPoolSet )
+		return;
+
+	if ( auto* pThreadPool = MAIN_REGISTRY().TryGetContext<SharedThreadPool>() )
+	{
+		m_pThreadPool = *pThreadPool;
+	}
+
+	m_bThreadPoolSet = true;
+}
+
+void NavigationSystem::CreateNavigationLuaBind( sol::state& lua, Scion::Core::ECS::Registry& registry )
+{
+	auto pNavigation =
+		registry.AddToContext<std::shared_ptr<NavigationSystem>>( std::make_shared<NavigationSystem>() );
+
+	lua.new_enum<EPathStatus>( "PathStatus",
+							   { { "Pending", EPathStatus::Pending },
+								 { "Found", EPathStatus::Found },
+								 { "NotFound", EPathStatus::NotFound },
+								 { "Invalid", EPathStatus::Invalid } } );
+
+	static std::vector<glm::vec2> path;
+
+	lua.create_named_table(
+		"Navigation",
+		"build",
+		[ pNavigation, &registry ]( float cellWidth, float cellHeight, sol::optional<int> clusterSize ) {
+			return pNavigation->BuildFromTiles( registry, glm::vec2{ cellWidth, cellHeight }, clusterSize.value_or( 16 ) );
+		},
+		"setBlocked",
+		[ pNavigation ]( const glm::vec2& position, bool bBlocked ) { pNavigation->SetBlocked( position, bBlocked ); },
+		"isWalkable",
+		[ pNavigation ]( const glm::vec2& position ) { return pNavigation->IsWalkable( position ); },
+		"requestPath",
+		[ pNavigation ]( const glm::vec2& start, const glm::vec2& goal ) {
+			return pNavigation->RequestPath( start, goal );
+		},
+		"pathStatus",
+		[ pNavigation ]( std::uint32_t requestID ) { return pNavigation->GetPathStatus( requestID ); },
+		// The path is returned packed as x1, y1, x2, y2, ... Passing a table reuses it.
+		"takePath",
+		[ pNavigation ]( std::uint32_t requestID, sol::optional<sol::table> outTable, sol::this_state s ) -> sol::object {
+			if ( !pNavigation->TakePath( requestID, path ) )
+				return sol::lua_nil;
+
+			sol::state_view lua{ s };
+			sol::table table = outTable ? *outTable : lua.create_table( static_cast<int>( path.size() * 2 ), 0 );
+
+			for ( size_t i = 0; i < path.size(); ++i )
+			{
+				table.raw_set( i * 2 + 1, path[ i ].x, i * 2 + 2, path[ i ].y );
+			}
+
+			for ( size_t i = path.size() * 2 + 1; table.raw_get<sol::object>( i ).valid(); ++i )
+			{
+				table.raw_set( i, sol::lua_nil );
+			}
+
+			return table;
+		},
+		"cancelPath",
+		[ pNavigation ]( std::uint32_t requestID ) { pNavigation->CancelPath( requestID ); },
+		"acquireFlowField",
+		[ pNavigation ]( const glm::vec2& goal ) { return pNavigation->AcquireFlowField( goal ); },
+		"releaseFlowField",
+		[ pNavigation ]( std::uint32_t fieldID ) { pNavigation->ReleaseFlowField( fieldID ); },
+		"isFlowFieldReady",
+		[ pNavigation ]( std::uint32_t fieldID ) { return pNavigation->IsFlowFieldReady( fieldID ); },
+		"flowDirection",
+		[ pNavigation ]( std::uint32_t fieldID, const glm::vec2& position ) {
+			return pNavigation->GetFlowDirection( fieldID, position );
+		} );
+}
+
+} // namespace Scion::Core::Systems
@@ -0,0 +1,306 @@
+#include "Core/Systems/ParticleSystem.h"
+#include "Core/Systems/NavigationSystem.h"
+#include "Core/Systems/TileColliderSystem.h"
+#include "Core/ECS/Registry.h"
+#include "Core/ECS/MainRegistry.h"
+#include "Core/ECS/Components/ParticleEmitterComponent.h"
+#include "Core/ECS/Components/TransformComponent.h"
+#include "Core/Resources/AssetManager.h"
+#include "Core/Profiling/ProfileCollector.h"
+
+#include <Rendering/Core/Camera2D.h>
+#include <Rendering/Core/ParticleBatchRenderer.h>
+#include <Rendering/Essentials/Shader.h>
+#include <Rendering/Essentials/Texture.h>
+#include <Logger/Logger.h>
+
+using namespace Scion::Core::ECS;
+using namespace Scion::Rendering;
+
+namespace
+{
+glm::vec4 ToVec4( const Color& color )
+{
+	return glm::vec4{ color.r, color.g, color.b, color.a };
+}
+
+GLubyte ToColorChannel( float value )
+{
+	return static_cast<GLubyte>( std::clamp( value, 0.f, 255.f ) );
+}
+} // namespace
+
+namespace Scion::Core::Systems
+{
+
+void ParticleSystem::ParticlePool::Resize( size_t maxParticles )
+{
+	positionX.resize( maxParticles );
+	positionY.resize( maxParticles );
+	velocityX.resize( maxParticles );
+	velocityY.resize( maxParticles );
+	age.resize( maxParticles );
+	lifetime.resize( maxParticles );
+	count = std::min( count, maxParticles );
+}
+
+void ParticleSystem::ParticlePool::Kill( size_t index )
+{
+	const size_t last = --count;
+	positionX[ index ] = positionX[ last ];
+	positionY[ index ] = positionY[ last ];
+	velocityX[ index ] = velocityX[ last ];
+	velocityY[ index ] = velocityY[ last ];
+	age[ index ] = age[ last ];
+	lifetime[ index ] = lifetime[ last ];
+}
+
+ParticleSystem::ParticleSystem()
+	: m_pBatchRenderer{ std::make_unique<ParticleBatchRenderer>() }
+	, m_Random{ std::random_device{}() }
+	, m_bWarnedNoTiles{ false }
+{
+}
+
+ParticleSystem::~ParticleSystem() = default;
+
+void ParticleSystem::Update( Scion::Core::ECS::Registry& registry, double deltaTime )
+{
+	auto& enttRegistry = registry.GetRegistry();
+
+	// Free the pools of emitters that are gone.
+	std::erase_if( m_Pools, [ & ]( const auto& pool ) {
+		return !enttRegistry.valid( pool.first ) || !enttRegistry.all_of<ParticleEmitterComponent>( pool.first );
+	} );
+
+	auto emitterView = enttRegistry.view<ParticleEmitterComponent>();
+	if ( emitterView.empty() )
+		return;
+
+	SCION_SYSTEM_ZONE( "ParticleSystem" );
+
+	const NavigationSystem* pNavigation{ nullptr };
+	if ( auto* pNavigationSystem = registry.TryGetContext<std::shared_ptr<NavigationSystem>>() )
+		pNavigation = pNavigationSystem->get();
+
+	const TileColliderSystem* pTileColliders{ nullptr };
+	if ( auto* pTileColliderSystem = registry.TryGetContext<std::shared_ptr<TileColliderSystem>>() )
+		pTileColliders = pTileColliderSystem->get();
+
+	const float dt = static_cast<float>( deltaTime );
+
+	for ( auto entity : emitterView )
+	{
+		auto& emitter = emitterView.get<ParticleEmitterComponent>( entity );
+		auto& pool = m_Pools[ entity ];
+
+		const size_t maxParticles = static_cast<size_t>( std::max( emitter.maxParticles, 0 ) );
+		if ( pool.age.size() != maxParticles )
+			pool.Resize( maxParticles );
+
+		Simulate( registry, pool, emitter, dt, pNavigation, pTileColliders );
+
+		size_t numToEmit = static_cast<size_t>( std::max( emitter.burstCount, 0 ) );
+		emitter.burstCount = 0;
+
+		if ( emitter.bEmitting )
+		{
+			pool.emitRemainder += emitter.emissionRate * dt;
+			const float wholeParticles = std::floor( pool.emitRemainder );
+			pool.emitRemainder -= wholeParticles;
+			numToEmit += static_cast<size_t>( wholeParticles );
+		}
+
+		if ( numToEmit > 0 )
+		{
+			glm::vec2 origin{ emitter.offset };
+			if ( const auto* pTransform = enttRegistry.try_get<TransformComponent>( entity ) )
+				origin += pTransform->position;
+
+			Emit( pool, emitter, origin, numToEmit );
+		}
+
+		emitter.numParticles = static_cast<int>( pool.count );
+	}
+}
+
+void ParticleSystem::Render( Scion::Core::ECS::Registry& registry, Scion::Rendering::Camera2D& camera )
+{
+	if ( m_Pools.empty() )
+		return;
+
+	SCION_SYSTEM_ZONE( "ParticleRender" );
+
+	auto& assetManager = MAIN_REGISTRY().GetAssetManager();
+	auto pShader = assetManager.GetShader( "particle" );
+	if ( !pShader || pShader->ShaderProgramID() == 0 )
+	{
+		SCION_ERROR( "Particle shader program has not been set correctly!" );
+		return;
+	}
+
+	auto& enttRegistry = registry.GetRegistry();
+	m_pBatchRenderer->Begin();
+
+	for ( const auto& [ entity, pool ] : m_Pools )
+	{
+		if ( pool.count == 0 )
+			continue;
+
+		// The pools are freed in Update, the emitter may have been removed since.
+		const auto* pEmitter =
+			enttRegistry.valid( entity ) ? enttRegistry.try_get<ParticleEmitterComponent>( entity ) : nullptr;
+		if ( !pEmitter || pEmitter->sTextureName.empty() )
+			continue;
+
+		const auto& emitter = *pEmitter;
+
+		const auto& pTexture = assetManager.GetTexture( emitter.sTextureName );
+		if ( !pTexture )
+		{
+			SCION_ERROR( "Texture [{}] was not created correctly!", emitter.sTextureName );
+			continue;
+		}
+
+		const glm::vec4 uvRect = pTexture->ToAtlasUVs(
+			glm::vec4{ emitter.uvs.u, emitter.uvs.v, emitter.uvs.uv_width, emitter.uvs.uv_height } );
+
+		auto instances = m_pBatchRenderer->AddParticles(
+			pTexture->GetID(), uvRect, glm::vec2{ emitter.width, emitter.height }, pool.count );
+
+		const glm::vec4 startColor = ToVec4( emitter.startColor );
+		const glm::vec4 colorChange = ToVec4( emitter.endColor ) - startColor;
+		const float scaleChange = emitter.endScale - emitter.startScale;
+
+		for ( size_t i = 0; i < pool.count; ++i )
+		{
+			const float life = Scion::Utilities::Ease( emitter.eLifeEasing, pool.age[ i ] / pool.lifetime[ i ] );
+			const glm::vec4 color = startColor + colorChange * life;
+
+			auto& instance = instances[ i ];
+			instance.position = glm::vec2{ pool.positionX[ i ], pool.positionY[ i ] };
+			instance.scale = emitter.startScale + scaleChange * life;
+			instance.rotation =
+				emitter.bAlignToVelocity ? std::atan2( pool.velocityY[ i ], pool.velocityX[ i ] ) : 0.f;
+			instance.color = Color{ .r = ToColorChannel( color.r ),
+									.g = ToColorChannel( color.g ),
+									.b = ToColorChannel( color.b ),
+									.a = ToColorChannel( color.a ) };
+		}
+	}
+
+	if ( m_pBatchRenderer->NumParticles() == 0 )
+		return;
+
+	m_pBatchRenderer->End();
+
+	pShader->Enable();
+	pShader->SetUniformMat4( "uProjection", camera.GetCameraMatrix() );
+	m_pBatchRenderer->Render( *pShader );
+	pShader->Disable();
+}
+
+void ParticleSystem::Clear()
+{
+	m_Pools.clear();
+}
+
+void ParticleSystem::Simulate( Scion::Core::ECS::Registry& registry, ParticlePool& pool,
+							   const Scion::Core::ECS::ParticleEmitterComponent& emitter, float dt,
+							   const NavigationSystem* pNavigation, const TileColliderSystem* pTileColliders )
+{
+	const size_t count = pool.count;
+	const float gravityX = emitter.gravity.x * dt;
+	const float gravityY = emitter.gravity.y * dt;
+
+	// Kept free of branches so the loop can be vectorized.
+	for ( size_t i = 0; i < count; ++i )
+	{
+		pool.velocityX[ i ] += gravityX;
+		pool.velocityY[ i ] += gravityY;
+		pool.positionX[ i ] += pool.velocityX[ i ] * dt;
+		pool.positionY[ i ] += pool.velocityY[ i ] * dt;
+		pool.age[ i ] += dt;
+	}
+
+	// A navigation grid built by a script can block more cells than the tiles, so it is used first.
+	const bool bUseNavGrid = pNavigation && pNavigation->HasGrid();
+	auto isBlocked = [ & ]( const glm::vec2& position ) {
+		return bUseNavGrid ? pNavigation->IsBlocked( position ) : pTileColliders->IsSolidAt( registry, position );
+	};
+
+	if ( emitter.bCollideWithTiles && !bUseNavGrid && !pTileColliders && !m_bWarnedNoTiles )
+	{
+		SCION_WARN( "Particle emitters collide with tiles, but there is no navigation grid or tile collider system." );
+		m_bWarnedNoTiles = true;
+	}
+
+	if ( emitter.bCollideWithTiles && ( bUseNavGrid || pTileColliders ) )
+	{
+		for ( size_t i = 0; i < count; ++i )
+		{
+			if ( !isBlocked( glm::vec2{ pool.positionX[ i ], pool.positionY[ i ] } ) )
+				continue;
+
+			if ( emitter.bounce <= 0.f )
+			{
+				pool.age[ i ] = pool.lifetime[ i ];
+				continue;
+			}
+
+			// Step back out of the tile and bounce off the side that was hit.
+			const float previousX = pool.positionX[ i ] - pool.velocityX[ i ] * dt;
+			const float previousY = pool.positionY[ i ] - pool.velocityY[ i ] * dt;
+			const bool bHitSide = isBlocked( glm::vec2{ pool.positionX[ i ], previousY } );
+
+			pool.positionX[ i ] = previousX;
+			pool.positionY[ i ] = previousY;
+
+			if ( bHitSide )
+				pool.velocityX[ i ] *= -emitter.bounce;
+			else
+				pool.velocityY[ i ] *= -emitter.bounce;
+		}
+	}
+
+	for ( size_t i = 0; i < pool.count; )
+	{
+		if ( pool.age[ i ] >= pool.lifetime[ i ] )
+			pool.Kill( i );
+		else
+			++i;
+	}
+}
+
+void ParticleSystem::Emit( ParticlePool& pool, const Scion::Core::ECS::ParticleEmitterComponent& emitter,
+						   const glm::vec2& origin, size_t numParticles )
+{
+	const size_t numToEmit = std::min( numParticles, pool.age.size() - pool.count );
+	const glm::vec2 halfArea = emitter.spawnArea * 0.5f;
+	const float halfSpread = emitter.spread * 0.5f;
+
+	for ( size_t n = 0; n < numToEmit; ++n )
+	{
+		const size_t i = pool.count++;
+		const float angle = glm::radians( emitter.direction + RandomRange( -halfSpread, halfSpread ) );
+		const float speed = RandomRange( emitter.minSpeed, emitter.maxSpeed );
+
+		pool.positionX[ i ] = origin.x + RandomRange( -halfArea.x, halfArea.x );
+		pool.positionY[ i ] = origin.y + RandomRange( -halfArea.y, halfArea.y );
+		pool.velocityX[ i ] = std::cos( angle ) * speed;
+		pool.velocityY[ i ] = std::sin( angle ) * speed;
+		pool.age[ i ] = 0.f;
+		// Particles always live a little, so the age can be divided by the lifetime.
+		pool.lifetime[ i ] = std::max( RandomRange( emitter.minLifetime, emitter.maxLifetime ), 0.001f );
+	}
+}
+
+float ParticleSystem::RandomRange( float min, float max )
+{
+	if ( max <= min )
+		return min;
+
+	return std::uniform_real_distribution<float>{ min, max }( m_Random );
+}
+
+} // namespace Scion::Core::Systems
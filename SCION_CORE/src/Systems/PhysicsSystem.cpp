@@ -1,13 +1,34 @@
 #include "Core/Systems/PhysicsSystem.h"
+#include "Core/Systems/TileColliderSystem.h"
 #include "Core/ECS/Registry.h"
 #include "Core/ECS/Components/BoxColliderComponent.h"
 #include "Core/ECS/Components/CircleColliderComponent.h"
 #include "Core/ECS/Components/TransformComponent.h"
 #include "Core/ECS/Components/PhysicsComponent.h"
 #include "Core/CoreUtilities/CoreEngineData.h"
+#include "Core/Events/EventDispatcher.h"
+#include "Core/Events/EngineEventTypes.h"
+#include <Physics/ContactListener.h>
 #include <Logger/Logger.h>
 
 using namespace Scion::Core::ECS;
+using namespace Scion::Core::Events;
+
+namespace
+{
+Scion::Physics::UserData* GetUserData( entt::registry& registry, std::uint32_t entityID )
+{
+	const auto entity = static_cast<entt::entity>( entityID );
+	if ( !registry.valid( entity ) )
+		return nullptr;
+
+	auto* pPhysics = registry.try_get<PhysicsComponent>( entity );
+	if ( !pPhysics || !pPhysics->GetUserData() )
+		return nullptr;
+
+	return pPhysics->GetUserData();
+}
+} // namespace
 
 namespace Scion::Core::Systems
 {
@@ -18,67 +39,117 @@ PhysicsSystem::PhysicsSystem()
 
 void PhysicsSystem::Update( Scion::Core::ECS::Registry& registry )
 {
-	auto boxView = registry.GetRegistry().view<PhysicsComponent, TransformComponent, BoxColliderComponent>();
-	auto& coreEngine = CoreEngineData::GetInstance();
+	auto* pPhysicsWorld = registry.TryGetContext<Scion::Physics::PhysicsWorld>();
+	if ( !pPhysicsWorld || !*pPhysicsWorld )
+		return;
 
-	float hScaledWidth = coreEngine.ScaledWidth() * 0.5f;
-	float hScaledHeight = coreEngine.ScaledHeight() * 0.5f;
+	// Merge the colliders of any tiles added or removed since the last frame.
+	if ( auto* pTileColliders = registry.TryGetContext<std::shared_ptr<TileColliderSystem>>();
+		 pTileColliders && *pTileColliders )
+	{
+		( *pTileColliders )->Update( registry );
+	}
+
+	auto& coreEngine = CoreEngineData::GetInstance();
 
+	const float hScaledWidth = coreEngine.ScaledWidth() * 0.5f;
+	const float hScaledHeight = coreEngine.ScaledHeight() * 0.5f;
 	const float M2P = coreEngine.MetersToPixels();
 
-	for ( auto entity : boxView )
+	auto& enttRegistry = registry.GetRegistry();
+
+	// Walk the bodies in the world rather than the component views. Static and sleeping bodies
+	// cannot have moved, so they are skipped before touching any components.
+	for ( auto* pBody = ( *pPhysicsWorld )->GetBodyList(); pBody; pBody = pBody->GetNext() )
 	{
-		auto& physics = boxView.get<PhysicsComponent>( entity );
-		auto pRigidBody = physics.GetBody();
+		if ( pBody->GetType() == b2_staticBody || !pBody->IsAwake() )
+			continue;
 
-		if ( !pRigidBody )
+		auto* pUserData = reinterpret_cast<Scion::Physics::UserData*>( pBody->GetUserData().pointer );
+		if ( !pUserData )
 			continue;
 
-		// If the entity is static, we can skip it
-		if ( pRigidBody->GetType() == b2BodyType::b2_staticBody )
+		const auto entity = static_cast<entt::entity>( pUserData->entityID );
+		if ( !enttRegistry.valid( entity ) )
 			continue;
 
-		auto& transform = boxView.get<TransformComponent>( entity );
-		auto& boxCollider = boxView.get<BoxColliderComponent>( entity );
+		auto* pTransform = enttRegistry.try_get<TransformComponent>( entity );
+		if ( !pTransform )
+			continue;
 
-		const auto& bodyPosition = pRigidBody->GetPosition();
+		auto& transform = *pTransform;
+		const auto& bodyPosition = pBody->GetPosition();
+		glm::vec2 newPosition{ ( hScaledWidth + bodyPosition.x ) * M2P, ( hScaledHeight + bodyPosition.y ) * M2P };
+
+		if ( auto* pBoxCollider = enttRegistry.try_get<BoxColliderComponent>( entity ) )
+		{
+			newPosition.x -= ( pBoxCollider->width * transform.scale.x ) * 0.5f + pBoxCollider->offset.x;
+			newPosition.y -= ( pBoxCollider->height * transform.scale.y ) * 0.5f + pBoxCollider->offset.y;
+		}
+		else if ( auto* pCircleCollider = enttRegistry.try_get<CircleColliderComponent>( entity ) )
+		{
+			newPosition.x -= pCircleCollider->radius * transform.scale.x + pCircleCollider->offset.x;
+			newPosition.y -= pCircleCollider->radius * transform.scale.y + pCircleCollider->offset.y;
+		}
+		else
+		{
+			continue;
+		}
 
-		transform.position.x = ( hScaledWidth + bodyPosition.x ) * M2P -
-							   ( boxCollider.width * transform.scale.x ) * 0.5f - boxCollider.offset.x;
+		const float newRotation =
+			pBody->IsFixedRotation() ? transform.rotation : glm::degrees( pBody->GetAngle() );
 
-		transform.position.y = ( hScaledHeight + bodyPosition.y ) * M2P -
-							   ( boxCollider.height * transform.scale.y ) * 0.5f - boxCollider.offset.y;
+		// Awake bodies can still be resting, only mark the transform when the body actually moved.
+		if ( transform.position == newPosition && transform.rotation == newRotation )
+			continue;
 
-		if ( !pRigidBody->IsFixedRotation() )
-			transform.rotation = glm::degrees( pRigidBody->GetAngle() );
+		transform.position = newPosition;
+		transform.rotation = newRotation;
+		transform.bDirty = true;
 	}
+}
 
-	auto circleView = registry.GetRegistry().view<PhysicsComponent, TransformComponent, CircleColliderComponent>();
-	for ( auto entity : circleView )
-	{
-		auto& physics = circleView.get<PhysicsComponent>( entity );
-		auto pRigidBody = physics.GetBody();
+void PhysicsSystem::DispatchContacts( Scion::Core::ECS::Registry& registry )
+{
+	auto* pContactListener = registry.TryGetContext<std::shared_ptr<Scion::Physics::ContactListener>>();
+	if ( !pContactListener || !*pContactListener )
+		return;
 
-		if ( !pRigidBody )
-			continue;
+	auto& contactListener = **pContactListener;
+	contactListener.FinishStep();
 
-		// If the entity is static, we can skip it
-		if ( pRigidBody->GetType() == b2BodyType::b2_staticBody )
-			continue;
+	const auto contacts = contactListener.GetContacts();
+	auto* pDispatcher = registry.TryGetContext<std::shared_ptr<EventDispatcher>>();
+	if ( contacts.empty() || !pDispatcher || !*pDispatcher )
+		return;
 
-		auto& transform = circleView.get<TransformComponent>( entity );
-		auto& circleCollider = circleView.get<CircleColliderComponent>( entity );
+	auto& dispatcher = **pDispatcher;
 
-		const auto& bodyPosition = pRigidBody->GetPosition();
+	if ( dispatcher.HasHandlers<ContactBatchEvent>() )
+	{
+		dispatcher.EmitEvent( ContactBatchEvent{ .contacts = contacts } );
+	}
+
+	// Contact events copy the object data of both bodies, only build them if someone is listening.
+	if ( !dispatcher.HasHandlers<ContactEvent>() )
+		return;
 
-		transform.position.x = ( hScaledWidth + bodyPosition.x ) * M2P - ( circleCollider.radius * transform.scale.x ) -
-							   circleCollider.offset.x;
+	auto& enttRegistry = registry.GetRegistry();
+	for ( const auto& contact : contacts )
+	{
+		if ( contact.eType != Scion::Physics::EContactType::Begin )
+			continue;
 
-		transform.position.y = ( hScaledHeight + bodyPosition.y ) * M2P -
-							   ( circleCollider.radius * transform.scale.y ) - circleCollider.offset.y;
+		auto* pUserDataA = GetUserData( enttRegistry, contact.entityA );
+		auto* pUserDataB = GetUserData( enttRegistry, contact.entityB );
 
-		if ( !pRigidBody->IsFixedRotation() )
-			transform.rotation = glm::degrees( pRigidBody->GetAngle() );
+		// Only emit contact event if both contacts are valid
+		if ( pUserDataA && pUserDataB )
+		{
+			dispatcher.EmitEvent( ContactEvent{ .objectA = Scion::Physics::ObjectData{ *pUserDataA, true },
+												.objectB = Scion::Physics::ObjectData{ *pUserDataB, true } } );
+		}
 	}
 }
+
 } // namespace Scion::Core::Systems
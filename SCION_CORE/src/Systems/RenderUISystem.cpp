@@ -75,7 +75,8 @@ void RenderUISystem::Update( Scion::Core::ECS::Registry& registry )
 		}
 
 		glm::vec4 spriteRect{ transform.position.x, transform.position.y, sprite.width, sprite.height };
-		glm::vec4 uvRect{ sprite.uvs.u, sprite.uvs.v, sprite.uvs.uv_width, sprite.uvs.uv_height };
+		const glm::vec4 uvRect =
+			pTexture->ToAtlasUVs( glm::vec4{ sprite.uvs.u, sprite.uvs.v, sprite.uvs.uv_width, sprite.uvs.uv_height } );
 
 		glm::mat4 model = Scion::Core::RSTModel( transform, sprite.width, sprite.height );
 
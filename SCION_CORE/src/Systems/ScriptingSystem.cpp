@@ -1,6 +1,7 @@
 #include "Core/Systems/ScriptingSystem.h"
 #include "Core/ECS/Components/ScriptComponent.h"
 #include "Core/ECS/Entity.h"
+#include "Core/ECS/EntityHandle.h"
 #include "Core/ECS/MainRegistry.h"
 #include "Core/ECS/ECSUtils.h"
 
@@ -12,8 +13,13 @@
 #include "Core/Scripting/ContactListenerBind.h"
 #include "Core/Scripting/LuaFilesystemBindings.h"
 #include "Core/Scripting/ScriptingUtilities.h"
+#include "Core/Scripting/LuaAllocator.h"
+#include "Core/Scripting/LuaTaskScheduler.h"
+#include "Core/Scripting/LuaWorkerPool.h"
+#include "Core/Scripting/LazyLuaBindings.h"
 
 #include "Core/Resources/AssetManager.h"
+#include "Core/Resources/AsyncAssetLoader.h"
 #include <Logger/Logger.h>
 #include <ScionUtilities/Timer.h>
 #include <ScionUtilities/RandomGenerator.h>
@@ -32,13 +38,18 @@
 #include "Core/Systems/RenderSystem.h"
 #include "Core/Systems/RenderUISystem.h"
 #include "Core/Systems/AnimationSystem.h"
+#include "Core/Systems/SpatialQuerySystem.h"
+#include "Core/Systems/NavigationSystem.h"
+#include "Core/Systems/TweenSystem.h"
 
 #include "Core/Character/Character.h"
 #include "ScionUtilities/HelperUtilities.h"
 #include "ScionUtilities/Tween.h"
 
 #include "Core/Scene/Scene.h"
+#include "Core/Loaders/LevelStreamer.h"
 #include "Core/Profiling/ProfileCollector.h"
+#include "Core/Profiling/LuaProfiler.h"
 
 #include "Rendering/Essentials/Texture.h"
 #include "Rendering/Essentials/Shader.h"
@@ -190,6 +201,35 @@ void ScriptingSystem::Update( Scion::Core::ECS::Registry& registry )
 	}
 
 	SCION_SYSTEM_ZONE( "ScriptSystem" );
+
+	// Loads finished here wake the tasks waiting on them in the same update.
+	if ( auto* pAsyncLoader = registry.TryGetContext<std::shared_ptr<SCION_RESOURCES::AsyncAssetLoader>>() )
+	{
+		SCION_SUBSYSTEM_ZONE( "Async Loads" );
+		( *pAsyncLoader )->Update();
+	}
+
+	if ( auto* pScheduler = registry.TryGetContext<std::shared_ptr<Scion::Core::Scripting::LuaTaskScheduler>>() )
+	{
+		SCION_SUBSYSTEM_ZONE( "Lua Tasks" );
+		( *pScheduler )->Update( CORE_GLOBALS().GetDeltaTime() );
+	}
+
+	if ( auto* pWorkerPool = registry.TryGetContext<std::shared_ptr<Scion::Core::Scripting::LuaWorkerPool>>() )
+	{
+		SCION_SUBSYSTEM_ZONE( "Lua Jobs" );
+		( *pWorkerPool )->Update();
+	}
+
+	{
+		// Events collected for lua batch handlers since the last update are delivered before the update script.
+		SCION_SUBSYSTEM_ZONE( "Lua Event Batches" );
+		if ( auto* pDispatcher = registry.TryGetContext<std::shared_ptr<EventDispatcher>>() )
+			( *pDispatcher )->FlushLuaEvents();
+
+		EVENT_DISPATCHER().FlushLuaEvents();
+	}
+
 	auto& pMainScript = registry.GetContext<MainScriptPtr>();
 	auto error = pMainScript->update();
 	if ( !error.valid() )
@@ -198,10 +238,8 @@ void ScriptingSystem::Update( Scion::Core::ECS::Registry& registry )
 		SCION_ERROR( "Error running the Update script: {0}", err.what() );
 	}
 
-	if ( auto* pLua = registry.TryGetContext<std::shared_ptr<sol::state>>() )
-	{
-		( *pLua )->collect_garbage();
-	}
+	// An error between profile_begin and profile_end would leave the zone open.
+	Scion::Core::LuaProfiler::CloseOpenZones( pMainScript->update.lua_state() );
 }
 
 void ScriptingSystem::Render( Scion::Core::ECS::Registry& registry )
@@ -220,9 +258,39 @@ void ScriptingSystem::Render( Scion::Core::ECS::Registry& registry )
 		SCION_ERROR( "Error running the Render script: {0}", err.what() );
 	}
 
-	if ( auto* pLua = registry.TryGetContext<std::shared_ptr<sol::state>>() )
+	Scion::Core::LuaProfiler::CloseOpenZones( pMainScript->render.lua_state() );
+}
+
+void ScriptingSystem::CollectGarbage( Scion::Core::ECS::Registry& registry, double idleTimeMs )
+{
+	auto* pLua = registry.TryGetContext<std::shared_ptr<sol::state>>();
+	if ( !pLua || !*pLua )
+		return;
+
+	lua_State* L = ( *pLua )->lua_state();
+	const auto& gcSettings = CORE_GLOBALS().GetLuaGCSettings();
+
+	Scion::Core::Scripting::LuaGCStepResult result{};
+	if ( const double budgetMs = std::min( idleTimeMs, static_cast<double>( gcSettings.idleBudgetMs ) ); budgetMs > 0.0 )
+	{
+		SCION_SUBSYSTEM_ZONE( "Lua GC" );
+		result = Scion::Core::Scripting::StepGarbageCollector( L, gcSettings.eMode, budgetMs );
+	}
+
+	SCION_PROFILE_COUNTER( "Lua GC Idle ms", result.elapsedMs );
+	SCION_PROFILE_COUNTER( "Lua GC Idle Steps", result.steps );
+
+	if ( const auto* pAllocator = Scion::Core::Scripting::LuaAllocator::Get( L ) )
 	{
-		( *pLua )->collect_garbage();
+		const auto& stats = pAllocator->GetStats();
+		SCION_PROFILE_COUNTER( "Lua Memory KB", stats.bytesInUse / 1024.0 );
+		SCION_PROFILE_COUNTER( "Lua Peak Memory KB", stats.peakBytesInUse / 1024.0 );
+		SCION_PROFILE_COUNTER( "Lua Pooled KB", stats.pooledBytes / 1024.0 );
+		SCION_PROFILE_COUNTER( "Lua Allocations", stats.totalAllocations );
+	}
+	else
+	{
+		SCION_PROFILE_COUNTER( "Lua Memory KB", lua_gc( L, LUA_GCCOUNT ) );
 	}
 }
 
@@ -406,36 +474,65 @@ auto create_lua_logger = []( sol::state& lua ) {
 
 void ScriptingSystem::RegisterLuaBindings( sol::state& lua, Scion::Core::ECS::Registry& registry )
 {
+	// Types the engine pushes to lua on its own must be bound before the scripts run.
 	Scion::Core::Scripting::GLMBindings::CreateGLMBindings( lua );
 	Scion::Core::InputManager::CreateLuaInputBindings( lua, registry );
 	SCION_RESOURCES::AssetManager::CreateLuaAssetManager( lua );
-	Scion::Core::Scripting::SoundBinder::CreateSoundBind( lua );
-	Scion::Core::Scripting::RendererBinder::CreateRenderingBind( lua, registry );
 	Scion::Core::Scripting::UserDataBinder::CreateLuaUserData( lua );
-	Scion::Core::Scripting::LuaFilesystem::CreateLuaFileSystemBind( lua );
 	Scion::Core::Scripting::ScriptingHelpers::CreateLuaHelpers( lua );
 
-	Scion::Core::FollowCamera::CreateLuaFollowCamera( lua, registry );
-	Scion::Core::Character::CreateCharacterLuaBind( lua, registry );
-
-	create_timer( lua );
 	create_lua_logger( lua );
 	createTweenLuaBind( lua );
 
-	Scion::Core::State::CreateLuaStateBind( lua );
-	Scion::Core::StateStack::CreateLuaStateStackBind( lua );
-	Scion::Core::StateMachine::CreateLuaStateMachine( lua );
-
 	Registry::CreateLuaRegistryBind( lua, registry );
 	Entity::CreateLuaEntityBind( lua, registry );
+	EntityHandle::CreateLuaEntityHandleBind( lua );
 	TransformComponent::CreateLuaTransformBind( lua );
 	SpriteComponent::CreateSpriteLuaBind( lua );
-	AnimationComponent::CreateAnimationLuaBind( lua );
-	BoxColliderComponent::CreateLuaBoxColliderBind( lua );
-	CircleColliderComponent::CreateLuaCircleColliderBind( lua );
-	TextComponent::CreateLuaTextBindings( lua );
-	RigidBodyComponent::CreateRigidBodyBind( lua );
-	UIComponent::CreateLuaBind( lua );
+
+	// Everything else is bound the first time a script reads one of its globals.
+	auto pLazyBindings = std::make_shared<Scion::Core::Scripting::LazyLuaBindings>( lua );
+
+	pLazyBindings->Add( "Sound", { "AudioPlayer" }, &Scion::Core::Scripting::SoundBinder::CreateSoundBind );
+	pLazyBindings->Add( "Renderer",
+						{ "Line", "Rect", "Circle", "Text", "DrawRect", "DrawLine", "DrawCircle", "DrawFilledRect",
+						  "DrawText", "Camera" },
+						[ &registry ]( sol::state& lua ) {
+							Scion::Core::Scripting::RendererBinder::CreateRenderingBind( lua, registry );
+						} );
+	pLazyBindings->Add(
+		"Filesystem", { "Filesystem" }, &Scion::Core::Scripting::LuaFilesystem::CreateLuaFileSystemBind );
+	pLazyBindings->Add( "Timer", { "Timer" }, create_timer );
+	pLazyBindings->Add( "States", { "State", "StateStack", "StateMachine" }, []( sol::state& lua ) {
+		Scion::Core::State::CreateLuaStateBind( lua );
+		Scion::Core::StateStack::CreateLuaStateStackBind( lua );
+		Scion::Core::StateMachine::CreateLuaStateMachine( lua );
+	} );
+
+	pLazyBindings->Add( "Animation", { "Animation" }, &AnimationComponent::CreateAnimationLuaBind );
+	pLazyBindings->Add( "BoxCollider", { "BoxCollider" }, &BoxColliderComponent::CreateLuaBoxColliderBind );
+	pLazyBindings->Add( "CircleCollider", { "CircleCollider" }, &CircleColliderComponent::CreateLuaCircleColliderBind );
+	pLazyBindings->Add( "TextComponent", { "TextComponent" }, &TextComponent::CreateLuaTextBindings );
+	pLazyBindings->Add( "RigidBody", { "RigidBody" }, &RigidBodyComponent::CreateRigidBodyBind );
+	pLazyBindings->Add( "UIComp", { "UIComp", "UIObjectType" }, &UIComponent::CreateLuaBind );
+	pLazyBindings->Add( "TweenComponent", { "TweenComponent" }, &TweenComponent::CreateLuaTweenComponentBind );
+	pLazyBindings->Add(
+		"ParticleEmitter", { "ParticleEmitter" }, &ParticleEmitterComponent::CreateLuaParticleEmitterBind );
+
+	pLazyBindings->Add(
+		"FollowCamera",
+		{ "FollowCamParams", "FollowCamera" },
+		[ &registry ]( sol::state& lua ) { Scion::Core::FollowCamera::CreateLuaFollowCamera( lua, registry ); },
+		{ "Renderer" } );
+	pLazyBindings->Add(
+		"Character",
+		{ "CharacterParams", "Character" },
+		[ &registry ]( sol::state& lua ) { Scion::Core::Character::CreateCharacterLuaBind( lua, registry ); },
+		// getStateMachine pushes a StateMachine without the script reading its global.
+		{ "Animation", "BoxCollider", "CircleCollider", "States" } );
+
+	Scion::Core::Scripting::LazyLuaBindings::Install( pLazyBindings );
+	registry.AddToContext<std::shared_ptr<Scion::Core::Scripting::LazyLuaBindings>>( pLazyBindings );
 
 	if ( CORE_GLOBALS().IsPhysicsEnabled() )
 	{
@@ -541,6 +638,26 @@ void ScriptingSystem::RegisterLuaFunctions( sol::state& lua, Scion::Core::ECS::R
 
 	lua.set_function( "S2D_GetProjecPath", [ & ] { return engine.GetProjectPath(); } );
 
+	// The number of allocations the lua state has made, 0 if it does not use the engine allocator.
+	lua.set_function( "S2D_LuaAllocations", []( sol::this_state s ) {
+		const auto* pAllocator = Scion::Core::Scripting::LuaAllocator::Get( s );
+		return pAllocator ? pAllocator->GetStats().totalAllocations : size_t{ 0 };
+	} );
+
+	Scion::Core::LuaProfiler::CreateLuaProfilerBind( lua );
+	Scion::Core::Scripting::LuaTaskScheduler::CreateLuaTaskSchedulerBind( lua, registry );
+	SCION_RESOURCES::AsyncAssetLoader::CreateLuaAsyncLoaderBind( lua, registry );
+
+	// The worker pool starts its threads and lua states when it is bound.
+	auto bindWorkerPool = [ &registry ]( sol::state& lua ) {
+		Scion::Core::Scripting::LuaWorkerPool::CreateLuaWorkerPoolBind( lua, registry );
+	};
+
+	if ( auto* pLazyBindings = registry.TryGetContext<std::shared_ptr<Scion::Core::Scripting::LazyLuaBindings>>() )
+		( *pLazyBindings )->Add( "Jobs", { "Jobs", "run_job", "JobStatus", "LuaJob" }, bindWorkerPool );
+	else
+		bindWorkerPool( lua );
+
 	lua.new_usertype<Scion::Utilities::RandomIntGenerator>(
 		"RandomInt",
 		sol::call_constructor,
@@ -561,6 +678,7 @@ void ScriptingSystem::RegisterLuaFunctions( sol::state& lua, Scion::Core::ECS::R
 	} );
 
 	Scene::CreateLuaBind( lua );
+	Scion::Core::Loaders::LevelStreamer::CreateLuaLevelStreamerBind( lua, registry );
 }
 
 void ScriptingSystem::RegisterLuaEvents( sol::state& lua, Scion::Core::ECS::Registry& registry )
@@ -573,6 +691,7 @@ void ScriptingSystem::RegisterLuaEvents( sol::state& lua, Scion::Core::ECS::Regi
 	EventDispatcher::RegisterMetaEventFuncs<KeyEvent>();
 	EventDispatcher::RegisterMetaEventFuncs<LuaEvent>();
 	EventDispatcher::RegisterMetaEventFuncs<GamepadConnectEvent>();
+	EventDispatcher::RegisterMetaEventFuncs<TweenEvent>();
 	EventDispatcher::CreateEventDispatcherLuaBind( lua, **pDispatcher );
 }
 
@@ -581,6 +700,9 @@ void ScriptingSystem::RegisterLuaSystems( sol::state& lua, Scion::Core::ECS::Reg
 	Scion::Core::Systems::RenderSystem::CreateRenderSystemLuaBind( lua, registry );
 	Scion::Core::Systems::RenderUISystem::CreateRenderUISystemLuaBind( lua );
 	Scion::Core::Systems::AnimationSystem::CreateAnimationSystemLuaBind( lua, registry );
+	Scion::Core::Systems::SpatialQuerySystem::CreateSpatialQueryLuaBind( lua, registry );
+	Scion::Core::Systems::NavigationSystem::CreateNavigationLuaBind( lua, registry );
+	Scion::Core::Systems::TweenSystem::CreateTweenLuaBind( lua, registry );
 }
 
 } // namespace Scion::Core::Systems
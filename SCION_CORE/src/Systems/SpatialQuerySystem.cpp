@@ -0,0 +1,991 @@
+#include "Core/Systems/SpatialQuerySystem.h"
+#include "Core/ECS/Registry.h"
+#include "Core/ECS/MainRegistry.h"
+#include "Core/ECS/Components/TransformComponent.h"
+#include "Core/ECS/Components/BoxColliderComponent.h"
+#include "Core/ECS/Components/CircleColliderComponent.h"
+#include "Core/ECS/Components/PhysicsComponent.h"
+#include "Core/ECS/Components/Identification.h"
+#include "Core/Systems/TileColliderSystem.h"
+#include "Core/CoreUtilities/CoreEngineData.h"
+
+#include <ScionUtilities/ThreadPool.h>
+#include <Logger/Logger.h>
+#include <numeric>
+#include <limits>
+
+using namespace Scion::Core::ECS;
+
+namespace
+{
+/* Entries touching more cells than this are tested by every query instead. */
+constexpr std::uint64_t MAX_ENTRY_CELLS = 256;
+/* Cell coordinates are clamped to this, far beyond any level, before casting to int. */
+constexpr float MAX_CELL_COORD = 536870912.f;
+
+std::uint64_t CellKey( int x, int y )
+{
+	return ( static_cast<std::uint64_t>( static_cast<std::uint32_t>( x ) ) << 32 ) |
+		   static_cast<std::uint32_t>( y );
+}
+
+std::uint32_t GroupHash( const std::string& sGroup )
+{
+	return sGroup.empty() ? 0 : entt::hashed_string::value( sGroup.c_str() );
+}
+
+/*
+ * The group of a query. Bodies are matched by the group bit of their user data, so testing a
+ * fixture is a single and. Entities in the grid are matched by the hash of their identification group.
+ */
+struct GroupFilter
+{
+	std::uint32_t hash{ 0 };
+	std::uint32_t mask{ 0 };
+
+	inline bool Matches( std::uint32_t groupHash ) const { return hash == 0 || groupHash == hash; }
+	inline bool Matches( const Scion::Physics::FixtureData& fixtureData ) const
+	{
+		return hash == 0 || ( fixtureData.pUserData && fixtureData.pUserData->InGroup( mask ) );
+	}
+};
+
+GroupFilter MakeGroupFilter( const std::string& sGroup )
+{
+	// A group no body has been created with yet gets no bit, and matches no body.
+	return GroupFilter{ .hash = GroupHash( sGroup ), .mask = Scion::Physics::ObjectTags::FindGroupMask( sGroup ) };
+}
+
+b2Vec2 PixelsToWorld( const glm::vec2& position )
+{
+	auto& coreGlobals = CORE_GLOBALS();
+	const float M2P = coreGlobals.MetersToPixels();
+	return b2Vec2{ ( position.x / M2P ) - coreGlobals.ScaledWidth() * 0.5f,
+				   ( position.y / M2P ) - coreGlobals.ScaledHeight() * 0.5f };
+}
+
+glm::vec2 WorldToPixels( const b2Vec2& position )
+{
+	auto& coreGlobals = CORE_GLOBALS();
+	const float M2P = coreGlobals.MetersToPixels();
+	return glm::vec2{ ( coreGlobals.ScaledWidth() * 0.5f + position.x ) * M2P,
+					  ( coreGlobals.ScaledHeight() * 0.5f + position.y ) * M2P };
+}
+
+b2World* GetPhysicsWorld( Registry& registry )
+{
+	auto* pPhysicsWorld = registry.TryGetContext<Scion::Physics::PhysicsWorld>();
+	return pPhysicsWorld ? pPhysicsWorld->get() : nullptr;
+}
+
+Scion::Core::Systems::TileColliderSystem* GetTileColliders( Registry& registry )
+{
+	auto* pTileColliders = registry.TryGetContext<std::shared_ptr<Scion::Core::Systems::TileColliderSystem>>();
+	return pTileColliders ? pTileColliders->get() : nullptr;
+}
+
+const Scion::Physics::FixtureData* GetFixtureData( b2Fixture* pFixture )
+{
+	return reinterpret_cast<Scion::Physics::FixtureData*>( pFixture->GetUserData().pointer );
+}
+
+/* Merged tile colliders report a single tile for each box, find the tile at the position instead. */
+std::uint32_t GetFixtureEntity( b2Fixture* pFixture, const glm::vec2& position,
+								const Scion::Core::Systems::TileColliderSystem* pTileColliders )
+{
+	auto* pFixtureData = GetFixtureData( pFixture );
+	if ( !pFixtureData )
+		return static_cast<std::uint32_t>( entt::null );
+
+	if ( !pTileColliders || pFixtureData->entityID == entt::null )
+		return pFixtureData->GetEntity();
+
+	return static_cast<std::uint32_t>(
+		pTileColliders->GetTileAt( static_cast<entt::entity>( pFixtureData->entityID ), position ) );
+}
+
+b2AABB GetFixtureAABB( b2Fixture* pFixture )
+{
+	b2AABB aabb = pFixture->GetAABB( 0 );
+	for ( int i = 1; i < pFixture->GetShape()->GetChildCount(); ++i )
+		aabb.Combine( pFixture->GetAABB( i ) );
+
+	return aabb;
+}
+
+/* @brief Gets the pixel bounds of the fixture. */
+std::pair<glm::vec2, glm::vec2> GetFixtureBounds( b2Fixture* pFixture )
+{
+	const b2AABB aabb = GetFixtureAABB( pFixture );
+	return { WorldToPixels( aabb.lowerBound ), WorldToPixels( aabb.upperBound ) };
+}
+
+/* Adds the entities of the fixture inside the box. A merged tile box adds each of its tiles inside. */
+void GetFixtureEntities( b2Fixture* pFixture, const glm::vec2& min, const glm::vec2& max,
+						 const Scion::Core::Systems::TileColliderSystem* pTileColliders,
+						 std::vector<std::uint32_t>& outEntities )
+{
+	auto* pFixtureData = GetFixtureData( pFixture );
+	if ( !pFixtureData )
+		return;
+
+	if ( pTileColliders && pFixtureData->entityID != entt::null )
+	{
+		pTileColliders->GetTilesIn( static_cast<entt::entity>( pFixtureData->entityID ), min, max, outEntities );
+		return;
+	}
+
+	if ( const auto entityID = pFixtureData->GetEntity(); entityID != entt::null )
+		outEntities.push_back( entityID );
+}
+
+bool FixturesOverlap( b2Fixture* pFixtureA, b2Fixture* pFixtureB )
+{
+	const auto& transformA = pFixtureA->GetBody()->GetTransform();
+	const auto& transformB = pFixtureB->GetBody()->GetTransform();
+
+	for ( int i = 0; i < pFixtureA->GetShape()->GetChildCount(); ++i )
+	{
+		for ( int j = 0; j < pFixtureB->GetShape()->GetChildCount(); ++j )
+		{
+			if ( b2TestOverlap( pFixtureA->GetShape(), i, pFixtureB->GetShape(), j, transformA, transformB ) )
+				return true;
+		}
+	}
+
+	return false;
+}
+
+/* @brief Tests a box, or a circle if the radius is not zero, in pixels against the fixture. */
+bool ShapeOverlapsFixture( const glm::vec2& min, const glm::vec2& max, float radius, b2Fixture* pFixture )
+{
+	const float P2M = CORE_GLOBALS().PixelsToMeters();
+	const glm::vec2 halfSize = ( max - min ) * 0.5f;
+
+	b2CircleShape circle{};
+	b2PolygonShape box{};
+	const b2Shape* pShape{ nullptr };
+
+	if ( radius > 0.f )
+	{
+		circle.m_radius = radius * P2M;
+		circle.m_p = PixelsToWorld( min + halfSize );
+		pShape = &circle;
+	}
+	else if ( halfSize.x > 0.f && halfSize.y > 0.f )
+	{
+		box.SetAsBox( halfSize.x * P2M, halfSize.y * P2M, PixelsToWorld( min + halfSize ), 0.f );
+		pShape = &box;
+	}
+	else
+	{
+		// A box without an area is only tested by its bounds, which the broadphase already did.
+		return true;
+	}
+
+	b2Transform identity{};
+	identity.SetIdentity();
+
+	for ( int i = 0; i < pFixture->GetShape()->GetChildCount(); ++i )
+	{
+		if ( b2TestOverlap( pShape, 0, pFixture->GetShape(), i, identity, pFixture->GetBody()->GetTransform() ) )
+			return true;
+	}
+
+	return false;
+}
+
+/* Collects the fixtures whose tight bounds overlap the query box. */
+class FixtureQueryCallback : public b2QueryCallback
+{
+  public:
+	FixtureQueryCallback( const b2AABB& aabb, std::vector<b2Fixture*>& fixtures )
+		: m_AABB{ aabb }
+		, m_Fixtures{ fixtures }
+	{
+	}
+
+	virtual bool ReportFixture( b2Fixture* pFixture ) override
+	{
+		for ( int i = 0; i < pFixture->GetShape()->GetChildCount(); ++i )
+		{
+			if ( b2TestOverlap( pFixture->GetAABB( i ), m_AABB ) )
+			{
+				m_Fixtures.push_back( pFixture );
+				break;
+			}
+		}
+
+		return true;
+	}
+
+  private:
+	b2AABB m_AABB;
+	std::vector<b2Fixture*>& m_Fixtures;
+};
+
+void QueryFixtures( b2World& world, const b2AABB& aabb, std::vector<b2Fixture*>& fixtures )
+{
+	fixtures.clear();
+
+	FixtureQueryCallback callback{ aabb, fixtures };
+	world.QueryAABB( &callback, aabb );
+}
+
+void QueryFixtures( b2World& world, const glm::vec2& min, const glm::vec2& max, std::vector<b2Fixture*>& fixtures )
+{
+	b2AABB aabb{};
+	aabb.lowerBound = PixelsToWorld( min );
+	aabb.upperBound = PixelsToWorld( max );
+
+	QueryFixtures( world, aabb, fixtures );
+}
+
+void SortUnique( std::vector<std::uint32_t>& entities )
+{
+	std::ranges::sort( entities );
+	const auto [ first, last ] = std::ranges::unique( entities );
+	entities.erase( first, last );
+}
+
+} // namespace
+
+namespace Scion::Core::Systems
+{
+
+SpatialQuerySystem::SpatialQuerySystem( float cellSize )
+	: m_CellSize{ cellSize > 0.f ? cellSize : 64.f }
+{
+}
+
+void SpatialQuerySystem::Update( Scion::Core::ECS::Registry& registry )
+{
+	m_Entries.clear();
+
+	auto& enttRegistry = registry.GetRegistry();
+
+	// Entities with a body are answered by the broadphase.
+	auto hasBody = [ & ]( entt::entity entity ) {
+		auto* pPhysics = enttRegistry.try_get<PhysicsComponent>( entity );
+		return pPhysics && pPhysics->GetBody();
+	};
+
+	auto getGroup = [ & ]( entt::entity entity ) {
+		auto* pID = enttRegistry.try_get<Identification>( entity );
+		return pID ? GroupHash( pID->group ) : 0;
+	};
+
+	auto boxView = enttRegistry.view<TransformComponent, BoxColliderComponent>();
+	for ( auto entity : boxView )
+	{
+		if ( hasBody( entity ) )
+			continue;
+
+		const auto& transform = boxView.get<TransformComponent>( entity );
+		const auto& boxCollider = boxView.get<BoxColliderComponent>( entity );
+
+		SpatialEntry entry{ .entity = static_cast<std::uint32_t>( entity ), .groupHash = getGroup( entity ) };
+		entry.min = transform.position + boxCollider.offset;
+		entry.max = entry.min + glm::vec2{ boxCollider.width * transform.scale.x, boxCollider.height * transform.scale.y };
+		entry.center = ( entry.min + entry.max ) * 0.5f;
+
+		m_Entries.push_back( entry );
+	}
+
+	auto circleView = enttRegistry.view<TransformComponent, CircleColliderComponent>();
+	for ( auto entity : circleView )
+	{
+		if ( hasBody( entity ) )
+			continue;
+
+		const auto& transform = circleView.get<TransformComponent>( entity );
+		const auto& circleCollider = circleView.get<CircleColliderComponent>( entity );
+
+		SpatialEntry entry{ .entity = static_cast<std::uint32_t>( entity ), .groupHash = getGroup( entity ) };
+		entry.radius = circleCollider.radius * transform.scale.x;
+		entry.min = transform.position + circleCollider.offset;
+		entry.max = entry.min + glm::vec2{ entry.radius * 2.f };
+		entry.center = entry.min + glm::vec2{ entry.radius };
+
+		m_Entries.push_back( entry );
+	}
+
+	RebuildCells();
+}
+
+void SpatialQuerySystem::RebuildCells()
+{
+	m_Cells.clear();
+	m_LargeEntries.clear();
+	m_MinCell = glm::ivec2{ std::numeric_limits<int>::max() };
+	m_MaxCell = glm::ivec2{ std::numeric_limits<int>::min() };
+
+	for ( std::uint32_t i = 0; i < static_cast<std::uint32_t>( m_Entries.size() ); ++i )
+	{
+		InsertEntry( i );
+	}
+
+	std::ranges::sort( m_Cells );
+}
+
+void SpatialQuerySystem::InsertEntry( std::uint32_t index )
+{
+	const auto& entry = m_Entries[ index ];
+	const glm::ivec2 minCell = ToCell( entry.min );
+	const glm::ivec2 maxCell = ToCell( entry.max );
+
+	const auto numCells = static_cast<std::uint64_t>( maxCell.x - minCell.x + 1 ) *
+						  static_cast<std::uint64_t>( maxCell.y - minCell.y + 1 );
+	if ( numCells > MAX_ENTRY_CELLS )
+	{
+		m_LargeEntries.push_back( index );
+		return;
+	}
+
+	m_MinCell = glm::min( m_MinCell, minCell );
+	m_MaxCell = glm::max( m_MaxCell, maxCell );
+
+	for ( int y = minCell.y; y <= maxCell.y; ++y )
+	{
+		for ( int x = minCell.x; x <= maxCell.x; ++x )
+		{
+			m_Cells.emplace_back( CellKey( x, y ), index );
+		}
+	}
+}
+
+glm::ivec2 SpatialQuerySystem::ToCell( const glm::vec2& position ) const
+{
+	auto toCell = [ this ]( float value ) {
+		const float cell = std::floor( value / m_CellSize );
+		// Written so that NaN ends up at the lower bound as well.
+		if ( !( cell > -MAX_CELL_COORD ) )
+			return -static_cast<int>( MAX_CELL_COORD );
+		if ( cell > MAX_CELL_COORD )
+			return static_cast<int>( MAX_CELL_COORD );
+		return static_cast<int>( cell );
+	};
+
+	return glm::ivec2{ toCell( position.x ), toCell( position.y ) };
+}
+
+void SpatialQuerySystem::GatherCandidates( const glm::vec2& min, const glm::vec2& max )
+{
+	m_Candidates.assign( m_LargeEntries.begin(), m_LargeEntries.end() );
+
+	const glm::ivec2 minCell = glm::max( ToCell( min ), m_MinCell );
+	const glm::ivec2 maxCell = glm::min( ToCell( max ), m_MaxCell );
+	if ( m_Cells.empty() || minCell.x > maxCell.x || minCell.y > maxCell.y )
+		return;
+
+	// Looking up more cells than there are entries costs more than testing every entry.
+	const auto numCells = static_cast<std::uint64_t>( maxCell.x - minCell.x + 1 ) *
+						  static_cast<std::uint64_t>( maxCell.y - minCell.y + 1 );
+	if ( numCells > m_Entries.size() )
+	{
+		m_Candidates.resize( m_Entries.size() );
+		std::iota( m_Candidates.begin(), m_Candidates.end(), 0u );
+		return;
+	}
+
+	for ( int y = minCell.y; y <= maxCell.y; ++y )
+	{
+		for ( int x = minCell.x; x <= maxCell.x; ++x )
+		{
+			const auto key = CellKey( x, y );
+			auto itr = std::ranges::lower_bound( m_Cells, key, {}, []( const auto& cell ) { return cell.first; } );
+			for ( ; itr != m_Cells.end() && itr->first == key; ++itr )
+			{
+				m_Candidates.push_back( itr->second );
+			}
+		}
+	}
+}
+
+bool SpatialQuerySystem::Overlaps( const SpatialEntry& a, const SpatialEntry& b ) const
+{
+	if ( a.radius > 0.f && b.radius > 0.f )
+	{
+		const glm::vec2 difference = a.center - b.center;
+		const float radSum = a.radius + b.radius;
+		return glm::dot( difference, difference ) <= radSum * radSum;
+	}
+
+	if ( a.radius > 0.f )
+		return OverlapsCircle( b, a.center, a.radius );
+
+	if ( b.radius > 0.f )
+		return OverlapsCircle( a, b.center, b.radius );
+
+	return a.min.x <= b.max.x && b.min.x <= a.max.x && a.min.y <= b.max.y && b.min.y <= a.max.y;
+}
+
+bool SpatialQuerySystem::OverlapsCircle( const SpatialEntry& entry, const glm::vec2& center, float radius ) const
+{
+	const float radSum = entry.radius + radius;
+	if ( entry.radius > 0.f )
+	{
+		const glm::vec2 difference = entry.center - center;
+		return glm::dot( difference, difference ) <= radSum * radSum;
+	}
+
+	const glm::vec2 closest = glm::clamp( center, entry.min, entry.max );
+	const glm::vec2 difference = closest - center;
+	return glm::dot( difference, difference ) <= radius * radius;
+}
+
+void SpatialQuerySystem::QueryAABB( Scion::Core::ECS::Registry& registry, const glm::vec2& min, const glm::vec2& max,
+									std::vector<std::uint32_t>& outEntities, const std::string& sGroup )
+{
+	outEntities.clear();
+	const auto filter = MakeGroupFilter( sGroup );
+
+	if ( auto* pWorld = GetPhysicsWorld( registry ) )
+	{
+		static thread_local std::vector<b2Fixture*> fixtures;
+		QueryFixtures( *pWorld, min, max, fixtures );
+
+		auto* pTileColliders = GetTileColliders( registry );
+
+		for ( auto* pFixture : fixtures )
+		{
+			auto* pFixtureData = GetFixtureData( pFixture );
+			if ( pFixtureData && filter.Matches( *pFixtureData ) )
+				GetFixtureEntities( pFixture, min, max, pTileColliders, outEntities );
+		}
+	}
+
+	const SpatialEntry queryBox{ .min = min, .max = max };
+
+	GatherCandidates( min, max );
+	for ( const auto index : m_Candidates )
+	{
+		const auto& entry = m_Entries[ index ];
+		if ( filter.Matches( entry.groupHash ) && Overlaps( entry, queryBox ) )
+			outEntities.push_back( entry.entity );
+	}
+
+	SortUnique( outEntities );
+}
+
+void SpatialQuerySystem::GatherCircle( Scion::Core::ECS::Registry& registry, const glm::vec2& center, float radius,
+									   const std::string& sGroup )
+{
+	m_Hits.clear();
+	const auto filter = MakeGroupFilter( sGroup );
+
+	const glm::vec2 min = center - glm::vec2{ radius };
+	const glm::vec2 max = center + glm::vec2{ radius };
+
+	if ( auto* pWorld = GetPhysicsWorld( registry ) )
+	{
+		static thread_local std::vector<b2Fixture*> fixtures;
+		QueryFixtures( *pWorld, min, max, fixtures );
+
+		b2CircleShape circle{};
+		circle.m_radius = radius * CORE_GLOBALS().PixelsToMeters();
+
+		b2Transform circleTransform{};
+		circleTransform.Set( PixelsToWorld( center ), 0.f );
+
+		auto* pTileColliders = GetTileColliders( registry );
+
+		for ( auto* pFixture : fixtures )
+		{
+			auto* pBody = pFixture->GetBody();
+			auto* pFixtureData = GetFixtureData( pFixture );
+			if ( !pFixtureData || !filter.Matches( *pFixtureData ) )
+				continue;
+
+			// The position of a merged body says nothing about its tiles, use the closest point of the box.
+			const bool bMergedTile = pFixtureData->entityID != entt::null;
+			glm::vec2 position = WorldToPixels( pBody->GetPosition() );
+			if ( bMergedTile )
+			{
+				const auto [ boundsMin, boundsMax ] = GetFixtureBounds( pFixture );
+				position = glm::clamp( center, boundsMin, boundsMax );
+			}
+
+			const auto entityID = GetFixtureEntity( pFixture, position, pTileColliders );
+			if ( entityID == entt::null )
+				continue;
+
+			bool bOverlaps{ false };
+			for ( int i = 0; i < pFixture->GetShape()->GetChildCount() && !bOverlaps; ++i )
+			{
+				bOverlaps =
+					b2TestOverlap( &circle, 0, pFixture->GetShape(), i, circleTransform, pBody->GetTransform() );
+			}
+
+			if ( !bOverlaps )
+				continue;
+
+			const glm::vec2 difference = position - center;
+			m_Hits.push_back( SpatialHit{ .entity = entityID, .distanceSq = glm::dot( difference, difference ) } );
+		}
+	}
+
+	GatherCandidates( min, max );
+	for ( const auto index : m_Candidates )
+	{
+		const auto& entry = m_Entries[ index ];
+		if ( !filter.Matches( entry.groupHash ) || !OverlapsCircle( entry, center, radius ) )
+			continue;
+
+		const glm::vec2 difference = entry.center - center;
+		m_Hits.push_back( SpatialHit{ .entity = entry.entity, .distanceSq = glm::dot( difference, difference ) } );
+	}
+
+	// Entities spanning several cells, or bodies with several fixtures, are found more than once.
+	std::ranges::sort( m_Hits, []( const SpatialHit& a, const SpatialHit& b ) {
+		return a.entity != b.entity ? a.entity < b.entity : a.distanceSq < b.distanceSq;
+	} );
+
+	const auto [ first, last ] = std::ranges::unique( m_Hits, {}, &SpatialHit::entity );
+	m_Hits.erase( first, last );
+}
+
+void SpatialQuerySystem::QueryCircle( Scion::Core::ECS::Registry& registry, const glm::vec2& center, float radius,
+									  std::vector<std::uint32_t>& outEntities, const std::string& sGroup )
+{
+	outEntities.clear();
+	GatherCircle( registry, center, radius, sGroup );
+
+	outEntities.reserve( m_Hits.size() );
+	for ( const auto& hit : m_Hits )
+	{
+		outEntities.push_back( hit.entity );
+	}
+}
+
+void SpatialQuerySystem::QueryNearest( Scion::Core::ECS::Registry& registry, const glm::vec2& center, float radius,
+									   size_t k, std::vector<std::uint32_t>& outEntities, const std::string& sGroup )
+{
+	outEntities.clear();
+	if ( k == 0 )
+		return;
+
+	GatherCircle( registry, center, radius, sGroup );
+
+	const auto count = std::min( k, m_Hits.size() );
+	std::partial_sort( m_Hits.begin(),
+					   m_Hits.begin() + count,
+					   m_Hits.end(),
+					   []( const SpatialHit& a, const SpatialHit& b ) { return a.distanceSq < b.distanceSq; } );
+
+	outEntities.reserve( count );
+	for ( size_t i = 0; i < count; ++i )
+	{
+		outEntities.push_back( m_Hits[ i ].entity );
+	}
+}
+
+void SpatialQuerySystem::QueryOverlapPairs( Scion::Core::ECS::Registry& registry, std::vector<std::uint32_t>& outPairs,
+											const std::string& sGroup )
+{
+	outPairs.clear();
+	const auto filter = MakeGroupFilter( sGroup );
+
+	// Store each pair as a single key, smallest id first, so duplicates can be removed.
+	static thread_local std::vector<std::uint64_t> pairKeys;
+	pairKeys.clear();
+
+	auto addPair = [ & ]( std::uint32_t a, std::uint32_t b ) {
+		if ( a == b || a == entt::null || b == entt::null )
+			return;
+		if ( a > b )
+			std::swap( a, b );
+		pairKeys.push_back( ( static_cast<std::uint64_t>( a ) << 32 ) | b );
+	};
+
+	if ( auto* pWorld = GetPhysicsWorld( registry ) )
+	{
+		auto* pTileColliders = GetTileColliders( registry );
+
+		static thread_local std::vector<b2Fixture*> fixtures;
+		static thread_local std::vector<std::uint32_t> entities;
+
+		// Bodies are paired through the broadphase rather than their contacts, since filters can keep
+		// overlapping bodies from getting a contact. Static bodies never move into each other, so only
+		// bodies that can move start a query.
+		for ( auto* pBody = pWorld->GetBodyList(); pBody; pBody = pBody->GetNext() )
+		{
+			if ( pBody->GetType() == b2_staticBody )
+				continue;
+
+			for ( auto* pFixtureA = pBody->GetFixtureList(); pFixtureA; pFixtureA = pFixtureA->GetNext() )
+			{
+				auto* pFixtureDataA = GetFixtureData( pFixtureA );
+				if ( !pFixtureDataA || !filter.Matches( *pFixtureDataA ) )
+					continue;
+
+				const auto entityA = pFixtureDataA->GetEntity();
+				const auto [ boundsMin, boundsMax ] = GetFixtureBounds( pFixtureA );
+
+				QueryFixtures( *pWorld, GetFixtureAABB( pFixtureA ), fixtures );
+				for ( auto* pFixtureB : fixtures )
+				{
+					auto* pFixtureDataB = GetFixtureData( pFixtureB );
+					if ( pFixtureB->GetBody() == pBody || !pFixtureDataB || !filter.Matches( *pFixtureDataB ) ||
+						 !FixturesOverlap( pFixtureA, pFixtureB ) )
+						continue;
+
+					entities.clear();
+					GetFixtureEntities( pFixtureB, boundsMin, boundsMax, pTileColliders, entities );
+					for ( const auto entityB : entities )
+						addPair( entityA, entityB );
+				}
+			}
+		}
+
+		// Entities without a body are not in the broadphase, query it with each of them.
+		for ( const auto& entry : m_Entries )
+		{
+			if ( !filter.Matches( entry.groupHash ) )
+				continue;
+
+			QueryFixtures( *pWorld, entry.min, entry.max, fixtures );
+			for ( auto* pFixture : fixtures )
+			{
+				auto* pFixtureData = GetFixtureData( pFixture );
+				if ( !pFixtureData || !filter.Matches( *pFixtureData ) ||
+					 !ShapeOverlapsFixture( entry.min, entry.max, entry.radius, pFixture ) )
+					continue;
+
+				entities.clear();
+				GetFixtureEntities( pFixture, entry.min, entry.max, pTileColliders, entities );
+				for ( const auto entityB : entities )
+					addPair( entry.entity, entityB );
+			}
+		}
+	}
+
+	// The cells are sorted by key, so each run of equal keys holds the entries of one cell.
+	for ( size_t runStart = 0; runStart < m_Cells.size(); )
+	{
+		const auto key = m_Cells[ runStart ].first;
+		size_t runEnd = runStart + 1;
+		while ( runEnd < m_Cells.size() && m_Cells[ runEnd ].first == key )
+			++runEnd;
+
+		for ( size_t i = runStart; i < runEnd; ++i )
+		{
+			const auto& a = m_Entries[ m_Cells[ i ].second ];
+			if ( !filter.Matches( a.groupHash ) )
+				continue;
+
+			for ( size_t j = i + 1; j < runEnd; ++j )
+			{
+				const auto& b = m_Entries[ m_Cells[ j ].second ];
+				if ( !filter.Matches( b.groupHash ) )
+					continue;
+
+				// Only test a pair in the first cell both entries share.
+				const glm::ivec2 homeCell = ToCell( glm::max( a.min, b.min ) );
+				if ( CellKey( homeCell.x, homeCell.y ) != key )
+					continue;
+
+				if ( Overlaps( a, b ) )
+					addPair( a.entity, b.entity );
+			}
+		}
+
+		runStart = runEnd;
+	}
+
+	// Large entries are not in the grid, test them against every entry.
+	for ( const auto largeIndex : m_LargeEntries )
+	{
+		const auto& a = m_Entries[ largeIndex ];
+		if ( !filter.Matches( a.groupHash ) )
+			continue;
+
+		for ( std::uint32_t i = 0; i < static_cast<std::uint32_t>( m_Entries.size() ); ++i )
+		{
+			const auto& b = m_Entries[ i ];
+			if ( i == largeIndex || !filter.Matches( b.groupHash ) )
+				continue;
+
+			if ( Overlaps( a, b ) )
+				addPair( a.entity, b.entity );
+		}
+	}
+
+	std::ranges::sort( pairKeys );
+	const auto [ first, last ] = std::ranges::unique( pairKeys );
+	pairKeys.erase( first, last );
+
+	outPairs.reserve( pairKeys.size() * 2 );
+	for ( const auto pairKey : pairKeys )
+	{
+		outPairs.push_back( static_cast<std::uint32_t>( pairKey >> 32 ) );
+		outPairs.push_back( static_cast<std::uint32_t>( pairKey ) );
+	}
+}
+
+void SpatialQuerySystem::RayCastBatch( Scion::Core::ECS::Registry& registry,
+										std::span<const Scion::Physics::RayQuery> rays,
+										std::vector<Scion::Physics::RayQueryResult>& outResults )
+{
+	auto* pWorld = GetPhysicsWorld( registry );
+	if ( !pWorld )
+	{
+		outResults.assign( rays.size(), Scion::Physics::RayQueryResult{} );
+		return;
+	}
+
+	SetupThreadPool();
+
+	m_Rays.assign( rays.begin(), rays.end() );
+	for ( auto& ray : m_Rays )
+	{
+		ray.start = PixelsToWorld( glm::vec2{ ray.start.x, ray.start.y } );
+		ray.end = PixelsToWorld( glm::vec2{ ray.end.x, ray.end.y } );
+	}
+
+	m_BatchQuery.RayCast( *pWorld, m_Rays, outResults );
+
+	auto* pTileColliders = GetTileColliders( registry );
+
+	for ( auto& result : outResults )
+	{
+		if ( !result.bHit )
+			continue;
+
+		const auto point = WorldToPixels( result.point );
+		result.point = b2Vec2{ point.x, point.y };
+
+		// Merged tiles report the tile at the corner of their box. Step into the box to find the tile that was hit.
+		if ( pTileColliders && result.entityID != entt::null )
+		{
+			const glm::vec2 inside = point - glm::vec2{ result.normal.x, result.normal.y } * 0.5f;
+			result.entityID = static_cast<std::uint32_t>(
+				pTileColliders->GetTileAt( static_cast<entt::entity>( result.entityID ), inside ) );
+		}
+	}
+}
+
+void SpatialQuerySystem::BoxQueryBatch( Scion::Core::ECS::Registry& registry,
+										std::span<const Scion::Physics::BoxQuery> boxes,
+										std::vector<Scion::Physics::BoxQueryResult>& outResults,
+										std::vector<std::uint32_t>& outEntities )
+{
+	auto* pWorld = GetPhysicsWorld( registry );
+	if ( !pWorld )
+	{
+		outResults.assign( boxes.size(), Scion::Physics::BoxQueryResult{} );
+		outEntities.clear();
+		return;
+	}
+
+	SetupThreadPool();
+
+	m_Boxes.assign( boxes.begin(), boxes.end() );
+	for ( auto& box : m_Boxes )
+	{
+		box.aabb.lowerBound = PixelsToWorld( glm::vec2{ box.aabb.lowerBound.x, box.aabb.lowerBound.y } );
+		box.aabb.upperBound = PixelsToWorld( glm::vec2{ box.aabb.upperBound.x, box.aabb.upperBound.y } );
+	}
+
+	m_BatchQuery.QueryBoxes( *pWorld, m_Boxes, outResults, outEntities );
+
+	auto* pTileColliders = GetTileColliders( registry );
+	if ( !pTileColliders )
+		return;
+
+	// Merged tiles report one tile for each fixture, find every tile inside each box instead.
+	static thread_local std::vector<std::uint32_t> entities;
+	entities.clear();
+
+	for ( size_t i = 0; i < outResults.size(); ++i )
+	{
+		auto& result = outResults[ i ];
+		const auto first = entities.size();
+		const glm::vec2 min{ boxes[ i ].aabb.lowerBound.x, boxes[ i ].aabb.lowerBound.y };
+		const glm::vec2 max{ boxes[ i ].aabb.upperBound.x, boxes[ i ].aabb.upperBound.y };
+
+		for ( std::uint32_t j = 0; j < result.count; ++j )
+		{
+			pTileColliders->GetTilesIn( static_cast<entt::entity>( outEntities[ result.first + j ] ), min, max, entities );
+		}
+
+		std::sort( entities.begin() + first, entities.end() );
+		entities.erase( std::unique( entities.begin() + first, entities.end() ), entities.end() );
+
+		result.first = static_cast<std::uint32_t>( first );
+		result.count = static_cast<std::uint32_t>( entities.size() - first );
+	}
+
+	outEntities.assign( entities.begin(), entities.end() );
+}
+
+void SpatialQuerySystem::SetupThreadPool()
+{
+	if ( m_bThreadPoolSet )
+		return;
+
+	if ( auto* pThreadPool = MAIN_REGISTRY().TryGetContext<SharedThreadPool>() )
+	{
+		m_BatchQuery.SetThreadPool( *pThreadPool );
+	}
+
+	m_bThreadPoolSet = true;
+}
+
+void SpatialQuerySystem::SetCellSize( float cellSize )
+{
+	if ( cellSize <= 0.f )
+	{
+		SCION_ERROR( "Failed to set spatial query cell size. Cell size must be greater than 0." );
+		return;
+	}
+
+	m_CellSize = cellSize;
+	RebuildCells();
+}
+
+void SpatialQuerySystem::CreateSpatialQueryLuaBind( sol::state& lua, Scion::Core::ECS::Registry& registry )
+{
+	auto& spatialQuery = MAIN_REGISTRY().GetSpatialQuerySystem();
+
+	// Results are copied into the given table when one is passed, so scripts can reuse it every frame.
+	static std::vector<std::uint32_t> results;
+	auto toTable = []( const std::vector<std::uint32_t>& ids, sol::optional<sol::table> outTable, sol::this_state s ) {
+		sol::state_view lua{ s };
+		sol::table table = outTable ? *outTable : lua.create_table( static_cast<int>( ids.size() ), 0 );
+
+		for ( size_t i = 0; i < ids.size(); ++i )
+		{
+			table.raw_set( i + 1, ids[ i ] );
+		}
+
+		for ( size_t i = ids.size() + 1; table.raw_get<sol::object>( i ).valid(); ++i )
+		{
+			table.raw_set( i, sol::lua_nil );
+		}
+
+		return table;
+	};
+
+	lua.create_named_table(
+		"SpatialQuery",
+		"queryAABB",
+		[ &, toTable ]( const glm::vec2& min,
+						const glm::vec2& max,
+						sol::optional<std::string> sGroup,
+						sol::optional<sol::table> outTable,
+						sol::this_state s ) {
+			spatialQuery.QueryAABB( registry, min, max, results, sGroup.value_or( "" ) );
+			return toTable( results, outTable, s );
+		},
+		"queryCircle",
+		[ &, toTable ]( const glm::vec2& center,
+						float radius,
+						sol::optional<std::string> sGroup,
+						sol::optional<sol::table> outTable,
+						sol::this_state s ) {
+			spatialQuery.QueryCircle( registry, center, radius, results, sGroup.value_or( "" ) );
+			return toTable( results, outTable, s );
+		},
+		"queryNearest",
+		[ &, toTable ]( const glm::vec2& center,
+						float radius,
+						int k,
+						sol::optional<std::string> sGroup,
+						sol::optional<sol::table> outTable,
+						sol::this_state s ) {
+			spatialQuery.QueryNearest(
+				registry, center, radius, static_cast<size_t>( std::max( k, 0 ) ), results, sGroup.value_or( "" ) );
+			return toTable( results, outTable, s );
+		},
+		"queryOverlapPairs",
+		[ &, toTable ]( sol::optional<std::string> sGroup, sol::optional<sol::table> outTable, sol::this_state s ) {
+			spatialQuery.QueryOverlapPairs( registry, results, sGroup.value_or( "" ) );
+			return toTable( results, outTable, s );
+		},
+		// rays is a packed table of x1, y1, x2, y2 per ray. For every ray the result holds
+		// entity (-1 if nothing was hit), hitX, hitY, normalX, normalY, fraction.
+		"rayCastBatch",
+		[ & ]( const sol::table& rays,
+			   sol::optional<std::uint16_t> maskBits,
+			   sol::optional<sol::table> outTable,
+			   sol::this_state s ) {
+			static std::vector<Scion::Physics::RayQuery> queries;
+			static std::vector<Scion::Physics::RayQueryResult> rayResults;
+
+			const size_t numRays = rays.size() / 4;
+			queries.resize( numRays );
+			for ( size_t i = 0; i < numRays; ++i )
+			{
+				const auto index = static_cast<int>( i * 4 );
+				queries[ i ] = Scion::Physics::RayQuery{
+					.start = b2Vec2{ rays.raw_get<float>( index + 1 ), rays.raw_get<float>( index + 2 ) },
+					.end = b2Vec2{ rays.raw_get<float>( index + 3 ), rays.raw_get<float>( index + 4 ) },
+					.maskBits = maskBits.value_or( 0xFFFF ) };
+			}
+
+			spatialQuery.RayCastBatch( registry, queries, rayResults );
+
+			sol::state_view lua{ s };
+			sol::table table = outTable ? *outTable : lua.create_table( static_cast<int>( numRays * 6 ), 0 );
+			int index{ 1 };
+			for ( const auto& result : rayResults )
+			{
+				table.raw_set( index++, result.bHit ? static_cast<double>( result.entityID ) : -1.0 );
+				table.raw_set( index++, result.point.x );
+				table.raw_set( index++, result.point.y );
+				table.raw_set( index++, result.normal.x );
+				table.raw_set( index++, result.normal.y );
+				table.raw_set( index++, result.fraction );
+			}
+
+			for ( ; table.raw_get<sol::object>( index ).valid(); ++index )
+			{
+				table.raw_set( index, sol::lua_nil );
+			}
+
+			return table;
+		},
+		// boxes is a packed table of minX, minY, maxX, maxY per box. For every box the result holds
+		// the number of entities found followed by their ids.
+		"boxQueryBatch",
+		[ &, toTable ]( const sol::table& boxes,
+						sol::optional<std::uint16_t> maskBits,
+						sol::optional<sol::table> outTable,
+						sol::this_state s ) {
+			static std::vector<Scion::Physics::BoxQuery> queries;
+			static std::vector<Scion::Physics::BoxQueryResult> boxResults;
+			static std::vector<std::uint32_t> entities;
+
+			const size_t numBoxes = boxes.size() / 4;
+			queries.resize( numBoxes );
+			for ( size_t i = 0; i < numBoxes; ++i )
+			{
+				const auto index = static_cast<int>( i * 4 );
+				auto& query = queries[ i ];
+				query.aabb.lowerBound = b2Vec2{ boxes.raw_get<float>( index + 1 ), boxes.raw_get<float>( index + 2 ) };
+				query.aabb.upperBound = b2Vec2{ boxes.raw_get<float>( index + 3 ), boxes.raw_get<float>( index + 4 ) };
+				query.maskBits = maskBits.value_or( 0xFFFF );
+			}
+
+			spatialQuery.BoxQueryBatch( registry, queries, boxResults, entities );
+
+			results.clear();
+			results.reserve( boxResults.size() + entities.size() );
+			for ( const auto& result : boxResults )
+			{
+				results.push_back( result.count );
+				results.insert( results.end(),
+								entities.begin() + result.first,
+								entities.begin() + result.first + result.count );
+			}
+
+			return toTable( results, outTable, s );
+		},
+		"setCellSize",
+		[ & ]( float cellSize ) { spatialQuery.SetCellSize( cellSize ); },
+		"cellSize",
+		[ & ] { return spatialQuery.GetCellSize(); } );
+}
+
+} // namespace Scion::Core::Systems
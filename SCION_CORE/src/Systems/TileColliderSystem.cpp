@@ -0,0 +1,655 @@
+#include "Core/Systems/TileColliderSystem.h"
+#include "Core/ECS/Registry.h"
+#include "Core/ECS/Components/TileComponent.h"
+#include "Core/ECS/Components/TransformComponent.h"
+#include "Core/ECS/Components/BoxColliderComponent.h"
+#include "Core/ECS/Components/SpriteComponent.h"
+#include "Core/ECS/Components/PhysicsComponent.h"
+#include "Core/CoreUtilities/CoreEngineData.h"
+
+#include <Logger/Logger.h>
+
+using namespace Scion::Core::ECS;
+using namespace Scion::Physics;
+
+namespace
+{
+/* How far a tile may be off the grid, in pixels, and still be merged with its neighbours. */
+constexpr float GRID_TOLERANCE = 0.01f;
+/* How close to the edge of a cell, in pixels, a position may be and still find the tile of the cell. */
+constexpr float CELL_EDGE_TOLERANCE = 0.5f;
+/* Boxes with cells past this are not looked up cell by cell, so the cells fit in an int. */
+constexpr double MAX_LOOKUP_CELL = 536870912.0;
+
+/* Finds a solid box of a tile at a point. Chains are left out, they have no inside. */
+class SolidTileQueryCallback : public b2QueryCallback
+{
+  public:
+	SolidTileQueryCallback( const entt::registry& registry, const b2Vec2& point )
+		: m_Registry{ registry }
+		, m_Point{ point }
+		, m_bHit{ false }
+	{
+	}
+
+	virtual bool ReportFixture( b2Fixture* pFixture ) override
+	{
+		if ( pFixture->IsSensor() || pFixture->GetBody()->GetType() != b2_staticBody ||
+			 pFixture->GetType() == b2Shape::e_chain || pFixture->GetType() == b2Shape::e_edge ||
+			 !pFixture->TestPoint( m_Point ) )
+		{
+			return true;
+		}
+
+		auto* pFixtureData = reinterpret_cast<FixtureData*>( pFixture->GetUserData().pointer );
+		if ( !pFixtureData )
+			return true;
+
+		const auto entity = static_cast<entt::entity>( pFixtureData->GetEntity() );
+		m_bHit = m_Registry.valid( entity ) && m_Registry.all_of<TileComponent>( entity );
+
+		// Stop at the first tile.
+		return !m_bHit;
+	}
+
+	inline bool Hit() const { return m_bHit; }
+
+  private:
+	const entt::registry& m_Registry;
+	b2Vec2 m_Point;
+	bool m_bHit;
+};
+
+std::uint64_t CellKey( int x, int y )
+{
+	return ( static_cast<std::uint64_t>( static_cast<std::uint32_t>( x ) ) << 32 ) |
+		   static_cast<std::uint32_t>( y );
+}
+
+/* The directions of the outline edges, each a quarter turn to the left of the one before. */
+constexpr std::array<glm::ivec2, 4> EDGE_STEPS{ glm::ivec2{ 1, 0 }, glm::ivec2{ 0, 1 }, glm::ivec2{ -1, 0 },
+												glm::ivec2{ 0, -1 } };
+
+struct OutlineLoop
+{
+	/* The corners of the loop in cell units, with the solid cells on the left of every edge. */
+	std::vector<glm::ivec2> corners{};
+	/* A cell on the inside of the first edge. */
+	glm::ivec2 cell{ 0 };
+};
+
+/*
+ * Traces the outlines of the solid cells into closed loops. Every side of a solid cell that faces
+ * an empty cell becomes an edge, directed so the solid cell is on its left. Where two cells only
+ * touch at a corner the trace turns left, so each loop stays around a single piece of the level.
+ * Straight runs of edges are joined, so a loop only has a vertex where the outline turns.
+ */
+void TraceOutlines( const std::unordered_map<std::uint64_t, entt::entity>& solid,
+					const std::vector<glm::ivec2>& cells, std::vector<OutlineLoop>& outLoops )
+{
+	auto isSolid = [ & ]( int x, int y ) { return solid.contains( CellKey( x, y ) ); };
+
+	// The directions of the edges leaving each vertex, one bit per direction.
+	std::unordered_map<std::uint64_t, std::uint8_t> outgoing;
+	outgoing.reserve( cells.size() * 2 );
+
+	auto addEdge = [ & ]( int x, int y, int direction ) { outgoing[ CellKey( x, y ) ] |= 1 << direction; };
+
+	for ( const auto& cell : cells )
+	{
+		if ( !isSolid( cell.x, cell.y - 1 ) )
+			addEdge( cell.x, cell.y, 0 );
+		if ( !isSolid( cell.x + 1, cell.y ) )
+			addEdge( cell.x + 1, cell.y, 1 );
+		if ( !isSolid( cell.x, cell.y + 1 ) )
+			addEdge( cell.x + 1, cell.y + 1, 2 );
+		if ( !isSolid( cell.x - 1, cell.y ) )
+			addEdge( cell.x, cell.y + 1, 3 );
+	}
+
+	// The solid cell on the left of an edge leaving the vertex in the direction.
+	auto insideCell = []( const glm::ivec2& vertex, int direction ) {
+		switch ( direction )
+		{
+		case 0: return vertex;
+		case 1: return vertex + glm::ivec2{ -1, 0 };
+		case 2: return vertex + glm::ivec2{ -1, -1 };
+		default: return vertex + glm::ivec2{ 0, -1 };
+		}
+	};
+
+	for ( const auto& cell : cells )
+	{
+		// Every loop passes the bottom of at least one of its cells, start from those.
+		const auto startKey = CellKey( cell.x, cell.y );
+		auto startItr = outgoing.find( startKey );
+		if ( startItr == outgoing.end() || ( startItr->second & 1 ) == 0 )
+			continue;
+
+		const glm::ivec2 start{ cell };
+		OutlineLoop loop{ .cell = insideCell( start, 0 ) };
+
+		glm::ivec2 vertex{ start };
+		int direction{ 0 };
+		startItr->second &= ~1;
+
+		while ( true )
+		{
+			vertex += EDGE_STEPS[ direction ];
+			auto& edges = outgoing[ CellKey( vertex.x, vertex.y ) ];
+
+			// Back at the start, unless the trace has to pass it again on the other side of a corner.
+			const bool bAtStart = vertex == start;
+			const std::uint8_t available = bAtStart ? static_cast<std::uint8_t>( edges | 1 ) : edges;
+
+			int next{ -1 };
+			for ( const int turn : { 1, 0, 3 } )
+			{
+				const int candidate = ( direction + turn ) % 4;
+				if ( available & ( 1 << candidate ) )
+				{
+					next = candidate;
+					break;
+				}
+			}
+
+			if ( next < 0 || ( bAtStart && next == 0 ) )
+			{
+				if ( direction != 0 )
+					loop.corners.push_back( start );
+				break;
+			}
+
+			edges &= ~( 1 << next );
+			if ( next != direction )
+				loop.corners.push_back( vertex );
+
+			direction = next;
+		}
+
+		if ( loop.corners.size() >= 4 )
+			outLoops.push_back( std::move( loop ) );
+	}
+}
+
+void OnTilePhysicsChanged( entt::registry& registry, entt::entity entity )
+{
+	if ( !registry.all_of<TileComponent, PhysicsComponent>( entity ) )
+		return;
+
+	if ( auto* pTileColliders = registry.ctx().find<std::shared_ptr<Scion::Core::Systems::TileColliderSystem>>() )
+	{
+		( *pTileColliders )->MarkTileDirty( entity );
+	}
+}
+
+} // namespace
+
+namespace Scion::Core::Systems
+{
+
+TileMergeStats TileColliderSystem::MergeTileColliders( Scion::Core::ECS::Registry& registry,
+													   Scion::Physics::PhysicsWorld pPhysicsWorld, int windowWidth,
+													   int windowHeight )
+{
+	if ( !pPhysicsWorld )
+	{
+		SCION_ERROR( "Failed to merge tile colliders - Physics world is nullptr!" );
+		return {};
+	}
+
+	m_pPhysicsWorld = std::move( pPhysicsWorld );
+	m_WindowWidth = windowWidth;
+	m_WindowHeight = windowHeight;
+
+	m_Groups.clear();
+	m_TileKeys.clear();
+	m_DirtyTiles.clear();
+	m_DirtyGroups.clear();
+
+	auto& enttRegistry = registry.GetRegistry();
+
+	// Tiles get their components one at a time, so listen for both of them.
+	enttRegistry.on_construct<PhysicsComponent>().connect<&OnTilePhysicsChanged>();
+	enttRegistry.on_destroy<PhysicsComponent>().connect<&OnTilePhysicsChanged>();
+	enttRegistry.on_construct<TileComponent>().connect<&OnTilePhysicsChanged>();
+	enttRegistry.on_destroy<TileComponent>().connect<&OnTilePhysicsChanged>();
+
+	// Moving, resizing or changing the attributes of a tile can change its group.
+	enttRegistry.on_update<PhysicsComponent>().connect<&OnTilePhysicsChanged>();
+	enttRegistry.on_update<TileComponent>().connect<&OnTilePhysicsChanged>();
+	enttRegistry.on_update<TransformComponent>().connect<&OnTilePhysicsChanged>();
+	enttRegistry.on_update<BoxColliderComponent>().connect<&OnTilePhysicsChanged>();
+
+	auto tiles = enttRegistry.view<TileComponent, PhysicsComponent>();
+	for ( auto tile : tiles )
+	{
+		AddTile( enttRegistry, tile );
+	}
+
+	for ( const auto& key : m_DirtyGroups )
+	{
+		RebuildGroup( enttRegistry, key, m_Groups[ key ] );
+	}
+
+	m_DirtyGroups.clear();
+	UpdateStats();
+
+	SCION_LOG( "Merged [{}] tile colliders. Bodies: [{}] -> [{}], Fixtures: [{}] -> [{}]",
+			   m_Stats.numTiles,
+			   m_Stats.bodiesBefore,
+			   m_Stats.bodiesAfter,
+			   m_Stats.fixturesBefore,
+			   m_Stats.fixturesAfter );
+
+	return m_Stats;
+}
+
+void TileColliderSystem::Update( Scion::Core::ECS::Registry& registry )
+{
+	if ( m_DirtyTiles.empty() || !m_pPhysicsWorld )
+		return;
+
+	auto& enttRegistry = registry.GetRegistry();
+
+	for ( auto tile : m_DirtyTiles )
+	{
+		bool bWasMerged{ false };
+		if ( auto keyItr = m_TileKeys.find( tile ); keyItr != m_TileKeys.end() )
+		{
+			m_DirtyGroups.insert( keyItr->second );
+			if ( auto groupItr = m_Groups.find( keyItr->second ); groupItr != m_Groups.end() )
+			{
+				std::erase( groupItr->second.tiles, tile );
+
+				// Let go of the old merged body, otherwise it outlives the rebuild of its group.
+				if ( auto* pPhysics = enttRegistry.try_get<PhysicsComponent>( tile );
+					 pPhysics && groupItr->second.pBody && pPhysics->GetBody() == groupItr->second.pBody.get() )
+				{
+					pPhysics->SetSharedBody( nullptr, nullptr );
+				}
+			}
+
+			m_TileKeys.erase( keyItr );
+			bWasMerged = true;
+		}
+
+		AddTile( enttRegistry, tile );
+
+		// A tile that can no longer be merged, such as one that opted out, needs a body of its own.
+		if ( bWasMerged && !m_TileKeys.contains( tile ) && enttRegistry.valid( tile ) )
+		{
+			if ( auto* pPhysics = enttRegistry.try_get<PhysicsComponent>( tile ); pPhysics && !pPhysics->GetBody() )
+			{
+				pPhysics->Init( m_pPhysicsWorld, m_WindowWidth, m_WindowHeight );
+				if ( auto* pUserData = pPhysics->GetUserData(); pUserData && pUserData->entityID == entt::null )
+					pUserData->entityID = static_cast<std::uint32_t>( tile );
+			}
+		}
+	}
+
+	m_DirtyTiles.clear();
+
+	for ( const auto& key : m_DirtyGroups )
+	{
+		auto groupItr = m_Groups.find( key );
+		if ( groupItr == m_Groups.end() )
+			continue;
+
+		RebuildGroup( enttRegistry, key, groupItr->second );
+
+		if ( groupItr->second.tiles.empty() )
+			m_Groups.erase( groupItr );
+	}
+
+	m_DirtyGroups.clear();
+	UpdateStats();
+}
+
+void TileColliderSystem::MarkTileDirty( entt::entity tile )
+{
+	m_DirtyTiles.push_back( tile );
+}
+
+entt::entity TileColliderSystem::GetTileAt( entt::entity tile, const glm::vec2& position ) const
+{
+	auto keyItr = m_TileKeys.find( tile );
+	if ( keyItr == m_TileKeys.end() )
+		return tile;
+
+	const auto& key = keyItr->second;
+	auto groupItr = m_Groups.find( key );
+	if ( groupItr == m_Groups.end() || groupItr->second.looseTiles.contains( tile ) )
+		return tile;
+
+	// Contacts and hits lie on the outline, so look at the cells on both sides of it.
+	const auto& cellTiles = groupItr->second.cellTiles;
+	for ( const float offsetX : { 0.f, -CELL_EDGE_TOLERANCE, CELL_EDGE_TOLERANCE } )
+	{
+		for ( const float offsetY : { 0.f, -CELL_EDGE_TOLERANCE, CELL_EDGE_TOLERANCE } )
+		{
+			const int cellX = static_cast<int>( std::floor( ( position.x + offsetX ) / key.tileWidth ) );
+			const int cellY = static_cast<int>( std::floor( ( position.y + offsetY ) / key.tileHeight ) );
+
+			if ( auto cellItr = cellTiles.find( CellKey( cellX, cellY ) ); cellItr != cellTiles.end() )
+				return cellItr->second;
+		}
+	}
+
+	return tile;
+}
+
+bool TileColliderSystem::IsSolidAt( Scion::Core::ECS::Registry& registry, const glm::vec2& position ) const
+{
+	for ( const auto& [ key, group ] : m_Groups )
+	{
+		const int cellX = static_cast<int>( std::floor( position.x / key.tileWidth ) );
+		const int cellY = static_cast<int>( std::floor( position.y / key.tileHeight ) );
+
+		if ( group.cellTiles.contains( CellKey( cellX, cellY ) ) )
+			return true;
+	}
+
+	auto* pPhysicsWorld = registry.TryGetContext<PhysicsWorld>();
+	if ( !pPhysicsWorld || !*pPhysicsWorld )
+		return false;
+
+	// Place the point the same way PhysicsComponent::Init places a body.
+	auto& coreGlobals = CORE_GLOBALS();
+	const float P2M = coreGlobals.PixelsToMeters();
+	const b2Vec2 point{ position.x * P2M - coreGlobals.ScaledWidth() * 0.5f,
+						position.y * P2M - coreGlobals.ScaledHeight() * 0.5f };
+
+	b2AABB aabb{};
+	aabb.lowerBound = point;
+	aabb.upperBound = point;
+
+	SolidTileQueryCallback callback{ registry.GetRegistry(), point };
+	( *pPhysicsWorld )->QueryAABB( &callback, aabb );
+
+	return callback.Hit();
+}
+
+void TileColliderSystem::GetTilesIn( entt::entity tile, const glm::vec2& min, const glm::vec2& max,
+									 std::vector<std::uint32_t>& outTiles ) const
+{
+	auto keyItr = m_TileKeys.find( tile );
+	auto groupItr = keyItr != m_TileKeys.end() ? m_Groups.find( keyItr->second ) : m_Groups.end();
+
+	// Tiles that are off the grid have a box of their own.
+	if ( groupItr == m_Groups.end() || groupItr->second.looseTiles.contains( tile ) )
+	{
+		outTiles.push_back( static_cast<std::uint32_t>( tile ) );
+		return;
+	}
+
+	const auto& key = keyItr->second;
+	const auto& cellTiles = groupItr->second.cellTiles;
+
+	const double minCellX = std::floor( min.x / key.tileWidth );
+	const double minCellY = std::floor( min.y / key.tileHeight );
+	const double maxCellX = std::floor( max.x / key.tileWidth );
+	const double maxCellY = std::floor( max.y / key.tileHeight );
+	const double numCells = ( maxCellX - minCellX + 1.0 ) * ( maxCellY - minCellY + 1.0 );
+
+	// Look the cells of small boxes up, and walk the tiles of the group for large ones.
+	if ( numCells <= static_cast<double>( cellTiles.size() ) && std::abs( minCellX ) < MAX_LOOKUP_CELL &&
+		 std::abs( minCellY ) < MAX_LOOKUP_CELL && std::abs( maxCellX ) < MAX_LOOKUP_CELL &&
+		 std::abs( maxCellY ) < MAX_LOOKUP_CELL )
+	{
+		for ( int y = static_cast<int>( minCellY ); y <= static_cast<int>( maxCellY ); ++y )
+		{
+			for ( int x = static_cast<int>( minCellX ); x <= static_cast<int>( maxCellX ); ++x )
+			{
+				if ( auto cellItr = cellTiles.find( CellKey( x, y ) ); cellItr != cellTiles.end() )
+					outTiles.push_back( static_cast<std::uint32_t>( cellItr->second ) );
+			}
+		}
+
+		return;
+	}
+
+	for ( const auto& [ cellKey, cellTile ] : cellTiles )
+	{
+		const float cellX = static_cast<float>( static_cast<std::int32_t>( cellKey >> 32 ) ) * key.tileWidth;
+		const float cellY = static_cast<float>( static_cast<std::int32_t>( cellKey ) ) * key.tileHeight;
+
+		if ( cellX <= max.x && cellX + key.tileWidth >= min.x && cellY <= max.y && cellY + key.tileHeight >= min.y )
+			outTiles.push_back( static_cast<std::uint32_t>( cellTile ) );
+	}
+}
+
+std::optional<TileColliderSystem::MergeKey> TileColliderSystem::GetMergeKey( entt::registry& registry,
+																			  entt::entity tile ) const
+{
+	if ( !registry.valid( tile ) ||
+		 !registry.all_of<TileComponent, PhysicsComponent, BoxColliderComponent, TransformComponent>( tile ) )
+	{
+		return std::nullopt;
+	}
+
+	const auto& attributes = registry.get<PhysicsComponent>( tile ).GetAttributes();
+
+	// Only solid, static boxes that allow it can be merged.
+	if ( !attributes.bMergeTileCollider || attributes.eType != RigidBodyType::STATIC || !attributes.bBoxShape ||
+		 attributes.bCircle || attributes.bIsSensor )
+	{
+		return std::nullopt;
+	}
+
+	const auto& transform = registry.get<TransformComponent>( tile );
+	const auto& boxCollider = registry.get<BoxColliderComponent>( tile );
+
+	const float tileWidth = boxCollider.width * transform.scale.x;
+	const float tileHeight = boxCollider.height * transform.scale.y;
+
+	if ( tileWidth <= 0.f || tileHeight <= 0.f )
+		return std::nullopt;
+
+	const auto optUserData = attributes.objectData.ToUserData();
+	if ( !optUserData )
+		return std::nullopt;
+
+	const auto& userData = *optUserData;
+
+	MergeKey key{ .tileWidth = tileWidth,
+				  .tileHeight = tileHeight,
+				  .density = attributes.density,
+				  .friction = attributes.friction,
+				  .restitution = attributes.restitution,
+				  .restitutionThreshold = attributes.restitutionThreshold,
+				  .tagID = userData.tagID,
+				  .groupMask = userData.groupMask,
+				  .flags = userData.flags,
+				  .bUseFilters = attributes.bUseFilters };
+
+	if ( auto* pSprite = registry.try_get<SpriteComponent>( tile ) )
+		key.layer = pSprite->layer;
+
+	if ( attributes.bUseFilters )
+	{
+		key.filterCategory = attributes.filterCategory;
+		key.filterMask = attributes.filterMask;
+		key.groupIndex = attributes.groupIndex;
+	}
+
+	return key;
+}
+
+void TileColliderSystem::AddTile( entt::registry& registry, entt::entity tile )
+{
+	auto optKey = GetMergeKey( registry, tile );
+	if ( !optKey )
+		return;
+
+	// The tile may have been marked more than once.
+	if ( m_TileKeys.contains( tile ) )
+		return;
+
+	m_Groups[ *optKey ].tiles.push_back( tile );
+	m_TileKeys.emplace( tile, *optKey );
+	m_DirtyGroups.insert( *optKey );
+}
+
+void TileColliderSystem::RebuildGroup( entt::registry& registry, const MergeKey& key, MergeGroup& group )
+{
+	// Tiles that were changed since they were added are no longer part of this group.
+	std::erase_if( group.tiles, [ & ]( entt::entity tile ) {
+		auto optKey = GetMergeKey( registry, tile );
+		if ( optKey && *optKey == key )
+			return false;
+
+		m_TileKeys.erase( tile );
+
+		// Let go of the merged body, otherwise the old colliders outlive the rebuild.
+		if ( auto* pPhysics = registry.try_get<PhysicsComponent>( tile );
+			 pPhysics && group.pBody && pPhysics->GetBody() == group.pBody.get() )
+		{
+			pPhysics->SetSharedBody( nullptr, nullptr );
+		}
+
+		return true;
+	} );
+
+	group.pBody.reset();
+	group.cellTiles.clear();
+	group.looseTiles.clear();
+	group.numFixtures = 0;
+
+	if ( group.tiles.empty() )
+		return;
+
+	std::vector<glm::ivec2> cells;
+	cells.reserve( group.tiles.size() );
+
+	// Tiles that do not line up with the grid keep a box of their own.
+	std::vector<std::pair<glm::vec2, entt::entity>> looseBoxes;
+
+	for ( auto tile : group.tiles )
+	{
+		const auto& transform = registry.get<TransformComponent>( tile );
+		const auto& boxCollider = registry.get<BoxColliderComponent>( tile );
+		const glm::vec2 min = transform.position + boxCollider.offset;
+
+		const int cellX = static_cast<int>( std::lround( min.x / key.tileWidth ) );
+		const int cellY = static_cast<int>( std::lround( min.y / key.tileHeight ) );
+
+		if ( std::abs( cellX * key.tileWidth - min.x ) > GRID_TOLERANCE ||
+			 std::abs( cellY * key.tileHeight - min.y ) > GRID_TOLERANCE )
+		{
+			looseBoxes.emplace_back( min, tile );
+			group.looseTiles.insert( tile );
+			continue;
+		}
+
+		// Two tiles in the same cell only need one outline.
+		if ( group.cellTiles.emplace( CellKey( cellX, cellY ), tile ).second )
+			cells.emplace_back( cellX, cellY );
+	}
+
+	std::vector<OutlineLoop> loops;
+	TraceOutlines( group.cellTiles, cells, loops );
+
+	// Every tile of the group has the same tag, group and flags. The fixtures report which tile they are.
+	const auto firstTile = group.tiles.front();
+	auto userData = *registry.get<PhysicsComponent>( firstTile ).GetAttributes().objectData.ToUserData();
+	userData.entityID = static_cast<std::uint32_t>( firstTile );
+
+	auto* pUserData = UserDataPool::Acquire( userData );
+
+	b2BodyDef bodyDef{};
+	bodyDef.type = b2_staticBody;
+	bodyDef.userData.pointer = reinterpret_cast<uintptr_t>( pUserData );
+
+	auto* pBody = m_pPhysicsWorld->CreateBody( &bodyDef );
+	if ( !pBody )
+	{
+		SCION_ERROR( "Failed to create the merged tile collider body!" );
+		UserDataPool::Release( pUserData );
+		return;
+	}
+
+	group.pBody = MakeSharedBody( pBody );
+
+	const float P2M = CoreEngineData::GetInstance().PixelsToMeters();
+
+	auto createFixture = [ & ]( const b2Shape& shape, entt::entity tile ) {
+		b2FixtureDef fixtureDef{};
+		fixtureDef.shape = &shape;
+		fixtureDef.density = key.density;
+		fixtureDef.friction = key.friction;
+		fixtureDef.restitution = key.restitution;
+		fixtureDef.restitutionThreshold = key.restitutionThreshold;
+
+		if ( key.bUseFilters )
+		{
+			fixtureDef.filter.categoryBits = key.filterCategory;
+			fixtureDef.filter.maskBits = key.filterMask;
+			fixtureDef.filter.groupIndex = key.groupIndex;
+		}
+
+		auto* pFixtureData =
+			FixtureDataPool::Acquire( FixtureData{ .pUserData = pUserData,
+												   .entityID = static_cast<std::uint32_t>( tile ),
+												   .fixtureIndex = static_cast<std::uint16_t>( group.numFixtures ) } );
+		fixtureDef.userData.pointer = reinterpret_cast<uintptr_t>( pFixtureData );
+
+		if ( group.pBody->CreateFixture( &fixtureDef ) )
+			++group.numFixtures;
+		else
+			FixtureDataPool::Release( pFixtureData );
+	};
+
+	// Place the outlines and boxes the same way PhysicsComponent::Init places a body.
+	auto toWorld = [ & ]( float x, float y ) {
+		return b2Vec2{ ( x - m_WindowWidth * 0.5f ) * P2M, ( y - m_WindowHeight * 0.5f ) * P2M };
+	};
+
+	std::vector<b2Vec2> vertices;
+	for ( const auto& loop : loops )
+	{
+		vertices.clear();
+		for ( const auto& corner : loop.corners )
+		{
+			vertices.push_back( toWorld( corner.x * key.tileWidth, corner.y * key.tileHeight ) );
+		}
+
+		// The loop reports the tile of its first edge, GetTileAt finds the others.
+		b2ChainShape chainShape;
+		chainShape.CreateLoop( vertices.data(), static_cast<int32>( vertices.size() ) );
+		createFixture( chainShape, group.cellTiles.at( CellKey( loop.cell.x, loop.cell.y ) ) );
+	}
+
+	for ( const auto& [ min, tile ] : looseBoxes )
+	{
+		b2PolygonShape polyShape;
+		polyShape.SetAsBox( key.tileWidth * 0.5f * P2M,
+							key.tileHeight * 0.5f * P2M,
+							toWorld( min.x + key.tileWidth * 0.5f, min.y + key.tileHeight * 0.5f ),
+							0.f );
+		createFixture( polyShape, tile );
+	}
+
+	for ( auto tile : group.tiles )
+	{
+		registry.get<PhysicsComponent>( tile ).SetSharedBody( group.pBody, pUserData );
+	}
+}
+
+void TileColliderSystem::UpdateStats()
+{
+	m_Stats = TileMergeStats{ .numTiles = m_TileKeys.size() };
+	m_Stats.bodiesBefore = m_Stats.numTiles;
+	m_Stats.fixturesBefore = m_Stats.numTiles;
+
+	for ( const auto& [ key, group ] : m_Groups )
+	{
+		if ( !group.pBody )
+			continue;
+
+		++m_Stats.bodiesAfter;
+		m_Stats.fixturesAfter += group.numFixtures;
+	}
+}
+
+} // namespace Scion::Core::Systems
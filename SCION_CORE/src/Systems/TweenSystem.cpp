@@ -0,0 +1,543 @@
+#include "Core/Systems/TweenSystem.h"
+#include "Core/ECS/Registry.h"
+#include "Core/ECS/Entity.h"
+#include "Core/ECS/EntityHandle.h"
+#include "Core/ECS/Components/TransformComponent.h"
+#include "Core/ECS/Components/SpriteComponent.h"
+#include "Core/ECS/Components/TextComponent.h"
+#include "Core/ECS/Components/TweenComponent.h"
+#include "Core/Events/EventDispatcher.h"
+#include "Core/Events/EngineEventTypes.h"
+#include "Core/Profiling/ProfileCollector.h"
+
+#include <Rendering/Core/Camera2D.h>
+#include <Logger/Logger.h>
+
+using namespace Scion::Core::ECS;
+using namespace Scion::Core::Events;
+using namespace Scion::Utilities;
+
+namespace
+{
+bool IsCameraProperty( Scion::Core::Systems::ETweenProperty eProperty )
+{
+	return eProperty >= Scion::Core::Systems::ETweenProperty::CameraX;
+}
+
+GLubyte ToColorChannel( float value )
+{
+	return static_cast<GLubyte>( std::clamp( value, 0.f, 255.f ) );
+}
+
+Scion::Rendering::Camera2D* GetCamera( Registry& registry )
+{
+	auto* pCamera = registry.TryGetContext<std::shared_ptr<Scion::Rendering::Camera2D>>();
+	return pCamera ? pCamera->get() : nullptr;
+}
+
+entt::entity ToEntity( const sol::object& entity )
+{
+	if ( entity.is<Entity>() )
+		return entity.as<Entity&>().GetEntity();
+
+	if ( entity.is<EntityHandle>() )
+		return entity.as<const EntityHandle&>().GetEntity();
+
+	if ( entity.get_type() == sol::type::number )
+		return static_cast<entt::entity>( entity.as<std::uint32_t>() );
+
+	return entt::null;
+}
+
+Scion::Core::Systems::TweenParams ToTweenParams( const sol::table& params )
+{
+	using namespace Scion::Core::Systems;
+
+	const sol::optional<float> from = params[ "from" ];
+
+	return TweenParams{ .eProperty = params[ "property" ].get_or( ETweenProperty::PositionX ),
+						.to = params[ "to" ].get_or( 0.f ),
+						.from = from ? std::optional<float>{ *from } : std::nullopt,
+						.duration = params[ "duration" ].get_or( 1.f ),
+						.delay = params[ "delay" ].get_or( 0.f ),
+						.eEasing = params[ "easing" ].get_or( EEasingFunc::LINEAR ),
+						.repeats = params[ "repeats" ].get_or( 0 ),
+						.bYoyo = params[ "yoyo" ].get_or( false ) };
+}
+
+} // namespace
+
+namespace Scion::Core::Systems
+{
+
+std::uint32_t TweenSystem::Start( Scion::Core::ECS::Registry& registry, entt::entity entity, const TweenParams& params )
+{
+	return StartSequence( registry, entity, { params } );
+}
+
+std::uint32_t TweenSystem::StartSequence( Scion::Core::ECS::Registry& registry, entt::entity entity,
+										  const std::vector<TweenParams>& steps )
+{
+	if ( steps.empty() )
+		return 0;
+
+	for ( const auto& step : steps )
+	{
+		if ( !CanAnimate( registry, entity, step.eProperty ) )
+		{
+			SCION_ERROR( "Failed to start tween - Entity [{}] does not have the component of the property.",
+						 static_cast<std::uint32_t>( entity ) );
+			return 0;
+		}
+	}
+
+	const std::uint32_t sequenceID = m_NextTweenID;
+	m_Tracks.push_back( CreateTrack( entity, steps.front(), sequenceID ) );
+
+	if ( steps.size() > 1 )
+	{
+		auto& waitingSteps = m_Sequences[ sequenceID ];
+		waitingSteps.reserve( steps.size() - 1 );
+
+		// The next step is kept last, so it can be popped when the running step finishes.
+		for ( auto itr = steps.rbegin(); itr != steps.rend() - 1; ++itr )
+		{
+			waitingSteps.push_back( CreateTrack( entity, *itr, sequenceID ) );
+		}
+
+		// Step ids are handed out in play order.
+		std::uint32_t stepID = sequenceID + 1;
+		for ( auto itr = waitingSteps.rbegin(); itr != waitingSteps.rend(); ++itr )
+		{
+			itr->id = stepID++;
+		}
+	}
+
+	ChangeTweenCount( registry, entity, static_cast<int>( steps.size() ) );
+	return sequenceID;
+}
+
+void TweenSystem::Stop( Scion::Core::ECS::Registry& registry, std::uint32_t tweenID, bool bComplete )
+{
+	for ( size_t i = m_Tracks.size(); i > 0; --i )
+	{
+		auto& track = m_Tracks[ i - 1 ];
+		if ( track.id != tweenID && track.sequenceID != tweenID )
+			continue;
+
+		if ( bComplete && !track.bRemoved && CanAnimate( registry, track.entity, track.eProperty ) )
+		{
+			WriteProperty( registry, track.entity, track.eProperty, track.to );
+		}
+
+		ClearSequence( registry, track.sequenceID );
+		RemoveTrack( registry, i - 1 );
+	}
+
+	// The id can be a step that has not started yet.
+	for ( const auto& [ sequenceID, waitingSteps ] : m_Sequences )
+	{
+		if ( std::ranges::any_of( waitingSteps, [ tweenID ]( const auto& step ) { return step.id == tweenID; } ) )
+		{
+			Stop( registry, sequenceID, false );
+			return;
+		}
+	}
+}
+
+void TweenSystem::StopAll( Scion::Core::ECS::Registry& registry, entt::entity entity )
+{
+	for ( size_t i = m_Tracks.size(); i > 0; --i )
+	{
+		if ( m_Tracks[ i - 1 ].entity != entity )
+			continue;
+
+		ClearSequence( registry, m_Tracks[ i - 1 ].sequenceID );
+		RemoveTrack( registry, i - 1 );
+	}
+}
+
+bool TweenSystem::IsPlaying( std::uint32_t tweenID ) const
+{
+	if ( std::ranges::any_of( m_Tracks, [ tweenID ]( const auto& track ) {
+			 return track.id == tweenID || track.sequenceID == tweenID;
+		 } ) )
+	{
+		return true;
+	}
+
+	return std::ranges::any_of( m_Sequences, [ tweenID ]( const auto& sequence ) {
+		return std::ranges::any_of( sequence.second, [ tweenID ]( const auto& step ) { return step.id == tweenID; } );
+	} );
+}
+
+size_t TweenSystem::NumTweens() const
+{
+	size_t numTweens{ m_Tracks.size() };
+	for ( const auto& [ sequenceID, waitingSteps ] : m_Sequences )
+	{
+		numTweens += waitingSteps.size();
+	}
+
+	return numTweens;
+}
+
+void TweenSystem::Update( Scion::Core::ECS::Registry& registry, double deltaTime )
+{
+	if ( m_Tracks.empty() )
+		return;
+
+	SCION_SYSTEM_ZONE( "TweenSystem" );
+
+	auto& enttRegistry = registry.GetRegistry();
+	auto& tweenComponents = enttRegistry.storage<TweenComponent>();
+
+	m_Values.resize( m_Tracks.size() );
+	m_Finished.clear();
+
+	// Advance and ease every tween before anything is written.
+	for ( size_t i = 0; i < m_Tracks.size(); ++i )
+	{
+		auto& track = m_Tracks[ i ];
+		float dt = static_cast<float>( deltaTime );
+
+		// The entity or its component can be gone since the last update.
+		if ( !CanAnimate( registry, track.entity, track.eProperty ) )
+		{
+			track.bRemoved = true;
+			m_Finished.push_back( i );
+			continue;
+		}
+
+		if ( track.entity != entt::null && tweenComponents.contains( track.entity ) )
+		{
+			const auto& tweenComponent = tweenComponents.get( track.entity );
+			dt = tweenComponent.bPaused ? 0.f : dt * tweenComponent.timeScale;
+		}
+
+		if ( track.delay > 0.f )
+		{
+			track.delay -= dt;
+			if ( track.delay > 0.f )
+				continue;
+
+			// The time past the delay is used by the tween.
+			dt = -track.delay;
+			track.delay = 0.f;
+		}
+
+		if ( !track.bStarted )
+		{
+			if ( track.bFromCurrent )
+				track.from = ReadProperty( registry, track.entity, track.eProperty );
+
+			track.bStarted = true;
+		}
+
+		track.elapsed += dt;
+
+		bool bFinished{ track.duration <= 0.f };
+		while ( !bFinished && track.elapsed >= track.duration )
+		{
+			if ( track.repeats == 0 )
+			{
+				bFinished = true;
+				break;
+			}
+
+			if ( track.repeats > 0 )
+				--track.repeats;
+
+			track.elapsed -= track.duration;
+			if ( track.bYoyo )
+				track.bReversed = !track.bReversed;
+		}
+
+		const float progress = bFinished ? 1.f : track.elapsed / track.duration;
+		const float eased = Ease( track.eEasing, track.bReversed ? 1.f - progress : progress );
+		m_Values[ i ] = track.from + ( track.to - track.from ) * eased;
+
+		if ( bFinished )
+			m_Finished.push_back( i );
+	}
+
+	for ( size_t i = 0; i < m_Tracks.size(); ++i )
+	{
+		const auto& track = m_Tracks[ i ];
+		if ( track.bStarted && !track.bRemoved )
+			WriteProperty( registry, track.entity, track.eProperty, m_Values[ i ] );
+	}
+
+	if ( m_Finished.empty() )
+		return;
+
+	std::vector<TweenEvent> events;
+	events.reserve( m_Finished.size() );
+
+	// Highest index first, so removing a tween does not move the ones still to be removed.
+	for ( auto itr = m_Finished.rbegin(); itr != m_Finished.rend(); ++itr )
+	{
+		const TweenTrack finished = m_Tracks[ *itr ];
+		RemoveTrack( registry, *itr );
+
+		if ( finished.bRemoved )
+		{
+			ClearSequence( registry, finished.sequenceID );
+			continue;
+		}
+
+		bool bSequenceFinished{ true };
+		if ( auto sequenceItr = m_Sequences.find( finished.sequenceID ); sequenceItr != m_Sequences.end() )
+		{
+			// The next step was counted for the entity when the sequence started.
+			m_Tracks.push_back( sequenceItr->second.back() );
+			sequenceItr->second.pop_back();
+			bSequenceFinished = false;
+
+			if ( sequenceItr->second.empty() )
+				m_Sequences.erase( sequenceItr );
+		}
+
+		events.push_back( TweenEvent{ .entity = finished.entity,
+									  .tweenID = finished.id,
+									  .sequenceID = finished.sequenceID,
+									  .bSequenceFinished = bSequenceFinished } );
+	}
+
+	auto* pDispatcher = registry.TryGetContext<std::shared_ptr<EventDispatcher>>();
+	if ( !pDispatcher || !*pDispatcher || !( *pDispatcher )->HasHandlers<TweenEvent>() )
+		return;
+
+	// Handlers may start and stop tweens, the tweens are in order again by now.
+	for ( auto& event : events )
+	{
+		( *pDispatcher )->EmitEvent( event );
+	}
+}
+
+TweenSystem::TweenTrack TweenSystem::CreateTrack( entt::entity entity, const TweenParams& params,
+												  std::uint32_t sequenceID )
+{
+	return TweenTrack{ .id = m_NextTweenID++,
+					   .sequenceID = sequenceID,
+					   .entity = IsCameraProperty( params.eProperty ) ? entt::entity{ entt::null } : entity,
+					   .eProperty = params.eProperty,
+					   .eEasing = params.eEasing,
+					   .from = params.from.value_or( 0.f ),
+					   .to = params.to,
+					   .duration = params.duration,
+					   .delay = params.delay,
+					   .repeats = params.repeats,
+					   .bYoyo = params.bYoyo,
+					   .bFromCurrent = !params.from.has_value() };
+}
+
+bool TweenSystem::CanAnimate( Scion::Core::ECS::Registry& registry, entt::entity entity, ETweenProperty eProperty ) const
+{
+	if ( IsCameraProperty( eProperty ) )
+		return GetCamera( registry ) != nullptr;
+
+	auto& enttRegistry = registry.GetRegistry();
+	if ( !enttRegistry.valid( entity ) )
+		return false;
+
+	switch ( eProperty )
+	{
+	case ETweenProperty::PositionX:
+	case ETweenProperty::PositionY:
+	case ETweenProperty::ScaleX:
+	case ETweenProperty::ScaleY:
+	case ETweenProperty::Rotation: return enttRegistry.all_of<TransformComponent>( entity );
+	case ETweenProperty::SpriteRed:
+	case ETweenProperty::SpriteGreen:
+	case ETweenProperty::SpriteBlue:
+	case ETweenProperty::SpriteAlpha:
+	case ETweenProperty::SpriteU:
+	case ETweenProperty::SpriteV: return enttRegistry.all_of<SpriteComponent>( entity );
+	case ETweenProperty::TextRed:
+	case ETweenProperty::TextGreen:
+	case ETweenProperty::TextBlue:
+	case ETweenProperty::TextAlpha: return enttRegistry.all_of<TextComponent>( entity );
+	default: return false;
+	}
+}
+
+void TweenSystem::ChangeTweenCount( Scion::Core::ECS::Registry& registry, entt::entity entity, int amount )
+{
+	auto& enttRegistry = registry.GetRegistry();
+	if ( entity == entt::null || !enttRegistry.valid( entity ) )
+		return;
+
+	enttRegistry.get_or_emplace<TweenComponent>( entity ).numTweens += amount;
+}
+
+void TweenSystem::ClearSequence( Scion::Core::ECS::Registry& registry, std::uint32_t sequenceID )
+{
+	auto itr = m_Sequences.find( sequenceID );
+	if ( itr == m_Sequences.end() )
+		return;
+
+	for ( const auto& step : itr->second )
+	{
+		ChangeTweenCount( registry, step.entity, -1 );
+	}
+
+	m_Sequences.erase( itr );
+}
+
+void TweenSystem::RemoveTrack( Scion::Core::ECS::Registry& registry, size_t index )
+{
+	ChangeTweenCount( registry, m_Tracks[ index ].entity, -1 );
+
+	m_Tracks[ index ] = m_Tracks.back();
+	m_Tracks.pop_back();
+}
+
+float TweenSystem::ReadProperty( Scion::Core::ECS::Registry& registry, entt::entity entity, ETweenProperty eProperty )
+{
+	if ( IsCameraProperty( eProperty ) )
+	{
+		auto* pCamera = GetCamera( registry );
+		if ( !pCamera )
+			return 0.f;
+
+		switch ( eProperty )
+		{
+		case ETweenProperty::CameraX: return pCamera->GetPosition().x;
+		case ETweenProperty::CameraY: return pCamera->GetPosition().y;
+		default: return pCamera->GetScale();
+		}
+	}
+
+	auto& enttRegistry = registry.GetRegistry();
+	switch ( eProperty )
+	{
+	case ETweenProperty::PositionX: return enttRegistry.get<TransformComponent>( entity ).position.x;
+	case ETweenProperty::PositionY: return enttRegistry.get<TransformComponent>( entity ).position.y;
+	case ETweenProperty::ScaleX: return enttRegistry.get<TransformComponent>( entity ).scale.x;
+	case ETweenProperty::ScaleY: return enttRegistry.get<TransformComponent>( entity ).scale.y;
+	case ETweenProperty::Rotation: return enttRegistry.get<TransformComponent>( entity ).rotation;
+	case ETweenProperty::SpriteRed: return enttRegistry.get<SpriteComponent>( entity ).color.r;
+	case ETweenProperty::SpriteGreen: return enttRegistry.get<SpriteComponent>( entity ).color.g;
+	case ETweenProperty::SpriteBlue: return enttRegistry.get<SpriteComponent>( entity ).color.b;
+	case ETweenProperty::SpriteAlpha: return enttRegistry.get<SpriteComponent>( entity ).color.a;
+	case ETweenProperty::SpriteU: return enttRegistry.get<SpriteComponent>( entity ).uvs.u;
+	case ETweenProperty::SpriteV: return enttRegistry.get<SpriteComponent>( entity ).uvs.v;
+	case ETweenProperty::TextRed: return enttRegistry.get<TextComponent>( entity ).color.r;
+	case ETweenProperty::TextGreen: return enttRegistry.get<TextComponent>( entity ).color.g;
+	case ETweenProperty::TextBlue: return enttRegistry.get<TextComponent>( entity ).color.b;
+	case ETweenProperty::TextAlpha: return enttRegistry.get<TextComponent>( entity ).color.a;
+	default: return 0.f;
+	}
+}
+
+void TweenSystem::WriteProperty( Scion::Core::ECS::Registry& registry, entt::entity entity, ETweenProperty eProperty,
+								 float value )
+{
+	if ( IsCameraProperty( eProperty ) )
+	{
+		auto* pCamera = GetCamera( registry );
+		if ( !pCamera )
+			return;
+
+		const glm::vec2 position = pCamera->GetPosition();
+		switch ( eProperty )
+		{
+		case ETweenProperty::CameraX: pCamera->SetPosition( glm::vec2{ value, position.y } ); break;
+		case ETweenProperty::CameraY: pCamera->SetPosition( glm::vec2{ position.x, value } ); break;
+		default: pCamera->SetScale( value ); break;
+		}
+
+		return;
+	}
+
+	auto& enttRegistry = registry.GetRegistry();
+	switch ( eProperty )
+	{
+	case ETweenProperty::PositionX:
+	case ETweenProperty::PositionY:
+	case ETweenProperty::ScaleX:
+	case ETweenProperty::ScaleY:
+	case ETweenProperty::Rotation: {
+		auto& transform = enttRegistry.get<TransformComponent>( entity );
+		switch ( eProperty )
+		{
+		case ETweenProperty::PositionX: transform.position.x = value; break;
+		case ETweenProperty::PositionY: transform.position.y = value; break;
+		case ETweenProperty::ScaleX: transform.scale.x = value; break;
+		case ETweenProperty::ScaleY: transform.scale.y = value; break;
+		default: transform.rotation = value; break;
+		}
+
+		transform.bDirty = true;
+		break;
+	}
+	case ETweenProperty::SpriteRed: enttRegistry.get<SpriteComponent>( entity ).color.r = ToColorChannel( value ); break;
+	case ETweenProperty::SpriteGreen: enttRegistry.get<SpriteComponent>( entity ).color.g = ToColorChannel( value ); break;
+	case ETweenProperty::SpriteBlue: enttRegistry.get<SpriteComponent>( entity ).color.b = ToColorChannel( value ); break;
+	case ETweenProperty::SpriteAlpha: enttRegistry.get<SpriteComponent>( entity ).color.a = ToColorChannel( value ); break;
+	case ETweenProperty::SpriteU: enttRegistry.get<SpriteComponent>( entity ).uvs.u = value; break;
+	case ETweenProperty::SpriteV: enttRegistry.get<SpriteComponent>( entity ).uvs.v = value; break;
+	case ETweenProperty::TextRed: enttRegistry.get<TextComponent>( entity ).color.r = ToColorChannel( value ); break;
+	case ETweenProperty::TextGreen: enttRegistry.get<TextComponent>( entity ).color.g = ToColorChannel( value ); break;
+	case ETweenProperty::TextBlue: enttRegistry.get<TextComponent>( entity ).color.b = ToColorChannel( value ); break;
+	case ETweenProperty::TextAlpha: enttRegistry.get<TextComponent>( entity ).color.a = ToColorChannel( value ); break;
+	default: break;
+	}
+}
+
+void TweenSystem::CreateTweenLuaBind( sol::state& lua, Scion::Core::ECS::Registry& registry )
+{
+	auto pTweens = registry.AddToContext<std::shared_ptr<TweenSystem>>( std::make_shared<TweenSystem>() );
+
+	lua.new_enum<ETweenProperty>( "TweenProperty",
+								  { { "PositionX", ETweenProperty::PositionX },
+									{ "PositionY", ETweenProperty::PositionY },
+									{ "ScaleX", ETweenProperty::ScaleX },
+									{ "ScaleY", ETweenProperty::ScaleY },
+									{ "Rotation", ETweenProperty::Rotation },
+									{ "SpriteRed", ETweenProperty::SpriteRed },
+									{ "SpriteGreen", ETweenProperty::SpriteGreen },
+									{ "SpriteBlue", ETweenProperty::SpriteBlue },
+									{ "SpriteAlpha", ETweenProperty::SpriteAlpha },
+									{ "SpriteU", ETweenProperty::SpriteU },
+									{ "SpriteV", ETweenProperty::SpriteV },
+									{ "TextRed", ETweenProperty::TextRed },
+									{ "TextGreen", ETweenProperty::TextGreen },
+									{ "TextBlue", ETweenProperty::TextBlue },
+									{ "TextAlpha", ETweenProperty::TextAlpha },
+									{ "CameraX", ETweenProperty::CameraX },
+									{ "CameraY", ETweenProperty::CameraY },
+									{ "CameraScale", ETweenProperty::CameraScale } } );
+
+	// Entities can be passed as an Entity, an EntityHandle or an entity id. Camera tweens take nil.
+	lua.create_named_table(
+		"Tweens",
+		"start",
+		[ pTweens, &registry ]( const sol::object& entity, const sol::table& params ) {
+			return pTweens->Start( registry, ToEntity( entity ), ToTweenParams( params ) );
+		},
+		"sequence",
+		[ pTweens, &registry ]( const sol::object& entity, const sol::table& steps ) {
+			std::vector<TweenParams> sequence;
+			sequence.reserve( steps.size() );
+			for ( size_t i = 1; i <= steps.size(); ++i )
+			{
+				sequence.push_back( ToTweenParams( steps.raw_get<sol::table>( i ) ) );
+			}
+
+			return pTweens->StartSequence( registry, ToEntity( entity ), sequence );
+		},
+		"stop",
+		[ pTweens, &registry ]( std::uint32_t tweenID, sol::optional<bool> bComplete ) {
+			pTweens->Stop( registry, tweenID, bComplete.value_or( false ) );
+		},
+		"stopAll",
+		[ pTweens, &registry ]( const sol::object& entity ) { pTweens->StopAll( registry, ToEntity( entity ) ); },
+		"isPlaying",
+		[ pTweens ]( std::uint32_t tweenID ) { return pTweens->IsPlaying( tweenID ); },
+		"count",
+		[ pTweens ] { return pTweens->NumTweens(); } );
+}
+
+} // namespace Scion::Core::Systems
@@ -28,6 +28,7 @@ class AssetDisplay : public IDisplay
 	void CheckRename( const std::string& sCheckName ) const;
 	void OpenAssetContext( const std::string& sAssetName );
 	void DrawSoundContext( const std::string& sAssetName );
+	void DrawTextureContext( const std::string& sAssetName );
 
   private:
 	const std::vector<std::string> m_SelectableTypes{ "TEXTURES", "FONTS", "MUSIC", "SOUNDFX", "SCENES", "PREFABS" };
@@ -15,8 +15,15 @@ namespace Scion::Core::Events
 class EventDispatcher;
 }
 
+namespace Scion::Filesystem
+{
+class DirectoryWatcher;
+}
+
 namespace Scion::Editor
 {
+class ThumbnailCache;
+
 class ContentDisplay : public IDisplay
 {
   public:
@@ -35,6 +42,13 @@ class ContentDisplay : public IDisplay
 	void HandleCreateEvent( const Scion::Editor::Events::ContentCreateEvent& createEvent );
 	void HandlePopups();
 
+	/*
+	 * @brief Rebuilds the cached entries of the current directory. Only called when the
+	 * directory changes or the watcher reports a change, never every frame.
+	 */
+	void RefreshDirectoryEntries();
+	void OnFileChanged( const std::filesystem::path& path, bool bModified );
+
 	void OpenDeletePopup();
 	void OpenCreateFolderPopup();
 
@@ -44,6 +58,15 @@ class ContentDisplay : public IDisplay
 	void OpenCreateEmptyLuaFilePopup();
 
   private:
+	struct ContentEntry
+	{
+		std::filesystem::path path{};
+		std::string sFilename{};
+		std::filesystem::file_time_type lastWrite{};
+		bool bDirectory{ false };
+		bool bImage{ false };
+	};
+
 	std::unique_ptr<Scion::Core::Events::EventDispatcher> m_pFileDispatcher;
 	std::filesystem::path m_CurrentDir;
 	std::string m_sFilepathToAction;
@@ -55,5 +78,15 @@ class ContentDisplay : public IDisplay
 	bool m_bItemCut;
 	bool m_bWindowHovered;
 
+	/* Cached contents of m_CurrentDir. Directories are listed first. */
+	std::vector<ContentEntry> m_DirectoryEntries;
+	/* The directory m_DirectoryEntries was built from. */
+	std::filesystem::path m_CachedDir;
+	std::unique_ptr<Scion::Filesystem::DirectoryWatcher> m_pDirWatcher;
+	/* Copy of m_CachedDir for the watcher thread, only changes inside it make the entries dirty. */
+	std::filesystem::path m_WatchedDir;
+	std::mutex m_WatchedDirMutex;
+	std::atomic_bool m_bDirectoryDirty;
+	std::unique_ptr<ThumbnailCache> m_pThumbnailCache;
 };
 } // namespace Scion::Editor
@@ -1,5 +1,6 @@
 #pragma once
 #include "IDisplay.h"
+#include "editor/events/EditorEventTypes.h"
 
 namespace Scion::Core
 {
@@ -19,6 +20,7 @@ class PackageGameDisplay : public IDisplay
 
 private:
 	bool CanPackageGame() const;
+	void OnPackagingProgress( const Scion::Editor::Events::PackagingProgressEvent& progressEvent );
 
   private:
 	std::unique_ptr<Scion::Core::GameConfig> m_pGameConfig;
@@ -26,6 +28,7 @@ private:
 	std::string m_sDestinationPath;
 	std::string m_sScriptListPath;
 	std::string m_sFileIconPath;
+	Scion::Editor::Events::PackagingProgressEvent m_PackageProgress;
 
 	bool m_bResizable;
 	bool m_bBorderless;
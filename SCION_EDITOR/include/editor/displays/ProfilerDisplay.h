@@ -1,6 +1,7 @@
 #pragma once
 #include "IDisplay.h"
 #include "Core/Profiling/ProfileCollector.h"
+#include "Core/Profiling/LuaProfiler.h"
 #include <imgui.h>
 
 namespace Scion::Editor
@@ -21,6 +22,10 @@ class ProfilerDisplay : public IDisplay
 	// -- Sub-panels
 	void DrawFrameGraph();
 	void DrawStatsTable( const std::vector<Scion::Core::ZoneStat>& stats );
+	void DrawCounterTable( const std::vector<Scion::Core::CounterStat>& stats );
+	void DrawLuaProfiler();
+	void DrawLuaFlameGraph();
+	void DrawLuaFlameNode( int node, float x, float width, int depth, const ImVec2& origin );
 
 	// -- Helpers
 	static ImVec4 FrameTimeColor( float ms );
@@ -34,7 +39,10 @@ class ProfilerDisplay : public IDisplay
 
 	// Cache stats so we don't recompute every frame
 	std::vector<Scion::Core::ZoneStat> m_CachedStats{};
+	std::vector<Scion::Core::CounterStat> m_CachedCounterStats{};
 	int m_LastStatsFrame{ -1 };
+
+	std::vector<Scion::Core::LuaHotLine> m_CachedHotLines{};
 };
 
 } // namespace Scion::Editor
@@ -48,6 +48,10 @@ class ProjectSettingsDisplay : public IDisplay
 										   Scion::Core::ProjectInfo& projectInfo,
 										   Scion::Core::ECS::MainRegistry& mainRegistry );
 
+	SettingCategory CreateScriptingSettings( Scion::Core::CoreEngineData& coreGlobals,
+											 Scion::Core::ProjectInfo& projectInfo,
+											 Scion::Core::ECS::MainRegistry& mainRegistry );
+
 	SettingCategory CreateGraphicsSettings( Scion::Core::CoreEngineData& coreGlobals,
 											Scion::Core::ProjectInfo& projectInfo,
 											Scion::Core::ECS::MainRegistry& mainRegistry );
@@ -34,6 +34,13 @@ struct SwitchEntityEvent
 	Scion::Core::ECS::Entity* pEntity{ nullptr };
 };
 
+/* Sent from the packaging thread through an event channel. */
+struct PackagingProgressEvent
+{
+	float percent{ 0.f };
+	std::string sMessage{};
+};
+
 enum class EContentCreateAction
 {
 	/* Create a new folder. */
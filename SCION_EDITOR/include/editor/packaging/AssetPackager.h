@@ -1,4 +1,5 @@
 #pragma once
+#include "editor/packaging/TextureAtlasBaker.h"
 #include <rapidjson/document.h>
 
 namespace Scion::Utilities
@@ -20,6 +21,9 @@ struct AssetPackagerParams
 	std::string sTempFilepath{};
 	std::string sDestinationPath{};
 	std::string sProjectPath{};
+	/* Pack textures into shared atlas pages. The runtime resolves the original names to atlas regions. */
+	bool bBakeTextureAtlases{ false };
+	AtlasBakerParams atlasParams{};
 };
 
 struct AssetConversionData
@@ -44,6 +48,12 @@ class AssetPackager
 								 const AssetConversionData& conversionData );
 
 	void CreateLuaAssetFiles( const std::string& sProjectPath, const rapidjson::Value& assets );
+	/*
+	 * @brief Bakes the atlasable project textures into atlas pages and writes the regions of
+	 * each packed texture to an atlases.s2dasset file.
+	 */
+	void BakeTextureAtlases( const rapidjson::Value& assets, const std::filesystem::path& tempAssetsPath,
+							 const std::string& sContentPath );
 	bool CompileLuaAssetFiles();
 	bool CreateAssetsZip();
 
@@ -61,6 +71,10 @@ class AssetPackager
   private:
 	AssetPackagerParams m_Params;
 	std::shared_ptr<Scion::Utilities::ThreadPool> m_pThreadPool;
+
+	/* Textures that were packed into an atlas and are not packaged on their own. */
+	std::unordered_set<std::string> m_AtlasedTextures;
+	std::vector<AtlasPage> m_AtlasPages;
 };
 
 } // namespace Scion::Editor
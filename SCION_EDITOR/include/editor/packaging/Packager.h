@@ -12,6 +12,17 @@ namespace Scion::Utilities
 class ThreadPool;
 }
 
+namespace Scion::Core::Events
+{
+template <typename TEvent>
+class EventChannel;
+}
+
+namespace Scion::Editor::Events
+{
+struct PackagingProgressEvent;
+}
+
 namespace Scion::Editor
 {
 struct PackageData
@@ -23,12 +34,6 @@ struct PackageData
 	std::string sFinalDestination{};
 };
 
-struct PackagingProgress
-{
-	float percent{ 0.f };
-	std::string sMessage{};
-};
-
 class Packager
 {
   public:
@@ -38,8 +43,6 @@ class Packager
 	bool Completed() const;
 	bool HasError() const;
 
-	PackagingProgress GetProgress() const;
-
 	void FinishPackaging();
 
   private:
@@ -56,8 +59,8 @@ class Packager
 	std::thread m_PackageThread;
 	std::atomic_bool m_bPackaging;
 	std::atomic_bool m_bHasError;
-	mutable std::shared_mutex m_ProgressMutex;
-	PackagingProgress m_Progress;
+	/* Progress is sent to the main thread, the packaging thread never waits on the editor. */
+	Scion::Core::Events::EventChannel<Events::PackagingProgressEvent>* m_pProgressChannel;
 
 	std::shared_ptr<Scion::Utilities::ThreadPool> m_pThreadPool;
 };
@@ -0,0 +1,84 @@
+#pragma once
+
+namespace Scion::Editor
+{
+struct AtlasBakerParams
+{
+	/* The max width and height of an atlas page in pixels. */
+	int maxAtlasSize{ 2048 };
+	/* Empty pixels between packed images. */
+	int padding{ 2 };
+	/* Number of times the edge pixels of each image are repeated around it to prevent bleeding. */
+	int extrusion{ 1 };
+};
+
+struct AtlasTextureEntry
+{
+	std::string sTextureName{};
+	std::string sFilepath{};
+	bool bPixelArt{ true };
+};
+
+struct AtlasRegion
+{
+	std::string sTextureName{};
+	std::string sAtlasName{};
+	int x{ 0 };
+	int y{ 0 };
+	int width{ 0 };
+	int height{ 0 };
+};
+
+struct AtlasPage
+{
+	std::string sAtlasName{};
+	std::string sFilepath{};
+	int width{ 0 };
+	int height{ 0 };
+	bool bPixelArt{ true };
+};
+
+/*
+ * Packs textures into as few atlas pages as possible using the MaxRects algorithm with the
+ * best short side fit heuristic. Textures are only packed together with textures that use
+ * the same filtering, since the filter mode belongs to the GL texture of the whole page.
+ * Textures that are too large to fit in a page are skipped and should be packaged on their own.
+ */
+class TextureAtlasBaker
+{
+  public:
+	explicit TextureAtlasBaker( const AtlasBakerParams& params );
+	~TextureAtlasBaker();
+
+	/**
+	 * @brief Packs the textures and writes each atlas page as a png.
+	 * @param textures    The textures to try and pack.
+	 * @param sOutputPath The directory the atlas pages are written to.
+	 * @return Returns true if all pages were written successfully, false otherwise.
+	 */
+	bool Bake( const std::vector<AtlasTextureEntry>& textures, const std::string& sOutputPath );
+
+	inline const std::vector<AtlasPage>& GetPages() const { return m_Pages; }
+	inline const std::vector<AtlasRegion>& GetRegions() const { return m_Regions; }
+	/* @brief Gets the names of the textures that could not be packed. */
+	inline const std::vector<std::string>& GetSkippedTextures() const { return m_SkippedTextures; }
+
+  private:
+	struct AtlasImage
+	{
+		const AtlasTextureEntry* pEntry{ nullptr };
+		std::vector<unsigned char> pixels{};
+		int width{ 0 };
+		int height{ 0 };
+	};
+
+	bool BakeGroup( std::vector<AtlasImage>& images, bool bPixelArt, const std::string& sOutputPath );
+
+  private:
+	AtlasBakerParams m_Params;
+	std::vector<AtlasPage> m_Pages;
+	std::vector<AtlasRegion> m_Regions;
+	std::vector<std::string> m_SkippedTextures;
+};
+
+} // namespace Scion::Editor
@@ -1,6 +1,7 @@
 #pragma once
 #include <sol/sol.hpp>
 #include "Core/Scene/SceneManager.h"
+#include "ScionUtilities/Timer.h"
 
 #define SCENE_MANAGER() Scion::Editor::EditorSceneManager::GetInstance()
 #define COMMAND_MANAGER() SCENE_MANAGER().GetCommandManager()
@@ -45,6 +46,14 @@ class EditorSceneManager : public Scion::Core::SceneManager
 
 	void UpdateScenes();
 
+	/*
+	 * @brief Sets how often a backup of the current scene is written in the background.
+	 * Backups are written to the autosave folder in the editor config and never replace
+	 * the scene's own files. An interval of zero disables autosaving.
+	 */
+	inline void SetAutosaveInterval( int intervalSeconds ) { m_AutosaveIntervalSec = intervalSeconds; }
+	inline int GetAutosaveInterval() const { return m_AutosaveIntervalSec; }
+
 	std::string GetSceneFilepath( const std::string& sSceneName );
 
 	inline const std::map<std::string, std::shared_ptr<Scion::Core::Scene>>& GetAllScenes() const { return m_mapScenes; }
@@ -53,10 +62,15 @@ class EditorSceneManager : public Scion::Core::SceneManager
 
 	static void CreateSceneManagerLuaBind( sol::state& lua );
 
+  private:
+	void UpdateAutosave();
+
   private:
 	std::unique_ptr<ToolManager> m_pToolManager;
 	std::unique_ptr<CommandManager> m_pCommandManager;
 	std::unique_ptr<Scion::Core::Events::EventDispatcher> m_pSceneDispatcher;
+	Scion::Utilities::Timer m_AutosaveTimer;
+	int m_AutosaveIntervalSec;
 
   private:
 	EditorSceneManager();
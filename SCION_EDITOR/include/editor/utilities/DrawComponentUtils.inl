@@ -1,5 +1,6 @@
 #include "DrawComponentUtils.h"
 #include "Core/ECS/Entity.h"
+#include "Core/ECS/MetaUtilities.h"
 
 namespace Scion::Editor
 {
@@ -31,6 +32,8 @@ inline void DrawComponentsUtil::RegisterUIComponent()
 	entt::meta_factory<TComponent>()
 		.type( entt::type_hash<TComponent>::value() )
 		.template func<&DrawEntityComponentInfo<TComponent>>( "DrawEntityComponentInfo"_hs );
+
+	Scion::Core::Utils::InvalidateMetaFunctionCache();
 }
 
 } // namespace Scion::Editor
@@ -40,6 +40,8 @@ struct EditorState
 	bool bShowCollisions{ false };
 	bool bShowAnimations{ false };
 	bool bEnableGridsnap{ true };
+	/* How often the current scene is backed up, in seconds. Zero turns autosaving off. */
+	int autosaveInterval{ 300 };
 
 	bool Save( Scion::Core::ProjectInfo& projectInfo );
 	bool Load( Scion::Core::ProjectInfo& projectInfo );
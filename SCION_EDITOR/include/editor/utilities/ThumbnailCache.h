@@ -0,0 +1,113 @@
+#pragma once
+
+namespace Scion::Rendering
+{
+class Texture;
+}
+
+namespace Scion::Utilities
+{
+class ThreadPool;
+}
+
+namespace Scion::Editor
+{
+
+/*
+ * Generates small preview textures for image files in the background.
+ *
+ * Images are decoded and downscaled on the thread pool and written to an on-disk cache
+ * keyed by the file path and its last write time, so a thumbnail is only ever generated
+ * once per version of a file. Finished thumbnails are uploaded to the GPU from Update()
+ * on the main thread, a few at a time, so scrolling a large folder never stalls a frame.
+ */
+class ThumbnailCache
+{
+  public:
+	/**
+	 * @param pThreadPool       The pool used to decode and downscale images.
+	 * @param cacheDirectory    The directory thumbnails are persisted to. Created if missing.
+	 * @param thumbnailSize     The max width and height of a thumbnail in pixels.
+	 * @param maxUploadsPerFrame The max number of thumbnails uploaded to the GPU in a single Update().
+	 */
+	ThumbnailCache( std::shared_ptr<Scion::Utilities::ThreadPool> pThreadPool, const std::filesystem::path& cacheDirectory,
+					int thumbnailSize = 128, int maxUploadsPerFrame = 4 );
+	~ThumbnailCache();
+
+	/**
+	 * @brief Gets the thumbnail for an image. If the thumbnail has not been generated yet,
+	 * a request is queued and nullptr is returned until it is ready.
+	 * @param imagePath  The path to the image file.
+	 * @param lastWrite  The last write time of the image, used to detect stale thumbnails.
+	 * @return Returns the thumbnail texture or nullptr.
+	 */
+	Scion::Rendering::Texture* GetThumbnail( const std::filesystem::path& imagePath,
+											 std::filesystem::file_time_type lastWrite );
+
+	/*
+	 * @brief Uploads finished thumbnails to the GPU. Must be called on the main thread.
+	 */
+	void Update();
+
+	/*
+	 * @brief Destroys all uploaded thumbnails. Thumbnails on disk are kept.
+	 */
+	void Clear();
+
+  private:
+	enum class EThumbnailState
+	{
+		Pending,
+		Ready,
+		Failed
+	};
+
+	struct ThumbnailEntry
+	{
+		EThumbnailState eState{ EThumbnailState::Pending };
+		std::filesystem::file_time_type lastWrite{};
+		std::unique_ptr<Scion::Rendering::Texture> pTexture{ nullptr };
+	};
+
+	struct ThumbnailResult
+	{
+		std::string sImagePath{};
+		std::filesystem::file_time_type lastWrite{};
+		std::vector<unsigned char> pixels{};
+		int width{ 0 };
+		int height{ 0 };
+		bool bSuccess{ false };
+	};
+
+	/*
+	 * State shared with the worker tasks. Held by a shared_ptr so tasks that are still
+	 * queued when the cache is destroyed have somewhere safe to write their results.
+	 */
+	struct SharedState
+	{
+		std::mutex mutex;
+		std::vector<ThumbnailResult> completed;
+		std::atomic_bool bCancelled{ false };
+	};
+
+	void RequestThumbnail( const std::filesystem::path& imagePath, std::filesystem::file_time_type lastWrite );
+
+	static ThumbnailResult GenerateThumbnail( const std::filesystem::path& imagePath,
+											  const std::filesystem::path& cachedPath, int thumbnailSize );
+	static std::filesystem::path GetCachedPath( const std::filesystem::path& cacheDirectory,
+												const std::filesystem::path& imagePath,
+												std::filesystem::file_time_type lastWrite );
+
+  private:
+	std::shared_ptr<Scion::Utilities::ThreadPool> m_pThreadPool;
+	std::filesystem::path m_CacheDirectory;
+	int m_ThumbnailSize;
+	int m_MaxUploadsPerFrame;
+
+	std::unordered_map<std::string, ThumbnailEntry> m_mapThumbnails;
+	std::shared_ptr<SharedState> m_pSharedState;
+	/* Results that have finished but did not fit in the upload budget yet. */
+	std::vector<ThumbnailResult> m_PendingUploads;
+};
+
+} // namespace Scion::Editor
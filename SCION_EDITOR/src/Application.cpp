@@ -54,6 +54,7 @@
 #include "Core/Profiling/ProfileCollector.h"
 
 #include "ScionUtilities/ThreadPool.h"
+#include "ScionFilesystem/Utilities/AsyncFileWriter.h"
 #include "ScionUtilities/HelperUtilities.h"
 #include "editor/hub/Hub.h"
 
@@ -285,6 +286,8 @@ bool Application::InitApp()
 	SCION_CRASH_LOGGER().SetProjectPath( pProjectInfo->GetProjectPath().string() );
 
 	MAIN_REGISTRY().AddToContext<SharedThreadPool>( std::make_shared<Scion::Utilities::ThreadPool>( 6 ) );
+	MAIN_REGISTRY().AddToContext<std::shared_ptr<Scion::Filesystem::AsyncFileWriter>>(
+		std::make_shared<Scion::Filesystem::AsyncFileWriter>() );
 
 	return true;
 }
@@ -322,6 +325,13 @@ bool Application::LoadShaders()
 		return false;
 	}
 
+	if ( !assetManager.AddShaderFromMemory(
+			 "particle", Scion::Core::Shaders::particleShaderVert, Scion::Core::Shaders::particleShaderFrag ) )
+	{
+		SCION_ERROR( "Failed to add the particle shader to the asset manager" );
+		return false;
+	}
+
 	if ( !assetManager.AddShaderFromMemory(
 			 "picking", Scion::Core::Shaders::pickingShaderVert, Scion::Core::Shaders::pickingShaderFrag ) )
 	{
@@ -578,6 +588,9 @@ void Application::Update()
 	auto& mainRegistry = MAIN_REGISTRY();
 	auto& displayHolder = mainRegistry.GetContext<std::shared_ptr<DisplayHolder>>();
 
+	// Events sent from other threads are delivered before anything reads the state they change.
+	mainRegistry.GetEventDispatcher().DrainChannels();
+
 	for ( const auto& pDisplay : displayHolder->displays )
 	{
 		pDisplay->Update();
@@ -614,6 +627,12 @@ void Application::CleanUp()
 	auto& pEditorState = MAIN_REGISTRY().GetContext<EditorStatePtr>();
 	pEditorState->Save( *pProjectInfo );
 
+	// Let any background saves finish before shutting down.
+	if ( auto* pFileWriter = MAIN_REGISTRY().TryGetContext<std::shared_ptr<Scion::Filesystem::AsyncFileWriter>>() )
+	{
+		( *pFileWriter )->Flush();
+	}
+
 	// Cleanup the registry before we shutdown sdl
 	MAIN_REGISTRY().CleanUp();
 
@@ -177,7 +177,8 @@ void AssetDisplay::CheckRename( const std::string& sCheckName ) const
 void AssetDisplay::OpenAssetContext( const std::string& sAssetName )
 {
 	DrawSoundContext( sAssetName );
-	
+	DrawTextureContext( sAssetName );
+
 	ImGui::SeparatorText( "Edit" );
 	if ( ImGui::Selectable( ICON_FA_PEN " Rename" ) )
 	{
@@ -325,6 +326,34 @@ void AssetDisplay::DrawSoundContext( const std::string& sAssetName )
 	}
 }
 
+void AssetDisplay::DrawTextureContext( const std::string& sAssetName )
+{
+	if ( m_eSelectedType != Scion::Utilities::AssetType::TEXTURE )
+		return;
+
+	auto pTexture = ASSET_MANAGER().GetTexture( sAssetName );
+	if ( !pTexture )
+		return;
+
+	ImGui::SeparatorText( "Texture Properties" );
+	bool bAtlasable{ pTexture->IsAtlasable() };
+	if ( ImGui::Checkbox( "Atlasable", &bAtlasable ) )
+	{
+		pTexture->SetIsAtlasable( bAtlasable );
+
+		// The flag is stored in the project file, so save the project.
+		auto& pProjectInfo = MAIN_REGISTRY().GetContext<Scion::Core::ProjectInfoPtr>();
+		SCION_ASSERT( pProjectInfo && "Project Info must exist!" );
+		ProjectLoader pl{};
+		if ( !pl.SaveLoadedProject( *pProjectInfo ) )
+		{
+			SCION_ERROR( "Failed to save project [{}] after changing texture [{}].",
+						 pProjectInfo->GetProjectName(),
+						 sAssetName );
+		}
+	}
+}
+
 void AssetDisplay::DrawSelectedAssets()
 {
 	auto& mainRegistry = MAIN_REGISTRY();
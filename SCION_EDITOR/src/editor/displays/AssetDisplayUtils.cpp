@@ -11,6 +11,8 @@
 #include "Sounds/AudioPlayer/AudioPlayer.hpp"
 #include "Sounds/Essentials/Audio.hpp"
 
+#include <Rendering/Essentials/Texture.h>
+
 #include <imgui.h>
 #include <misc/cpp/imgui_stdlib.h>
 
@@ -46,6 +48,7 @@ struct AddAssetParams
 	Scion::Utilities::AssetType eAssetType;
 	std::optional<bool> optbTileset{ std::nullopt };
 	std::optional<bool> optbPixelArt{ std::nullopt };
+	std::optional<bool> optbAtlasable{ std::nullopt };
 	std::optional<bool> optbSdfFont{ std::nullopt };
 	std::optional<float> optFontSize{ std::nullopt };
 	std::optional<std::string> optVertPath{ std::nullopt };
@@ -66,8 +69,16 @@ class AssetModalCreator
 			SCION_ASSERT( assetParams.optbPixelArt && assetParams.optbTileset &&
 						  "These must be set when adding textures" );
 
-			return assetManager.AddTexture(
-				assetParams.sAssetName, assetParams.sFilepath, *assetParams.optbPixelArt, *assetParams.optbTileset );
+			if ( !assetManager.AddTexture(
+					 assetParams.sAssetName, assetParams.sFilepath, *assetParams.optbPixelArt, *assetParams.optbTileset ) )
+			{
+				return false;
+			}
+
+			if ( auto pTexture = assetManager.GetTexture( assetParams.sAssetName ) )
+				pTexture->SetIsAtlasable( assetParams.optbAtlasable.value_or( false ) );
+
+			return true;
 		}
 		case Scion::Utilities::AssetType::FONT: {
 			SCION_ASSERT( assetParams.optbSdfFont && assetParams.optFontSize && "These must be set when adding fonts" );
@@ -242,8 +253,14 @@ class AssetModalCreator
 					m_AddAssetParams.optbTileset = false;
 				}
 
+				if ( !m_AddAssetParams.optbAtlasable )
+				{
+					m_AddAssetParams.optbAtlasable = false;
+				}
+
 				ImGui::Checkbox( "Pixel Art", &( *m_AddAssetParams.optbPixelArt ) );
 				ImGui::Checkbox( "Tileset", &( *m_AddAssetParams.optbTileset ) );
+				ImGui::Checkbox( "Atlasable", &( *m_AddAssetParams.optbAtlasable ) );
 			}
 			else if ( eAssetType == Scion::Utilities::AssetType::FONT )
 			{
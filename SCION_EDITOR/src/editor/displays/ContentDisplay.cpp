@@ -6,6 +6,7 @@
 #include "ScionFilesystem/Dialogs/FileDialog.h"
 #include "editor/utilities/EditorUtilities.h"
 #include "editor/utilities/EditorState.h"
+#include "editor/utilities/ThumbnailCache.h"
 #include "editor/utilities/imgui/ImGuiUtils.h"
 #include "editor/utilities/fonts/IconsFontAwesome5.h"
 #include "Logger/Logger.h"
@@ -16,6 +17,8 @@
 
 #include "ScionFilesystem/Process/FileProcessor.h"
 #include "ScionFilesystem/Serializers/LuaSerializer.h"
+#include "ScionFilesystem/Utilities/DirectoryWatcher.h"
+#include "ScionUtilities/ThreadPool.h"
 
 #include <Rendering/Essentials/Texture.h>
 #include <imgui.h>
@@ -38,16 +41,44 @@ ContentDisplay::ContentDisplay()
 	, m_eCreateAction{ Events::EContentCreateAction::NoAction }
 	, m_bItemCut{ false }
 	, m_bWindowHovered{ false }
+	, m_DirectoryEntries{}
+	, m_CachedDir{}
+	, m_pDirWatcher{ nullptr }
+	, m_WatchedDir{}
+	, m_WatchedDirMutex{}
+	, m_bDirectoryDirty{ true }
+	, m_pThumbnailCache{ nullptr }
 {
 	ADD_EVENT_HANDLER( FileEvent, &ContentDisplay::HandleFileEvent, *this );
 	m_pFileDispatcher->AddHandler<FileEvent, &ContentDisplay::HandleFileEvent>( *this );
+
+	auto& pProjectInfo = MAIN_REGISTRY().GetContext<Scion::Core::ProjectInfoPtr>();
+
+	m_pDirWatcher = std::make_unique<Scion::Filesystem::DirectoryWatcher>(
+		m_CurrentDir, [ this ]( const fs::path& file, bool bModified ) { OnFileChanged( file, bModified ); } );
+
+	if ( auto optEditorConfig = pProjectInfo->TryGetFolderPath( Scion::Core::EProjectFolderType::EditorConfig ) )
+	{
+		auto* pThreadPool = MAIN_REGISTRY().TryGetContext<SharedThreadPool>();
+		m_pThumbnailCache = std::make_unique<ThumbnailCache>( pThreadPool ? *pThreadPool : nullptr,
+															  *optEditorConfig / "thumbnails" );
+	}
 }
 
-ContentDisplay::~ContentDisplay() = default;
+ContentDisplay::~ContentDisplay()
+{
+	// Stop the watcher first so the callback can never run against a partially destroyed display.
+	m_pDirWatcher.reset();
+}
 
 void ContentDisplay::Update()
 {
 	m_pFileDispatcher->UpdateAll();
+
+	if ( m_pThumbnailCache )
+	{
+		m_pThumbnailCache->Update();
+	}
 }
 
 void ContentDisplay::Draw()
@@ -78,141 +109,162 @@ void ContentDisplay::Draw()
 
 	DrawToolbar();
 
-	auto size = static_cast<int>( std::distance( fs::directory_iterator( m_CurrentDir ), fs::directory_iterator{} ) );
-	int numRows = size / numCols < 1 ? 1 : ( size / numCols ) + 1;
-	auto itr = fs::directory_iterator( m_CurrentDir );
+	if ( m_CachedDir != m_CurrentDir || m_bDirectoryDirty.exchange( false, std::memory_order_acquire ) )
+	{
+		RefreshDirectoryEntries();
+	}
+
+	const int size = static_cast<int>( m_DirectoryEntries.size() );
+	const int numRows = std::max( 1, ( size + numCols - 1 ) / numCols );
 
 	if ( ImGui::BeginTable( "Content", numCols, IMGUI_NORMAL_TABLE_FLAGS ) )
 	{
 		m_bWindowHovered = ImGui::IsWindowHovered();
 		static ImGuiID popID = 0;
 
-		for ( int i = 0; i < numRows; i++ )
+		// Only the rows that are visible in the window are laid out.
+		ImGuiListClipper clipper;
+		clipper.Begin( numRows );
+
+		while ( clipper.Step() )
 		{
-			ImGui::TableNextRow();
-			for ( int j = 0; j < numCols; j++ )
+			for ( int i = clipper.DisplayStart; i < clipper.DisplayEnd; i++ )
 			{
-				if ( itr == fs::directory_iterator{} )
-					break;
-
-				const auto& path = itr->path();
-
-				auto relativePath = fs::relative( path, m_CurrentDir );
-				auto filenameStr = relativePath.filename().string();
-
-				ImGui::TableSetColumnIndex( j );
-				ImGui::PushID( j + j + i );
-				int id = j + j + i;
-
-				if ( m_Selected == id )
+				ImGui::TableNextRow();
+				for ( int j = 0; j < numCols; j++ )
 				{
-					ImGui::TableSetBgColor( ImGuiTableBgTarget_CellBg,
-											ImGui::GetColorU32( ImVec4{ 0.f, 0.9f, 0.f, 0.3f } ) );
-				}
+					const int id = i * numCols + j;
+					if ( id >= size )
+						break;
 
-				const auto* icon = GetIconTexture( path.string() );
-				static bool bItemPop{ false };
+					// Taking a copy, double clicking a folder changes the directory mid loop.
+					const ContentEntry entry = m_DirectoryEntries[ id ];
+					const auto& path = entry.path;
+					const auto& filenameStr = entry.sFilename;
 
-				std::string contentBtn = "##content_" + std::to_string( id );
-				if ( itr->is_directory() )
-				{
-					// Change to the next Directory
-					ImGui::ImageButton(
-						contentBtn.c_str(), (ImTextureID)(intptr_t)icon->GetID(), ImVec2{ 80.f, 80.f } );
-					if ( ImGui::IsItemHovered() && ImGui::IsMouseDoubleClicked( 0 ) )
+					ImGui::TableSetColumnIndex( j );
+					ImGui::PushID( id );
+
+					if ( m_Selected == id )
 					{
-						m_CurrentDir /= path.filename();
-						m_Selected = -1;
+						ImGui::TableSetBgColor( ImGuiTableBgTarget_CellBg,
+												ImGui::GetColorU32( ImVec4{ 0.f, 0.9f, 0.f, 0.3f } ) );
 					}
-					else if ( ImGui::IsItemHovered() && ImGui::IsMouseClicked( 0 ) )
+
+					const Scion::Rendering::Texture* icon{ nullptr };
+					if ( entry.bImage && m_pThumbnailCache )
 					{
-						m_Selected = id;
+						icon = m_pThumbnailCache->GetThumbnail( path, entry.lastWrite );
 					}
-					else if ( !ImGui::IsItemHovered() && ImGui::IsWindowHovered() && ImGui::IsMouseClicked( 0 ) )
+
+					if ( !icon )
 					{
-						m_Selected = -1;
+						icon = GetIconTexture( path.string() );
 					}
-				}
-				else
-				{
-					ImGui::PushStyleVar( ImGuiStyleVar_FramePadding, { 0.0f, 0.0f } );
-					ImGui::ImageButton(
-						contentBtn.c_str(), (ImTextureID)(intptr_t)icon->GetID(), ImVec2{ 80.f, 80.f } );
-					ImGui::PopStyleVar( 1 );
 
-					if ( ImGui::IsItemHovered() && ImGui::IsMouseDoubleClicked( 0 ) )
+					static bool bItemPop{ false };
+
+					std::string contentBtn = "##content_" + std::to_string( id );
+					if ( entry.bDirectory )
 					{
-						Scion::Filesystem::FileProcessor fp{};
-						if ( !fp.OpenApplicationFromFile( path.string(), {} ) )
+						// Change to the next Directory
+						ImGui::ImageButton(
+							contentBtn.c_str(), (ImTextureID)(intptr_t)icon->GetID(), ImVec2{ 80.f, 80.f } );
+						if ( ImGui::IsItemHovered() && ImGui::IsMouseDoubleClicked( 0 ) )
 						{
-							SCION_ERROR( "Failed to open file {}", path.string() );
+							m_CurrentDir /= path.filename();
+							m_Selected = -1;
+							m_bDirectoryDirty.store( true, std::memory_order_relaxed );
+						}
+						else if ( ImGui::IsItemHovered() && ImGui::IsMouseClicked( 0 ) )
+						{
+							m_Selected = id;
+						}
+						else if ( !ImGui::IsItemHovered() && ImGui::IsWindowHovered() && ImGui::IsMouseClicked( 0 ) )
+						{
+							m_Selected = -1;
 						}
 					}
-					else if ( ImGui::IsItemHovered() && ImGui::IsMouseClicked( 0 ) )
+					else
 					{
-						m_Selected = id;
-					}
-				}
+						ImGui::PushStyleVar( ImGuiStyleVar_FramePadding, { 0.0f, 0.0f } );
+						ImGui::ImageButton(
+							contentBtn.c_str(), (ImTextureID)(intptr_t)icon->GetID(), ImVec2{ 80.f, 80.f } );
+						ImGui::PopStyleVar( 1 );
 
-				if ( ImGui::BeginPopupContextItem() )
-				{
-					popID = ImGui::GetItemID();
-					ImGui::SeparatorText( "Common" );
-					if ( m_bItemCut )
-					{
-						ImGui::BeginDisabled();
-						ImGui::Selectable( ICON_FA_CUT " Cut" );
-						ImGui::EndDisabled();
+						if ( ImGui::IsItemHovered() && ImGui::IsMouseDoubleClicked( 0 ) )
+						{
+							Scion::Filesystem::FileProcessor fp{};
+							if ( !fp.OpenApplicationFromFile( path.string(), {} ) )
+							{
+								SCION_ERROR( "Failed to open file {}", path.string() );
+							}
+						}
+						else if ( ImGui::IsItemHovered() && ImGui::IsMouseClicked( 0 ) )
+						{
+							m_Selected = id;
+						}
 					}
-					else
+
+					if ( ImGui::BeginPopupContextItem() )
 					{
-						if ( ImGui::Selectable( ICON_FA_CUT " Cut" ) )
+						popID = ImGui::GetItemID();
+						ImGui::SeparatorText( "Common" );
+						if ( m_bItemCut )
 						{
-							m_sFilepathToAction = path.string();
-							m_bItemCut = true;
+							ImGui::BeginDisabled();
+							ImGui::Selectable( ICON_FA_CUT " Cut" );
+							ImGui::EndDisabled();
 						}
-
-						if ( ImGui::Selectable( ICON_FA_TRASH " Delete" ) )
+						else
 						{
-							if ( m_Selected == id )
+							if ( ImGui::Selectable( ICON_FA_CUT " Cut" ) )
 							{
 								m_sFilepathToAction = path.string();
-								m_eFileAction = Events::EFileAction::Delete;
+								m_bItemCut = true;
+							}
+
+							if ( ImGui::Selectable( ICON_FA_TRASH " Delete" ) )
+							{
+								if ( m_Selected == id )
+								{
+									m_sFilepathToAction = path.string();
+									m_eFileAction = Events::EFileAction::Delete;
+								}
 							}
 						}
-					}
 
-					if ( ImGui::Selectable( ICON_FA_PEN " Rename" ) )
-					{
-						// TODO: Rename file
-					}
+						if ( ImGui::Selectable( ICON_FA_PEN " Rename" ) )
+						{
+							// TODO: Rename file
+						}
 
-					ImGui::SeparatorText( "File Exporer" );
+						ImGui::SeparatorText( "File Exporer" );
 
-					if ( ImGui::Selectable( ICON_FA_FILE_ALT " Open File Location" ) )
-					{
-						Scion::Filesystem::FileProcessor fp{};
-						if ( !fp.OpenFileLocation( path.string() ) )
+						if ( ImGui::Selectable( ICON_FA_FILE_ALT " Open File Location" ) )
 						{
-							SCION_ERROR( "Failed to open file location [{}]", path.string() );
+							Scion::Filesystem::FileProcessor fp{};
+							if ( !fp.OpenFileLocation( path.string() ) )
+							{
+								SCION_ERROR( "Failed to open file location [{}]", path.string() );
+							}
 						}
+
+						bItemPop = true;
+						ImGui::EndPopup();
 					}
 
-					bItemPop = true;
-					ImGui::EndPopup();
-				}
+					ImGui::SetNextItemWidth( 80.f );
+					ImGui::TextWrapped( filenameStr.c_str() );
 
-				ImGui::SetNextItemWidth( 80.f );
-				ImGui::TextWrapped( filenameStr.c_str() );
+					if ( !ImGui::IsPopupOpen( "", ImGuiPopupFlags_AnyPopupId | ImGuiPopupFlags_AnyPopupLevel ) && bItemPop )
+					{
+						popID = 0;
+						bItemPop = false;
+					}
 
-				if ( !ImGui::IsPopupOpen( "", ImGuiPopupFlags_AnyPopupId | ImGuiPopupFlags_AnyPopupLevel ) && bItemPop )
-				{
-					popID = 0;
-					bItemPop = false;
+					ImGui::PopID();
 				}
-
-				ImGui::PopID();
-				++itr;
 			}
 		}
 
@@ -500,6 +552,65 @@ void ContentDisplay::HandleFileEvent( const Scion::Editor::Events::FileEvent& fi
 	}
 }
 
+void ContentDisplay::RefreshDirectoryEntries()
+{
+	m_DirectoryEntries.clear();
+	m_CachedDir = m_CurrentDir;
+
+	{
+		std::lock_guard lock{ m_WatchedDirMutex };
+		m_WatchedDir = m_CachedDir.lexically_normal();
+		// A trailing separator leaves an empty filename, which would never match a parent path.
+		if ( !m_WatchedDir.has_filename() )
+			m_WatchedDir = m_WatchedDir.parent_path();
+	}
+
+	std::error_code ec;
+	auto dirItr = fs::directory_iterator( m_CurrentDir, ec );
+	if ( ec )
+	{
+		SCION_ERROR( "Failed to read directory [{}] - {}", m_CurrentDir.string(), ec.message() );
+		return;
+	}
+
+	for ( const auto& dirEntry : dirItr )
+	{
+		const auto& path = dirEntry.path();
+		ContentEntry entry{ .path = path, .sFilename = path.filename().string() };
+		entry.bDirectory = dirEntry.is_directory( ec );
+		if ( !entry.bDirectory )
+		{
+			entry.bImage = GetFileType( path.string() ) == EFileType::IMAGE;
+			entry.lastWrite = dirEntry.last_write_time( ec );
+		}
+
+		m_DirectoryEntries.emplace_back( std::move( entry ) );
+	}
+
+	std::ranges::sort( m_DirectoryEntries, []( const ContentEntry& a, const ContentEntry& b ) {
+		if ( a.bDirectory != b.bDirectory )
+			return a.bDirectory;
+		return a.sFilename < b.sFilename;
+	} );
+
+	if ( m_Selected >= static_cast<int>( m_DirectoryEntries.size() ) )
+	{
+		m_Selected = -1;
+	}
+}
+
+void ContentDisplay::OnFileChanged( const std::filesystem::path& path, bool bModified )
+{
+	// The watcher covers the whole content tree, only entries of the listed directory need a rescan.
+	const fs::path changedPath{ path.lexically_normal() };
+
+	std::lock_guard lock{ m_WatchedDirMutex };
+	if ( changedPath.parent_path() == m_WatchedDir )
+	{
+		m_bDirectoryDirty.store( true, std::memory_order_relaxed );
+	}
+}
+
 void ContentDisplay::HandleCreateEvent( const Scion::Editor::Events::ContentCreateEvent& createEvent )
 {
 	if ( createEvent.eAction == EContentCreateAction::NoAction )
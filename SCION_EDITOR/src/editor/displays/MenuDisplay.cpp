@@ -130,6 +130,18 @@ void MenuDisplay::Draw()
 				bShowAnimations ? coreGlobals.EnableAnimationRender() : coreGlobals.DisableAnimationRender();
 			}
 
+			auto& sceneManager = SCENE_MANAGER();
+			int autosaveInterval{ sceneManager.GetAutosaveInterval() };
+			ImGui::PushItemWidth( 96.f );
+			if ( ImGui::InputInt( "Autosave (sec)", &autosaveInterval, 30, 60 ) )
+			{
+				autosaveInterval = std::max( autosaveInterval, 0 );
+				sceneManager.SetAutosaveInterval( autosaveInterval );
+				MAIN_REGISTRY().GetContext<EditorStatePtr>()->autosaveInterval = autosaveInterval;
+			}
+			ImGui::PopItemWidth();
+			ImGui::ItemToolTip( "How often the current scene is backed up. Zero turns autosaving off." );
+
 			ImGui::EndMenu();
 		}
 
@@ -28,6 +28,7 @@ PackageGameDisplay::PackageGameDisplay()
 	, m_sDestinationPath{}
 	, m_sScriptListPath{}
 	, m_sFileIconPath{}
+	, m_PackageProgress{}
 	, m_bResizable{ false }
 	, m_bBorderless{ false }
 	, m_bFullScreen{ false }
@@ -41,6 +42,8 @@ PackageGameDisplay::PackageGameDisplay()
 
 	m_sScriptListPath = optScriptListPath->string();
 	m_bScriptListExists = fs::exists( *optScriptListPath );
+
+	ADD_EVENT_HANDLER( Scion::Editor::Events::PackagingProgressEvent, &PackageGameDisplay::OnPackagingProgress, *this );
 }
 
 PackageGameDisplay::~PackageGameDisplay() = default;
@@ -133,6 +136,45 @@ void PackageGameDisplay::Draw()
 		ImGui::InlineLabel( "Package Assets" );
 		ImGui::ItemToolTip( "Convert assets into luac files and add them to zip archive." );
 		ImGui::Checkbox( "##packageassets", &m_pGameConfig->bPackageAssets );
+
+		if ( m_pGameConfig->bPackageAssets )
+		{
+			ImGui::InlineLabel( "Bake Atlases" );
+			ImGui::ItemToolTip( "Pack the textures flagged as atlasable into shared atlas textures. Sprites keep using the original texture names." );
+			ImGui::Checkbox( "##bakeatlases", &m_pGameConfig->bBakeTextureAtlases );
+
+			if ( m_pGameConfig->bBakeTextureAtlases )
+			{
+				ImGui::InlineLabel( "Atlas Size" );
+				ImGui::PushItemWidth( 128.f );
+				if ( ImGui::InputInt( "##atlasMaxSize", &m_pGameConfig->atlasMaxSize, 256, 1024 ) )
+				{
+					m_pGameConfig->atlasMaxSize = std::clamp( m_pGameConfig->atlasMaxSize, 256, 8192 );
+				}
+
+				ImGui::InlineLabel( "Atlas Padding" );
+				if ( ImGui::InputInt( "##atlasPadding", &m_pGameConfig->atlasPadding, 1, 2 ) )
+				{
+					m_pGameConfig->atlasPadding = std::clamp( m_pGameConfig->atlasPadding, 0, 16 );
+				}
+				ImGui::PopItemWidth();
+			}
+		}
+
+		ImGui::InlineLabel( "Stream Levels" );
+		ImGui::ItemToolTip( "Split scenes into cells that are loaded and unloaded around the camera." );
+		ImGui::Checkbox( "##streamlevels", &m_pGameConfig->bStreamLevels );
+
+		if ( m_pGameConfig->bStreamLevels )
+		{
+			ImGui::InlineLabel( "Cell Size" );
+			ImGui::PushItemWidth( 128.f );
+			if ( ImGui::InputInt( "##streamCellSize", &m_pGameConfig->streamCellSize, 64, 256 ) )
+			{
+				m_pGameConfig->streamCellSize = std::max( 64, m_pGameConfig->streamCellSize );
+			}
+			ImGui::PopItemWidth();
+		}
 		ImGui::AddSpaces( 2 );
 		ImGui::Separator();
 		ImGui::AddSpaces( 3 );
@@ -236,7 +278,7 @@ void PackageGameDisplay::Draw()
 		{
 			ImGui::LoadingSpinner( "##packaging", 10.f, 3.f, IM_COL32( 32, 175, 32, 255 ) );
 			ImGui::SameLine( 0.f, 16.f );
-			const auto packageProgress = m_pPackager->GetProgress();
+			const auto& packageProgress = m_PackageProgress;
 			if ( auto pFont = ImGui::GetFont( "roboto-bold-24" ) )
 			{
 				ImGui::PushFont( pFont );
@@ -275,6 +317,7 @@ void PackageGameDisplay::Draw()
 			m_pGameConfig->gravity = coreGlobals.GetGravity();
 			m_pGameConfig->sGameName = pProjectInfo->GetProjectName();
 			m_pGameConfig->audioConfig = pProjectInfo->GetAudioConfig();
+			m_pGameConfig->luaGCSettings = coreGlobals.GetLuaGCSettings();
 
 			// Set window flags
 			uint32_t flags{ 0 };
@@ -301,6 +344,7 @@ void PackageGameDisplay::Draw()
 			auto& pThreadPool = MAIN_REGISTRY().GetContext<SharedThreadPool>();
 			SCION_ASSERT( pThreadPool && "Thread pool must exist and be valid." );
 
+			m_PackageProgress = Scion::Editor::Events::PackagingProgressEvent{};
 			m_pPackager = std::make_unique<Packager>( std::move( pPackageData ), pThreadPool );
 
 			ImGui::End();
@@ -322,4 +366,9 @@ bool PackageGameDisplay::CanPackageGame() const
 		   fs::exists( fs::path{ m_sDestinationPath } ) && !m_sDestinationPath.empty();
 }
 
+void PackageGameDisplay::OnPackagingProgress( const Scion::Editor::Events::PackagingProgressEvent& progressEvent )
+{
+	m_PackageProgress = progressEvent;
+}
+
 } // namespace Scion::Editor
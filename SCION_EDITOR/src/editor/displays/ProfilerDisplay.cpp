@@ -6,6 +6,12 @@
 
 using namespace Scion::Core;
 
+namespace
+{
+constexpr float FLAME_ROW_HEIGHT = 20.f;
+constexpr int FLAME_MAX_ROWS = 16;
+} // namespace
+
 namespace Scion::Editor
 {
 ProfilerDisplay::ProfilerDisplay()
@@ -37,6 +43,8 @@ void ProfilerDisplay::Draw()
 	if ( !m_bPaused && curIdx != m_LastStatsFrame )
 	{
 		m_CachedStats = collector.ComputeStats( m_FrameWindow );
+		m_CachedCounterStats = collector.ComputeCounterStats( m_FrameWindow );
+		m_CachedHotLines = LUA_PROFILER().GetHotLines();
 		m_LastStatsFrame = curIdx;
 	}
 
@@ -55,6 +63,18 @@ void ProfilerDisplay::Draw()
 			ImGui::EndTabItem();
 		}
 
+		if ( ImGui::BeginTabItem( "Counters" ) )
+		{
+			DrawCounterTable( m_CachedCounterStats );
+			ImGui::EndTabItem();
+		}
+
+		if ( ImGui::BeginTabItem( "Lua" ) )
+		{
+			DrawLuaProfiler();
+			ImGui::EndTabItem();
+		}
+
 		ImGui::EndTabBar();
 	}
 
@@ -218,6 +238,183 @@ void ProfilerDisplay::DrawStatsTable( const std::vector<ZoneStat>& stats )
 	}
 }
 
+void ProfilerDisplay::DrawCounterTable( const std::vector<CounterStat>& stats )
+{
+	if ( stats.empty() )
+	{
+		ImGui::TextDisabled( "No counters recorded. Add SCION_PROFILE_COUNTER() macros to your systems." );
+		return;
+	}
+
+	constexpr ImGuiTableFlags flags = ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY |
+									  ImGuiTableFlags_SizingStretchProp;
+
+	float tableH = ImGui::GetContentRegionAvail().y - 30.f;
+
+	if ( ImGui::BeginTable( "##counter_stats", 5, flags, ImVec2( 0.f, tableH ) ) )
+	{
+		ImGui::TableSetupScrollFreeze( 0, 1 );
+		ImGui::TableSetupColumn( "Counter", ImGuiTableColumnFlags_WidthStretch );
+		ImGui::TableSetupColumn( "Avg", ImGuiTableColumnFlags_WidthFixed, 90.f );
+		ImGui::TableSetupColumn( "Min", ImGuiTableColumnFlags_WidthFixed, 90.f );
+		ImGui::TableSetupColumn( "Max", ImGuiTableColumnFlags_WidthFixed, 90.f );
+		ImGui::TableSetupColumn( "Last", ImGuiTableColumnFlags_WidthFixed, 90.f );
+		ImGui::TableHeadersRow();
+
+		for ( const auto& counter : stats )
+		{
+			ImGui::TableNextRow();
+
+			ImGui::TableSetColumnIndex( 0 );
+			ImGui::TextUnformatted( counter.name.c_str() );
+
+			ImGui::TableSetColumnIndex( 1 );
+			ImGui::Text( "%.2f", counter.avg );
+
+			ImGui::TableSetColumnIndex( 2 );
+			ImGui::TextDisabled( "%.2f", counter.min );
+
+			ImGui::TableSetColumnIndex( 3 );
+			ImGui::Text( "%.2f", counter.max );
+
+			ImGui::TableSetColumnIndex( 4 );
+			ImGui::Text( "%.2f", counter.last );
+		}
+
+		ImGui::EndTable();
+	}
+}
+
+void ProfilerDisplay::DrawLuaProfiler()
+{
+	auto& luaProfiler = LUA_PROFILER();
+
+	bool bEnabled{ luaProfiler.IsEnabled() };
+	if ( ImGui::Checkbox( "Sample Lua", &bEnabled ) )
+	{
+		luaProfiler.SetEnabled( bEnabled );
+	}
+
+	ImGui::SameLine();
+	int interval{ luaProfiler.GetSampleInterval() };
+	ImGui::SetNextItemWidth( 100.f );
+	if ( ImGui::InputInt( "Interval us", &interval, 100, 1000 ) )
+	{
+		luaProfiler.SetSampleInterval( interval );
+	}
+
+	ImGui::SameLine();
+	if ( ImGui::Button( "Reset" ) )
+	{
+		luaProfiler.Reset();
+		m_CachedHotLines.clear();
+	}
+
+	ImGui::SameLine();
+	if ( ImGui::Button( "Copy Folded Stacks" ) )
+	{
+		ImGui::SetClipboardText( luaProfiler.ToFoldedStacks().c_str() );
+	}
+
+	ImGui::SameLine();
+	ImGui::TextDisabled( "%llu samples", static_cast<unsigned long long>( luaProfiler.GetTotalSamples() ) );
+
+	if ( luaProfiler.GetTotalSamples() == 0 )
+	{
+		ImGui::TextDisabled( "No samples yet. Enable sampling and play the scene." );
+		return;
+	}
+
+	DrawLuaFlameGraph();
+	ImGui::Separator();
+
+	constexpr ImGuiTableFlags flags =
+		ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY | ImGuiTableFlags_SizingStretchProp;
+
+	const float total = static_cast<float>( luaProfiler.GetTotalSamples() );
+	float tableH = ImGui::GetContentRegionAvail().y - 30.f;
+
+	if ( ImGui::BeginTable( "##lua_hot_lines", 3, flags, ImVec2( 0.f, tableH ) ) )
+	{
+		ImGui::TableSetupScrollFreeze( 0, 1 );
+		ImGui::TableSetupColumn( "Line", ImGuiTableColumnFlags_WidthStretch );
+		ImGui::TableSetupColumn( "Samples", ImGuiTableColumnFlags_WidthFixed, 80.f );
+		ImGui::TableSetupColumn( "%", ImGuiTableColumnFlags_WidthFixed, 60.f );
+		ImGui::TableHeadersRow();
+
+		for ( const auto& hotLine : m_CachedHotLines )
+		{
+			ImGui::TableNextRow();
+
+			ImGui::TableSetColumnIndex( 0 );
+			ImGui::Text( "%s:%d", hotLine.sSource.c_str(), hotLine.line );
+
+			ImGui::TableSetColumnIndex( 1 );
+			ImGui::Text( "%llu", static_cast<unsigned long long>( hotLine.samples ) );
+
+			ImGui::TableSetColumnIndex( 2 );
+			ImGui::Text( "%.1f", static_cast<float>( hotLine.samples ) / total * 100.f );
+		}
+
+		ImGui::EndTable();
+	}
+}
+
+void ProfilerDisplay::DrawLuaFlameGraph()
+{
+	const ImVec2 origin = ImGui::GetCursorScreenPos();
+	const float width = ImGui::GetContentRegionAvail().x;
+
+	// The root spans the whole width, every callee sits below its caller.
+	DrawLuaFlameNode( 0, origin.x, width, 0, origin );
+	ImGui::Dummy( ImVec2( width, FLAME_ROW_HEIGHT * FLAME_MAX_ROWS ) );
+}
+
+void ProfilerDisplay::DrawLuaFlameNode( int node, float x, float width, int depth, const ImVec2& origin )
+{
+	if ( width < 1.f || depth >= FLAME_MAX_ROWS )
+		return;
+
+	const auto& nodes = LUA_PROFILER().GetNodes();
+	const auto& current = nodes[ node ];
+
+	const ImVec2 min{ x, origin.y + depth * FLAME_ROW_HEIGHT };
+	const ImVec2 max{ x + width - 1.f, min.y + FLAME_ROW_HEIGHT - 1.f };
+
+	auto* pDrawList = ImGui::GetWindowDrawList();
+	pDrawList->AddRectFilled( min, max, ImGui::ColorConvertFloat4ToU32( ZoneDepthColor( depth % 5 ) ) );
+
+	const std::string sLabel = node == 0 ? current.sName : fmt::format( "{} ({}:{})", current.sName, current.sSource, current.lineDefined );
+	if ( width > 30.f )
+	{
+		const ImVec4 clip{ min.x, min.y, max.x, max.y };
+		pDrawList->AddText( nullptr,
+							0.f,
+							ImVec2( min.x + 3.f, min.y + 3.f ),
+							IM_COL32( 255, 255, 255, 255 ),
+							sLabel.c_str(),
+							nullptr,
+							0.f,
+							&clip );
+	}
+
+	if ( ImGui::IsMouseHoveringRect( min, max ) )
+	{
+		ImGui::SetTooltip( "%s\n%llu samples (%llu self)",
+						   sLabel.c_str(),
+						   static_cast<unsigned long long>( current.samples ),
+						   static_cast<unsigned long long>( current.selfSamples ) );
+	}
+
+	float childX{ x };
+	for ( int child : current.children )
+	{
+		const float childWidth = width * static_cast<float>( nodes[ child ].samples ) / static_cast<float>( current.samples );
+		DrawLuaFlameNode( child, childX, childWidth, depth + 1, origin );
+		childX += childWidth;
+	}
+}
+
 ImVec4 ProfilerDisplay::FrameTimeColor( float ms )
 {
 	if ( ms < 8.f )
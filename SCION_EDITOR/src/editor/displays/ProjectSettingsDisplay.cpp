@@ -120,6 +120,7 @@ void ProjectSettingsDisplay::CreateProjectSettings()
 	SettingCategory projectSettings{ .sName = "Project" };
 	projectSettings.subCategories.emplace_back( CreateGeneralSettings( coreGlobals, *pProjectInfo, mainRegistry ) );
 	projectSettings.subCategories.emplace_back( CreatePhysicsSettings( coreGlobals, *pProjectInfo, mainRegistry ) );
+	projectSettings.subCategories.emplace_back( CreateScriptingSettings( coreGlobals, *pProjectInfo, mainRegistry ) );
 	projectSettings.subCategories.emplace_back( CreateGraphicsSettings( coreGlobals, *pProjectInfo, mainRegistry ) );
 	projectSettings.subCategories.emplace_back( CreateAudioSettings( coreGlobals, *pProjectInfo, mainRegistry ) );
 
@@ -345,6 +346,69 @@ ProjectSettingsDisplay::SettingCategory ProjectSettingsDisplay::CreatePhysicsSet
 	};
 }
 
+ProjectSettingsDisplay::SettingCategory ProjectSettingsDisplay::CreateScriptingSettings(
+	Scion::Core::CoreEngineData& coreGlobals, Scion::Core::ProjectInfo& projectInfo,
+	Scion::Core::ECS::MainRegistry& mainRegistry )
+{
+	using namespace Scion::Core::Scripting;
+	return SettingCategory{
+		.sName = "Scripting",
+		.items = {
+			{ "Garbage Collector",
+				[ & ]() {
+					auto gcSettings{ coreGlobals.GetLuaGCSettings() };
+					bool bChanged{ false };
+
+					const std::string sMode{ GetLuaGCModeStr( gcSettings.eMode ) };
+					ImGui::InlineLabel( "Mode" );
+					ImGui::ItemToolTip( "Incremental collects in small steps. Generational collects young objects more often." );
+					if ( ImGui::BeginCombo( "##gcMode", sMode.c_str() ) )
+					{
+						for ( auto eMode : { ELuaGCMode::Incremental, ELuaGCMode::Generational } )
+						{
+							if ( ImGui::Selectable( GetLuaGCModeStr( eMode ).c_str(), eMode == gcSettings.eMode ) )
+							{
+								gcSettings.eMode = eMode;
+								bChanged = true;
+							}
+						}
+
+						ImGui::EndCombo();
+					}
+
+					ImGui::TextDisabled( "Values of 0 keep lua's defaults." );
+					if ( gcSettings.eMode == ELuaGCMode::Incremental )
+					{
+						ImGui::InlineLabel( "Pause" );
+						bChanged |= ImGui::InputInt( "##gcPause", &gcSettings.pause );
+						ImGui::InlineLabel( "Step Multiplier" );
+						bChanged |= ImGui::InputInt( "##gcStepMultiplier", &gcSettings.stepMultiplier );
+						ImGui::InlineLabel( "Step Size" );
+						bChanged |= ImGui::InputInt( "##gcStepSize", &gcSettings.stepSize );
+					}
+					else
+					{
+						ImGui::InlineLabel( "Minor Multiplier" );
+						bChanged |= ImGui::InputInt( "##gcMinorMultiplier", &gcSettings.minorMultiplier );
+						ImGui::InlineLabel( "Major Multiplier" );
+						bChanged |= ImGui::InputInt( "##gcMajorMultiplier", &gcSettings.majorMultiplier );
+					}
+
+					ImGui::InlineLabel( "Idle Budget ms" );
+					ImGui::ItemToolTip( "The most time spent collecting garbage in the spare time of a frame." );
+					bChanged |= ImGui::InputFloat( "##idleGCBudget", &gcSettings.idleBudgetMs, 0.f, 0.f, "%.2f" );
+
+					if ( bChanged )
+					{
+						gcSettings.idleBudgetMs = std::max( gcSettings.idleBudgetMs, 0.f );
+						coreGlobals.SetLuaGCSettings( gcSettings );
+					}
+				}
+			},
+		}
+	};
+}
+
 ProjectSettingsDisplay::SettingCategory ProjectSettingsDisplay::CreateGraphicsSettings(
 	Scion::Core::CoreEngineData& coreGlobals, Scion::Core::ProjectInfo& projectInfo,
 	Scion::Core::ECS::MainRegistry& mainRegistry )
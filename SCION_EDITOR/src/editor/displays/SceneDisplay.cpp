@@ -9,6 +9,11 @@
 #include "Core/Systems/RenderUISystem.h"
 #include "Core/Systems/RenderShapeSystem.h"
 #include "Core/Systems/PhysicsSystem.h"
+#include "Core/Systems/SpatialQuerySystem.h"
+#include "Core/Systems/TileColliderSystem.h"
+#include "Core/Systems/NavigationSystem.h"
+#include "Core/Systems/TweenSystem.h"
+#include "Core/Systems/ParticleSystem.h"
 #include "Core/Systems/ScriptingSystem.h"
 #include "Core/CoreUtilities/CoreEngineData.h"
 
@@ -17,10 +22,16 @@
 
 #include "Core/Scripting/CrashLoggerTestBindings.h"
 #include "Core/Scripting/ScriptingUtilities.h"
+#include "Core/Scripting/LuaAllocator.h"
+#include "Core/Scripting/LuaTaskScheduler.h"
+#include "Core/Scripting/LuaWorkerPool.h"
+#include "Core/Scripting/LazyLuaBindings.h"
+#include "Core/Profiling/LuaProfiler.h"
 
 #include "Physics/Box2DWrappers.h"
 #include "Physics/ContactListener.h"
 #include "Core/Resources/AssetManager.h"
+#include "Core/Resources/AsyncAssetLoader.h"
 
 #include "editor/utilities/EditorFramebuffers.h"
 #include "editor/utilities/EditorUtilities.h"
@@ -82,13 +93,16 @@ void SceneDisplay::LoadScene()
 		runtimeRegistry.AddToContext<std::shared_ptr<ScriptingSystem>>( std::make_shared<ScriptingSystem>() );
 	runtimeRegistry.AddToContext<std::shared_ptr<MouseGuiInfo>>( std::make_shared<MouseGuiInfo>() );
 
-	auto lua = runtimeRegistry.AddToContext<std::shared_ptr<sol::state>>( std::make_shared<sol::state>() );
+	auto lua = runtimeRegistry.AddToContext<std::shared_ptr<sol::state>>( Scion::Core::Scripting::CreateLuaState() );
 
 	if ( !lua )
 	{
-		lua = std::make_shared<sol::state>();
+		lua = Scion::Core::Scripting::CreateLuaState();
 	}
 
+	Scion::Core::Scripting::ApplyGCSettings( lua->lua_state(), CORE_GLOBALS().GetLuaGCSettings() );
+	LUA_PROFILER().Attach( lua->lua_state() );
+
 	lua->open_libraries( sol::lib::base,
 						 sol::lib::math,
 						 sol::lib::os,
@@ -107,6 +121,15 @@ void SceneDisplay::LoadScene()
 
 	EditorSceneManager::CreateSceneManagerLuaBind( *lua );
 
+	// Static tiles are merged into shared bodies first, those tiles are skipped below.
+	auto pTileColliders = runtimeRegistry.AddToContext<std::shared_ptr<Scion::Core::Systems::TileColliderSystem>>(
+		std::make_shared<Scion::Core::Systems::TileColliderSystem>() );
+
+	if ( CORE_GLOBALS().IsTileColliderMergingEnabled() )
+	{
+		pTileColliders->MergeTileColliders( runtimeRegistry, pPhysicsWorld, pCamera->GetWidth(), pCamera->GetHeight() );
+	}
+
 	// We need to initialize all of the physics entities
 	auto physicsEntities = runtimeRegistry.GetRegistry().view<PhysicsComponent>();
 	for ( auto entity : physicsEntities )
@@ -123,6 +146,11 @@ void SceneDisplay::LoadScene()
 		}
 
 		auto& physics = ent.GetComponent<PhysicsComponent>();
+
+		// Merged tiles already share a body.
+		if ( physics.GetBody() )
+			continue;
+
 		auto& physicsAttributes = physics.GetChangableAttributes();
 
 		if ( bBoxCollider )
@@ -191,6 +219,7 @@ void SceneDisplay::UnloadScene()
 {
 	EVENT_DISPATCHER().ClearHandlers<Scion::Core::Events::GamepadConnectEvent>();
 	EVENT_DISPATCHER().ClearHandlers<Scion::Core::Events::LuaEvent>();
+	EVENT_DISPATCHER().ClearLuaBatchHandlers();
 
 	m_bPlayScene = false;
 	m_bSceneLoaded = false;
@@ -202,15 +231,24 @@ void SceneDisplay::UnloadScene()
 
 	runtimeRegistry.ClearRegistry();
 	runtimeRegistry.RemoveContext<std::shared_ptr<Camera2D>>();
+	runtimeRegistry.RemoveContext<std::shared_ptr<Scion::Core::Systems::TileColliderSystem>>();
+	runtimeRegistry.RemoveContext<std::shared_ptr<Scion::Core::Systems::NavigationSystem>>();
+	runtimeRegistry.RemoveContext<std::shared_ptr<Scion::Core::Systems::TweenSystem>>();
 	runtimeRegistry.RemoveContext<Scion::Physics::PhysicsWorld>();
 	runtimeRegistry.RemoveContext<std::shared_ptr<Scion::Physics::ContactListener>>();
 	runtimeRegistry.RemoveContext<std::shared_ptr<ScriptingSystem>>();
 	runtimeRegistry.RemoveContext<std::shared_ptr<Scion::Core::Events::EventDispatcher>>();
 	runtimeRegistry.RemoveContext<MainScriptPtr>();
+	runtimeRegistry.RemoveContext<std::shared_ptr<Scion::Core::Scripting::LuaTaskScheduler>>();
+	runtimeRegistry.RemoveContext<std::shared_ptr<Scion::Core::Scripting::LuaWorkerPool>>();
+	runtimeRegistry.RemoveContext<std::shared_ptr<SCION_RESOURCES::AsyncAssetLoader>>();
+	runtimeRegistry.RemoveContext<std::shared_ptr<Scion::Core::Scripting::LazyLuaBindings>>();
+	LUA_PROFILER().Detach();
 	runtimeRegistry.RemoveContext<std::shared_ptr<sol::state>>();
 
 	auto& mainRegistry = MAIN_REGISTRY();
 	mainRegistry.GetAudioPlayer().StopAllTracks();
+	mainRegistry.GetParticleSystem().Clear();
 }
 
 void SceneDisplay::RenderScene() const
@@ -237,6 +275,7 @@ void SceneDisplay::RenderScene() const
 		auto& runtimeRegistry = pCurrentScene->GetRuntimeRegistry();
 		auto& camera = runtimeRegistry.GetContext<std::shared_ptr<Camera2D>>();
 		renderSystem.Update( runtimeRegistry, *camera );
+		mainRegistry.GetParticleSystem().Render( runtimeRegistry, *camera );
 
 		if ( CORE_GLOBALS().RenderCollidersEnabled() )
 		{
@@ -413,10 +452,20 @@ void SceneDisplay::Update()
 	double dt = coreGlobals.GetDeltaTime();
 	coreGlobals.UpdateDeltaTime();
 
-	// Clamp delta time to the target frame rate
+	auto& scriptSystem = runtimeRegistry.GetContext<std::shared_ptr<Scion::Core::Systems::ScriptingSystem>>();
+
+	// Clamp delta time to the target frame rate. Part of the spare time goes to the lua garbage collector.
 	if ( dt < TARGET_FRAME_TIME )
 	{
-		std::this_thread::sleep_for( std::chrono::duration<double>( TARGET_FRAME_TIME - dt ) );
+		const auto idleTime = std::chrono::duration<double>( TARGET_FRAME_TIME - dt );
+		const auto idleEnd = std::chrono::steady_clock::now() + idleTime;
+
+		scriptSystem->CollectGarbage( runtimeRegistry, idleTime.count() * 1000.0 );
+		std::this_thread::sleep_until( idleEnd );
+	}
+	else
+	{
+		scriptSystem->CollectGarbage( runtimeRegistry, 0.0 );
 	}
 
 	auto& camera = runtimeRegistry.GetContext<std::shared_ptr<Scion::Rendering::Camera2D>>();
@@ -428,7 +477,6 @@ void SceneDisplay::Update()
 
 	camera->Update();
 
-	auto& scriptSystem = runtimeRegistry.GetContext<std::shared_ptr<Scion::Core::Systems::ScriptingSystem>>();
 	scriptSystem->Update( runtimeRegistry );
 
 	if ( coreGlobals.IsPhysicsEnabled() )
@@ -438,39 +486,27 @@ void SceneDisplay::Update()
 			TARGET_FRAME_TIME_F, coreGlobals.GetVelocityIterations(), coreGlobals.GetPositionIterations() );
 		pPhysicsWorld->ClearForces();
 
-		auto& dispatch = runtimeRegistry.GetContext<std::shared_ptr<Scion::Core::Events::EventDispatcher>>();
-
-		// If there are no listeners for contact events, don't emit event
-		if ( dispatch->HasHandlers<Scion::Core::Events::ContactEvent>() )
-		{
-			if ( auto& pContactListener = runtimeRegistry.GetContext<std::shared_ptr<ContactListener>>() )
-			{
-				auto pUserDataA = pContactListener->GetUserDataA();
-				auto pUserDataB = pContactListener->GetUserDataB();
-
-				// Only emit contact event if both contacts are valid
-				if ( pUserDataA && pUserDataB )
-				{
-					try
-					{
-						auto ObjectA = std::any_cast<ObjectData>( pUserDataA->userData );
-						auto ObjectB = std::any_cast<ObjectData>( pUserDataB->userData );
-
-						dispatch->EmitEvent(
-							Scion::Core::Events::ContactEvent{ .objectA = ObjectA, .objectB = ObjectB } );
-					}
-					catch ( const std::bad_any_cast& e )
-					{
-						SCION_ERROR( "Failed to cast to object data - {}", e.what() );
-					}
-				}
-			}
-		}
+		mainRegistry.GetPhysicsSystem().DispatchContacts( runtimeRegistry );
 	}
 
 	auto& pPhysicsSystem = mainRegistry.GetPhysicsSystem();
 	pPhysicsSystem.Update( runtimeRegistry );
 
+	mainRegistry.GetSpatialQuerySystem().Update( runtimeRegistry );
+
+	if ( auto* pNavigation =
+			 runtimeRegistry.TryGetContext<std::shared_ptr<Scion::Core::Systems::NavigationSystem>>() )
+	{
+		( *pNavigation )->Update( runtimeRegistry );
+	}
+
+	if ( auto* pTweens = runtimeRegistry.TryGetContext<std::shared_ptr<Scion::Core::Systems::TweenSystem>>() )
+	{
+		( *pTweens )->Update( runtimeRegistry, coreGlobals.GetDeltaTime() );
+	}
+
+	mainRegistry.GetParticleSystem().Update( runtimeRegistry, coreGlobals.GetDeltaTime() );
+
 	auto& animationSystem = mainRegistry.GetAnimationSystem();
 	animationSystem.Update( runtimeRegistry, *camera );
 
@@ -8,6 +8,7 @@
 #include "ScionFilesystem/Serializers/LuaSerializer.h"
 #include "ScionFilesystem/Utilities/DirectoryWatcher.h"
 #include "ScionFilesystem/Utilities/FilesystemUtilities.h"
+#include "ScionFilesystem/Utilities/AsyncFileWriter.h"
 
 #include "editor/utilities/fonts/IconsFontAwesome5.h"
 #include "editor/utilities/EditorState.h"
@@ -291,7 +292,18 @@ void ScriptDisplay::WriteScriptListToFile()
 		pSerializer->AddValue( script, true, false, false, true );
 	}
 
-	pSerializer->EndTable().FinishStream();
+	pSerializer->EndTable();
+
+	auto* pFileWriter = MAIN_REGISTRY().TryGetContext<std::shared_ptr<AsyncFileWriter>>();
+	if ( pFileWriter && *pFileWriter )
+	{
+		pSerializer->FinishStream( **pFileWriter );
+	}
+	else
+	{
+		pSerializer->FinishStream();
+	}
+
 	m_bScriptsChanged = false;
 }
 
@@ -299,6 +299,11 @@ bool ProjectLoader::LoadProject( const std::string& sFilepath )
 				SCION_ERROR( "Failed to load texture [{}] at path [{}]", sTextureName, texturePath.string() );
 				// Should we stop loading or finish??
 			}
+			else if ( jsonTexture.HasMember( "bAtlasable" ) )
+			{
+				if ( auto pTexture = assetManager.GetTexture( sTextureName ) )
+					pTexture->SetIsAtlasable( jsonTexture[ "bAtlasable" ].GetBool() );
+			}
 		}
 	}
 
@@ -461,6 +466,20 @@ bool ProjectLoader::LoadProject( const std::string& sFilepath )
 		coreGlobals.SetPositionIterations( physics[ "positionIterations" ].GetInt() );
 	}
 
+	if ( projectData.HasMember( "scripting" ) )
+	{
+		const rapidjson::Value& scripting = projectData[ "scripting" ];
+		Scion::Core::Scripting::LuaGCSettings gcSettings{};
+		gcSettings.eMode = Scion::Core::Scripting::GetLuaGCModeFromStr( scripting[ "gcMode" ].GetString() );
+		gcSettings.pause = scripting[ "gcPause" ].GetInt();
+		gcSettings.stepMultiplier = scripting[ "gcStepMultiplier" ].GetInt();
+		gcSettings.stepSize = scripting[ "gcStepSize" ].GetInt();
+		gcSettings.minorMultiplier = scripting[ "gcMinorMultiplier" ].GetInt();
+		gcSettings.majorMultiplier = scripting[ "gcMajorMultiplier" ].GetInt();
+		gcSettings.idleBudgetMs = scripting[ "idleGCBudgetMs" ].GetFloat();
+		coreGlobals.SetLuaGCSettings( gcSettings );
+	}
+
 	if (projectData.HasMember("audio_config"))
 	{
 		auto& audioConfig = pProjectInfo->GetAudioConfig();
@@ -505,6 +524,8 @@ bool ProjectLoader::LoadProject( const std::string& sFilepath )
 		return false;
 	}
 
+	SCENE_MANAGER().SetAutosaveInterval( pEditorState->autosaveInterval );
+
 	return true;
 }
 
@@ -585,6 +606,7 @@ bool ProjectLoader::SaveLoadedProject( const Scion::Core::ProjectInfo& projectIn
 			.AddKeyValuePair( "path", sTexturePath )
 			.AddKeyValuePair( "bPixelArt", pTexture->GetType() == Scion::Rendering::Texture::TextureType::PIXEL )
 			.AddKeyValuePair( "bTilemap", pTexture->IsTileset() )
+			.AddKeyValuePair( "bAtlasable", pTexture->IsAtlasable() )
 			.EndObject();
 	}
 	pSerializer->EndArray(); // Textures
@@ -664,6 +686,17 @@ bool ProjectLoader::SaveLoadedProject( const Scion::Core::ProjectInfo& projectIn
 		.AddKeyValuePair( "positionIterations", coreGlobals.GetPositionIterations() )
 		.EndObject(); // Physics
 
+	const auto& gcSettings = coreGlobals.GetLuaGCSettings();
+	pSerializer->StartNewObject( "scripting" )
+		.AddKeyValuePair( "gcMode", Scion::Core::Scripting::GetLuaGCModeStr( gcSettings.eMode ) )
+		.AddKeyValuePair( "gcPause", gcSettings.pause )
+		.AddKeyValuePair( "gcStepMultiplier", gcSettings.stepMultiplier )
+		.AddKeyValuePair( "gcStepSize", gcSettings.stepSize )
+		.AddKeyValuePair( "gcMinorMultiplier", gcSettings.minorMultiplier )
+		.AddKeyValuePair( "gcMajorMultiplier", gcSettings.majorMultiplier )
+		.AddKeyValuePair( "idleGCBudgetMs", gcSettings.idleBudgetMs )
+		.EndObject(); // Scripting
+
 	const auto& audioConfig = projectInfo.GetAudioConfig();
 
 	pSerializer->StartNewObject( "audio_config" )
@@ -16,6 +16,8 @@ namespace Scion::Editor
 AssetPackager::AssetPackager( const AssetPackagerParams& params, std::shared_ptr<Scion::Utilities::ThreadPool> pThreadPool )
 	: m_Params{ params }
 	, m_pThreadPool{ pThreadPool }
+	, m_AtlasedTextures{}
+	, m_AtlasPages{}
 {
 }
 
@@ -133,6 +135,11 @@ void AssetPackager::CreateLuaAssetFiles( const std::string& sProjectPath, const
 			"Failed to create lua asset files. Content path [{}] does not exist or is invalid.", sContentPath ) );
 	}
 
+	if ( m_Params.bBakeTextureAtlases )
+	{
+		BakeTextureAtlases( assets, tempAssetPath, sContentPath );
+	}
+
 	std::vector<std::future<AssetPackageStatus>> assetFutures;
 	assetFutures.emplace_back( m_pThreadPool->Enqueue( [ & ] {
 		return SerializeAssetsByType( assets, tempAssetPath, "textures", sContentPath, Scion::Utilities::AssetType::TEXTURE );
@@ -176,6 +183,67 @@ void AssetPackager::CreateLuaAssetFiles( const std::string& sProjectPath, const
 	}
 }
 
+void AssetPackager::BakeTextureAtlases( const rapidjson::Value& assets, const std::filesystem::path& tempAssetsPath,
+										const std::string& sContentPath )
+{
+	m_AtlasedTextures.clear();
+	m_AtlasPages.clear();
+
+	if ( !assets.HasMember( "textures" ) || !assets[ "textures" ].IsArray() )
+		return;
+
+	std::vector<AtlasTextureEntry> textures;
+	for ( const auto& jsonValue : assets[ "textures" ].GetArray() )
+	{
+		// Only textures flagged as atlasable are packed, the rest are packaged on their own.
+		if ( !jsonValue.HasMember( "bAtlasable" ) || !jsonValue[ "bAtlasable" ].GetBool() )
+			continue;
+
+		textures.push_back( AtlasTextureEntry{
+			.sTextureName = jsonValue[ "name" ].GetString(),
+			.sFilepath = sContentPath + PATH_SEPARATOR + jsonValue[ "path" ].GetString(),
+			.bPixelArt = jsonValue.HasMember( "bPixelArt" ) ? jsonValue[ "bPixelArt" ].GetBool() : true } );
+	}
+
+	if ( textures.empty() )
+		return;
+
+	TextureAtlasBaker atlasBaker{ m_Params.atlasParams };
+	if ( !atlasBaker.Bake( textures, ( fs::path{ m_Params.sTempFilepath } / "atlases" ).string() ) )
+	{
+		// Nothing has been excluded yet, so every texture is still packaged on its own.
+		SCION_ERROR( "Failed to bake texture atlases. Packaging textures individually." );
+		return;
+	}
+
+	const auto& regions = atlasBaker.GetRegions();
+	if ( regions.empty() )
+		return;
+
+	LuaSerializer luaSerializer{ ( tempAssetsPath / "atlases.s2dasset" ).string() };
+	luaSerializer.StartNewTable( "S2D_AtlasRegions" );
+
+	for ( const auto& region : regions )
+	{
+		luaSerializer.StartNewTable()
+			.AddKeyValuePair( "textureName", region.sTextureName, true, false, false, true )
+			.AddKeyValuePair( "atlasName", region.sAtlasName, true, false, false, true )
+			.AddKeyValuePair( "x", region.x )
+			.AddKeyValuePair( "y", region.y )
+			.AddKeyValuePair( "width", region.width )
+			.AddKeyValuePair( "height", region.height )
+			.EndTable();
+
+		m_AtlasedTextures.insert( region.sTextureName );
+	}
+
+	luaSerializer.EndTable(); // S2D_AtlasRegions
+
+	m_AtlasPages = atlasBaker.GetPages();
+
+	SCION_LOG( "Baked [{}] textures into [{}] atlas pages.", regions.size(), m_AtlasPages.size() );
+}
+
 bool AssetPackager::CompileLuaAssetFiles()
 {
 	ScriptCompiler scriptCompiler{};
@@ -250,6 +318,17 @@ bool AssetPackager::CreateAssetsZip()
 		}
 	}
 
+	const std::string atlasesPath{ fmt::format( "{}{}{}", m_Params.sTempFilepath, PATH_SEPARATOR, "atlases.luac" ) };
+	if ( fs::exists( atlasesPath ) )
+	{
+		if ( !zip.addFile( fmt::format( "{}{}{}", "ScionAssets", PATH_SEPARATOR, "atlases.luac" ), atlasesPath ) )
+		{
+			SCION_ERROR( "Failed to add atlases.luac to zip." );
+			zip.close();
+			return false;
+		}
+	}
+
 	const std::string musicPath{ fmt::format( "{}{}{}", m_Params.sTempFilepath, PATH_SEPARATOR, "music.luac" ) };
 	if ( fs::exists( musicPath ) )
 	{
@@ -325,6 +404,13 @@ AssetPackager::AssetPackageStatus AssetPackager::SerializeAssetsByType( const ra
 		{
 			for ( const auto& jsonValue : assetArray.GetArray() )
 			{
+				// Atlased textures are packaged as part of their atlas page.
+				if ( eAssetType == Scion::Utilities::AssetType::TEXTURE &&
+					 m_AtlasedTextures.contains( jsonValue[ "name" ].GetString() ) )
+				{
+					continue;
+				}
+
 				std::string sPath{ sContentPath + PATH_SEPARATOR + jsonValue[ "path" ].GetString() };
 
 				AssetConversionData conversionData{
@@ -341,6 +427,18 @@ AssetPackager::AssetPackageStatus AssetPackager::SerializeAssetsByType( const ra
 
 				ConvertAssetToLuaTable( *pLuaSerializer, conversionData);
 			}
+
+			if ( eAssetType == Scion::Utilities::AssetType::TEXTURE )
+			{
+				for ( const auto& atlasPage : m_AtlasPages )
+				{
+					ConvertAssetToLuaTable( *pLuaSerializer,
+											AssetConversionData{ .sInAssetFile = atlasPage.sFilepath,
+																 .sAssetName = atlasPage.sAtlasName,
+																 .eType = eAssetType,
+																 .optPixelArt = atlasPage.bPixelArt } );
+				}
+			}
 		}
 		catch ( const std::exception& ex )
 		{
@@ -4,11 +4,14 @@
 #include "editor/packaging/AssetPackager.h"
 
 #include "editor/scene/SceneObject.h"
+#include "editor/events/EditorEventTypes.h"
 #include "ScionFilesystem/Serializers/LuaSerializer.h"
 #include "ScionUtilities/HelperUtilities.h"
 #include "ScionUtilities/ThreadPool.h"
 
 #include "Core/CoreUtilities/ProjectInfo.h"
+#include "Core/Loaders/LevelStreamer.h"
+#include "Core/ECS/MainRegistry.h"
 #include "Logger/Logger.h"
 #include <rapidjson/error/en.h>
 
@@ -66,6 +69,7 @@ Packager::Packager( std::unique_ptr<PackageData> pData, std::shared_ptr<Scion::U
 	: m_pPackageData{ std::move( pData ) }
 	, m_bPackaging{ false }
 	, m_bHasError{ false }
+	, m_pProgressChannel{ &EVENT_DISPATCHER().GetChannel<Events::PackagingProgressEvent>( 64 ) }
 	, m_pThreadPool{ pThreadPool }
 {
 	m_PackageThread = std::thread( [ this ] { RunPackager(); } );
@@ -85,12 +89,6 @@ bool Packager::HasError() const
 {
 	return m_bHasError;
 }
-PackagingProgress Packager::GetProgress() const
-{
-	std::shared_lock lock( m_ProgressMutex );
-	return m_Progress;
-}
-
 void Packager::FinishPackaging()
 {
 	// Delete temp files
@@ -269,7 +267,10 @@ void Packager::RunPackager()
 			AssetPackagerParams assetPackagerParams{
 				.sTempFilepath = m_pPackageData->sTempDataPath,
 				.sDestinationPath = m_pPackageData->sFinalDestination + PATH_SEPARATOR + "assets",
-				.sProjectPath = m_pPackageData->pProjectInfo->GetProjectPath().string() };
+				.sProjectPath = m_pPackageData->pProjectInfo->GetProjectPath().string(),
+				.bBakeTextureAtlases = m_pPackageData->pGameConfig->bBakeTextureAtlases,
+				.atlasParams = AtlasBakerParams{ .maxAtlasSize = m_pPackageData->pGameConfig->atlasMaxSize,
+												 .padding = m_pPackageData->pGameConfig->atlasPadding } };
 
 			AssetPackager assetPackager{ assetPackagerParams, m_pThreadPool };
 
@@ -400,9 +401,8 @@ void Packager::RunPackager()
 
 void Packager::UpdateProgress( float percent, std::string_view message )
 {
-	std::lock_guard lock( m_ProgressMutex );
-	m_Progress.percent = percent;
-	m_Progress.sMessage = message;
+	// A dropped update is replaced by the next one, the display only shows the latest.
+	m_pProgressChannel->Send( Events::PackagingProgressEvent{ .percent = percent, .sMessage = std::string{ message } } );
 }
 
 std::string Packager::CreateConfigFile( const std::string& sTempFilepath )
@@ -430,6 +430,10 @@ std::string Packager::CreateConfigFile( const std::string& sTempFilepath )
 		.AddKeyValuePair( "GameName", m_pPackageData->pGameConfig->sGameName, true, false, false, true )
 		.AddKeyValuePair( "StartupScene", m_pPackageData->pGameConfig->sStartupScene, true, false, false, true )
 		.AddKeyValuePair( "bPackageAssets", m_pPackageData->pGameConfig->bPackageAssets ? "true" : "false" )
+		.StartNewTable( "StreamingParams" )
+		.AddKeyValuePair( "bEnabled", m_pPackageData->pGameConfig->bStreamLevels ? "true" : "false" )
+		.AddKeyValuePair( "cellSize", m_pPackageData->pGameConfig->streamCellSize )
+		.EndTable() // StreamingParams
 		.StartNewTable( "WindowParams" )
 		.AddKeyValuePair( "width", m_pPackageData->pGameConfig->windowWidth )
 		.AddKeyValuePair( "height", m_pPackageData->pGameConfig->windowHeight )
@@ -441,6 +445,20 @@ std::string Packager::CreateConfigFile( const std::string& sTempFilepath )
 		.AddKeyValuePair( "velocityIterations", m_pPackageData->pGameConfig->velocityIterations )
 		.AddKeyValuePair( "gravity", m_pPackageData->pGameConfig->gravity )
 		.EndTable() // PhysicsParams
+		.StartNewTable( "ScriptingParams" )
+		.AddKeyValuePair( "gcMode",
+						  Scion::Core::Scripting::GetLuaGCModeStr( m_pPackageData->pGameConfig->luaGCSettings.eMode ),
+						  true,
+						  false,
+						  false,
+						  true )
+		.AddKeyValuePair( "gcPause", m_pPackageData->pGameConfig->luaGCSettings.pause )
+		.AddKeyValuePair( "gcStepMultiplier", m_pPackageData->pGameConfig->luaGCSettings.stepMultiplier )
+		.AddKeyValuePair( "gcStepSize", m_pPackageData->pGameConfig->luaGCSettings.stepSize )
+		.AddKeyValuePair( "gcMinorMultiplier", m_pPackageData->pGameConfig->luaGCSettings.minorMultiplier )
+		.AddKeyValuePair( "gcMajorMultiplier", m_pPackageData->pGameConfig->luaGCSettings.majorMultiplier )
+		.AddKeyValuePair( "idleGCBudgetMs", m_pPackageData->pGameConfig->luaGCSettings.idleBudgetMs )
+		.EndTable() // ScriptingParams
 		.StartNewTable( "AudioParams" )
 		.AddKeyValuePair( "bGlobalEnabled", m_pPackageData->pGameConfig->audioConfig.bGlobalOverrideEnabled )
 		.AddKeyValuePair( "globalVolume", m_pPackageData->pGameConfig->audioConfig.globalVolumeOverride )
@@ -672,6 +690,20 @@ std::vector<std::string> Packager::CreateSceneFiles( const std::string& sTempFil
 		sceneFiles.push_back( sceneExportFiles.sTilemapFile);
 		sceneFiles.push_back( sceneExportFiles.sObjectFile);
 		sceneFiles.push_back( sceneExportFiles.sDataFile);
+
+		// The registry still holds the exported scene, partition it for the level streamer.
+		if ( m_pPackageData->pGameConfig->bStreamLevels )
+		{
+			fs::path cellsPath{ sTempFilepath };
+			cellsPath /= sSceneName + "_cells";
+
+			if ( !Scion::Core::Loaders::LevelStreamer::ExportCells(
+					 registry, cellsPath.string(), m_pPackageData->pGameConfig->streamCellSize ) )
+			{
+				SCION_ERROR( "Failed to create level cells for scene [{}]", sSceneName );
+				return {};
+			}
+		}
 	}
 
 	return sceneFiles;
@@ -749,6 +781,27 @@ void Packager::CopyFilesToDestination()
 			}
 		}
 
+		// Copy the streamed level cells
+		if ( m_pPackageData->pGameConfig->bStreamLevels && fs::exists( tempDataPath ) )
+		{
+			fs::path levelsPath{ destination / "assets" / "levels" };
+			if ( !fs::exists( levelsPath ) )
+			{
+				fs::create_directories( levelsPath );
+			}
+
+			for ( const auto& entry : fs::directory_iterator( tempDataPath ) )
+			{
+				if ( entry.is_directory() && entry.path().filename().string().ends_with( "_cells" ) )
+				{
+					fs::copy( entry.path(),
+							  levelsPath / entry.path().filename(),
+							  fs::copy_options::recursive | fs::copy_options::overwrite_existing );
+					SCION_LOG( "Copied level cells [{}] to [{}]", entry.path().filename().string(), levelsPath.string() );
+				}
+			}
+		}
+
 		// Replace the SCION_ENGINE.exe name with the game name and change the icon if available.
 		for ( const auto& entry : fs::directory_iterator( destination ) )
 		{
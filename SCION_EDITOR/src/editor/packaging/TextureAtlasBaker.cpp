@@ -0,0 +1,365 @@
+#include "editor/packaging/TextureAtlasBaker.h"
+#include "Logger/Logger.h"
+
+#include <SOIL2/SOIL2.h>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+constexpr int ATLAS_CHANNELS = 4;
+
+struct PackRect
+{
+	int x{ 0 };
+	int y{ 0 };
+	int width{ 0 };
+	int height{ 0 };
+
+	bool Contains( const PackRect& other ) const
+	{
+		return other.x >= x && other.y >= y && other.x + other.width <= x + width &&
+			   other.y + other.height <= y + height;
+	}
+
+	bool Intersects( const PackRect& other ) const
+	{
+		return other.x < x + width && other.x + other.width > x && other.y < y + height &&
+			   other.y + other.height > y;
+	}
+};
+
+/*
+ * A single MaxRects bin. Keeps a list of maximal free rectangles that may overlap each other.
+ * Every placement splits the free rectangles it touches and removes any that become contained
+ * in another, so the list always describes every spot a new rect could go.
+ */
+class MaxRectsBin
+{
+  public:
+	MaxRectsBin( int width, int height )
+		: m_FreeRects{ PackRect{ .width = width, .height = height } }
+	{
+	}
+
+	std::optional<PackRect> Insert( int width, int height )
+	{
+		std::optional<PackRect> bestRect{ std::nullopt };
+		int bestShortSide{ std::numeric_limits<int>::max() };
+		int bestLongSide{ std::numeric_limits<int>::max() };
+
+		for ( const auto& freeRect : m_FreeRects )
+		{
+			if ( freeRect.width < width || freeRect.height < height )
+				continue;
+
+			const int leftoverX = freeRect.width - width;
+			const int leftoverY = freeRect.height - height;
+			const int shortSide = std::min( leftoverX, leftoverY );
+			const int longSide = std::max( leftoverX, leftoverY );
+
+			if ( shortSide < bestShortSide || ( shortSide == bestShortSide && longSide < bestLongSide ) )
+			{
+				bestRect = PackRect{ .x = freeRect.x, .y = freeRect.y, .width = width, .height = height };
+				bestShortSide = shortSide;
+				bestLongSide = longSide;
+			}
+		}
+
+		if ( !bestRect )
+			return std::nullopt;
+
+		std::vector<PackRect> splitRects;
+		std::erase_if( m_FreeRects, [ & ]( const PackRect& freeRect ) {
+			return SplitFreeRect( freeRect, *bestRect, splitRects );
+		} );
+
+		std::ranges::move( splitRects, std::back_inserter( m_FreeRects ) );
+		PruneFreeRects();
+
+		return bestRect;
+	}
+
+  private:
+	static bool SplitFreeRect( const PackRect& freeRect, const PackRect& usedRect, std::vector<PackRect>& outRects )
+	{
+		if ( !freeRect.Intersects( usedRect ) )
+			return false;
+
+		// Space above and below the used rect.
+		if ( usedRect.x < freeRect.x + freeRect.width && usedRect.x + usedRect.width > freeRect.x )
+		{
+			if ( usedRect.y > freeRect.y )
+			{
+				outRects.push_back( PackRect{
+					.x = freeRect.x, .y = freeRect.y, .width = freeRect.width, .height = usedRect.y - freeRect.y } );
+			}
+
+			if ( usedRect.y + usedRect.height < freeRect.y + freeRect.height )
+			{
+				outRects.push_back(
+					PackRect{ .x = freeRect.x,
+							  .y = usedRect.y + usedRect.height,
+							  .width = freeRect.width,
+							  .height = freeRect.y + freeRect.height - ( usedRect.y + usedRect.height ) } );
+			}
+		}
+
+		// Space to the left and right of the used rect.
+		if ( usedRect.y < freeRect.y + freeRect.height && usedRect.y + usedRect.height > freeRect.y )
+		{
+			if ( usedRect.x > freeRect.x )
+			{
+				outRects.push_back( PackRect{
+					.x = freeRect.x, .y = freeRect.y, .width = usedRect.x - freeRect.x, .height = freeRect.height } );
+			}
+
+			if ( usedRect.x + usedRect.width < freeRect.x + freeRect.width )
+			{
+				outRects.push_back( PackRect{ .x = usedRect.x + usedRect.width,
+											  .y = freeRect.y,
+											  .width = freeRect.x + freeRect.width - ( usedRect.x + usedRect.width ),
+											  .height = freeRect.height } );
+			}
+		}
+
+		return true;
+	}
+
+	void PruneFreeRects()
+	{
+		for ( size_t i = 0; i < m_FreeRects.size(); ++i )
+		{
+			for ( size_t j = i + 1; j < m_FreeRects.size(); )
+			{
+				if ( m_FreeRects[ i ].Contains( m_FreeRects[ j ] ) )
+				{
+					m_FreeRects.erase( m_FreeRects.begin() + j );
+				}
+				else if ( m_FreeRects[ j ].Contains( m_FreeRects[ i ] ) )
+				{
+					m_FreeRects.erase( m_FreeRects.begin() + i );
+					--i;
+					break;
+				}
+				else
+				{
+					++j;
+				}
+			}
+		}
+	}
+
+  private:
+	std::vector<PackRect> m_FreeRects;
+};
+
+/*
+ * Copies the image into the page at x, y and repeats its outer pixels extrusion times
+ * around it, so linear filtering at the edges samples the image instead of its neighbours.
+ */
+void BlitExtruded( std::vector<unsigned char>& page, int pageWidth, const unsigned char* pImage, int imageWidth,
+				   int imageHeight, int x, int y, int extrusion )
+{
+	for ( int dy = -extrusion; dy < imageHeight + extrusion; ++dy )
+	{
+		const int srcY = std::clamp( dy, 0, imageHeight - 1 );
+		for ( int dx = -extrusion; dx < imageWidth + extrusion; ++dx )
+		{
+			const int srcX = std::clamp( dx, 0, imageWidth - 1 );
+
+			const unsigned char* pSrc = pImage + static_cast<size_t>( srcY * imageWidth + srcX ) * ATLAS_CHANNELS;
+			unsigned char* pDst =
+				page.data() + ( static_cast<size_t>( y + dy ) * pageWidth + static_cast<size_t>( x + dx ) ) * ATLAS_CHANNELS;
+
+			std::copy_n( pSrc, ATLAS_CHANNELS, pDst );
+		}
+	}
+}
+
+} // namespace
+
+namespace Scion::Editor
+{
+TextureAtlasBaker::TextureAtlasBaker( const AtlasBakerParams& params )
+	: m_Params{ params }
+	, m_Pages{}
+	, m_Regions{}
+	, m_SkippedTextures{}
+{
+	m_Params.maxAtlasSize = std::max( 1, m_Params.maxAtlasSize );
+	m_Params.padding = std::max( 0, m_Params.padding );
+	m_Params.extrusion = std::max( 0, m_Params.extrusion );
+}
+
+TextureAtlasBaker::~TextureAtlasBaker() = default;
+
+bool TextureAtlasBaker::Bake( const std::vector<AtlasTextureEntry>& textures, const std::string& sOutputPath )
+{
+	m_Pages.clear();
+	m_Regions.clear();
+	m_SkippedTextures.clear();
+
+	std::error_code ec;
+	if ( !fs::exists( sOutputPath, ec ) && !fs::create_directories( sOutputPath, ec ) )
+	{
+		SCION_ERROR( "Failed to create atlas output directory [{}] - {}", sOutputPath, ec.message() );
+		return false;
+	}
+
+	const int border = m_Params.extrusion * 2;
+	std::vector<AtlasImage> pixelArtImages;
+	std::vector<AtlasImage> blendedImages;
+
+	for ( const auto& texture : textures )
+	{
+		int width{ 0 }, height{ 0 }, channels{ 0 };
+		unsigned char* pImage =
+			SOIL_load_image( texture.sFilepath.c_str(), &width, &height, &channels, SOIL_LOAD_RGBA );
+
+		if ( !pImage )
+		{
+			SCION_WARN( "Failed to load [{}] for atlas baking. Packaging it on its own.", texture.sFilepath );
+			m_SkippedTextures.push_back( texture.sTextureName );
+			continue;
+		}
+
+		if ( width + border > m_Params.maxAtlasSize || height + border > m_Params.maxAtlasSize )
+		{
+			m_SkippedTextures.push_back( texture.sTextureName );
+			SOIL_free_image_data( pImage );
+			continue;
+		}
+
+		AtlasImage image{ .pEntry = &texture, .width = width, .height = height };
+		image.pixels.assign( pImage, pImage + static_cast<size_t>( width * height * ATLAS_CHANNELS ) );
+		SOIL_free_image_data( pImage );
+
+		( texture.bPixelArt ? pixelArtImages : blendedImages ).push_back( std::move( image ) );
+	}
+
+	return BakeGroup( pixelArtImages, true, sOutputPath ) && BakeGroup( blendedImages, false, sOutputPath );
+}
+
+bool TextureAtlasBaker::BakeGroup( std::vector<AtlasImage>& images, bool bPixelArt, const std::string& sOutputPath )
+{
+	if ( images.empty() )
+		return true;
+
+	// Packing the largest images first leaves the smaller ones to fill in the gaps.
+	std::ranges::sort( images, []( const AtlasImage& a, const AtlasImage& b ) {
+		const int maxA = std::max( a.width, a.height );
+		const int maxB = std::max( b.width, b.height );
+		return maxA != maxB ? maxA > maxB : a.width * a.height > b.width * b.height;
+	} );
+
+	struct PlacedImage
+	{
+		const AtlasImage* pImage{ nullptr };
+		size_t pageIndex{ 0 };
+		PackRect cell{};
+	};
+
+	const int border = m_Params.extrusion * 2;
+	// The trailing padding of a cell may hang off the edge of the page.
+	const int binSize = m_Params.maxAtlasSize + m_Params.padding;
+
+	std::vector<MaxRectsBin> bins;
+	std::vector<PlacedImage> placedImages;
+	placedImages.reserve( images.size() );
+
+	for ( const auto& image : images )
+	{
+		const int cellWidth = image.width + border + m_Params.padding;
+		const int cellHeight = image.height + border + m_Params.padding;
+
+		std::optional<PackRect> optCell{ std::nullopt };
+		size_t pageIndex{ 0 };
+
+		for ( ; pageIndex < bins.size(); ++pageIndex )
+		{
+			if ( optCell = bins[ pageIndex ].Insert( cellWidth, cellHeight ); optCell )
+				break;
+		}
+
+		if ( !optCell )
+		{
+			bins.emplace_back( binSize, binSize );
+			pageIndex = bins.size() - 1;
+			optCell = bins.back().Insert( cellWidth, cellHeight );
+		}
+
+		if ( !optCell )
+		{
+			m_SkippedTextures.push_back( image.pEntry->sTextureName );
+			continue;
+		}
+
+		placedImages.push_back( PlacedImage{ .pImage = &image, .pageIndex = pageIndex, .cell = *optCell } );
+	}
+
+	const size_t firstPage = m_Pages.size();
+	for ( size_t i = 0; i < bins.size(); ++i )
+	{
+		m_Pages.push_back( AtlasPage{ .sAtlasName = fmt::format( "S2D_Atlas_{}", firstPage + i ), .bPixelArt = bPixelArt } );
+	}
+
+	// Trim each page down to the space that was actually used.
+	for ( const auto& placed : placedImages )
+	{
+		auto& page = m_Pages[ firstPage + placed.pageIndex ];
+		page.width = std::max( page.width, placed.cell.x + placed.pImage->width + border );
+		page.height = std::max( page.height, placed.cell.y + placed.pImage->height + border );
+	}
+
+	std::vector<std::vector<unsigned char>> pagePixels( bins.size() );
+	for ( size_t i = 0; i < bins.size(); ++i )
+	{
+		const auto& page = m_Pages[ firstPage + i ];
+		pagePixels[ i ].resize( static_cast<size_t>( page.width * page.height * ATLAS_CHANNELS ), 0 );
+	}
+
+	for ( const auto& placed : placedImages )
+	{
+		const auto& page = m_Pages[ firstPage + placed.pageIndex ];
+		const int x = placed.cell.x + m_Params.extrusion;
+		const int y = placed.cell.y + m_Params.extrusion;
+
+		BlitExtruded( pagePixels[ placed.pageIndex ],
+					  page.width,
+					  placed.pImage->pixels.data(),
+					  placed.pImage->width,
+					  placed.pImage->height,
+					  x,
+					  y,
+					  m_Params.extrusion );
+
+		m_Regions.push_back( AtlasRegion{ .sTextureName = placed.pImage->pEntry->sTextureName,
+										  .sAtlasName = page.sAtlasName,
+										  .x = x,
+										  .y = y,
+										  .width = placed.pImage->width,
+										  .height = placed.pImage->height } );
+	}
+
+	for ( size_t i = 0; i < bins.size(); ++i )
+	{
+		auto& page = m_Pages[ firstPage + i ];
+		page.sFilepath = ( fs::path{ sOutputPath } / ( page.sAtlasName + ".png" ) ).string();
+
+		if ( !SOIL_save_image( page.sFilepath.c_str(),
+							   SOIL_SAVE_TYPE_PNG,
+							   page.width,
+							   page.height,
+							   ATLAS_CHANNELS,
+							   pagePixels[ i ].data() ) )
+		{
+			SCION_ERROR( "Failed to write atlas page [{}].", page.sFilepath );
+			return false;
+		}
+	}
+
+	return true;
+}
+
+} // namespace Scion::Editor
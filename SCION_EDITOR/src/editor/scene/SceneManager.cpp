@@ -10,8 +10,11 @@
 #include "Core/Events/EventDispatcher.h"
 #include "Core/ECS/Components/AllComponents.h"
 #include "Core/ECS/MainRegistry.h"
+#include "Core/Scripting/LuaTaskScheduler.h"
+#include "Core/Resources/AsyncAssetLoader.h"
 #include "Core/CoreUtilities/ProjectInfo.h"
 #include "Core/CoreUtilities/CoreUtilities.h"
+#include "ScionFilesystem/Utilities/AsyncFileWriter.h"
 
 #include "Logger/Logger.h"
 
@@ -196,6 +199,56 @@ void EditorSceneManager::UpdateScenes()
 		Scion::Core::UpdateDirtyEntities( pCurrentScene->GetRegistry() );
 		Scion::Core::UpdateDirtyEntities( pCurrentScene->GetRuntimeRegistry() );
 	}
+
+	UpdateAutosave();
+}
+
+void EditorSceneManager::UpdateAutosave()
+{
+	if ( m_AutosaveIntervalSec <= 0 )
+		return;
+
+	if ( !m_AutosaveTimer.IsRunning() )
+	{
+		m_AutosaveTimer.Start();
+		return;
+	}
+
+	if ( m_AutosaveTimer.ElapsedSec() < m_AutosaveIntervalSec )
+		return;
+
+	m_AutosaveTimer.Stop();
+	m_AutosaveTimer.Start();
+
+	auto pCurrentScene = GetCurrentSceneObject();
+	if ( !pCurrentScene || !pCurrentScene->IsLoaded() )
+		return;
+
+	auto* pFileWriter = MAIN_REGISTRY().TryGetContext<std::shared_ptr<Scion::Filesystem::AsyncFileWriter>>();
+	if ( !pFileWriter || !*pFileWriter )
+		return;
+
+	// Don't pile up snapshots if the last autosave is still being written.
+	if ( !( *pFileWriter )->IsIdle() )
+		return;
+
+	auto& pProjectInfo = MAIN_REGISTRY().GetContext<Scion::Core::ProjectInfoPtr>();
+	auto optEditorConfig = pProjectInfo->TryGetFolderPath( Scion::Core::EProjectFolderType::EditorConfig );
+	if ( !optEditorConfig )
+		return;
+
+	fs::path autosavePath = *optEditorConfig / "autosave" / pCurrentScene->GetSceneName();
+	std::error_code ec;
+	if ( !fs::exists( autosavePath, ec ) && !fs::create_directories( autosavePath, ec ) )
+	{
+		SCION_ERROR( "Failed to autosave scene - Unable to create [{}] - {}", autosavePath.string(), ec.message() );
+		return;
+	}
+
+	if ( !pCurrentScene->SaveSceneAsync( **pFileWriter, autosavePath.string() ) )
+	{
+		SCION_ERROR( "Failed to autosave scene [{}]", pCurrentScene->GetSceneName() );
+	}
 }
 
 std::string EditorSceneManager::GetSceneFilepath( const std::string& sSceneName )
@@ -209,6 +262,8 @@ EditorSceneManager::EditorSceneManager()
 	, m_pToolManager{ nullptr }
 	, m_pCommandManager{ nullptr }
 	, m_pSceneDispatcher{ nullptr }
+	, m_AutosaveTimer{}
+	, m_AutosaveIntervalSec{ 300 }
 {
 }
 
@@ -218,51 +273,72 @@ void EditorSceneManager::CreateSceneManagerLuaBind( sol::state& lua )
 {
 	auto& sceneManager = SCENE_MANAGER();
 
+	// Shared by changeScene and changeSceneAsync, which runs it once the assets of the scene are loaded.
+	auto changeScene = [ &sceneManager ]( const std::string& sSceneName ) {
+		auto pCurrentScene = sceneManager.GetCurrentSceneObject();
+		if ( !pCurrentScene )
+		{
+			SCION_ERROR( "Failed to change to scene [{}] - Current scene is invalid.", sSceneName );
+			return false;
+		}
+
+		auto* pRuntimeData = pCurrentScene->GetRuntimeData();
+		SCION_ASSERT(pRuntimeData && "Runtime Data was not initialized.");
+		if ( pRuntimeData->sSceneName == sSceneName )
+		{
+			SCION_ERROR( "Failed to load scene [{}] - Scene has already been loaded.", sSceneName );
+			return false;
+		}
+
+		auto pScene = sceneManager.GetScene( sSceneName );
+		if ( !pScene )
+		{
+			SCION_ERROR( "Failed to change to scene [{}] - Scene [{}] is invalid.", sSceneName, sSceneName );
+			return false;
+		}
+
+		if ( !pScene->IsLoaded() )
+		{
+			pScene->LoadScene();
+		}
+
+		auto pSceneObject = dynamic_cast<SceneObject*>( pScene );
+		SCION_ASSERT( pSceneObject && "Scene Must be a valid Scene Object If run in the editor!" );
+		if ( !pSceneObject )
+		{
+			SCION_ERROR( "Failed to load scene [{}] - Scene is not a valid SceneObject.", sSceneName );
+
+			return pScene->UnloadScene( false );
+		}
+
+		pCurrentScene->CopySceneToRuntime( *pSceneObject );
+
+		if ( auto* pScheduler = pCurrentScene->GetRuntimeRegistry()
+									.TryGetContext<std::shared_ptr<Scion::Core::Scripting::LuaTaskScheduler>>() )
+		{
+			( *pScheduler )->NotifySceneLoaded( sSceneName );
+		}
+
+		return pScene->UnloadScene( false );
+	};
+
 	// clang-format off
 	lua.new_usertype<EditorSceneManager>(
 		"SceneManager",
 		sol::no_constructor,
 		"changeScene",
-		[ & ]( const std::string& sSceneName ) {
+		changeScene,
+		"changeSceneAsync",
+		[ &sceneManager, changeScene ]( const std::string& sSceneName, sol::optional<sol::table> optAssetDefs ) {
 			auto pCurrentScene = sceneManager.GetCurrentSceneObject();
 			if ( !pCurrentScene )
 			{
 				SCION_ERROR( "Failed to change to scene [{}] - Current scene is invalid.", sSceneName );
-				return false;
+				return std::shared_ptr<SCION_RESOURCES::AsyncLoad>{};
 			}
 
-			auto* pRuntimeData = pCurrentScene->GetRuntimeData();
-			SCION_ASSERT(pRuntimeData && "Runtime Data was not initialized.");
-			if ( pRuntimeData->sSceneName == sSceneName )
-			{
-				SCION_ERROR( "Failed to load scene [{}] - Scene has already been loaded.", sSceneName );
-				return false;
-			}
-
-			auto pScene = sceneManager.GetScene( sSceneName );
-			if ( !pScene )
-			{
-				SCION_ERROR( "Failed to change to scene [{}] - Scene [{}] is invalid.", sSceneName, sSceneName );
-				return false;
-			}
-
-			if ( !pScene->IsLoaded() )
-			{
-				pScene->LoadScene();
-			}
-
-			auto pSceneObject = dynamic_cast<SceneObject*>( pScene );
-			SCION_ASSERT( pSceneObject && "Scene Must be a valid Scene Object If run in the editor!" );
-			if ( !pSceneObject )
-			{
-				SCION_ERROR( "Failed to load scene [{}] - Scene is not a valid SceneObject.", sSceneName );
-
-				return pScene->UnloadScene( false );
-			}
-
-			pCurrentScene->CopySceneToRuntime( *pSceneObject );
-
-			return pScene->UnloadScene( false );
+			return SCION_RESOURCES::AsyncAssetLoader::LoadScene(
+				pCurrentScene->GetRuntimeRegistry(), sSceneName, optAssetDefs, changeScene );
 		},
 		"getCanvas", // Returns the canvas of the current scene or an empty canvas object.
 		[ & ] {
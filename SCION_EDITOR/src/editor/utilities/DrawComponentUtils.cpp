@@ -487,6 +487,11 @@ void DrawComponentsUtil::DrawImGuiComponent( Scion::Core::ECS::PhysicsComponent&
 							"dynamic-versus-dynamic continuous collision. They may interfere with joint constraints." );
 		ImGui::Checkbox( "##bullet", &physicsAttributes.bIsBullet );
 
+		ImGui::InlineLabel( "merge tile" );
+		ImGui::ItemToolTip( "Can the collider of a static box tile be merged with the tiles around it?\n"
+							"Merged tiles share a body, turn this off for tiles that need a body of their own." );
+		ImGui::Checkbox( "##mergeTileCollider", &physicsAttributes.bMergeTileCollider );
+
 		ImGui::SeparatorText( "Physics Object Data" );
 		ImGui::AddSpaces( 2 );
 
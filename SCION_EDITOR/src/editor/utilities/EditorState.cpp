@@ -51,6 +51,7 @@ bool EditorState::Save( Scion::Core::ProjectInfo& projectInfo )
 		.AddKeyValuePair( "gridSnap", bEnableGridsnap )
 		.AddKeyValuePair( "showAnimations", bShowAnimations )
 		.AddKeyValuePair( "showCollisions", bShowCollisions )
+		.AddKeyValuePair( "autosaveInterval", autosaveInterval )
 		.EndObject(); // EditorState
 
 	return pSerializer->EndDocument();
@@ -114,6 +115,10 @@ bool EditorState::Load( Scion::Core::ProjectInfo& projectInfo )
 	bShowCollisions = editorState[ "showCollisions" ].GetBool();
 	bEnableGridsnap = editorState[ "gridSnap" ].GetBool();
 
+	// Older editor states do not have an autosave interval.
+	if ( editorState.HasMember( "autosaveInterval" ) )
+		autosaveInterval = editorState[ "autosaveInterval" ].GetInt();
+
 	return true;
 }
 
@@ -164,6 +169,7 @@ bool EditorState::CreateEditorStateFile( Scion::Core::ProjectInfo& projectInfo )
 		.AddKeyValuePair( "gridSnap", true )
 		.AddKeyValuePair( "showAnimations", false )
 		.AddKeyValuePair( "showCollisions", false )
+		.AddKeyValuePair( "autosaveInterval", 300 )
 		.EndObject(); // EditorState
 
 	return pSerializer->EndDocument();
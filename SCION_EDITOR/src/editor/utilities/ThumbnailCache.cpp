@@ -0,0 +1,268 @@
+#include "editor/utilities/ThumbnailCache.h"
+#include "ScionUtilities/ThreadPool.h"
+#include "Logger/Logger.h"
+
+#include <Rendering/Essentials/Texture.h>
+#include <SOIL2/SOIL2.h>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+constexpr int THUMBNAIL_CHANNELS = 4;
+
+/*
+ * Box filter downscale of an RGBA image so that it fits inside maxSize x maxSize.
+ * Each destination pixel is the average of all source pixels it covers.
+ */
+std::vector<unsigned char> DownscaleImage( const unsigned char* pSrc, int srcWidth, int srcHeight, int maxSize,
+										   int& outWidth, int& outHeight )
+{
+	const float scale = std::min( 1.f, static_cast<float>( maxSize ) / static_cast<float>( std::max( srcWidth, srcHeight ) ) );
+
+	outWidth = std::max( 1, static_cast<int>( srcWidth * scale ) );
+	outHeight = std::max( 1, static_cast<int>( srcHeight * scale ) );
+
+	std::vector<unsigned char> pixels( static_cast<size_t>( outWidth * outHeight * THUMBNAIL_CHANNELS ) );
+
+	for ( int y = 0; y < outHeight; ++y )
+	{
+		const int srcY0 = y * srcHeight / outHeight;
+		const int srcY1 = std::max( srcY0 + 1, ( y + 1 ) * srcHeight / outHeight );
+
+		for ( int x = 0; x < outWidth; ++x )
+		{
+			const int srcX0 = x * srcWidth / outWidth;
+			const int srcX1 = std::max( srcX0 + 1, ( x + 1 ) * srcWidth / outWidth );
+
+			std::uint32_t sum[ THUMBNAIL_CHANNELS ]{ 0 };
+			for ( int sy = srcY0; sy < srcY1; ++sy )
+			{
+				const unsigned char* pRow = pSrc + static_cast<size_t>( sy * srcWidth + srcX0 ) * THUMBNAIL_CHANNELS;
+				for ( int sx = srcX0; sx < srcX1; ++sx, pRow += THUMBNAIL_CHANNELS )
+				{
+					for ( int c = 0; c < THUMBNAIL_CHANNELS; ++c )
+						sum[ c ] += pRow[ c ];
+				}
+			}
+
+			const std::uint32_t count = static_cast<std::uint32_t>( ( srcY1 - srcY0 ) * ( srcX1 - srcX0 ) );
+			unsigned char* pDst = pixels.data() + static_cast<size_t>( y * outWidth + x ) * THUMBNAIL_CHANNELS;
+			for ( int c = 0; c < THUMBNAIL_CHANNELS; ++c )
+				pDst[ c ] = static_cast<unsigned char>( sum[ c ] / count );
+		}
+	}
+
+	return pixels;
+}
+} // namespace
+
+namespace Scion::Editor
+{
+
+ThumbnailCache::ThumbnailCache( std::shared_ptr<Scion::Utilities::ThreadPool> pThreadPool,
+								const std::filesystem::path& cacheDirectory, int thumbnailSize, int maxUploadsPerFrame )
+	: m_pThreadPool{ pThreadPool }
+	, m_CacheDirectory{ cacheDirectory }
+	, m_ThumbnailSize{ thumbnailSize }
+	, m_MaxUploadsPerFrame{ maxUploadsPerFrame }
+	, m_mapThumbnails{}
+	, m_pSharedState{ std::make_shared<SharedState>() }
+	, m_PendingUploads{}
+{
+	std::error_code ec;
+	if ( !fs::exists( m_CacheDirectory, ec ) && !fs::create_directories( m_CacheDirectory, ec ) )
+	{
+		SCION_ERROR( "Failed to create thumbnail cache directory [{}] - {}", m_CacheDirectory.string(), ec.message() );
+	}
+}
+
+ThumbnailCache::~ThumbnailCache()
+{
+	m_pSharedState->bCancelled.store( true, std::memory_order_relaxed );
+	Clear();
+}
+
+Scion::Rendering::Texture* ThumbnailCache::GetThumbnail( const std::filesystem::path& imagePath,
+														 std::filesystem::file_time_type lastWrite )
+{
+	auto thumbItr = m_mapThumbnails.find( imagePath.string() );
+	if ( thumbItr == m_mapThumbnails.end() )
+	{
+		RequestThumbnail( imagePath, lastWrite );
+		return nullptr;
+	}
+
+	auto& entry = thumbItr->second;
+
+	// The image changed since the thumbnail was generated.
+	if ( entry.lastWrite != lastWrite && entry.eState != EThumbnailState::Pending )
+	{
+		if ( entry.pTexture )
+		{
+			entry.pTexture->Destroy();
+			entry.pTexture.reset();
+		}
+
+		RequestThumbnail( imagePath, lastWrite );
+		return nullptr;
+	}
+
+	return entry.eState == EThumbnailState::Ready ? entry.pTexture.get() : nullptr;
+}
+
+void ThumbnailCache::Update()
+{
+	{
+		std::lock_guard lock{ m_pSharedState->mutex };
+		if ( !m_pSharedState->completed.empty() )
+		{
+			std::ranges::move( m_pSharedState->completed, std::back_inserter( m_PendingUploads ) );
+			m_pSharedState->completed.clear();
+		}
+	}
+
+	int numUploads{ 0 };
+	auto resultItr = m_PendingUploads.begin();
+	for ( ; resultItr != m_PendingUploads.end() && numUploads < m_MaxUploadsPerFrame; ++resultItr )
+	{
+		auto thumbItr = m_mapThumbnails.find( resultItr->sImagePath );
+		// The thumbnail was cleared or re-requested for a newer version of the image.
+		if ( thumbItr == m_mapThumbnails.end() || thumbItr->second.lastWrite != resultItr->lastWrite )
+			continue;
+
+		auto& entry = thumbItr->second;
+		if ( !resultItr->bSuccess )
+		{
+			entry.eState = EThumbnailState::Failed;
+			continue;
+		}
+
+		GLuint id;
+		glGenTextures( 1, &id );
+		glBindTexture( GL_TEXTURE_2D, id );
+
+		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE );
+		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE );
+		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST );
+		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR );
+
+		glTexImage2D( GL_TEXTURE_2D,
+					  0,
+					  GL_RGBA,
+					  resultItr->width,
+					  resultItr->height,
+					  0,
+					  GL_RGBA,
+					  GL_UNSIGNED_BYTE,
+					  resultItr->pixels.data() );
+
+		glBindTexture( GL_TEXTURE_2D, 0 );
+
+		entry.pTexture = std::make_unique<Scion::Rendering::Texture>(
+			id, resultItr->width, resultItr->height, Scion::Rendering::Texture::TextureType::ICON, resultItr->sImagePath );
+		entry.pTexture->SetIsEditorTexture( true );
+		entry.eState = EThumbnailState::Ready;
+
+		++numUploads;
+	}
+
+	m_PendingUploads.erase( m_PendingUploads.begin(), resultItr );
+}
+
+void ThumbnailCache::Clear()
+{
+	for ( auto& [ sPath, entry ] : m_mapThumbnails )
+	{
+		if ( entry.pTexture )
+			entry.pTexture->Destroy();
+	}
+
+	m_mapThumbnails.clear();
+	m_PendingUploads.clear();
+}
+
+void ThumbnailCache::RequestThumbnail( const std::filesystem::path& imagePath, std::filesystem::file_time_type lastWrite )
+{
+	auto& entry = m_mapThumbnails[ imagePath.string() ];
+	entry.eState = EThumbnailState::Pending;
+	entry.lastWrite = lastWrite;
+
+	if ( !m_pThreadPool )
+	{
+		entry.eState = EThumbnailState::Failed;
+		return;
+	}
+
+	m_pThreadPool->Enqueue( [ pSharedState = m_pSharedState,
+							  imagePath,
+							  lastWrite,
+							  cachedPath = GetCachedPath( m_CacheDirectory, imagePath, lastWrite ),
+							  thumbnailSize = m_ThumbnailSize ] {
+		if ( pSharedState->bCancelled.load( std::memory_order_relaxed ) )
+			return;
+
+		auto result = GenerateThumbnail( imagePath, cachedPath, thumbnailSize );
+		result.lastWrite = lastWrite;
+
+		std::lock_guard lock{ pSharedState->mutex };
+		pSharedState->completed.emplace_back( std::move( result ) );
+	} );
+}
+
+ThumbnailCache::ThumbnailResult ThumbnailCache::GenerateThumbnail( const std::filesystem::path& imagePath,
+																   const std::filesystem::path& cachedPath,
+																   int thumbnailSize )
+{
+	ThumbnailResult result{ .sImagePath = imagePath.string() };
+
+	int width{ 0 }, height{ 0 }, channels{ 0 };
+	std::error_code ec;
+
+	// Try the on-disk cache first. It is already downscaled so it can be used as is.
+	if ( fs::exists( cachedPath, ec ) )
+	{
+		if ( unsigned char* pCached =
+				 SOIL_load_image( cachedPath.string().c_str(), &width, &height, &channels, SOIL_LOAD_RGBA ) )
+		{
+			result.pixels.assign( pCached, pCached + static_cast<size_t>( width * height * THUMBNAIL_CHANNELS ) );
+			result.width = width;
+			result.height = height;
+			result.bSuccess = true;
+			SOIL_free_image_data( pCached );
+			return result;
+		}
+	}
+
+	unsigned char* pImage = SOIL_load_image( imagePath.string().c_str(), &width, &height, &channels, SOIL_LOAD_RGBA );
+	if ( !pImage )
+		return result;
+
+	result.pixels = DownscaleImage( pImage, width, height, thumbnailSize, result.width, result.height );
+	result.bSuccess = true;
+	SOIL_free_image_data( pImage );
+
+	if ( !SOIL_save_image( cachedPath.string().c_str(),
+						   SOIL_SAVE_TYPE_PNG,
+						   result.width,
+						   result.height,
+						   THUMBNAIL_CHANNELS,
+						   result.pixels.data() ) )
+	{
+		SCION_WARN( "Failed to write thumbnail [{}] to the cache.", cachedPath.string() );
+	}
+
+	return result;
+}
+
+std::filesystem::path ThumbnailCache::GetCachedPath( const std::filesystem::path& cacheDirectory,
+													 const std::filesystem::path& imagePath,
+													 std::filesystem::file_time_type lastWrite )
+{
+	const size_t pathHash = std::hash<std::string>{}( imagePath.lexically_normal().string() );
+	const auto writeTicks = lastWrite.time_since_epoch().count();
+
+	return cacheDirectory / fmt::format( "{:016x}_{:x}.png", pathHash, static_cast<std::uint64_t>( writeTicks ) );
+}
+
+} // namespace Scion::Editor
@@ -11,11 +11,17 @@
 #include "Core/Scripting/InputManager.h"
 #include "Core/Scripting/CrashLoggerTestBindings.h"
 #include "Core/Scripting/ScriptingUtilities.h"
+#include "Core/Scripting/LuaAllocator.h"
 
 #include "Core/Scene/SceneManager.h"
 
 #include "Core/Systems/AnimationSystem.h"
 #include "Core/Systems/PhysicsSystem.h"
+#include "Core/Systems/SpatialQuerySystem.h"
+#include "Core/Systems/TileColliderSystem.h"
+#include "Core/Systems/NavigationSystem.h"
+#include "Core/Systems/TweenSystem.h"
+#include "Core/Systems/ParticleSystem.h"
 #include "Core/Systems/ScriptingSystem.h"
 #include "Core/Systems/RenderSystem.h"
 #include "Core/Systems/RenderUISystem.h"
@@ -28,6 +34,7 @@
 #include "Logger/CrashLogger.h"
 #include "ScionUtilities/HelperUtilities.h"
 #include "ScionUtilities/ScionUtilities.h"
+#include "ScionUtilities/ThreadPool.h"
 
 #include "Windowing/Window/Window.h"
 #include "Windowing/Inputs/Mouse.h"
@@ -37,6 +44,7 @@
 #include "Rendering/Core/Renderer.h"
 
 #include "Core/Loaders/TilemapLoader.h"
+#include "Core/Loaders/LevelStreamer.h"
 #include "Core/CoreUtilities/ProjectInfo.h"
 
 #include <SDL3/SDL.h>
@@ -50,6 +58,14 @@ using namespace Scion::Core::Systems;
 using namespace Scion::Core::ECS;
 using namespace Scion::Rendering;
 
+namespace
+{
+glm::vec2 GetCameraCenter( const Camera2D& camera )
+{
+	return camera.ScreenCoordsToWorld( glm::vec2{ camera.GetWidth() * 0.5f, camera.GetHeight() * 0.5f } );
+}
+} // namespace
+
 namespace Scion::Engine
 {
 RuntimeApp::RuntimeApp()
@@ -57,6 +73,8 @@ RuntimeApp::RuntimeApp()
 	, m_Event{}
 	, m_bRunning{ true }
 	, m_pGameConfig{ std::make_unique<Scion::Core::GameConfig>() }
+	, m_StreamFocusID{ 0 }
+	, m_StreamedTextures{}
 {
 }
 
@@ -111,7 +129,7 @@ void RuntimeApp::Initialize()
 	SDL_GL_SetAttribute( SDL_GL_DOUBLEBUFFER, 1 );
 	SDL_GL_SetAttribute( SDL_GL_ACCELERATED_VISUAL, 1 );
 
-	auto pLuaState = std::make_shared<sol::state>();
+	auto pLuaState = Scion::Core::Scripting::CreateLuaState();
 	pLuaState->open_libraries( sol::lib::base,
 							   sol::lib::math,
 							   sol::lib::os,
@@ -126,6 +144,8 @@ void RuntimeApp::Initialize()
 		throw std::runtime_error( "Failed to initialize the game configuration." );
 	}
 
+	Scion::Core::Scripting::ApplyGCSettings( pLuaState->lua_state(), CORE_GLOBALS().GetLuaGCSettings() );
+
 
 	// Set the lua state for the crash logger.
 	// This is used to log the lua stack trace in case of a crash
@@ -195,6 +215,19 @@ void RuntimeApp::Initialize()
 	LoadBindings();
 	Scion::Core::CoreEngineData::RegisterMetaFunctions();
 
+	// Textures of streamed cells are held back from the zip, the level streamer uploads them when needed.
+	if ( m_pGameConfig->bStreamLevels && m_pGameConfig->bPackageAssets )
+	{
+		std::error_code ec;
+		for ( const auto& entry : fs::directory_iterator( fs::path{ "assets" } / "levels", ec ) )
+		{
+			if ( entry.is_directory() && entry.path().filename().string().ends_with( "_cells" ) )
+			{
+				Scion::Core::Loaders::LevelStreamer::ReadStreamedTextures( entry.path().string(), m_StreamedTextures );
+			}
+		}
+	}
+
 	if ( m_pGameConfig->bPackageAssets && !LoadZip() )
 	{
 		throw std::runtime_error( "Failed to load game assets zip file." );
@@ -208,11 +241,36 @@ void RuntimeApp::Initialize()
 	auto pSceneManagerData = mainRegistry.AddToContext<std::shared_ptr<Scion::Core::SceneManagerData>>(
 		std::make_shared<Scion::Core::SceneManagerData>() );
 
-	Scion::Core::Loaders::TilemapLoader tl{};
-	auto& lua = mainRegistry.GetContext<std::shared_ptr<sol::state>>();
-	tl.LoadTilemapFromLuaTable( *mainRegistry.GetRegistry(), ( *lua )[ m_pGameConfig->sStartupScene + "_tilemap" ] );
-	tl.LoadGameObjectsFromLuaTable( *mainRegistry.GetRegistry(),
-									( *lua )[ m_pGameConfig->sStartupScene + "_objects" ] );
+	std::shared_ptr<Scion::Core::Loaders::LevelStreamer> pLevelStreamer{ nullptr };
+	if ( m_pGameConfig->bStreamLevels )
+	{
+		pLevelStreamer = mainRegistry.AddToContext<std::shared_ptr<Scion::Core::Loaders::LevelStreamer>>(
+			std::make_shared<Scion::Core::Loaders::LevelStreamer>() );
+
+		if ( m_pGameConfig->bPackageAssets )
+		{
+			pLevelStreamer->SetTextureSource(
+				[ this ]( const std::string& sTextureName ) { return AddPackagedTexture( sTextureName ); } );
+		}
+
+		if ( !pLevelStreamer->LoadManifest(
+				 Scion::Core::Loaders::LevelStreamer::GetCellsDirectory( m_pGameConfig->sStartupScene ) ) )
+		{
+			throw std::runtime_error( "Failed to load the level streaming manifest." );
+		}
+
+		auto& pCamera = mainRegistry.GetContext<std::shared_ptr<Camera2D>>();
+		m_StreamFocusID = pLevelStreamer->AddFocusPoint( GetCameraCenter( *pCamera ) );
+	}
+	else
+	{
+		Scion::Core::Loaders::TilemapLoader tl{};
+		auto& lua = mainRegistry.GetContext<std::shared_ptr<sol::state>>();
+		tl.LoadTilemapFromLuaTable( *mainRegistry.GetRegistry(),
+									( *lua )[ m_pGameConfig->sStartupScene + "_tilemap" ] );
+		tl.LoadGameObjectsFromLuaTable( *mainRegistry.GetRegistry(),
+										( *lua )[ m_pGameConfig->sStartupScene + "_objects" ] );
+	}
 
 	pSceneManagerData->sSceneName = m_pGameConfig->sStartupScene;
 
@@ -227,6 +285,12 @@ void RuntimeApp::Initialize()
 	{
 		LoadPhysics();
 	}
+
+	// Streamed cells initialize their own physics bodies, so they are loaded after LoadPhysics.
+	if ( pLevelStreamer )
+	{
+		pLevelStreamer->LoadRequiredCells( *mainRegistry.GetRegistry() );
+	}
 }
 
 bool RuntimeApp::LoadShaders()
@@ -262,6 +326,13 @@ bool RuntimeApp::LoadShaders()
 		return false;
 	}
 
+	if ( !assetManager.AddShaderFromMemory(
+			 "particle", Scion::Core::Shaders::particleShaderVert, Scion::Core::Shaders::particleShaderFrag ) )
+	{
+		SCION_ERROR( "Failed to add the particle shader to the asset manager" );
+		return false;
+	}
+
 	return true;
 }
 
@@ -324,17 +395,41 @@ bool RuntimeApp::LoadConfig( sol::state& lua )
 		int32_t positionIterations = ( *maybePhysics )[ "positionIterations" ].get_or( 0 );
 		int32_t velocityIterations = ( *maybePhysics )[ "velocityIterations" ].get_or( 0 );
 		float gravity = ( *maybePhysics )[ "gravity" ].get_or( 9.8f );
+		bool bMergeTileColliders = ( *maybePhysics )[ "bMergeTileColliders" ].get_or( true );
 		bPhysicsEnabled ? coreGlobals.EnablePhysics() : coreGlobals.DisablePhysics();
+		bMergeTileColliders ? coreGlobals.EnableTileColliderMerging() : coreGlobals.DisableTileColliderMerging();
 
 		coreGlobals.SetPositionIterations( positionIterations );
 		coreGlobals.SetVelocityIterations( velocityIterations );
 		coreGlobals.SetGravity( gravity );
 	}
 
+	sol::optional<sol::table> maybeScripting = ( *maybeConfig )[ "ScriptingParams" ];
+	if ( maybeScripting )
+	{
+		Scion::Core::Scripting::LuaGCSettings gcSettings{};
+		gcSettings.eMode = Scion::Core::Scripting::GetLuaGCModeFromStr(
+			( *maybeScripting )[ "gcMode" ].get_or( std::string{ "incremental" } ) );
+		gcSettings.pause = ( *maybeScripting )[ "gcPause" ].get_or( 0 );
+		gcSettings.stepMultiplier = ( *maybeScripting )[ "gcStepMultiplier" ].get_or( 0 );
+		gcSettings.stepSize = ( *maybeScripting )[ "gcStepSize" ].get_or( 0 );
+		gcSettings.minorMultiplier = ( *maybeScripting )[ "gcMinorMultiplier" ].get_or( 0 );
+		gcSettings.majorMultiplier = ( *maybeScripting )[ "gcMajorMultiplier" ].get_or( 0 );
+		gcSettings.idleBudgetMs = ( *maybeScripting )[ "idleGCBudgetMs" ].get_or( 1.f );
+		coreGlobals.SetLuaGCSettings( gcSettings );
+	}
+
 	// TODO: Flags, etc
 
 	m_pGameConfig->bPackageAssets = ( *maybeConfig )[ "bPackageAssets" ].get_or( false );
 
+	sol::optional<sol::table> maybeStreaming = ( *maybeConfig )[ "StreamingParams" ];
+	if ( maybeStreaming )
+	{
+		m_pGameConfig->bStreamLevels = ( *maybeStreaming )[ "bEnabled" ].get_or( false );
+		m_pGameConfig->streamCellSize = ( *maybeStreaming )[ "cellSize" ].get_or( 1024 );
+	}
+
 	sol::optional<sol::table> maybeAudio = ( *maybeConfig )[ "AudioParams" ];
 	if (maybeAudio)
 	{
@@ -369,6 +464,10 @@ bool RuntimeApp::LoadRegistryContext()
 		pPhysicsWorld->SetContactListener( pContactListener.get() );
 	}
 
+	// Used for work that can be spread across threads, such as batched physics queries.
+	mainRegistry.AddToContext<SharedThreadPool>( std::make_shared<Scion::Utilities::ThreadPool>(
+		std::max( std::thread::hardware_concurrency(), 2u ) - 1 ) );
+
 	mainRegistry.AddToContext<std::shared_ptr<ScriptingSystem>>( std::make_shared<ScriptingSystem>() );
 
 	return false;
@@ -406,6 +505,15 @@ bool RuntimeApp::LoadPhysics()
 	auto& pPhysicsWorld = mainRegistry.GetContext<Scion::Physics::PhysicsWorld>();
 	auto& pCamera = mainRegistry.GetContext<std::shared_ptr<Camera2D>>();
 
+	// Static tiles are merged into shared bodies first, those tiles are skipped below.
+	auto pTileColliders = pRegistry->AddToContext<std::shared_ptr<Scion::Core::Systems::TileColliderSystem>>(
+		std::make_shared<Scion::Core::Systems::TileColliderSystem>() );
+
+	if ( coreGlobals.IsTileColliderMergingEnabled() )
+	{
+		pTileColliders->MergeTileColliders( *pRegistry, pPhysicsWorld, pCamera->GetWidth(), pCamera->GetHeight() );
+	}
+
 	// We need to initialize all of the physics entities
 	auto physicsEntities = pRegistry->GetRegistry().view<PhysicsComponent>();
 	for ( auto entity : physicsEntities )
@@ -422,6 +530,11 @@ bool RuntimeApp::LoadPhysics()
 		}
 
 		auto& physics = ent.GetComponent<PhysicsComponent>();
+
+		// Merged tiles already share a body.
+		if ( physics.GetBody() )
+			continue;
+
 		auto& physicsAttributes = physics.GetChangableAttributes();
 
 		if ( bBoxCollider )
@@ -479,6 +592,15 @@ bool RuntimeApp::LoadZip()
 
 	using namespace Scion::Utilities;
 
+	struct AtlasRegionDef
+	{
+		std::string sTextureName{};
+		std::string sAtlasName{};
+		int x{ 0 }, y{ 0 }, width{ 0 }, height{ 0 };
+	};
+
+	std::vector<AtlasRegionDef> atlasRegions;
+
 	for ( const auto& entry : entries )
 	{
 		auto text = entry.readAsText();
@@ -529,6 +651,21 @@ bool RuntimeApp::LoadZip()
 				m_mapS2DAssets[ pS2DAsset->eType ].push_back( std::move( pS2DAsset ) );
 			}
 		}
+
+		sol::optional<sol::table> s2dAtlasRegions = lua[ "S2D_AtlasRegions" ];
+		if ( s2dAtlasRegions )
+		{
+			for ( const auto& [ index, regionTable ] : *s2dAtlasRegions )
+			{
+				sol::table region = regionTable.as<sol::table>();
+				atlasRegions.push_back( AtlasRegionDef{ .sTextureName = region[ "textureName" ].get_or( std::string{ "" } ),
+														.sAtlasName = region[ "atlasName" ].get_or( std::string{ "" } ),
+														.x = region[ "x" ].get_or( 0 ),
+														.y = region[ "y" ].get_or( 0 ),
+														.width = region[ "width" ].get_or( 0 ),
+														.height = region[ "height" ].get_or( 0 ) } );
+			}
+		}
 	}
 
 	for ( const auto& [ eType, assets ] : m_mapS2DAssets )
@@ -538,6 +675,9 @@ bool RuntimeApp::LoadZip()
 		case AssetType::TEXTURE: {
 			for ( const auto& pTexAsset : assets )
 			{
+				if ( m_StreamedTextures.contains( pTexAsset->sName ) )
+					continue;
+
 				if ( !assetManager.AddTextureFromMemory( pTexAsset->sName,
 														 pTexAsset->assetData.data(),
 														 pTexAsset->assetSize,
@@ -585,10 +725,38 @@ bool RuntimeApp::LoadZip()
 		}
 	}
 
+	// Atlas regions reference the atlas pages, so they can only be added once every texture is loaded.
+	for ( const auto& region : atlasRegions )
+	{
+		if ( !assetManager.AddTextureAtlasRegion(
+				 region.sTextureName, region.sAtlasName, region.x, region.y, region.width, region.height ) )
+		{
+			SCION_ERROR( "Failed to add texture [{}] from atlas [{}].", region.sTextureName, region.sAtlasName );
+		}
+	}
+
 	zipArchive.close();
 	return true;
 }
 
+bool RuntimeApp::AddPackagedTexture( const std::string& sTextureName )
+{
+	auto texItr = m_mapS2DAssets.find( Scion::Utilities::AssetType::TEXTURE );
+	if ( texItr == m_mapS2DAssets.end() )
+		return false;
+
+	auto assetItr = std::ranges::find_if( texItr->second,
+										  [ & ]( const auto& pAsset ) { return pAsset->sName == sTextureName; } );
+	if ( assetItr == texItr->second.end() )
+		return false;
+
+	const auto& pTexAsset = *assetItr;
+	return MAIN_REGISTRY().GetAssetManager().AddTextureFromMemory( pTexAsset->sName,
+																	pTexAsset->assetData.data(),
+																	pTexAsset->assetSize,
+																	( pTexAsset->optPixelArt ? *pTexAsset->optPixelArt : true ) );
+}
+
 void RuntimeApp::ProcessEvents()
 {
 	auto& inputManager = INPUT_MANAGER();
@@ -661,13 +829,26 @@ void RuntimeApp::Update()
 	double dt = coreGlobals.GetDeltaTime();
 	coreGlobals.UpdateDeltaTime();
 
-	// Clamp delta time to the target frame rate
+	auto& scriptSystem = mainRegistry.GetContext<std::shared_ptr<ScriptingSystem>>();
+
+	// Clamp delta time to the target frame rate. Part of the spare time goes to the lua garbage
+	// collector, so it does less work while the scripts run.
 	if ( dt < Scion::Core::TARGET_FRAME_TIME )
 	{
-		std::this_thread::sleep_for( std::chrono::duration<double>( Scion::Core::TARGET_FRAME_TIME - dt ) );
+		const auto idleTime = std::chrono::duration<double>( Scion::Core::TARGET_FRAME_TIME - dt );
+		const auto idleEnd = std::chrono::steady_clock::now() + idleTime;
+
+		scriptSystem->CollectGarbage( *registry, idleTime.count() * 1000.0 );
+		std::this_thread::sleep_until( idleEnd );
+	}
+	else
+	{
+		scriptSystem->CollectGarbage( *registry, 0.0 );
 	}
 
-	auto& scriptSystem = mainRegistry.GetContext<std::shared_ptr<ScriptingSystem>>();
+	// Events sent from other threads are delivered before the scripts and systems run.
+	mainRegistry.GetEventDispatcher().DrainChannels();
+
 	scriptSystem->Update( *registry );
 
 	if ( coreGlobals.IsPhysicsEnabled() && !coreGlobals.IsPhysicsPaused() )
@@ -677,39 +858,25 @@ void RuntimeApp::Update()
 			Scion::Core::TARGET_FRAME_TIME_F, coreGlobals.GetVelocityIterations(), coreGlobals.GetPositionIterations() );
 		pPhysicsWorld->ClearForces();
 
-		auto& dispatch = mainRegistry.GetContext<std::shared_ptr<Scion::Core::Events::EventDispatcher>>();
+		auto& pPhysicsSystem = mainRegistry.GetPhysicsSystem();
+		pPhysicsSystem.DispatchContacts( *registry );
+		pPhysicsSystem.Update( *registry );
+	}
 
-		// If there are no listeners for contact events, don't emit event
-		if ( dispatch->HasHandlers<Scion::Core::Events::ContactEvent>() )
-		{
-			if ( auto& pContactListener = mainRegistry.GetContext<std::shared_ptr<Scion::Physics::ContactListener>>() )
-			{
-				auto pUserDataA = pContactListener->GetUserDataA();
-				auto pUserDataB = pContactListener->GetUserDataB();
+	mainRegistry.GetSpatialQuerySystem().Update( *registry );
 
-				// Only emit contact event if both contacts are valid
-				if ( pUserDataA && pUserDataB )
-				{
-					try
-					{
-						auto ObjectA = std::any_cast<Scion::Physics::ObjectData>( pUserDataA->userData );
-						auto ObjectB = std::any_cast<Scion::Physics::ObjectData>( pUserDataB->userData );
-
-						dispatch->EmitEvent(
-							Scion::Core::Events::ContactEvent{ .objectA = ObjectA, .objectB = ObjectB } );
-					}
-					catch ( const std::bad_any_cast& e )
-					{
-						SCION_ERROR( "Failed to cast to object data - {}", e.what() );
-					}
-				}
-			}
-		}
+	if ( auto* pNavigation = registry->TryGetContext<std::shared_ptr<Scion::Core::Systems::NavigationSystem>>() )
+	{
+		( *pNavigation )->Update( *registry );
+	}
 
-		auto& pPhysicsSystem = mainRegistry.GetPhysicsSystem();
-		pPhysicsSystem.Update( *registry );
+	if ( auto* pTweens = registry->TryGetContext<std::shared_ptr<Scion::Core::Systems::TweenSystem>>() )
+	{
+		( *pTweens )->Update( *registry, coreGlobals.GetDeltaTime() );
 	}
 
+	mainRegistry.GetParticleSystem().Update( *registry, coreGlobals.GetDeltaTime() );
+
 	auto& camera = mainRegistry.GetContext<std::shared_ptr<Camera2D>>();
 	mainRegistry.GetAnimationSystem().Update( *registry, *camera );
 
@@ -723,6 +890,12 @@ void RuntimeApp::Update()
 	INPUT_MANAGER().UpdateInputs();
 	camera->Update();
 
+	if ( auto* pLevelStreamer = mainRegistry.TryGetContext<std::shared_ptr<Scion::Core::Loaders::LevelStreamer>>() )
+	{
+		( *pLevelStreamer )->SetFocusPoint( m_StreamFocusID, GetCameraCenter( *camera ) );
+		( *pLevelStreamer )->Update( *registry );
+	}
+
 	registry->ClearPendingEntities();
 }
 
@@ -742,6 +915,7 @@ void RuntimeApp::Render()
 
 	auto& camera = mainRegistry.GetContext<std::shared_ptr<Camera2D>>();
 	mainRegistry.GetRenderSystem().Update( *mainRegistry.GetRegistry(), *camera );
+	mainRegistry.GetParticleSystem().Render( *mainRegistry.GetRegistry(), *camera );
 	mainRegistry.GetRenderUISystem().Update( *mainRegistry.GetRegistry() );
 
 	if ( coreGlobals.RenderCollidersEnabled() )
@@ -757,6 +931,8 @@ void RuntimeApp::Render()
 
 void RuntimeApp::CleanUp()
 {
+	// Batch handlers hold lua functions, end them while the lua state is still open.
+	EVENT_DISPATCHER().ClearLuaBatchHandlers();
 	SDL_Quit();
 }
 
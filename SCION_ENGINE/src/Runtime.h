@@ -42,6 +42,8 @@ class RuntimeApp
 	bool LoadScripts();
 	bool LoadPhysics();
 	bool LoadZip();
+	/* @brief Adds a texture that was held back from the zip for the level streamer. */
+	bool AddPackagedTexture( const std::string& sTextureName );
 
 	void ProcessEvents();
 	void Update();
@@ -63,5 +65,9 @@ class RuntimeApp
 	   have already been initialized.
 	*/
 	int m_DeltaAllocatedChannels;
+	/* Focus point that follows the camera when level streaming is enabled. */
+	std::uint32_t m_StreamFocusID;
+	/* Packaged textures used by streamed cells. They are only uploaded while a loaded cell uses them. */
+	std::set<std::string> m_StreamedTextures;
 };
 } // namespace Scion::Engine
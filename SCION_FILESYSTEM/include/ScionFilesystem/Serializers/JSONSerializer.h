@@ -1,13 +1,31 @@
 #pragma once
 #include <fstream>
+#include <variant>
 #include <rapidjson/prettywriter.h>
+#include <rapidjson/writer.h>
 
 namespace Scion::Filesystem
 {
+/*
+ * Builds a JSON document in memory and writes it out when the document is ended.
+ * File writes are done in a single write to a temporary file that is then renamed over
+ * the destination, so a failed or interrupted save never leaves a half written file.
+ */
 class JSONSerializer
 {
   public:
-	JSONSerializer( const std::string& sFilename, int maxDecimalPlaces = -1 );
+	/**
+	 * @param sFilename        The file to write to. Created if it does not exist.
+	 * @param maxDecimalPlaces The max decimal places to write for floating point values.
+	 * @param bPrettyPrint     If false, the document is written without any whitespace.
+	 */
+	JSONSerializer( const std::string& sFilename, int maxDecimalPlaces = -1, bool bPrettyPrint = true );
+
+	/*
+	 * @brief Creates a serializer that only writes to memory. The finished document
+	 * can be retrieved with GetString() after EndDocument().
+	 */
+	explicit JSONSerializer( int maxDecimalPlaces = -1, bool bPrettyPrint = true );
 	~JSONSerializer();
 
 	bool StartDocument();
@@ -25,10 +43,24 @@ class JSONSerializer
 	template <typename TValue>
 	JSONSerializer& AddKeyValuePair( const std::string& key, const TValue& value );
 
+	/* @brief Gets the document that has been written so far. */
+	inline std::string GetString() const { return std::string{ m_StringBuffer.GetString(), m_StringBuffer.GetSize() }; }
+	inline bool IsInMemory() const { return m_sFilename.empty(); }
+
+  private:
+	using PrettyWriter = rapidjson::PrettyWriter<rapidjson::StringBuffer>;
+	using CompactWriter = rapidjson::Writer<rapidjson::StringBuffer>;
+
+	template <typename TFunc>
+	decltype( auto ) Write( TFunc&& func );
+
+	void CreateWriter( int maxDecimalPlaces, bool bPrettyPrint );
+	void CheckFile( const std::string& sFilename );
+
   private:
-	std::fstream m_Filestream;
+	std::string m_sFilename;
 	rapidjson::StringBuffer m_StringBuffer;
-	std::unique_ptr<rapidjson::PrettyWriter<rapidjson::StringBuffer>> m_pWriter;
+	std::variant<std::unique_ptr<PrettyWriter>, std::unique_ptr<CompactWriter>> m_Writer;
 	int m_NumObjectsStarted;
 	int m_NumArraysStarted;
 };
@@ -2,39 +2,47 @@
 
 namespace Scion::Filesystem
 {
+template <typename TFunc>
+inline decltype( auto ) JSONSerializer::Write( TFunc&& func )
+{
+	return std::visit( [ &func ]( auto& pWriter ) -> decltype( auto ) { return func( *pWriter ); }, m_Writer );
+}
+
 template <typename TValue>
 inline JSONSerializer& JSONSerializer::AddKeyValuePair( const std::string& key, const TValue& value )
 {
-	m_pWriter->Key( key.c_str() );
+	Write( [ & ]( auto& writer ) {
+		writer.Key( key.c_str() );
 
-	if constexpr ( std::is_same_v<TValue, std::string> )
-	{
-		m_pWriter->String( value.c_str() );
-	}
-	else if constexpr ( std::is_same_v<TValue, const char*> )
-	{
-		m_pWriter->String( value );
-	}
-	else if constexpr ( std::is_same_v<TValue, const char> )
-	{
-		m_pWriter->String( value );
-	}
-	else if constexpr ( std::is_integral_v<TValue> )
-	{
-		m_pWriter->Int64( value );
-	}
-	else if constexpr ( std::is_unsigned_v<TValue> )
-	{
-		m_pWriter->Uint64( value );
-	}
-	else if constexpr ( std::is_floating_point_v<TValue> )
-	{
-		m_pWriter->Double( value );
-	}
-	else
-	{
-		assert( false && "Type not supported!" );
-	}
+		if constexpr ( std::is_same_v<TValue, std::string> )
+		{
+			writer.String( value.c_str() );
+		}
+		else if constexpr ( std::is_same_v<TValue, const char*> )
+		{
+			writer.String( value );
+		}
+		else if constexpr ( std::is_same_v<TValue, const char> )
+		{
+			writer.String( value );
+		}
+		else if constexpr ( std::is_integral_v<TValue> )
+		{
+			writer.Int64( value );
+		}
+		else if constexpr ( std::is_unsigned_v<TValue> )
+		{
+			writer.Uint64( value );
+		}
+		else if constexpr ( std::is_floating_point_v<TValue> )
+		{
+			writer.Double( value );
+		}
+		else
+		{
+			assert( false && "Type not supported!" );
+		}
+	} );
 
 	return *this;
 }
@@ -5,6 +5,8 @@
 
 namespace Scion::Filesystem
 {
+class AsyncFileWriter;
+
 template <class T>
 concept Streamable = requires( std::ostream& os, T obj ) { os << obj; };
 
@@ -23,14 +25,34 @@ std::string to_string( T val )
 	}
 }
 
+/*
+ * Formats Lua tables into an in-memory buffer. The buffer is written to the file in one
+ * go when the stream is finished, using a temporary file and a rename so the destination
+ * is never left half written. The buffer can also be handed to an AsyncFileWriter, which
+ * writes it the same way on its own thread.
+ */
 class LuaSerializer
 {
   public:
 	explicit LuaSerializer( const std::string& sFilepath );
 	~LuaSerializer();
 
+	/*
+	 * @brief Writes the current stream if it has not been written, then starts a new stream
+	 * for the new file.
+	 */
 	bool ResetStream( const std::string& sNewFilename );
+	/*
+	 * @brief Finishes the stream and writes the buffer to the file.
+	 * @return Returns true if the file was written successfully.
+	 */
 	bool FinishStream();
+	/*
+	 * @brief Finishes the stream and queues the buffer to be written by the file writer.
+	 * The file is written atomically on the writer's thread.
+	 * @return Returns true if the buffer was queued.
+	 */
+	bool FinishStream( AsyncFileWriter& fileWriter );
 
 	inline const std::string& GetFilepath() const { return m_sFilepath; }
 
@@ -60,17 +82,21 @@ class LuaSerializer
 
 	std::string AddQuotes( const std::string& str );
 
+	bool WriteStream();
+	static bool CheckFile( const std::string& sFilepath );
+
 	template <Streamable T>
 	void Stream( const T& val );
 
   private:
-	std::fstream m_FileStream;
+	std::string m_Buffer;
 	std::string m_sFilepath;
 	int m_NumIndents;
 	int m_NumTablesStarted;
 	bool m_bStreamStarted;
 	bool m_bValueAdded;
 	bool m_bNewLineAdded;
+	bool m_bStreamWritten;
 };
 
 
@@ -74,13 +74,15 @@ inline void LuaSerializer::Stream( const T& val )
 {
 	if constexpr ( std::is_same_v<T, bool> )
 	{
-		auto flags = m_FileStream.flags(); // save stream state
-		m_FileStream << std::boolalpha << val;
-		m_FileStream.flags( flags ); // restore
+		m_Buffer += val ? "true" : "false";
+	}
+	else if constexpr ( std::is_same_v<T, char> || std::is_convertible_v<const T&, std::string_view> )
+	{
+		m_Buffer += val;
 	}
 	else
 	{
-		m_FileStream << val;
+		m_Buffer += to_string( val );
 	}
 }
 
@@ -0,0 +1,79 @@
+#pragma once
+#include <string>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+
+namespace Scion::Filesystem
+{
+enum class EAsyncWriteFormat
+{
+	/* The contents are written exactly as they are. */
+	Raw,
+	/* The contents are compact JSON that is pretty printed on the worker before writing. */
+	PrettyJSON
+};
+
+/*
+ * Writes files on a single background thread so saving never blocks the caller.
+ *
+ * The caller takes a snapshot of the data it wants to save, usually by serializing into
+ * memory with a compact JSONSerializer, and hands the contents off. Formatting and disk
+ * writes happen on the worker, and every file is written atomically. Writes are processed
+ * in order, and a queued write to a file that has not started yet is replaced by a newer
+ * write to the same file.
+ */
+class AsyncFileWriter
+{
+  public:
+	AsyncFileWriter();
+	/* Finishes all queued writes before returning. */
+	~AsyncFileWriter();
+
+	AsyncFileWriter( const AsyncFileWriter& ) = delete;
+	AsyncFileWriter& operator=( const AsyncFileWriter& ) = delete;
+
+	/**
+	 * @brief Queues the contents to be written to the file.
+	 * @param sFilepath  The destination file.
+	 * @param sContents  The full contents of the file.
+	 * @param eFormat    How the contents should be formatted before writing.
+	 */
+	void Write( const std::string& sFilepath, std::string sContents,
+				EAsyncWriteFormat eFormat = EAsyncWriteFormat::Raw );
+
+	/*
+	 * @brief Blocks until every queued write has finished.
+	 */
+	void Flush();
+
+	/* @brief Returns true if there are no queued or in progress writes. */
+	bool IsIdle() const;
+
+	inline size_t NumFailedWrites() const { return m_NumFailedWrites.load( std::memory_order_relaxed ); }
+
+  private:
+	struct WriteRequest
+	{
+		std::string sFilepath{};
+		std::string sContents{};
+		EAsyncWriteFormat eFormat{ EAsyncWriteFormat::Raw };
+	};
+
+	void Run();
+	bool ProcessRequest( WriteRequest& request );
+
+  private:
+	mutable std::mutex m_Mutex;
+	std::condition_variable m_RequestCondition;
+	std::condition_variable m_IdleCondition;
+	std::deque<WriteRequest> m_Requests;
+	bool m_bWriting;
+	bool m_bStopped;
+	std::atomic<size_t> m_NumFailedWrites;
+	std::thread m_Worker;
+};
+
+} // namespace Scion::Filesystem
@@ -5,6 +5,13 @@
 
 namespace Scion::Filesystem
 {
+/*
+ * Watches a directory and all of its sub-directories for changes on a background thread.
+ * The callback is invoked from the watcher thread with the changed path and true if the
+ * file was added or modified, false if it was removed. A rename is reported as the old
+ * path removed followed by the new path added. On Linux, bursts of changes to the same
+ * path are coalesced into a single callback.
+ */
 class DirectoryWatcher
 {
   public:
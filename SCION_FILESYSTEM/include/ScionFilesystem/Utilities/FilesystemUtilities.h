@@ -1,5 +1,6 @@
 #pragma once
 #include <string>
+#include <string_view>
 
 namespace Scion::Filesystem
 {
@@ -25,4 +26,15 @@ std::string ExecCmdWithErrorOutput( const std::string& sCmd );
 */
 std::string NormalizePath( const std::string& sPath );
 
+/**
+ * @brief Writes the contents to a temporary file next to the destination in a single
+ * write and then renames it over the destination. Readers will either see the old
+ * file or the complete new file, never a partially written one.
+ *
+ * @param sFilepath The destination file.
+ * @param sContents The full contents of the file.
+ * @return true if the file was written and renamed, false otherwise.
+ */
+bool WriteFileAtomic( const std::string& sFilepath, std::string_view sContents );
+
 } // namespace Scion::Filesystem
@@ -0,0 +1,138 @@
+#include "ScionFilesystem/Utilities/AsyncFileWriter.h"
+#include "ScionFilesystem/Utilities/FilesystemUtilities.h"
+#include "Logger/Logger.h"
+
+#include <rapidjson/document.h>
+#include <rapidjson/prettywriter.h>
+#include <rapidjson/error/en.h>
+
+constexpr int MAX_DECIMAL_PLACES = 5;
+
+namespace Scion::Filesystem
+{
+AsyncFileWriter::AsyncFileWriter()
+	: m_Mutex{}
+	, m_RequestCondition{}
+	, m_IdleCondition{}
+	, m_Requests{}
+	, m_bWriting{ false }
+	, m_bStopped{ false }
+	, m_NumFailedWrites{ 0 }
+	, m_Worker{}
+{
+	// Start the worker last, after everything it uses has been initialized.
+	m_Worker = std::thread{ [ this ] { Run(); } };
+}
+
+AsyncFileWriter::~AsyncFileWriter()
+{
+	{
+		std::lock_guard lock{ m_Mutex };
+		m_bStopped = true;
+	}
+
+	m_RequestCondition.notify_all();
+
+	if ( m_Worker.joinable() )
+		m_Worker.join();
+}
+
+void AsyncFileWriter::Write( const std::string& sFilepath, std::string sContents, EAsyncWriteFormat eFormat )
+{
+	{
+		std::lock_guard lock{ m_Mutex };
+
+		// Only the latest contents of a file matter, replace any write that has not started yet.
+		auto requestItr = std::ranges::find_if(
+			m_Requests, [ &sFilepath ]( const WriteRequest& request ) { return request.sFilepath == sFilepath; } );
+
+		if ( requestItr != m_Requests.end() )
+		{
+			requestItr->sContents = std::move( sContents );
+			requestItr->eFormat = eFormat;
+		}
+		else
+		{
+			m_Requests.emplace_back(
+				WriteRequest{ .sFilepath = sFilepath, .sContents = std::move( sContents ), .eFormat = eFormat } );
+		}
+	}
+
+	m_RequestCondition.notify_one();
+}
+
+void AsyncFileWriter::Flush()
+{
+	std::unique_lock lock{ m_Mutex };
+	m_IdleCondition.wait( lock, [ this ] { return m_Requests.empty() && !m_bWriting; } );
+}
+
+bool AsyncFileWriter::IsIdle() const
+{
+	std::lock_guard lock{ m_Mutex };
+	return m_Requests.empty() && !m_bWriting;
+}
+
+void AsyncFileWriter::Run()
+{
+	while ( true )
+	{
+		WriteRequest request{};
+
+		{
+			std::unique_lock lock{ m_Mutex };
+			m_RequestCondition.wait( lock, [ this ] { return m_bStopped || !m_Requests.empty(); } );
+
+			// Queued writes are always finished before shutting down.
+			if ( m_Requests.empty() )
+				return;
+
+			request = std::move( m_Requests.front() );
+			m_Requests.pop_front();
+			m_bWriting = true;
+		}
+
+		if ( !ProcessRequest( request ) )
+		{
+			m_NumFailedWrites.fetch_add( 1, std::memory_order_relaxed );
+		}
+
+		{
+			std::lock_guard lock{ m_Mutex };
+			m_bWriting = false;
+		}
+
+		m_IdleCondition.notify_all();
+	}
+}
+
+bool AsyncFileWriter::ProcessRequest( WriteRequest& request )
+{
+	if ( request.eFormat == EAsyncWriteFormat::PrettyJSON )
+	{
+		rapidjson::Document doc;
+		doc.Parse<rapidjson::kParseFullPrecisionFlag>( request.sContents.c_str(), request.sContents.size() );
+
+		if ( doc.HasParseError() )
+		{
+			SCION_ERROR( "Failed to format [{}] - {} - {}. Writing unformatted.",
+						 request.sFilepath,
+						 rapidjson::GetParseError_En( doc.GetParseError() ),
+						 doc.GetErrorOffset() );
+		}
+		else
+		{
+			rapidjson::StringBuffer buffer;
+			buffer.Reserve( request.sContents.size() * 2 );
+			rapidjson::PrettyWriter<rapidjson::StringBuffer> writer{ buffer };
+			writer.SetMaxDecimalPlaces( MAX_DECIMAL_PLACES );
+			doc.Accept( writer );
+
+			return WriteFileAtomic( request.sFilepath, std::string_view{ buffer.GetString(), buffer.GetSize() } );
+		}
+	}
+
+	return WriteFileAtomic( request.sFilepath, request.sContents );
+}
+
+} // namespace Scion::Filesystem
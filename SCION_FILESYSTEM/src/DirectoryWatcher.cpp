@@ -5,7 +5,12 @@
 #ifdef _WIN32
 #include <Windows.h>
 #else
-// Add linux specific headers.
+#include <sys/inotify.h>
+#include <sys/eventfd.h>
+#include <poll.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
 #endif // _WIN32
 
 namespace fs = std::filesystem;
@@ -26,13 +31,21 @@ struct DirectoryWatcher::Impl
 	HANDLE shutdownHandle{ nullptr };
 	OVERLAPPED overlapped{};
 #else
-	// TODO: add necessary linux variables
+	int inotifyFd{ -1 };
+	/* Written to on shutdown to wake up the poll in RunLinux. */
+	int shutdownFd{ -1 };
+	/* Watch descriptors to the directory they are watching. */
+	std::unordered_map<int, fs::path> mapWatchDescriptors;
 #endif
 
 	Impl( const std::filesystem::path& path, Callback cb )
 		: rootPath{ path }
 		, callback{ std::move( cb ) }
 	{
+#ifndef _WIN32
+		// Created before the thread starts so the destructor can always signal it.
+		shutdownFd = eventfd( 0, EFD_NONBLOCK | EFD_CLOEXEC );
+#endif
 		watcherThread = std::thread( [ this ] { Run(); } );
 	}
 
@@ -44,6 +57,8 @@ struct DirectoryWatcher::Impl
 	void RunWindows();
 #else
 	void RunLinux();
+	void AddWatchRecursive( const fs::path& directory );
+	void RemoveWatchesUnder( const fs::path& directory );
 #endif
 };
 
@@ -62,6 +77,12 @@ DirectoryWatcher::Impl::~Impl()
 #ifdef _WIN32
 		SetEvent( shutdownHandle );
 		CancelIoEx( directoryHandle, &overlapped );
+#else
+		if ( shutdownFd != -1 )
+		{
+			const std::uint64_t value{ 1 };
+			[[maybe_unused]] auto bytesWritten = write( shutdownFd, &value, sizeof( value ) );
+		}
 #endif
 		watcherThread.join();
 	}
@@ -79,7 +100,18 @@ DirectoryWatcher::Impl::~Impl()
 		shutdownHandle = nullptr;
 	}
 #else
-	// TODO: handle any Linux shutdown stuff
+	if ( inotifyFd != -1 )
+	{
+		// Closing the inotify descriptor removes all of its watches.
+		close( inotifyFd );
+		inotifyFd = -1;
+	}
+
+	if ( shutdownFd != -1 )
+	{
+		close( shutdownFd );
+		shutdownFd = -1;
+	}
 #endif
 }
 
@@ -227,8 +259,211 @@ void DirectoryWatcher::Impl::RunWindows()
 	directoryHandle = nullptr;
 }
 #else
+
+constexpr std::uint32_t WATCH_MASK =
+	IN_CREATE | IN_DELETE | IN_MODIFY | IN_CLOSE_WRITE | IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF | IN_ONLYDIR;
+
+/* How long the watcher waits for the directory to go quiet before reporting the coalesced changes. */
+constexpr int COALESCE_TIMEOUT_MS = 100;
+
+void DirectoryWatcher::Impl::AddWatchRecursive( const fs::path& directory )
+{
+	int wd = inotify_add_watch( inotifyFd, directory.c_str(), WATCH_MASK );
+	if ( wd == -1 )
+	{
+		SCION_ERROR( "Failed to watch directory [{}] - {}", directory.string(), std::strerror( errno ) );
+		return;
+	}
+
+	mapWatchDescriptors[ wd ] = directory;
+
+	std::error_code ec;
+	for ( const auto& entry :
+		  fs::recursive_directory_iterator( directory, fs::directory_options::skip_permission_denied, ec ) )
+	{
+		if ( !entry.is_directory( ec ) || entry.is_symlink( ec ) )
+			continue;
+
+		int subWd = inotify_add_watch( inotifyFd, entry.path().c_str(), WATCH_MASK );
+		if ( subWd == -1 )
+		{
+			SCION_ERROR( "Failed to watch directory [{}] - {}", entry.path().string(), std::strerror( errno ) );
+			continue;
+		}
+
+		mapWatchDescriptors[ subWd ] = entry.path();
+	}
+}
+
+void DirectoryWatcher::Impl::RemoveWatchesUnder( const fs::path& directory )
+{
+	const std::string sPrefix{ directory.string() };
+	std::erase_if( mapWatchDescriptors, [ & ]( const auto& pair ) {
+		const std::string sWatched{ pair.second.string() };
+		if ( sWatched == sPrefix || sWatched.starts_with( sPrefix + "/" ) )
+		{
+			inotify_rm_watch( inotifyFd, pair.first );
+			return true;
+		}
+
+		return false;
+	} );
+}
+
 void DirectoryWatcher::Impl::RunLinux()
 {
+	inotifyFd = inotify_init1( IN_NONBLOCK | IN_CLOEXEC );
+	if ( inotifyFd == -1 )
+	{
+		SCION_ERROR( "Failed to initialize inotify: {}", std::strerror( errno ) );
+		return;
+	}
+
+	if ( shutdownFd == -1 )
+	{
+		SCION_ERROR( "Failed to create directory watcher shutdown event: {}", std::strerror( errno ) );
+		return;
+	}
+
+	AddWatchRecursive( rootPath );
+
+	// Changes are coalesced by path so a burst of writes to the same file only reports once.
+	// The value is true if the file was modified/added and false if it was removed.
+	std::map<fs::path, bool> mapPendingChanges;
+	// IN_MOVED_FROM events waiting for their matching IN_MOVED_TO.
+	std::unordered_map<std::uint32_t, fs::path> mapPendingMoves;
+
+	alignas( inotify_event ) char buffer[ 8192 ];
+
+	pollfd fds[ 2 ]{ { .fd = inotifyFd, .events = POLLIN, .revents = 0 },
+					 { .fd = shutdownFd, .events = POLLIN, .revents = 0 } };
+
+	auto flushChanges = [ & ] {
+		// A move without a partner left the watched tree, so treat it as a removal.
+		for ( auto& [ cookie, movedPath ] : mapPendingMoves )
+		{
+			mapPendingChanges[ movedPath ] = false;
+		}
+		mapPendingMoves.clear();
+
+		if ( callback )
+		{
+			for ( const auto& [ changedPath, bModified ] : mapPendingChanges )
+			{
+				callback( changedPath, bModified );
+			}
+		}
+
+		mapPendingChanges.clear();
+	};
+
+	while ( !bStopFlag )
+	{
+		// Block until something happens. Once changes are pending, only wait long enough to coalesce them.
+		const bool bHasPending = !mapPendingChanges.empty() || !mapPendingMoves.empty();
+		int result = poll( fds, 2, bHasPending ? COALESCE_TIMEOUT_MS : -1 );
+
+		if ( result == -1 )
+		{
+			if ( errno == EINTR )
+				continue;
+
+			SCION_ERROR( "Directory watcher poll failed: {}", std::strerror( errno ) );
+			break;
+		}
+
+		if ( fds[ 1 ].revents & POLLIN )
+			break;
+
+		if ( result == 0 )
+		{
+			flushChanges();
+			continue;
+		}
+
+		if ( !( fds[ 0 ].revents & POLLIN ) )
+			continue;
+
+		ssize_t length{ 0 };
+		while ( ( length = read( inotifyFd, buffer, sizeof( buffer ) ) ) > 0 )
+		{
+			for ( char* ptr = buffer; ptr < buffer + length; )
+			{
+				const auto* pEvent = reinterpret_cast<const inotify_event*>( ptr );
+				ptr += sizeof( inotify_event ) + pEvent->len;
+
+				if ( pEvent->mask & IN_Q_OVERFLOW )
+				{
+					SCION_WARN( "Directory watcher queue overflowed for [{}]. Some changes may be missed.",
+								rootPath.string() );
+					continue;
+				}
+
+				auto watchItr = mapWatchDescriptors.find( pEvent->wd );
+				if ( watchItr == mapWatchDescriptors.end() )
+					continue;
+
+				if ( pEvent->mask & ( IN_DELETE_SELF | IN_IGNORED ) )
+				{
+					mapWatchDescriptors.erase( watchItr );
+					continue;
+				}
+
+				if ( pEvent->len == 0 )
+					continue;
+
+				const fs::path changedPath{ watchItr->second / pEvent->name };
+				const bool bIsDirectory{ ( pEvent->mask & IN_ISDIR ) != 0 };
+
+				if ( pEvent->mask & IN_MOVED_FROM )
+				{
+					mapPendingMoves[ pEvent->cookie ] = changedPath;
+					continue;
+				}
+
+				if ( pEvent->mask & IN_MOVED_TO )
+				{
+					if ( auto moveItr = mapPendingMoves.find( pEvent->cookie ); moveItr != mapPendingMoves.end() )
+					{
+						// Rename inside the watched tree, report the old path as removed.
+						if ( bIsDirectory )
+						{
+							RemoveWatchesUnder( moveItr->second );
+						}
+
+						mapPendingChanges[ moveItr->second ] = false;
+						mapPendingMoves.erase( moveItr );
+					}
+
+					if ( bIsDirectory )
+					{
+						AddWatchRecursive( changedPath );
+					}
+
+					mapPendingChanges[ changedPath ] = true;
+					continue;
+				}
+
+				if ( bIsDirectory && ( pEvent->mask & IN_CREATE ) )
+				{
+					AddWatchRecursive( changedPath );
+				}
+
+				mapPendingChanges[ changedPath ] = ( pEvent->mask & IN_DELETE ) == 0;
+			}
+		}
+
+		if ( length == -1 && errno != EAGAIN && errno != EINTR )
+		{
+			SCION_ERROR( "Failed to read directory watcher events: {}", std::strerror( errno ) );
+			break;
+		}
+	}
+
+	if ( !bStopFlag )
+	{
+		flushChanges();
+	}
 }
 
 #endif
@@ -1,8 +1,10 @@
 #include "ScionFilesystem/Utilities/FilesystemUtilities.h"
+#include "Logger/Logger.h"
 #include <cstdio>
 #include <array>
 #include <memory>
 #include <stdexcept>
+#include <fstream>
 
 namespace Scion::Filesystem
 {
@@ -36,4 +38,42 @@ std::string NormalizePath( const std::string& sPath )
 	fs::path path{ sPath };
 	return path.make_preferred().string();
 }
+
+bool WriteFileAtomic( const std::string& sFilepath, std::string_view sContents )
+{
+	fs::path filepath{ sFilepath };
+	fs::path tempPath{ filepath };
+	tempPath += ".tmp";
+
+	std::error_code ec;
+	{
+		std::ofstream tempFile{ tempPath, std::ios::out | std::ios::trunc };
+		if ( !tempFile.is_open() )
+		{
+			SCION_ERROR( "Failed to write file [{}] - Unable to open temporary file.", sFilepath );
+			return false;
+		}
+
+		tempFile.write( sContents.data(), static_cast<std::streamsize>( sContents.size() ) );
+		tempFile.flush();
+
+		if ( !tempFile )
+		{
+			tempFile.close();
+			fs::remove( tempPath, ec );
+			SCION_ERROR( "Failed to write file [{}] - Write failed.", sFilepath );
+			return false;
+		}
+	}
+
+	fs::rename( tempPath, filepath, ec );
+	if ( ec )
+	{
+		SCION_ERROR( "Failed to write file [{}] - {}", sFilepath, ec.message() );
+		fs::remove( tempPath, ec );
+		return false;
+	}
+
+	return true;
+}
 } // namespace Scion::Filesystem
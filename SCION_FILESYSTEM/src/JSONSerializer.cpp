@@ -1,32 +1,34 @@
 #include "ScionFilesystem/Serializers/JSONSerializer.h"
+#include "ScionFilesystem/Utilities/FilesystemUtilities.h"
 #include "Logger/Logger.h"
 
 constexpr int MAX_DECIMAL_PLACES = 5;
 
 namespace Scion::Filesystem
 {
-JSONSerializer::JSONSerializer( const std::string& sFilename, int maxDecimalPlaces )
-	: m_Filestream{}
+JSONSerializer::JSONSerializer( const std::string& sFilename, int maxDecimalPlaces, bool bPrettyPrint )
+	: m_sFilename{ sFilename }
 	, m_StringBuffer{}
-	, m_pWriter{ std::make_unique<rapidjson::PrettyWriter<rapidjson::StringBuffer>>( m_StringBuffer ) }
+	, m_Writer{}
 	, m_NumObjectsStarted{ 0 }
 	, m_NumArraysStarted{ 0 }
 {
-	m_Filestream.open( sFilename, std::ios::out | std::ios::trunc );
-	SCION_ASSERT( m_Filestream.is_open() && "Failed to open file!" );
-
-	if ( !m_Filestream.is_open() )
-		throw std::runtime_error( fmt::format( "JSONSerializer failed to open file [{}]", sFilename ) );
-
-	m_pWriter->SetMaxDecimalPlaces( maxDecimalPlaces > 1 ? maxDecimalPlaces : MAX_DECIMAL_PLACES );
+	CheckFile( sFilename );
+	CreateWriter( maxDecimalPlaces, bPrettyPrint );
 }
 
-JSONSerializer::~JSONSerializer()
+JSONSerializer::JSONSerializer( int maxDecimalPlaces, bool bPrettyPrint )
+	: m_sFilename{}
+	, m_StringBuffer{}
+	, m_Writer{}
+	, m_NumObjectsStarted{ 0 }
+	, m_NumArraysStarted{ 0 }
 {
-	if ( m_Filestream.is_open() )
-		m_Filestream.close();
+	CreateWriter( maxDecimalPlaces, bPrettyPrint );
 }
 
+JSONSerializer::~JSONSerializer() = default;
+
 bool JSONSerializer::StartDocument()
 {
 	SCION_ASSERT( m_NumObjectsStarted == 0 && "Document has already been started. Please Reset the serializer." );
@@ -39,7 +41,7 @@ bool JSONSerializer::StartDocument()
 
 	++m_NumObjectsStarted;
 
-	return m_pWriter->StartObject();
+	return Write( []( auto& writer ) { return writer.StartObject(); } );
 }
 
 bool JSONSerializer::EndDocument()
@@ -61,13 +63,13 @@ bool JSONSerializer::EndDocument()
 		return false;
 	}
 
-	m_pWriter->EndObject();
+	Write( []( auto& writer ) { writer.EndObject(); } );
 	--m_NumObjectsStarted;
 
-	m_Filestream << m_StringBuffer.GetString();
-	m_Filestream.flush();
+	if ( IsInMemory() )
+		return true;
 
-	return true;
+	return WriteFileAtomic( m_sFilename, std::string_view{ m_StringBuffer.GetString(), m_StringBuffer.GetSize() } );
 }
 
 bool JSONSerializer::Reset( const std::string& sFilename )
@@ -87,14 +89,12 @@ bool JSONSerializer::Reset( const std::string& sFilename )
 		return false;
 	}
 
-	if ( m_Filestream.is_open() )
-		m_Filestream.close();
-
-	m_Filestream.open( sFilename, std::ios::out | std::ios::trunc );
-	SCION_ASSERT( m_Filestream.is_open() && "Failed to open file!" );
+	CheckFile( sFilename );
+	m_sFilename = sFilename;
 
-	if ( !m_Filestream.is_open() )
-		throw std::runtime_error( fmt::format( "JSONSerializer failed to open file [{}]", sFilename ) );
+	// Start the new document with a clean buffer
+	m_StringBuffer.Clear();
+	Write( [ this ]( auto& writer ) { writer.Reset( m_StringBuffer ); } );
 
 	return true;
 }
@@ -102,26 +102,31 @@ bool JSONSerializer::Reset( const std::string& sFilename )
 JSONSerializer& JSONSerializer::StartNewObject( const std::string& key )
 {
 	++m_NumObjectsStarted;
-	if ( !key.empty() )
-		m_pWriter->Key( key.c_str() );
+	Write( [ &key ]( auto& writer ) {
+		if ( !key.empty() )
+			writer.Key( key.c_str() );
+
+		writer.StartObject();
+	} );
 
-	m_pWriter->StartObject();
 	return *this;
 }
 JSONSerializer& JSONSerializer::EndObject()
 {
 	SCION_ASSERT( m_NumObjectsStarted > 1 && "EndObject() called too many times!" );
 	--m_NumObjectsStarted;
-	m_pWriter->EndObject();
+	Write( []( auto& writer ) { writer.EndObject(); } );
 	return *this;
 }
 
 JSONSerializer& JSONSerializer::StartNewArray( const std::string& key )
 {
 	++m_NumArraysStarted;
-	m_pWriter->Key( key.c_str() );
+	Write( [ &key ]( auto& writer ) {
+		writer.Key( key.c_str() );
+		writer.StartArray();
+	} );
 
-	m_pWriter->StartArray();
 	return *this;
 }
 
@@ -129,16 +134,48 @@ JSONSerializer& JSONSerializer::EndArray()
 {
 	SCION_ASSERT( m_NumArraysStarted > 0 && "EndArray() called too many times!" );
 	--m_NumArraysStarted;
-	m_pWriter->EndArray();
+	Write( []( auto& writer ) { writer.EndArray(); } );
 	return *this;
 }
 
 JSONSerializer& JSONSerializer::AddKeyValuePair( const std::string& key, const bool& value )
 {
-	m_pWriter->Key( key.c_str() );
-	m_pWriter->Bool( value );
+	Write( [ & ]( auto& writer ) {
+		writer.Key( key.c_str() );
+		writer.Bool( value );
+	} );
 
 	return *this;
 }
 
+void JSONSerializer::CreateWriter( int maxDecimalPlaces, bool bPrettyPrint )
+{
+	const int decimalPlaces = maxDecimalPlaces > 1 ? maxDecimalPlaces : MAX_DECIMAL_PLACES;
+
+	if ( bPrettyPrint )
+	{
+		m_Writer = std::make_unique<PrettyWriter>( m_StringBuffer );
+	}
+	else
+	{
+		m_Writer = std::make_unique<CompactWriter>( m_StringBuffer );
+	}
+
+	Write( [ decimalPlaces ]( auto& writer ) { writer.SetMaxDecimalPlaces( decimalPlaces ); } );
+}
+
+void JSONSerializer::CheckFile( const std::string& sFilename )
+{
+	/*
+	 * Nothing is written until the document is ended; however, we still want to fail early
+	 * if the file cannot be opened. Opening in append mode creates the file if needed
+	 * without destroying the current contents.
+	 */
+	std::ofstream file{ sFilename, std::ios::out | std::ios::app };
+	SCION_ASSERT( file.is_open() && "Failed to open file!" );
+
+	if ( !file.is_open() )
+		throw std::runtime_error( fmt::format( "JSONSerializer failed to open file [{}]", sFilename ) );
+}
+
 } // namespace Scion::Filesystem
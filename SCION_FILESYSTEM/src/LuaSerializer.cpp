@@ -1,4 +1,6 @@
 #include "ScionFilesystem/Serializers/LuaSerializer.h"
+#include "ScionFilesystem/Utilities/FilesystemUtilities.h"
+#include "ScionFilesystem/Utilities/AsyncFileWriter.h"
 #include "Logger/Logger.h"
 #include <set>
 #include <algorithm>
@@ -7,6 +9,7 @@ constexpr char SEPARATOR = ',';
 constexpr char INDENT = '\t';
 constexpr char NEW_LINE = '\n';
 constexpr char SPACE = ' ';
+constexpr size_t INITIAL_BUFFER_SIZE = 16 * 1024;
 
 #define SPECIAL_CASES                                                                                                  \
 	std::set<char>                                                                                                     \
@@ -17,42 +20,42 @@ constexpr char SPACE = ' ';
 namespace Scion::Filesystem
 {
 LuaSerializer::LuaSerializer( const std::string& sFilepath )
-	: m_FileStream{}
+	: m_Buffer{}
 	, m_sFilepath{ sFilepath }
 	, m_NumIndents{ 0 }
 	, m_NumTablesStarted{ 0 }
 	, m_bStreamStarted{ false }
 	, m_bValueAdded{ false }
 	, m_bNewLineAdded{ false }
+	, m_bStreamWritten{ false }
 {
-	m_FileStream.open( sFilepath, std::ios::out | std::ios::trunc );
-	SCION_ASSERT( m_FileStream.is_open() /*&&
-				  fmt::format( "LuaSerialization failed. Failed to open file [{}]", sFilename )*/ );
-
-	if ( !m_FileStream.is_open() )
+	if ( !CheckFile( sFilepath ) )
 		throw std::runtime_error( fmt::format( "LuaSerialization failed. Failed to open file [{}]", sFilepath ) );
+
+	m_Buffer.reserve( INITIAL_BUFFER_SIZE );
 }
 
 
 LuaSerializer::~LuaSerializer()
 {
-	if ( m_FileStream.is_open() )
-		m_FileStream.close();
+	// Streams that were never finished are still written, matching the old unbuffered behavior.
+	if ( !m_bStreamWritten )
+		WriteStream();
 }
 
 bool LuaSerializer::ResetStream( const std::string& sNewFilename )
 {
-	if ( m_FileStream.is_open() )
-	{
-		m_FileStream.close();
-		m_bNewLineAdded = false;
-		m_bValueAdded = false;
-		m_bStreamStarted = false;
-		m_sFilepath = sNewFilename;
-	}
+	if ( !m_bStreamWritten )
+		WriteStream();
+
+	m_Buffer.clear();
+	m_bNewLineAdded = false;
+	m_bValueAdded = false;
+	m_bStreamStarted = false;
+	m_bStreamWritten = false;
+	m_sFilepath = sNewFilename;
 
-	m_FileStream.open( sNewFilename, std::ios::out | std::ios::trunc );
-	return m_FileStream.is_open();
+	return CheckFile( sNewFilename );
 }
 
 bool LuaSerializer::FinishStream()
@@ -60,6 +63,18 @@ bool LuaSerializer::FinishStream()
 	SCION_ASSERT( m_NumTablesStarted == 0 && "Too many tables started! Did you forget to call EndTable()?" );
 	SCION_ASSERT( m_NumIndents == 0 && "Indent count should be zero when ending the document!" );
 	Stream( NEW_LINE );
+	return WriteStream();
+}
+
+bool LuaSerializer::FinishStream( AsyncFileWriter& fileWriter )
+{
+	SCION_ASSERT( m_NumTablesStarted == 0 && "Too many tables started! Did you forget to call EndTable()?" );
+	SCION_ASSERT( m_NumIndents == 0 && "Indent count should be zero when ending the document!" );
+	Stream( NEW_LINE );
+
+	m_bStreamWritten = true;
+	fileWriter.Write( m_sFilepath, std::move( m_Buffer ) );
+	m_Buffer.clear();
 	return true;
 }
 
@@ -160,6 +175,20 @@ void LuaSerializer::SeparateValues( bool bNewLine )
 		AddNewLine();
 }
 
+bool LuaSerializer::WriteStream()
+{
+	m_bStreamWritten = true;
+	return WriteFileAtomic( m_sFilepath, m_Buffer );
+}
+
+bool LuaSerializer::CheckFile( const std::string& sFilepath )
+{
+	// Append mode creates the file if needed without destroying the contents before the stream is written.
+	std::ofstream file{ sFilepath, std::ios::out | std::ios::app };
+	SCION_ASSERT( file.is_open() && "LuaSerialization failed. Failed to open file." );
+	return file.is_open();
+}
+
 std::string LuaSerializer::AddQuotes( const std::string& str )
 {
 	std::string quotedStr{ "\"" };
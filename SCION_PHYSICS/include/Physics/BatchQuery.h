@@ -0,0 +1,104 @@
+#pragma once
+#include <box2d/box2d.h>
+#include <entt/entt.hpp>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace Scion::Utilities
+{
+class ThreadPool;
+}
+
+namespace Scion::Physics
+{
+struct RayQuery
+{
+	b2Vec2 start{ 0.f, 0.f };
+	b2Vec2 end{ 0.f, 0.f };
+	/* Only fixtures with a category bit in the mask are hit. */
+	std::uint16_t maskBits{ 0xFFFF };
+	/* Should sensors be hit? */
+	bool bHitSensors{ false };
+};
+
+struct RayQueryResult
+{
+	std::uint32_t entityID{ entt::null };
+	b2Vec2 point{ 0.f, 0.f };
+	b2Vec2 normal{ 0.f, 0.f };
+	/* The fraction along the ray of the closest hit. */
+	float fraction{ 1.f };
+	bool bHit{ false };
+};
+
+struct BoxQuery
+{
+	b2AABB aabb{};
+	/* Only fixtures with a category bit in the mask are found. */
+	std::uint16_t maskBits{ 0xFFFF };
+};
+
+struct BoxQueryResult
+{
+	/* The index of the first entity found by this query in the shared entity buffer. */
+	std::uint32_t first{ 0 };
+	std::uint32_t count{ 0 };
+};
+
+/*
+ * BatchQuery
+ * Runs many ray casts or box overlap queries against a world at once.
+ * The queries only read the broadphase, so they are split across the worker threads of the
+ * thread pool when one is given. The world must not be stepped or changed while a batch runs;
+ * the batch functions block until all queries are finished.
+ */
+class BatchQuery
+{
+  public:
+	/*
+	 * @param The thread pool to run the queries on. If null, queries run on the calling thread.
+	 * @param The smallest number of queries worth sending to another thread.
+	 */
+	BatchQuery( std::shared_ptr<Scion::Utilities::ThreadPool> pThreadPool = nullptr, size_t minQueriesPerTask = 32 );
+	~BatchQuery() = default;
+
+	/*
+	 * @brief Finds the closest hit of every ray.
+	 * @param The world to query.
+	 * @param The rays in meters.
+	 * @param Resized to the number of rays. The result of each ray is at the same index.
+	 */
+	void RayCast( const b2World& world, std::span<const RayQuery> queries, std::vector<RayQueryResult>& outResults );
+
+	/*
+	 * @brief Finds the entities overlapping every box.
+	 * @param The world to query.
+	 * @param The boxes in meters.
+	 * @param Resized to the number of boxes. Each result is a range in the entity buffer.
+	 * @param The entities found by all queries, packed one query after another.
+	 */
+	void QueryBoxes( const b2World& world, std::span<const BoxQuery> queries, std::vector<BoxQueryResult>& outResults,
+					 std::vector<std::uint32_t>& outEntities );
+
+	inline void SetThreadPool( std::shared_ptr<Scion::Utilities::ThreadPool> pThreadPool )
+	{
+		m_pThreadPool = std::move( pThreadPool );
+	}
+
+  private:
+	/* @brief Gets how many queries each task runs, so the work is spread over the pool. */
+	size_t GetTaskSize( size_t count ) const;
+
+	/* @brief Splits the queries into tasks and calls func( taskIndex, begin, end ) for each. */
+	template <typename TFunc>
+	void ParallelFor( size_t count, TFunc&& func );
+
+  private:
+	std::shared_ptr<Scion::Utilities::ThreadPool> m_pThreadPool;
+	size_t m_MinQueriesPerTask;
+	/* The entities found by each task of a box query, merged once all tasks are done. */
+	std::vector<std::vector<std::uint32_t>> m_TaskEntities;
+};
+} // namespace Scion::Physics
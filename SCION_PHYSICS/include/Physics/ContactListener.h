@@ -1,12 +1,57 @@
 #pragma once
 #include "Box2DWrappers.h"
 #include "UserData.h"
+#include <span>
 
 namespace Scion::Physics
 {
+enum class EContactType : std::uint8_t
+{
+	Begin,
+	End,
+	PreSolve,
+	PostSolve
+};
+
+/*
+ * ContactRecord
+ * A single contact callback from a physics step. Records are plain data so the whole
+ * step can be stored in a reused array and handed off in bulk. Positions and normals are in meters.
+ */
+struct ContactRecord
+{
+	std::uint32_t entityA{ entt::null };
+	std::uint32_t entityB{ entt::null };
+	/* The index of the fixture in its body, in the order the fixtures were created. */
+	std::uint16_t fixtureA{ 0 };
+	std::uint16_t fixtureB{ 0 };
+	EContactType eType{ EContactType::Begin };
+	bool bSensor{ false };
+	/* World normal pointing from A to B. Only set for PreSolve and PostSolve. */
+	b2Vec2 normal{ 0.f, 0.f };
+	/* The first world contact point. Only set for PreSolve and PostSolve. */
+	b2Vec2 point{ 0.f, 0.f };
+	/* The summed impulses of all contact points. Only set for PostSolve. */
+	float normalImpulse{ 0.f };
+	float tangentImpulse{ 0.f };
+};
+
+static_assert( std::is_trivially_copyable_v<ContactRecord> );
+
+/*
+ * ContactListener
+ * Records every contact of a physics step into a preallocated buffer. The buffer is double buffered,
+ * FinishStep() should be called after every step to publish the recorded contacts. The published
+ * contacts stay valid until the next call to FinishStep(), and neither buffer is released, so after
+ * the first few steps no memory is allocated.
+ */
 class ContactListener : public b2ContactListener
 {
   public:
+	/*
+	 * @param The number of contact records to reserve up front.
+	 */
+	explicit ContactListener( size_t initialCapacity = 1024 );
 	/*
 	 * @brief Called when two fixtures begin to touch.
 	 * @param b2Contact*
@@ -38,14 +83,39 @@ class ContactListener : public b2ContactListener
 	 */
 	void PreSolve( b2Contact* contact, const b2Manifold* oldManifold ) override;
 
+	/*
+	 * @brief Publishes the contacts recorded since the last call and starts recording a new step.
+	 */
+	void FinishStep();
+
+	/*
+	 * @brief Gets the contacts recorded in the last finished step.
+	 */
+	inline std::span<const ContactRecord> GetContacts() const { return m_Contacts; }
+
+	/*
+	 * @brief PreSolve and PostSolve are called for every touching contact every step. They are only
+	 * recorded if enabled. Begin and End contacts are always recorded.
+	 */
+	inline void SetRecordSolveContacts( bool bRecord ) { m_bRecordSolveContacts = bRecord; }
+	inline bool IsRecordingSolveContacts() const { return m_bRecordSolveContacts; }
+
+	/* @brief The last begin contact pair. Kept for scripts that poll a single contact. */
 	UserData* GetUserDataA() { return m_pUserDataA; }
 	UserData* GetUserDataB() { return m_pUserDataB; }
 
   private:
 	void SetUserContacts( UserData* a, UserData* b );
+	ContactRecord& RecordContact( b2Contact* contact, EContactType eType );
 
   private:
 	UserData* m_pUserDataA{ nullptr };
 	UserData* m_pUserDataB{ nullptr };
+
+	/* Contacts of the step in progress. */
+	std::vector<ContactRecord> m_RecordingContacts;
+	/* Contacts of the last finished step. */
+	std::vector<ContactRecord> m_Contacts;
+	bool m_bRecordSolveContacts{ false };
 };
 } // namespace Scion::Physics
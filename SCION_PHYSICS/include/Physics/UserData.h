@@ -1,23 +1,153 @@
 #pragma once
 #include <cstdint>
-#include <any>
+#include <limits>
+#include <optional>
 #include <string>
+#include <string_view>
 #include <sstream>
 #include <vector>
 #include <entt/entt.hpp>
 
 namespace Scion::Physics
 {
+enum EObjectFlags : std::uint8_t
+{
+	OBJECT_FLAG_NONE = 0,
+	OBJECT_FLAG_COLLIDER = 1 << 0,
+	OBJECT_FLAG_TRIGGER = 1 << 1,
+	OBJECT_FLAG_FRIENDLY = 1 << 2
+};
+
+constexpr std::uint32_t NULL_CONTACT_INDEX = std::numeric_limits<std::uint32_t>::max();
+
+/*
+ * UserData
+ * The data every physics body and its fixtures point to. It is plain data, tags are interned
+ * into ids and groups into bits of a mask, so checking what a body is only takes an integer
+ * compare. UserData lives in the UserDataPool and is released when its body is destroyed.
+ */
 struct UserData
 {
-	std::any userData{};
-	std::uint32_t type_id{ 0 };
+	std::uint32_t entityID{ entt::null };
+	/* The interned tag. 0 if the body has no tag. */
+	std::uint32_t tagID{ 0 };
+	/* One bit per interned group. 0 if the body has no group. */
+	std::uint32_t groupMask{ 0 };
+	/* The first node of this body's contacts in the ContactPool. */
+	std::uint32_t contactHead{ NULL_CONTACT_INDEX };
+	std::uint8_t flags{ OBJECT_FLAG_NONE };
+
+	inline bool HasFlag( EObjectFlags eFlag ) const { return ( flags & eFlag ) != 0; }
+	inline bool HasTag( std::uint32_t id ) const { return tagID == id; }
+	inline bool InGroup( std::uint32_t mask ) const { return ( groupMask & mask ) != 0; }
+};
+
+static_assert( std::is_trivially_copyable_v<UserData> );
+
+/*
+ * FixtureData
+ * What each fixture points to. The fixtures of a body share the body's UserData, the fixture
+ * data adds the index of the fixture in its body so contacts can report it without walking
+ * the fixture list. FixtureData lives in the FixtureDataPool and is released with its body.
+ */
+struct FixtureData
+{
+	UserData* pUserData{ nullptr };
+	/*
+	 * The entity of the fixture when it is not the entity of the body, such as a tile of a
+	 * merged tile collider. Null if the fixture belongs to the body's entity.
+	 */
+	std::uint32_t entityID{ entt::null };
+	/* The index of the fixture in its body, in the order the fixtures were created. */
+	std::uint16_t fixtureIndex{ 0 };
+
+	/* @brief Gets the entity of the fixture, falling back to the entity of its body. */
+	inline std::uint32_t GetEntity() const
+	{
+		if ( entityID != entt::null )
+			return entityID;
+
+		return pUserData ? pUserData->entityID : static_cast<std::uint32_t>( entt::null );
+	}
+};
+
+static_assert( std::is_trivially_copyable_v<FixtureData> );
+
+/*
+ * ObjectTags
+ * Interns the tag and group names used by physics bodies.
+ * Tags get sequential ids, groups each get a single bit so a body can be tested
+ * against several groups at once. There is room for 32 groups, new groups past that are
+ * rejected instead of getting an empty mask, which would match no group and every body alike.
+ */
+class ObjectTags
+{
+  public:
+	/* @brief Gets the id of the tag, adding it if it does not exist. Returns 0 for an empty tag. */
+	static std::uint32_t GetTagID( std::string_view sTag );
+	static const std::string& GetTagName( std::uint32_t tagID );
+
+	/*
+	 * @brief Gets the bit of the group, adding it if it does not exist. Returns 0 for an empty group.
+	 * @return Returns an empty optional if the group is new and all 32 groups are taken.
+	 */
+	static std::optional<std::uint32_t> GetGroupMask( std::string_view sGroup );
+	/* @brief Gets the bit of the group without adding it. Returns 0 if the group does not exist. */
+	static std::uint32_t FindGroupMask( std::string_view sGroup );
+	/* @brief Gets the name of the lowest group set in the mask. */
+	static const std::string& GetGroupName( std::uint32_t groupMask );
+};
+
+/*
+ * UserDataPool
+ * Stable storage for the user data of physics bodies. Data is allocated in blocks and
+ * reused, so creating and destroying bodies does not allocate once the pool has grown.
+ */
+class UserDataPool
+{
+  public:
+	static UserData* Acquire( const UserData& userData );
+	/* @brief Clears the contacts of the user data and returns it to the pool. */
+	static void Release( UserData* pUserData );
+};
+
+/*
+ * FixtureDataPool
+ * Stable storage for the fixture data of physics bodies, pooled the same way as the UserDataPool.
+ */
+class FixtureDataPool
+{
+  public:
+	static FixtureData* Acquire( const FixtureData& fixtureData );
+	static void Release( FixtureData* pFixtureData );
+};
+
+/*
+ * ContactPool
+ * Keeps the list of bodies each body is touching. The lists are linked through a single
+ * pooled array of nodes, the head of each list is stored in the UserData.
+ */
+class ContactPool
+{
+  public:
+	/*
+	 * @brief Adds other to the contacts of owner. Bodies without a tag or group, bodies with the
+	 * same tag and group and friendly triggers are not added.
+	 * @return Returns true if the contact was added.
+	 */
+	static bool AddContact( UserData& owner, const UserData& other );
+	static bool RemoveContact( UserData& owner, const UserData& other );
+	static void ClearContacts( UserData& owner );
+
+	/* @brief Gets the user data of every body the owner is touching. */
+	static void GetContacts( const UserData& owner, std::vector<const UserData*>& outContacts );
 };
 
 /*
 * ObjectData
 * Currently this struct is used for all Rigidbodies in Scion2D.
-* This is waht the user data is set to and checked for in the contact listerer bindings.
+* ObjectData is the editable and scriptable form of the UserData of a body, with the tag and
+* group as strings. It is converted to UserData when the body is created.
 * You may need a specific user data setup for your own specific needs; however,
 * you can always use the tag and group to do different functions on the body as needed.
 *
@@ -52,19 +182,25 @@ struct ObjectData
 	ObjectData( const std::string& tag, const std::string& group, bool collider, bool trigger, bool friendly,
 				std::uint32_t entityId = entt::null );
 
-	inline const std::vector<const ObjectData*>& GetContactEntities() const { return contactEntities; }
+	/*
+	 * @brief Creates the object data from the user data of a body.
+	 * @param The user data to copy.
+	 * @param If true, the bodies the user data is touching are copied into the contact entities.
+	 */
+	explicit ObjectData( const UserData& userData, bool bWithContacts = false );
 
-	friend bool operator==( const ObjectData& a, const ObjectData& b );
-	[[nodiscard]] std::string to_string() const;
+	/*
+	 * @brief Interns the tag and group and creates the user data for a body.
+	 * @return Returns an empty optional if the group could not be added.
+	 */
+	[[nodiscard]] std::optional<UserData> ToUserData() const;
 
-  private:
-	bool AddContact( const ObjectData* objectData );
-	bool RemoveContact( const ObjectData* objectData );
-	void ClearContacts() { contactEntities.clear(); }
+	inline const std::vector<ObjectData>& GetContactEntities() const { return contactEntities; }
 
-	friend class ContactListener;
+	friend bool operator==( const ObjectData& a, const ObjectData& b );
+	[[nodiscard]] std::string to_string() const;
 
   private:
-	std::vector<const ObjectData*> contactEntities;
+	std::vector<ObjectData> contactEntities;
 };
 } // namespace Scion::Physics
@@ -0,0 +1,226 @@
+#include "Physics/BatchQuery.h"
+#include "Physics/UserData.h"
+#include <ScionUtilities/ThreadPool.h>
+#include <Logger/Logger.h>
+
+namespace
+{
+std::uint32_t GetFixtureEntity( b2Fixture* pFixture )
+{
+	auto* pFixtureData = reinterpret_cast<Scion::Physics::FixtureData*>( pFixture->GetUserData().pointer );
+	return pFixtureData ? pFixtureData->GetEntity() : static_cast<std::uint32_t>( entt::null );
+}
+
+/* Keeps the closest fixture along the ray that passes the mask. Lives on the stack of the worker. */
+class ClosestRayCallback : public b2RayCastCallback
+{
+  public:
+	ClosestRayCallback( const Scion::Physics::RayQuery& query, Scion::Physics::RayQueryResult& result )
+		: m_Query{ query }
+		, m_Result{ result }
+	{
+	}
+
+	virtual float ReportFixture( b2Fixture* pFixture, const b2Vec2& point, const b2Vec2& normal,
+								 float fraction ) override
+	{
+		if ( ( pFixture->GetFilterData().categoryBits & m_Query.maskBits ) == 0 )
+			return -1.f;
+
+		if ( pFixture->IsSensor() && !m_Query.bHitSensors )
+			return -1.f;
+
+		m_Result.bHit = true;
+		m_Result.entityID = GetFixtureEntity( pFixture );
+		m_Result.point = point;
+		m_Result.normal = normal;
+		m_Result.fraction = fraction;
+
+		// Clip the ray so only closer fixtures are reported.
+		return fraction;
+	}
+
+  private:
+	const Scion::Physics::RayQuery& m_Query;
+	Scion::Physics::RayQueryResult& m_Result;
+};
+
+class BoxOverlapCallback : public b2QueryCallback
+{
+  public:
+	BoxOverlapCallback( const Scion::Physics::BoxQuery& query, std::vector<std::uint32_t>& entities )
+		: m_Query{ query }
+		, m_Entities{ entities }
+	{
+	}
+
+	virtual bool ReportFixture( b2Fixture* pFixture ) override
+	{
+		if ( ( pFixture->GetFilterData().categoryBits & m_Query.maskBits ) == 0 )
+			return true;
+
+		for ( int i = 0; i < pFixture->GetShape()->GetChildCount(); ++i )
+		{
+			if ( b2TestOverlap( pFixture->GetAABB( i ), m_Query.aabb ) )
+			{
+				const auto entityID = GetFixtureEntity( pFixture );
+				if ( entityID != entt::null )
+					m_Entities.push_back( entityID );
+
+				break;
+			}
+		}
+
+		return true;
+	}
+
+  private:
+	const Scion::Physics::BoxQuery& m_Query;
+	std::vector<std::uint32_t>& m_Entities;
+};
+
+} // namespace
+
+namespace Scion::Physics
+{
+
+BatchQuery::BatchQuery( std::shared_ptr<Scion::Utilities::ThreadPool> pThreadPool, size_t minQueriesPerTask )
+	: m_pThreadPool{ std::move( pThreadPool ) }
+	, m_MinQueriesPerTask{ std::max<size_t>( minQueriesPerTask, 1 ) }
+{
+}
+
+size_t BatchQuery::GetTaskSize( size_t count ) const
+{
+	if ( !m_pThreadPool )
+		return std::max<size_t>( count, 1 );
+
+	// The calling thread runs a task as well.
+	const size_t numThreads = std::max<size_t>( std::thread::hardware_concurrency(), 1 );
+	return std::max( m_MinQueriesPerTask, ( count + numThreads - 1 ) / numThreads );
+}
+
+template <typename TFunc>
+void BatchQuery::ParallelFor( size_t count, TFunc&& func )
+{
+	const size_t taskSize = GetTaskSize( count );
+	const size_t numTasks = ( count + taskSize - 1 ) / taskSize;
+
+	if ( numTasks <= 1 || !m_pThreadPool )
+	{
+		func( size_t{ 0 }, size_t{ 0 }, count );
+		return;
+	}
+
+	std::vector<std::future<void>> futures;
+	futures.reserve( numTasks - 1 );
+
+	try
+	{
+		for ( size_t task = 1; task < numTasks; ++task )
+		{
+			const size_t begin = task * taskSize;
+			const size_t end = std::min( begin + taskSize, count );
+			futures.push_back( m_pThreadPool->Enqueue( [ &func, task, begin, end ] { func( task, begin, end ); } ) );
+		}
+	}
+	catch ( const std::exception& ex )
+	{
+		SCION_ERROR( "Failed to enqueue batch query tasks: {}", ex.what() );
+
+		// Run whatever could not be enqueued on this thread.
+		for ( size_t task = futures.size() + 1; task < numTasks; ++task )
+		{
+			const size_t begin = task * taskSize;
+			func( task, begin, std::min( begin + taskSize, count ) );
+		}
+	}
+
+	func( size_t{ 0 }, size_t{ 0 }, std::min( taskSize, count ) );
+
+	for ( auto& future : futures )
+	{
+		future.get();
+	}
+}
+
+void BatchQuery::RayCast( const b2World& world, std::span<const RayQuery> queries,
+						  std::vector<RayQueryResult>& outResults )
+{
+	outResults.assign( queries.size(), RayQueryResult{} );
+	if ( queries.empty() )
+		return;
+
+	// Every ray writes only to its own result, so the tasks share nothing.
+	ParallelFor( queries.size(), [ & ]( size_t, size_t begin, size_t end ) {
+		for ( size_t i = begin; i < end; ++i )
+		{
+			const auto& query = queries[ i ];
+			if ( ( query.end - query.start ).LengthSquared() <= 0.f )
+				continue;
+
+			ClosestRayCallback callback{ query, outResults[ i ] };
+			world.RayCast( &callback, query.start, query.end );
+		}
+	} );
+}
+
+void BatchQuery::QueryBoxes( const b2World& world, std::span<const BoxQuery> queries,
+							 std::vector<BoxQueryResult>& outResults, std::vector<std::uint32_t>& outEntities )
+{
+	outResults.assign( queries.size(), BoxQueryResult{} );
+	outEntities.clear();
+	if ( queries.empty() )
+		return;
+
+	const size_t taskSize = GetTaskSize( queries.size() );
+	const size_t numTasks = ( queries.size() + taskSize - 1 ) / taskSize;
+
+	if ( m_TaskEntities.size() < numTasks )
+		m_TaskEntities.resize( numTasks );
+
+	// Each task fills its own buffer. The results first point into that buffer.
+	ParallelFor( queries.size(), [ & ]( size_t task, size_t begin, size_t end ) {
+		auto& entities = m_TaskEntities[ task ];
+		entities.clear();
+
+		for ( size_t i = begin; i < end; ++i )
+		{
+			const auto first = entities.size();
+
+			BoxOverlapCallback callback{ queries[ i ], entities };
+			world.QueryAABB( &callback, queries[ i ].aabb );
+
+			// A body with several fixtures is reported once per fixture.
+			std::sort( entities.begin() + first, entities.end() );
+			entities.erase( std::unique( entities.begin() + first, entities.end() ), entities.end() );
+
+			outResults[ i ].first = static_cast<std::uint32_t>( first );
+			outResults[ i ].count = static_cast<std::uint32_t>( entities.size() - first );
+		}
+	} );
+
+	size_t totalEntities{ 0 };
+	for ( size_t task = 0; task < numTasks; ++task )
+	{
+		totalEntities += m_TaskEntities[ task ].size();
+	}
+
+	outEntities.reserve( totalEntities );
+
+	for ( size_t task = 0; task < numTasks; ++task )
+	{
+		const auto offset = static_cast<std::uint32_t>( outEntities.size() );
+		const size_t begin = task * taskSize;
+		const size_t end = std::min( begin + taskSize, queries.size() );
+
+		for ( size_t i = begin; i < end; ++i )
+		{
+			outResults[ i ].first += offset;
+		}
+
+		outEntities.insert( outEntities.end(), m_TaskEntities[ task ].begin(), m_TaskEntities[ task ].end() );
+	}
+}
+
+} // namespace Scion::Physics
@@ -1,9 +1,25 @@
 #include "Physics/Box2DWrappers.h"
+#include "Physics/UserData.h"
 
 namespace Scion::Physics
 {
 void BodyDestroyer::operator()( b2Body* body ) const
 {
+	// Destroying the body ends its contacts, which still need the user and fixture data.
+	static thread_local std::vector<FixtureData*> fixtureData;
+	fixtureData.clear();
+	for ( auto* pFixture = body->GetFixtureList(); pFixture; pFixture = pFixture->GetNext() )
+	{
+		fixtureData.push_back( reinterpret_cast<FixtureData*>( pFixture->GetUserData().pointer ) );
+	}
+
+	auto* pUserData = reinterpret_cast<UserData*>( body->GetUserData().pointer );
 	body->GetWorld()->DestroyBody( body );
+	UserDataPool::Release( pUserData );
+
+	for ( auto* pFixtureData : fixtureData )
+	{
+		FixtureDataPool::Release( pFixtureData );
+	}
 }
 } // namespace Scion::Physics
@@ -1,104 +1,117 @@
 #include "Physics/ContactListener.h"
 #include <Logger/Logger.h>
 
-#include <entt/entt.hpp>
+namespace
+{
+Scion::Physics::FixtureData* GetFixtureData( b2Fixture* pFixture )
+{
+	return pFixture ? reinterpret_cast<Scion::Physics::FixtureData*>( pFixture->GetUserData().pointer ) : nullptr;
+}
+
+Scion::Physics::UserData* GetUserData( b2Fixture* pFixture )
+{
+	auto* pFixtureData = GetFixtureData( pFixture );
+	return pFixtureData ? pFixtureData->pUserData : nullptr;
+}
+
+std::uint16_t GetFixtureIndex( b2Fixture* pFixture )
+{
+	auto* pFixtureData = GetFixtureData( pFixture );
+	return pFixtureData ? pFixtureData->fixtureIndex : 0;
+}
+} // namespace
 
 namespace Scion::Physics
 {
 
+ContactListener::ContactListener( size_t initialCapacity )
+{
+	m_RecordingContacts.reserve( initialCapacity );
+	m_Contacts.reserve( initialCapacity );
+}
+
+void ContactListener::FinishStep()
+{
+	// Swapping keeps the capacity of both buffers, so nothing is reallocated.
+	m_Contacts.swap( m_RecordingContacts );
+	m_RecordingContacts.clear();
+}
+
 void ContactListener::SetUserContacts( UserData* a, UserData* b )
 {
 	m_pUserDataA = a;
 	m_pUserDataB = b;
 }
 
-void ContactListener::BeginContact( b2Contact* contact )
+ContactRecord& ContactListener::RecordContact( b2Contact* contact, EContactType eType )
 {
 	auto* fixtureA = contact->GetFixtureA();
 	auto* fixtureB = contact->GetFixtureB();
 
-	if ( !fixtureA || !fixtureB || !fixtureA->GetUserData().pointer || !fixtureB->GetUserData().pointer )
-	{
-		SetUserContacts( nullptr, nullptr );
-		return;
-	}
-
-	UserData* a_data = reinterpret_cast<UserData*>( fixtureA->GetUserData().pointer );
-	UserData* b_data = reinterpret_cast<UserData*>( fixtureB->GetUserData().pointer );
+	auto& record = m_RecordingContacts.emplace_back();
+	record.eType = eType;
+	record.fixtureA = GetFixtureIndex( fixtureA );
+	record.fixtureB = GetFixtureIndex( fixtureB );
+	record.bSensor = fixtureA->IsSensor() || fixtureB->IsSensor();
 
-	constexpr auto expectedType = entt::type_hash<ObjectData>::value();
+	// Fixtures of merged bodies report their own entity rather than the entity of the body.
+	if ( auto* pFixtureDataA = GetFixtureData( fixtureA ) )
+		record.entityA = pFixtureDataA->GetEntity();
 
-	if ( !a_data || !b_data || a_data->type_id != expectedType || b_data->type_id != expectedType )
-	{
-		SetUserContacts( nullptr, nullptr );
-		return;
-	}
+	if ( auto* pFixtureDataB = GetFixtureData( fixtureB ) )
+		record.entityB = pFixtureDataB->GetEntity();
 
-	try
+	if ( eType == EContactType::PreSolve || eType == EContactType::PostSolve )
 	{
-		auto* a_any = std::any_cast<ObjectData>( &a_data->userData );
-		auto* b_any = std::any_cast<ObjectData>( &b_data->userData );
+		b2WorldManifold worldManifold;
+		contact->GetWorldManifold( &worldManifold );
+		record.normal = worldManifold.normal;
 
-		a_any->AddContact( b_any );
-		b_any->AddContact( a_any );
-
-		SetUserContacts( a_data, b_data );
-	}
-	catch ( const std::bad_any_cast& ex )
-	{
-		// SCION_ERROR( "Failed to cast user contacts: {}", ex.what() );
-		SetUserContacts( nullptr, nullptr );
-		// Eat this exception for now
+		if ( contact->GetManifold()->pointCount > 0 )
+			record.point = worldManifold.points[ 0 ];
 	}
+
+	return record;
 }
 
-void ContactListener::EndContact( b2Contact* contact )
+void ContactListener::BeginContact( b2Contact* contact )
 {
-	auto* fixtureA = contact->GetFixtureA();
-	auto* fixtureB = contact->GetFixtureB();
+	RecordContact( contact, EContactType::Begin );
 
-	if ( !fixtureA || !fixtureB || !fixtureA->GetUserData().pointer || !fixtureB->GetUserData().pointer )
+	UserData* a_data = GetUserData( contact->GetFixtureA() );
+	UserData* b_data = GetUserData( contact->GetFixtureB() );
+
+	if ( !a_data || !b_data )
 	{
 		SetUserContacts( nullptr, nullptr );
 		return;
 	}
 
-	UserData* a_data = reinterpret_cast<UserData*>( fixtureA->GetUserData().pointer );
-	UserData* b_data = reinterpret_cast<UserData*>( fixtureB->GetUserData().pointer );
+	ContactPool::AddContact( *a_data, *b_data );
+	ContactPool::AddContact( *b_data, *a_data );
+
+	SetUserContacts( a_data, b_data );
+}
+
+void ContactListener::EndContact( b2Contact* contact )
+{
+	RecordContact( contact, EContactType::End );
 
-	constexpr auto expectedType = entt::type_hash<ObjectData>::value();
+	UserData* a_data = GetUserData( contact->GetFixtureA() );
+	UserData* b_data = GetUserData( contact->GetFixtureB() );
 
-	if ( !a_data || !b_data || a_data->type_id != expectedType || b_data->type_id != expectedType )
+	if ( !a_data && b_data )
 	{
-		SetUserContacts( nullptr, nullptr );
-		return;
+		ContactPool::ClearContacts( *b_data );
 	}
-
-	try
+	else if ( a_data && !b_data )
 	{
-		auto* a_any = std::any_cast<ObjectData>( &a_data->userData );
-		auto* b_any = std::any_cast<ObjectData>( &b_data->userData );
-		if (!a_any && b_any)
-		{
-			b_any->ClearContacts();
-			SetUserContacts( nullptr, nullptr );
-			return;
-		}
-
-		if (a_any && !b_any)
-		{
-			a_any->ClearContacts();
-			SetUserContacts( nullptr, nullptr );
-			return;
-		}
-
-		a_any->RemoveContact( b_any );
-		b_any->RemoveContact( a_any );		
+		ContactPool::ClearContacts( *a_data );
 	}
-	catch ( const std::bad_any_cast& ex )
+	else if ( a_data && b_data )
 	{
-		// SCION_ERROR( "Failed to cast user contacts: {}", ex.what() );
-		//  Eat this exception for now
+		ContactPool::RemoveContact( *a_data, *b_data );
+		ContactPool::RemoveContact( *b_data, *a_data );
 	}
 
 	SetUserContacts( nullptr, nullptr );
@@ -106,12 +119,23 @@ void ContactListener::EndContact( b2Contact* contact )
 
 void ContactListener::PostSolve( b2Contact* contact, const b2ContactImpulse* impulse )
 {
-	// TODO: We could probably make some sol::functions that could be setup to be used.
+	if ( !m_bRecordSolveContacts )
+		return;
+
+	auto& record = RecordContact( contact, EContactType::PostSolve );
+	for ( int i = 0; i < impulse->count; ++i )
+	{
+		record.normalImpulse += impulse->normalImpulses[ i ];
+		record.tangentImpulse += impulse->tangentImpulses[ i ];
+	}
 }
 
 void ContactListener::PreSolve( b2Contact* contact, const b2Manifold* oldManifold )
 {
-	// TODO: We could probably make some sol::functions that could be setup to be used.
+	if ( !m_bRecordSolveContacts )
+		return;
+
+	RecordContact( contact, EContactType::PreSolve );
 }
 
 } // namespace Scion::Physics
@@ -1,50 +1,287 @@
 #include "Physics/UserData.h"
 #include <algorithm> // find_if
+#include <array>
+#include <bit>
+#include <memory>
+#include <unordered_map>
 #include <Logger/Logger.h>
 
+namespace
+{
+constexpr size_t USER_DATA_BLOCK_SIZE = 256;
+constexpr size_t MAX_GROUPS = 32;
+
+struct TagStorage
+{
+	/* Index 0 is the empty tag. */
+	std::vector<std::string> tagNames{ std::string{} };
+	std::unordered_map<std::string, std::uint32_t> tagIDs{};
+	std::vector<std::string> groupNames{};
+	std::unordered_map<std::string, std::uint32_t> groupMasks{};
+};
+
+template <typename TData>
+struct PoolStorage
+{
+	std::vector<std::unique_ptr<std::array<TData, USER_DATA_BLOCK_SIZE>>> blocks{};
+	std::vector<TData*> freeList{};
+
+	TData* Acquire()
+	{
+		if ( freeList.empty() )
+		{
+			auto& block = blocks.emplace_back( std::make_unique<std::array<TData, USER_DATA_BLOCK_SIZE>>() );
+
+			freeList.reserve( freeList.size() + USER_DATA_BLOCK_SIZE );
+			for ( auto itr = block->rbegin(); itr != block->rend(); ++itr )
+			{
+				freeList.push_back( &( *itr ) );
+			}
+		}
+
+		TData* pData = freeList.back();
+		freeList.pop_back();
+		return pData;
+	}
+};
+
+using UserDataStorage = PoolStorage<Scion::Physics::UserData>;
+using FixtureDataStorage = PoolStorage<Scion::Physics::FixtureData>;
+
+struct ContactNode
+{
+	const Scion::Physics::UserData* pOther{ nullptr };
+	std::uint32_t next{ Scion::Physics::NULL_CONTACT_INDEX };
+};
+
+struct ContactStorage
+{
+	std::vector<ContactNode> nodes{};
+	std::uint32_t freeHead{ Scion::Physics::NULL_CONTACT_INDEX };
+};
+
+TagStorage& GetTagStorage()
+{
+	static TagStorage storage{};
+	return storage;
+}
+
+UserDataStorage& GetUserDataStorage()
+{
+	static UserDataStorage storage{};
+	return storage;
+}
+
+FixtureDataStorage& GetFixtureDataStorage()
+{
+	static FixtureDataStorage storage{};
+	return storage;
+}
+
+ContactStorage& GetContactStorage()
+{
+	static ContactStorage storage{};
+	return storage;
+}
+
+} // namespace
+
 namespace Scion::Physics
 {
-bool ObjectData::AddContact( const ObjectData* objectData )
+std::uint32_t ObjectTags::GetTagID( std::string_view sTag )
+{
+	if ( sTag.empty() )
+		return 0;
+
+	auto& storage = GetTagStorage();
+	std::string sKey{ sTag };
+
+	if ( auto tagItr = storage.tagIDs.find( sKey ); tagItr != storage.tagIDs.end() )
+		return tagItr->second;
+
+	const auto tagID = static_cast<std::uint32_t>( storage.tagNames.size() );
+	storage.tagNames.push_back( sKey );
+	storage.tagIDs.emplace( std::move( sKey ), tagID );
+
+	return tagID;
+}
+
+const std::string& ObjectTags::GetTagName( std::uint32_t tagID )
 {
-	if ( tag.empty() && group.empty() )
+	auto& storage = GetTagStorage();
+	return tagID < storage.tagNames.size() ? storage.tagNames[ tagID ] : storage.tagNames[ 0 ];
+}
+
+std::optional<std::uint32_t> ObjectTags::GetGroupMask( std::string_view sGroup )
+{
+	if ( sGroup.empty() )
+		return 0;
+
+	auto& storage = GetTagStorage();
+	std::string sKey{ sGroup };
+
+	if ( auto groupItr = storage.groupMasks.find( sKey ); groupItr != storage.groupMasks.end() )
+		return groupItr->second;
+
+	if ( storage.groupNames.size() >= MAX_GROUPS )
+	{
+		SCION_ERROR( "Failed to add physics group [{}]. There can only be [{}] groups.", sKey, MAX_GROUPS );
+		return std::nullopt;
+	}
+
+	const auto groupMask = std::uint32_t{ 1 } << storage.groupNames.size();
+	storage.groupNames.push_back( sKey );
+	storage.groupMasks.emplace( std::move( sKey ), groupMask );
+
+	return groupMask;
+}
+
+std::uint32_t ObjectTags::FindGroupMask( std::string_view sGroup )
+{
+	if ( sGroup.empty() )
+		return 0;
+
+	auto& storage = GetTagStorage();
+	auto groupItr = storage.groupMasks.find( std::string{ sGroup } );
+	return groupItr != storage.groupMasks.end() ? groupItr->second : 0;
+}
+
+const std::string& ObjectTags::GetGroupName( std::uint32_t groupMask )
+{
+	auto& storage = GetTagStorage();
+	if ( groupMask == 0 )
+		return storage.tagNames[ 0 ];
+
+	const auto index = static_cast<size_t>( std::countr_zero( groupMask ) );
+	return index < storage.groupNames.size() ? storage.groupNames[ index ] : storage.tagNames[ 0 ];
+}
+
+UserData* UserDataPool::Acquire( const UserData& userData )
+{
+	UserData* pUserData = GetUserDataStorage().Acquire();
+
+	*pUserData = userData;
+	pUserData->contactHead = NULL_CONTACT_INDEX;
+
+	return pUserData;
+}
+
+void UserDataPool::Release( UserData* pUserData )
+{
+	if ( !pUserData )
+		return;
+
+	ContactPool::ClearContacts( *pUserData );
+	*pUserData = UserData{};
+
+	GetUserDataStorage().freeList.push_back( pUserData );
+}
+
+FixtureData* FixtureDataPool::Acquire( const FixtureData& fixtureData )
+{
+	FixtureData* pFixtureData = GetFixtureDataStorage().Acquire();
+	*pFixtureData = fixtureData;
+	return pFixtureData;
+}
+
+void FixtureDataPool::Release( FixtureData* pFixtureData )
+{
+	if ( !pFixtureData )
+		return;
+
+	*pFixtureData = FixtureData{};
+	GetFixtureDataStorage().freeList.push_back( pFixtureData );
+}
+
+bool ContactPool::AddContact( UserData& owner, const UserData& other )
+{
+	if ( owner.tagID == 0 && owner.groupMask == 0 )
 		return false;
 
-	if ( objectData->tag.empty() && objectData->group.empty() )
+	if ( other.tagID == 0 && other.groupMask == 0 )
 		return false;
 
-	if ( objectData->tag == tag && objectData->group == group )
+	if ( other.tagID == owner.tagID && other.groupMask == owner.groupMask )
 		return false;
 
-	if ( bIsFriendly && objectData->bIsFriendly && bTrigger && objectData->bTrigger )
+	if ( owner.HasFlag( OBJECT_FLAG_FRIENDLY ) && other.HasFlag( OBJECT_FLAG_FRIENDLY ) &&
+		 owner.HasFlag( OBJECT_FLAG_TRIGGER ) && other.HasFlag( OBJECT_FLAG_TRIGGER ) )
+	{
 		return false;
+	}
 
-	auto contactItr = std::find_if( contactEntities.begin(),
-									contactEntities.end(),
-									[ & ]( const ObjectData* contactInfo ) { return *contactInfo == *objectData; } );
+	auto& storage = GetContactStorage();
 
-	if ( contactItr != contactEntities.end() )
-		return false;
+	for ( auto index = owner.contactHead; index != NULL_CONTACT_INDEX; index = storage.nodes[ index ].next )
+	{
+		if ( storage.nodes[ index ].pOther == &other )
+			return false;
+	}
+
+	std::uint32_t newIndex{ storage.freeHead };
+	if ( newIndex != NULL_CONTACT_INDEX )
+	{
+		storage.freeHead = storage.nodes[ newIndex ].next;
+	}
+	else
+	{
+		newIndex = static_cast<std::uint32_t>( storage.nodes.size() );
+		storage.nodes.emplace_back();
+	}
 
-	contactEntities.push_back( objectData );
+	storage.nodes[ newIndex ] = ContactNode{ .pOther = &other, .next = owner.contactHead };
+	owner.contactHead = newIndex;
 
 	return true;
 }
 
-bool ObjectData::RemoveContact( const ObjectData* objectData )
+bool ContactPool::RemoveContact( UserData& owner, const UserData& other )
 {
-	if ( objectData->tag.empty() && objectData->group.empty() )
+	if ( other.tagID == 0 && other.groupMask == 0 )
 		return true;
 
-	auto contactItr = std::remove_if( contactEntities.begin(),
-									  contactEntities.end(),
-									  [ & ]( const ObjectData* contactInfo ) { return *contactInfo == *objectData; } );
+	auto& storage = GetContactStorage();
 
-	if ( contactItr == contactEntities.end() )
-		return false;
+	std::uint32_t* pLink = &owner.contactHead;
+	while ( *pLink != NULL_CONTACT_INDEX )
+	{
+		const auto index = *pLink;
+		auto& node = storage.nodes[ index ];
 
-	contactEntities.erase( contactItr, contactEntities.end() );
+		if ( node.pOther == &other )
+		{
+			*pLink = node.next;
+			node = ContactNode{ .next = storage.freeHead };
+			storage.freeHead = index;
+			return true;
+		}
 
-	return true;
+		pLink = &node.next;
+	}
+
+	return false;
+}
+
+void ContactPool::ClearContacts( UserData& owner )
+{
+	auto& storage = GetContactStorage();
+
+	while ( owner.contactHead != NULL_CONTACT_INDEX )
+	{
+		const auto index = owner.contactHead;
+		owner.contactHead = storage.nodes[ index ].next;
+		storage.nodes[ index ] = ContactNode{ .next = storage.freeHead };
+		storage.freeHead = index;
+	}
+}
+
+void ContactPool::GetContacts( const UserData& owner, std::vector<const UserData*>& outContacts )
+{
+	const auto& storage = GetContactStorage();
+	for ( auto index = owner.contactHead; index != NULL_CONTACT_INDEX; index = storage.nodes[ index ].next )
+	{
+		outContacts.push_back( storage.nodes[ index ].pOther );
+	}
 }
 
 ObjectData::ObjectData( const std::string& tag, const std::string& group, bool collider, bool trigger, bool friendly,
@@ -58,6 +295,45 @@ ObjectData::ObjectData( const std::string& tag, const std::string& group, bool c
 {
 }
 
+ObjectData::ObjectData( const UserData& userData, bool bWithContacts )
+	: tag{ ObjectTags::GetTagName( userData.tagID ) }
+	, group{ ObjectTags::GetGroupName( userData.groupMask ) }
+	, bCollider{ userData.HasFlag( OBJECT_FLAG_COLLIDER ) }
+	, bTrigger{ userData.HasFlag( OBJECT_FLAG_TRIGGER ) }
+	, bIsFriendly{ userData.HasFlag( OBJECT_FLAG_FRIENDLY ) }
+	, entityID{ userData.entityID }
+{
+	if ( !bWithContacts )
+		return;
+
+	std::vector<const UserData*> contacts;
+	ContactPool::GetContacts( userData, contacts );
+
+	contactEntities.reserve( contacts.size() );
+	for ( const auto* pContact : contacts )
+	{
+		contactEntities.emplace_back( *pContact );
+	}
+}
+
+std::optional<UserData> ObjectData::ToUserData() const
+{
+	const auto optGroupMask = ObjectTags::GetGroupMask( group );
+	if ( !optGroupMask )
+		return std::nullopt;
+
+	UserData userData{ .entityID = entityID, .tagID = ObjectTags::GetTagID( tag ), .groupMask = *optGroupMask };
+
+	if ( bCollider )
+		userData.flags |= OBJECT_FLAG_COLLIDER;
+	if ( bTrigger )
+		userData.flags |= OBJECT_FLAG_TRIGGER;
+	if ( bIsFriendly )
+		userData.flags |= OBJECT_FLAG_FRIENDLY;
+
+	return userData;
+}
+
 std::string ObjectData::to_string() const
 {
 	std::stringstream ss;
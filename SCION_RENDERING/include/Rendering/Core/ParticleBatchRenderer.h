@@ -0,0 +1,62 @@
+#pragma once
+#include "Rendering/Essentials/BatchTypes.h"
+#include <span>
+#include <vector>
+
+namespace Scion::Rendering
+{
+class Shader;
+
+/*
+ * ParticleBatchRenderer
+ * Draws particles as instances of one shared quad. Every particle only uploads its instance data,
+ * and all particles that share a texture, uvs and size are drawn with a single instanced call.
+ */
+class ParticleBatchRenderer
+{
+  public:
+	ParticleBatchRenderer();
+	~ParticleBatchRenderer();
+
+	ParticleBatchRenderer( const ParticleBatchRenderer& ) = delete;
+	ParticleBatchRenderer& operator=( const ParticleBatchRenderer& ) = delete;
+
+	void Begin();
+
+	/*
+	 * @brief Adds a batch of particles and returns the instances to fill in.
+	 * The instances are only valid until the next call to AddParticles or End.
+	 * @param The OpenGL texture ID.
+	 * @param The uvs of the texture to use, {u, v, width, height}.
+	 * @param The width and height of a particle at a scale of one.
+	 * @param The number of particles in the batch.
+	 */
+	std::span<ParticleInstance> AddParticles( GLuint textureID, const glm::vec4& uvRect, const glm::vec2& size,
+											  size_t numParticles );
+
+	/* @brief Uploads the instances of every batch in one buffer. */
+	void End();
+
+	/*
+	 * @brief Draws the batches. The particle shader must be enabled, the uvs and size of each batch
+	 * are set as its uniforms.
+	 */
+	void Render( Shader& shader );
+
+	inline size_t NumParticles() const { return m_Instances.size(); }
+
+  private:
+	void Initialize();
+
+  private:
+	GLuint m_VAO{ 0 };
+	GLuint m_QuadVBO{ 0 };
+	GLuint m_InstanceVBO{ 0 };
+	GLuint m_IBO{ 0 };
+	/* The number of instances the instance buffer has room for. */
+	size_t m_InstanceCapacity{ 0 };
+
+	std::vector<ParticleInstance> m_Instances;
+	std::vector<ParticleBatch> m_Batches;
+};
+} // namespace Scion::Rendering
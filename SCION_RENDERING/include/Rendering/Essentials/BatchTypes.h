@@ -58,6 +58,17 @@ struct CircleGlyph
 	CircleVertex bottomRight;
 };
 
+struct ParticleBatch
+{
+	GLuint textureID{ 0 };
+	/* The uvs of the texture every particle of the batch uses. */
+	glm::vec4 uvRect{ 0.f, 0.f, 1.f, 1.f };
+	/* The width and height of a particle at a scale of one. */
+	glm::vec2 size{ 1.f };
+	GLuint firstInstance{ 0 };
+	GLuint numInstances{ 0 };
+};
+
 struct TextBatch
 {
 	GLuint offset{ 0 };
@@ -1,9 +1,26 @@
 #pragma once
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace Scion::Rendering
 {
+/*
+ * BakedFont
+ * The glyph atlas of a font that has been rasterized, but not uploaded to OpenGL yet.
+ */
+struct BakedFont
+{
+	std::vector<unsigned char> bitmap{};
+	/* The stbtt_bakedchar data of the 96 baked characters. */
+	std::vector<unsigned char> charData{};
+	int width{ 0 };
+	int height{ 0 };
+	float fontSize{ 0.f };
+	float fontAscent{ 0.f };
+	std::string sFontPath{};
+};
+
 class FontLoader
 {
   public:
@@ -28,5 +45,22 @@ class FontLoader
 	 */
 	static std::unique_ptr<class Font> CreateFromMemory( const unsigned char* fontData, float fontSize = 32.f,
 														 int width = 512, int height = 512 );
+
+	/*
+	 * @brief Reads the font file and bakes its glyph atlas without touching open GL, so it can be called
+	 * from any thread.
+	 * @param A string for the font path, the font to bake into, a float for the font's size, and the width
+	 * and height of the generated font texture.
+	 * @return Returns true if the font was baked, false otherwise.
+	 */
+	static bool Bake( const std::string& fontPath, BakedFont& bakedFont, float fontSize = 32.f, int width = 512,
+					  int height = 512 );
+
+	/*
+	 * @brief Uploads a font baked with Bake into open GL and creates the Font. Must be called on the thread
+	 * that owns the GL context.
+	 * @return Returns a unique_ptr to a font class if successful, nullptr otherwise.
+	 */
+	static std::unique_ptr<class Font> CreateFromBaked( const BakedFont& bakedFont );
 };
 } // namespace Scion::Rendering
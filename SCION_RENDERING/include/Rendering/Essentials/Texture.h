@@ -1,5 +1,6 @@
 #pragma once
 #include <glad/glad.h>
+#include <glm/glm.hpp>
 #include <string>
 
 namespace Scion::Rendering
@@ -31,13 +32,46 @@ class Texture
 	inline const std::string& GetPath() const { return m_sPath; }
 	inline const bool IsEditorTexture() const { return m_bEditorTexture; }
 	inline void SetIsEditorTexture( bool bIsEditorTexture ) { m_bEditorTexture = bIsEditorTexture; }
+	/* @brief Atlasable textures are packed into texture atlases when the game is packaged. */
+	inline const bool IsAtlasable() const { return m_bAtlasable; }
+	inline void SetIsAtlasable( bool bIsAtlasable ) { m_bAtlasable = bIsAtlasable; }
+
+	/*
+	 * @brief Marks this texture as a region of a shared atlas texture. The width and height stay
+	 * the size of the original image, and the region is the normalized rect {u, v, width, height}
+	 * of the image inside of the atlas.
+	 */
+	inline void SetAtlasRegion( const glm::vec4& atlasRegion )
+	{
+		m_AtlasRegion = atlasRegion;
+		m_bAtlasRegion = true;
+	}
+	inline const bool IsAtlasRegion() const { return m_bAtlasRegion; }
+	inline const glm::vec4& GetAtlasRegion() const { return m_AtlasRegion; }
+
+	/*
+	 * @brief Converts uvs that are relative to this texture into uvs of the underlying GL texture.
+	 * @param A glm::vec4 of normalized uvs {u, v, width, height}.
+	 * @return Returns the uvs unchanged if this texture is not an atlas region.
+	 */
+	inline glm::vec4 ToAtlasUVs( const glm::vec4& uvs ) const
+	{
+		if ( !m_bAtlasRegion )
+			return uvs;
+
+		return glm::vec4{ m_AtlasRegion.x + uvs.x * m_AtlasRegion.z,
+						  m_AtlasRegion.y + uvs.y * m_AtlasRegion.w,
+						  uvs.z * m_AtlasRegion.z,
+						  uvs.w * m_AtlasRegion.w };
+	}
 
 	void Bind();
 	void Unbind();
 
 	/*
 	* @brief Deletes the underlying OpenGL Texture.
-	* Only use this if texture is no longer needed.
+	* Only use this if texture is no longer needed. Atlas regions do not own
+	* their OpenGL Texture and are never deleted.
 	*/
 	void Destroy();
 
@@ -49,5 +83,8 @@ class Texture
 	TextureType m_eType;
 	bool m_bTileset;
 	bool m_bEditorTexture;
+	bool m_bAtlasable;
+	bool m_bAtlasRegion;
+	glm::vec4 m_AtlasRegion;
 };
 } // namespace Scion::Rendering
@@ -1,9 +1,22 @@
 #pragma once
 #include "Texture.h"
 #include <memory>
+#include <vector>
 
 namespace Scion::Rendering
 {
+/*
+ * DecodedImage
+ * The pixels of an image file that have not been uploaded to OpenGL yet.
+ */
+struct DecodedImage
+{
+	std::vector<unsigned char> pixels{};
+	int width{ 0 };
+	int height{ 0 };
+	int channels{ 0 };
+};
+
 class TextureLoader
 {
   public:
@@ -22,7 +35,24 @@ class TextureLoader
 	static std::unique_ptr<Texture> CreateFromMemory( const unsigned char* imageData, size_t length,
 													  bool blended = false, bool bTileset = false );
 
+	/*
+	 * @brief Decodes the image file without touching open GL, so it can be called from any thread.
+	 * @params Takes in a string for the filepath of the image and the image to decode into.
+	 * @return Returns true if the image was decoded, false otherwise.
+	 */
+	static bool DecodeImage( const std::string& texturePath, DecodedImage& image );
+
+	/*
+	 * @brief Uploads an image decoded with DecodeImage into open GL and creates a new Texture object.
+	 * Must be called on the thread that owns the GL context.
+	 * @params Takes in the type of texture, the decoded image and the filepath it was decoded from.
+	 * @return Returns a unique_ptr<Texture> if successful, nullptr otherwise.
+	 */
+	static std::unique_ptr<Texture> CreateFromDecoded( Texture::TextureType type, const DecodedImage& image,
+													   const std::string& texturePath, bool bTileset = false );
+
   private:
+	static void UploadPixels( const unsigned char* pixels, int width, int height, int channels, bool blended );
 	static bool LoadTexture( const std::string& filepath, GLuint& id, int& width, int& height, bool blended = false );
 	static bool LoadFBTexture( GLuint& id, int& width, int& height );
 	static bool LoadTextureFromMemory( const unsigned char* imageData, size_t length, GLuint& id, int& width,
@@ -63,6 +63,18 @@ struct CircleVertex
 	float lineThickness;
 };
 
+/*
+ * The data of one particle for instanced drawing. The quad corners are shared by every particle.
+ */
+struct ParticleInstance
+{
+	glm::vec2 position{ 0.f };
+	float scale{ 1.f };
+	/* The rotation in radians. */
+	float rotation{ 0.f };
+	Color color{};
+};
+
 struct PickingVertex
 {
 	glm::vec2 position{ 0.f };
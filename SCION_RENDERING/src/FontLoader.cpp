@@ -2,6 +2,7 @@
 #include "Rendering/Essentials/Font.h"
 #include <fstream>
 #include <vector>
+#include <cstring>
 #include <Logger/Logger.h>
 
 #define STB_TRUETYPE_IMPLEMENTATION
@@ -11,13 +12,22 @@ namespace Scion::Rendering
 {
 
 std::unique_ptr<Font> FontLoader::Create( const std::string& fontPath, float fontSize, int width, int height )
+{
+	BakedFont bakedFont{};
+	if ( !Bake( fontPath, bakedFont, fontSize, width, height ) )
+		return nullptr;
+
+	return CreateFromBaked( bakedFont );
+}
+
+bool FontLoader::Bake( const std::string& fontPath, BakedFont& bakedFont, float fontSize, int width, int height )
 {
 	std::ifstream fontStream{ fontPath, std::ios::binary };
 
 	if ( fontStream.fail() )
 	{
 		SCION_ERROR( "Failed to load font [{}] - Unable to read buffer!", fontPath );
-		return nullptr;
+		return false;
 	}
 
 	fontStream.seekg( 0, fontStream.end );
@@ -26,20 +36,25 @@ std::unique_ptr<Font> FontLoader::Create( const std::string& fontPath, float fon
 
 	std::vector<unsigned char> buffer;
 	buffer.resize( length );
-	std::vector<unsigned char> bitmap;
-	bitmap.resize( width * height );
+	bakedFont.bitmap.resize( width * height );
+	bakedFont.charData.resize( sizeof( stbtt_bakedchar ) * 96 );
 	fontStream.read( (char*)( &buffer[ 0 ] ), length );
 
-	auto data = (void*)new stbtt_bakedchar[ 96 ];
-
-	stbtt_BakeFontBitmap( buffer.data(), 0, fontSize, bitmap.data(), width, height, 32, 96, (stbtt_bakedchar*)data );
+	stbtt_BakeFontBitmap( buffer.data(),
+						  0,
+						  fontSize,
+						  bakedFont.bitmap.data(),
+						  width,
+						  height,
+						  32,
+						  96,
+						  (stbtt_bakedchar*)bakedFont.charData.data() );
 
 	stbtt_fontinfo fontInfo;
 	if ( !stbtt_InitFont( &fontInfo, buffer.data(), 0 ) )
 	{
-		SCION_ASSERT( false && "Failed to initialize Font Info." );
-		SCION_ERROR( "Failed to initialize Font Info." );
-		return nullptr;
+		SCION_ERROR( "Failed to initialize Font Info for font [{}].", fontPath );
+		return false;
 	}
 
 	// Top of tallest glyph above baseline
@@ -52,20 +67,53 @@ std::unique_ptr<Font> FontLoader::Create( const std::string& fontPath, float fon
 	// Get the scale to convert from font units to pixel units.
 	float scale = stbtt_ScaleForPixelHeight( &fontInfo, fontSize );
 	// Convert the ascent from font units to pixel units.
-	float fontAscent = ascent * scale;
+	bakedFont.fontAscent = ascent * scale;
+	bakedFont.width = width;
+	bakedFont.height = height;
+	bakedFont.fontSize = fontSize;
+	bakedFont.sFontPath = fontPath;
+
+	return true;
+}
+
+std::unique_ptr<Font> FontLoader::CreateFromBaked( const BakedFont& bakedFont )
+{
+	if ( bakedFont.bitmap.empty() || bakedFont.charData.size() != sizeof( stbtt_bakedchar ) * 96 )
+	{
+		SCION_ERROR( "Failed to create font [{}] - The font has not been baked.", bakedFont.sFontPath );
+		return nullptr;
+	}
+
+	// The font owns and deletes the char data.
+	auto data = new stbtt_bakedchar[ 96 ];
+	std::memcpy( data, bakedFont.charData.data(), bakedFont.charData.size() );
 
 	GLuint fontId;
 	glGenTextures( 1, &fontId );
 	glBindTexture( GL_TEXTURE_2D, fontId );
 
-	glTexImage2D( GL_TEXTURE_2D, 0, GL_RED, width, height, 0, GL_RED, GL_UNSIGNED_BYTE, bitmap.data() );
+	glTexImage2D( GL_TEXTURE_2D,
+				  0,
+				  GL_RED,
+				  bakedFont.width,
+				  bakedFont.height,
+				  0,
+				  GL_RED,
+				  GL_UNSIGNED_BYTE,
+				  bakedFont.bitmap.data() );
 	glGenerateMipmap( GL_TEXTURE_2D );
 	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE );
 	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE );
 	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR );
 	glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
 
-	return std::make_unique<Font>( fontId, width, height, fontSize, data, fontAscent, fontPath );
+	return std::make_unique<Font>( fontId,
+								   bakedFont.width,
+								   bakedFont.height,
+								   bakedFont.fontSize,
+								   (void*)data,
+								   bakedFont.fontAscent,
+								   bakedFont.sFontPath );
 }
 
 std::unique_ptr<Font> FontLoader::CreateFromMemory( const unsigned char* fontData, float fontSize, int width,
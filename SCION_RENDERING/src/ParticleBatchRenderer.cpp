@@ -0,0 +1,126 @@
+#include "Rendering/Core/ParticleBatchRenderer.h"
+#include "Rendering/Essentials/Shader.h"
+
+namespace Scion::Rendering
+{
+
+ParticleBatchRenderer::ParticleBatchRenderer()
+{
+	Initialize();
+}
+
+ParticleBatchRenderer::~ParticleBatchRenderer()
+{
+	if ( m_VAO )
+		glDeleteVertexArrays( 1, &m_VAO );
+	if ( m_QuadVBO )
+		glDeleteBuffers( 1, &m_QuadVBO );
+	if ( m_InstanceVBO )
+		glDeleteBuffers( 1, &m_InstanceVBO );
+	if ( m_IBO )
+		glDeleteBuffers( 1, &m_IBO );
+}
+
+void ParticleBatchRenderer::Begin()
+{
+	m_Instances.clear();
+	m_Batches.clear();
+}
+
+std::span<ParticleInstance> ParticleBatchRenderer::AddParticles( GLuint textureID, const glm::vec4& uvRect,
+																 const glm::vec2& size, size_t numParticles )
+{
+	const size_t firstInstance = m_Instances.size();
+	m_Instances.resize( firstInstance + numParticles );
+
+	m_Batches.push_back( ParticleBatch{ .textureID = textureID,
+										.uvRect = uvRect,
+										.size = size,
+										.firstInstance = static_cast<GLuint>( firstInstance ),
+										.numInstances = static_cast<GLuint>( numParticles ) } );
+
+	return std::span<ParticleInstance>{ m_Instances.data() + firstInstance, numParticles };
+}
+
+void ParticleBatchRenderer::End()
+{
+	if ( m_Instances.empty() )
+		return;
+
+	glBindBuffer( GL_ARRAY_BUFFER, m_InstanceVBO );
+
+	// Only grow the buffer when the particles no longer fit, otherwise orphan it.
+	if ( m_Instances.size() > m_InstanceCapacity )
+		m_InstanceCapacity = m_Instances.size() * 2;
+
+	glBufferData( GL_ARRAY_BUFFER, m_InstanceCapacity * sizeof( ParticleInstance ), nullptr, GL_STREAM_DRAW );
+	glBufferSubData( GL_ARRAY_BUFFER, 0, m_Instances.size() * sizeof( ParticleInstance ), m_Instances.data() );
+
+	glBindBuffer( GL_ARRAY_BUFFER, 0 );
+}
+
+void ParticleBatchRenderer::Render( Shader& shader )
+{
+	if ( m_Batches.empty() )
+		return;
+
+	glBindVertexArray( m_VAO );
+
+	for ( const auto& batch : m_Batches )
+	{
+		if ( batch.numInstances == 0 )
+			continue;
+
+		shader.SetUniformVec4( "uUVRect", batch.uvRect.x, batch.uvRect.y, batch.uvRect.z, batch.uvRect.w );
+		shader.SetUniformVec2( "uSize", batch.size );
+
+		glBindTextureUnit( 0, batch.textureID );
+		glDrawElementsInstancedBaseInstance(
+			GL_TRIANGLES, 6, GL_UNSIGNED_INT, nullptr, batch.numInstances, batch.firstInstance );
+	}
+
+	glBindVertexArray( 0 );
+}
+
+void ParticleBatchRenderer::Initialize()
+{
+	// The corners of the quad, from the bottom left. The vertex shader centers them on the particle.
+	constexpr float corners[] = { 0.f, 0.f, 1.f, 0.f, 1.f, 1.f, 0.f, 1.f };
+	constexpr GLuint indices[] = { 0, 1, 2, 2, 3, 0 };
+
+	glGenVertexArrays( 1, &m_VAO );
+	glGenBuffers( 1, &m_QuadVBO );
+	glGenBuffers( 1, &m_InstanceVBO );
+	glGenBuffers( 1, &m_IBO );
+
+	glBindVertexArray( m_VAO );
+
+	glBindBuffer( GL_ARRAY_BUFFER, m_QuadVBO );
+	glBufferData( GL_ARRAY_BUFFER, sizeof( corners ), corners, GL_STATIC_DRAW );
+	glVertexAttribPointer( 0, 2, GL_FLOAT, GL_FALSE, 2 * sizeof( float ), nullptr );
+	glEnableVertexAttribArray( 0 );
+
+	glBindBuffer( GL_ARRAY_BUFFER, m_InstanceVBO );
+	glVertexAttribPointer(
+		1, 2, GL_FLOAT, GL_FALSE, sizeof( ParticleInstance ), (void*)offsetof( ParticleInstance, position ) );
+	glVertexAttribPointer(
+		2, 1, GL_FLOAT, GL_FALSE, sizeof( ParticleInstance ), (void*)offsetof( ParticleInstance, scale ) );
+	glVertexAttribPointer(
+		3, 1, GL_FLOAT, GL_FALSE, sizeof( ParticleInstance ), (void*)offsetof( ParticleInstance, rotation ) );
+	glVertexAttribPointer(
+		4, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof( ParticleInstance ), (void*)offsetof( ParticleInstance, color ) );
+
+	for ( GLuint attribute = 1; attribute <= 4; ++attribute )
+	{
+		glEnableVertexAttribArray( attribute );
+		glVertexAttribDivisor( attribute, 1 );
+	}
+
+	glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, m_IBO );
+	glBufferData( GL_ELEMENT_ARRAY_BUFFER, sizeof( indices ), indices, GL_STATIC_DRAW );
+
+	glBindVertexArray( 0 );
+	glBindBuffer( GL_ARRAY_BUFFER, 0 );
+}
+
+} // namespace Scion::Rendering
@@ -16,6 +16,9 @@ Texture::Texture( GLuint id, int width, int height, TextureType type, const std:
 	, m_sPath{ texturePath }
 	, m_bTileset{ bIsTileset }
 	, m_bEditorTexture{ false }
+	, m_bAtlasable{ false }
+	, m_bAtlasRegion{ false }
+	, m_AtlasRegion{ 0.f, 0.f, 1.f, 1.f }
 {
 }
 
@@ -30,6 +33,9 @@ void Texture::Unbind()
 }
 void Texture::Destroy()
 {
+	if ( m_bAtlasRegion )
+		return;
+
 	glDeleteTextures( 1, &m_TextureID );
 }
 } // namespace Scion::Rendering
@@ -28,6 +28,16 @@ bool TextureLoader::LoadTexture( const std::string& filepath, GLuint& id, int& w
 		return false;
 	}
 
+	UploadPixels( image, width, height, channels, blended );
+
+	// Delete the image data from SOIL
+	SOIL_free_image_data( image );
+
+	return true;
+}
+
+void TextureLoader::UploadPixels( const unsigned char* pixels, int width, int height, int channels, bool blended )
+{
 	GLint format = GL_RGBA;
 
 	switch ( channels )
@@ -58,11 +68,23 @@ bool TextureLoader::LoadTexture( const std::string& filepath, GLuint& id, int& w
 				  0,				// border
 				  format,			// format			-- format of the pixel data
 				  GL_UNSIGNED_BYTE, // type				-- The data type of the pixel data
-				  image				// data
+				  pixels			// data
 	);
+}
 
-	// Delete the image data from SOIL
-	SOIL_free_image_data( image );
+bool TextureLoader::DecodeImage( const std::string& texturePath, DecodedImage& image )
+{
+	unsigned char* pixels =
+		SOIL_load_image( texturePath.c_str(), &image.width, &image.height, &image.channels, SOIL_LOAD_AUTO );
+
+	if ( !pixels )
+	{
+		SCION_ERROR( "SOIL failed to decode image [{0}] -- {1}", texturePath, SOIL_last_result() );
+		return false;
+	}
+
+	image.pixels.assign( pixels, pixels + static_cast<size_t>( image.width ) * image.height * image.channels );
+	SOIL_free_image_data( pixels );
 
 	return true;
 }
@@ -257,6 +279,31 @@ std::unique_ptr<Texture> TextureLoader::Create( Texture::TextureType type, int w
 	return nullptr;
 }
 
+std::unique_ptr<Texture> TextureLoader::CreateFromDecoded( Texture::TextureType type, const DecodedImage& image,
+														   const std::string& texturePath, bool bTileset )
+{
+	if ( type != Texture::TextureType::PIXEL && type != Texture::TextureType::BLENDED )
+	{
+		SCION_ERROR( "Failed to create texture [{}]. Only pixel and blended textures can be decoded.", texturePath );
+		return nullptr;
+	}
+
+	if ( image.pixels.empty() )
+	{
+		SCION_ERROR( "Failed to create texture [{}]. The image has not been decoded.", texturePath );
+		return nullptr;
+	}
+
+	GLuint id;
+	glGenTextures( 1, &id );
+	glBindTexture( GL_TEXTURE_2D, id );
+
+	UploadPixels(
+		image.pixels.data(), image.width, image.height, image.channels, type == Texture::TextureType::BLENDED );
+
+	return std::make_unique<Texture>( id, image.width, image.height, type, texturePath, bTileset );
+}
+
 std::unique_ptr<Texture> TextureLoader::CreateFromMemory( const unsigned char* imageData, size_t length, bool blended,
 														  bool bTileset )
 {
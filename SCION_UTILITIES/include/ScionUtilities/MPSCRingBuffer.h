@@ -0,0 +1,108 @@
+#pragma once
+#include <atomic>
+#include <memory>
+#include <cstdint>
+#include <bit>
+
+namespace Scion::Utilities
+{
+/*
+ * MPSCRingBuffer
+ * Bounded queue that any number of threads can push to and one thread pops from, without locks.
+ * Every cell has a sequence number that tells whose turn the cell is. A producer claims a cell
+ * by moving the write index forward with a compare exchange, then publishes the value by
+ * setting the sequence. The consumer only reads cells that have been published, so it never
+ * needs a compare exchange.
+ * The capacity is rounded up to a power of two. Pushing to a full buffer fails instead of waiting.
+ */
+template <typename T>
+class MPSCRingBuffer
+{
+  public:
+	explicit MPSCRingBuffer( size_t capacity )
+		: m_Capacity{ std::bit_ceil( std::max( capacity, size_t{ 2 } ) ) }
+		, m_Mask{ m_Capacity - 1 }
+		, m_pCells{ std::make_unique<Cell[]>( m_Capacity ) }
+	{
+		for ( size_t i = 0; i < m_Capacity; ++i )
+		{
+			m_pCells[ i ].sequence.store( i, std::memory_order_relaxed );
+		}
+	}
+
+	MPSCRingBuffer( const MPSCRingBuffer& ) = delete;
+	MPSCRingBuffer& operator=( const MPSCRingBuffer& ) = delete;
+
+	/*
+	 * @brief Adds the value to the buffer. Can be called from any thread.
+	 * @return false if the buffer is full. The value is not moved from then.
+	 */
+	bool TryPush( T&& value )
+	{
+		size_t position = m_WriteIndex.load( std::memory_order_relaxed );
+		Cell* pCell{ nullptr };
+
+		while ( true )
+		{
+			pCell = &m_pCells[ position & m_Mask ];
+			const size_t sequence = pCell->sequence.load( std::memory_order_acquire );
+			const auto difference = static_cast<std::intptr_t>( sequence ) - static_cast<std::intptr_t>( position );
+
+			if ( difference == 0 )
+			{
+				// The cell is free for this position, claim it.
+				if ( m_WriteIndex.compare_exchange_weak( position, position + 1, std::memory_order_relaxed ) )
+					break;
+			}
+			else if ( difference < 0 )
+			{
+				// The consumer has not popped the value of the last lap yet.
+				return false;
+			}
+			else
+			{
+				position = m_WriteIndex.load( std::memory_order_relaxed );
+			}
+		}
+
+		pCell->value = std::move( value );
+		pCell->sequence.store( position + 1, std::memory_order_release );
+		return true;
+	}
+
+	/*
+	 * @brief Takes the oldest value that has been published. Must only be called from the consumer thread.
+	 * @return false if there is nothing to pop.
+	 */
+	bool TryPop( T& value )
+	{
+		Cell& cell = m_pCells[ m_ReadIndex & m_Mask ];
+		const size_t sequence = cell.sequence.load( std::memory_order_acquire );
+		if ( static_cast<std::intptr_t>( sequence ) - static_cast<std::intptr_t>( m_ReadIndex + 1 ) < 0 )
+			return false;
+
+		value = std::move( cell.value );
+		// Frees the cell for the producers of the next lap.
+		cell.sequence.store( m_ReadIndex + m_Capacity, std::memory_order_release );
+		++m_ReadIndex;
+		return true;
+	}
+
+	inline size_t Capacity() const { return m_Capacity; }
+
+  private:
+	struct Cell
+	{
+		std::atomic<size_t> sequence{ 0 };
+		T value{};
+	};
+
+	const size_t m_Capacity;
+	const size_t m_Mask;
+	std::unique_ptr<Cell[]> m_pCells;
+
+	/* Kept on their own cache lines, producers and the consumer write them from different threads. */
+	alignas( 64 ) std::atomic<size_t> m_WriteIndex{ 0 };
+	alignas( 64 ) size_t m_ReadIndex{ 0 };
+};
+} // namespace Scion::Utilities
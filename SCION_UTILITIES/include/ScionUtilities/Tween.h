@@ -26,6 +26,14 @@ enum class EEasingFunc
 	EASE_IN_OUT_CIRC
 };
 
+/*
+ * @brief Gets the eased progress of a tween.
+ * @param The easing function to use.
+ * @param The linear progress of the tween, from 0 to 1.
+ * @return Returns the eased progress, 0 at the start and 1 at the end.
+ */
+float Ease( EEasingFunc func, float progress );
+
 class Tween
 {
   public:
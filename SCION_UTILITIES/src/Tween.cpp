@@ -196,55 +196,61 @@ constexpr auto ExponentialInOut =
 	return change / 2.f * (-powf(2, -10 * --current) + 2.f) + start;
 };
 
-constexpr auto BounceIn = 
+// Bounce easing: [OUT] - Bounces against the end position.
+constexpr auto BounceOut =
 [](float current, float start, float change, float duration)
 {
-	SCION_ERROR("EASE_IN_BOUNCE, has not been implemented.");
-	// TODO:
-	return 0.f;
+	if ((current /= duration) < (1.f / 2.75f))
+		return change * (7.5625f * current * current) + start;
+
+	if (current < (2.f / 2.75f))
+		return change * (7.5625f * (current -= (1.5f / 2.75f)) * current + 0.75f) + start;
+
+	if (current < (2.5f / 2.75f))
+		return change * (7.5625f * (current -= (2.25f / 2.75f)) * current + 0.9375f) + start;
+
+	return change * (7.5625f * (current -= (2.625f / 2.75f)) * current + 0.984375f) + start;
 };
 
-constexpr auto BounceOut =
+// Bounce easing: [IN] - Bounces against the start position.
+constexpr auto BounceIn = 
 [](float current, float start, float change, float duration)
 {
-	SCION_ERROR("EASE_OUT_BOUNCE, has not been implemented.");
-	// TODO:
-	return 0.f;
+	return change - BounceOut(duration - current, 0.f, change, duration) + start;
 };
 
+// Bounce easing: [IN-OUT] - Bounces against the start and the end positions.
 constexpr auto BounceInOut =
 [](float current, float start, float change, float duration)
 {
-	SCION_ERROR("EASE_IN_OUT_BOUNCE, has not been implemented.");
-	// TODO:
-	return 0.f;
+	if (current < duration / 2.f)
+		return BounceIn(current * 2.f, 0.f, change, duration) * 0.5f + start;
+
+	return BounceOut(current * 2.f - duration, 0.f, change, duration) * 0.5f + change * 0.5f + start;
 };
 
 // Circular easing: sqrt(1-t^2)
 constexpr auto CircularIn =
 [](float current, float start, float change, float duration)
 {
-	SCION_ERROR("EASE_IN_CIRC, has not been implemented.");
-	// TODO:
-	return 0.f;
+	return -change * (sqrtf(1.f - (current /= duration) * current) - 1.f) + start;
 };
 
 // Circular easing: sqrt(1-t^2)
 constexpr auto CircularOut =
 [](float current, float start, float change, float duration)
 {
-	SCION_ERROR("EASE_OUT_CIRC, has not been implemented.");
-	// TODO:
-	return 0.f;
+	return change * sqrtf(1.f - (current = current / duration - 1.f) * current) + start;
 };
 
 // Circular easing: sqrt(1-t^2)
 constexpr auto CircularInOut = 
 [](float current, float start, float change, float duration)
 {
-	SCION_ERROR("EASE_IN_OUT_CIRC, has not been implemented.");
-	// TODO:
-	return 0.f;
+	if ((current /= duration / 2.f) < 1.f)
+		return -change / 2.f * (sqrtf(1.f - current * current) - 1.f) + start;
+
+	return change / 2.f * (sqrtf(1.f - (current -= 2.f) * current) + 1.f) + start;
 };
 
 std::unordered_map<EEasingFunc, EasingFunction> g_mapEasingFunctions = {
@@ -301,6 +307,34 @@ void Tween::Update( const float dt )
 	}
 }
 
+float Ease( EEasingFunc func, float progress )
+{
+	// Called for every native tween each frame, so the easing functions are called directly.
+	switch ( func )
+	{
+	case EEasingFunc::LINEAR: return Linear( progress, 0.f, 1.f, 1.f );
+	case EEasingFunc::EASE_IN_QUAD: return EaseQuadIn( progress, 0.f, 1.f, 1.f );
+	case EEasingFunc::EASE_OUT_QUAD: return EaseQuadOut( progress, 0.f, 1.f, 1.f );
+	case EEasingFunc::EASE_IN_OUT_QUAD: return EaseQuadInOut( progress, 0.f, 1.f, 1.f );
+	case EEasingFunc::EASE_IN_SINE: return SineIn( progress, 0.f, 1.f, 1.f );
+	case EEasingFunc::EASE_OUT_SINE: return SineOut( progress, 0.f, 1.f, 1.f );
+	case EEasingFunc::EASE_IN_OUT_SINE: return SineInOut( progress, 0.f, 1.f, 1.f );
+	case EEasingFunc::EASE_IN_ELASTIC: return ElasticIn( progress, 0.f, 1.f, 1.f );
+	case EEasingFunc::EASE_OUT_ELASTIC: return ElasticOut( progress, 0.f, 1.f, 1.f );
+	case EEasingFunc::EASE_IN_OUT_ELASTIC: return ElasticInOut( progress, 0.f, 1.f, 1.f );
+	case EEasingFunc::EASE_IN_EXPONENTIAL: return ExponentialIn( progress, 0.f, 1.f, 1.f );
+	case EEasingFunc::EASE_OUT_EXPONENTIAL: return ExponentialOut( progress, 0.f, 1.f, 1.f );
+	case EEasingFunc::EASE_IN_OUT_EXPONENTIAL: return ExponentialInOut( progress, 0.f, 1.f, 1.f );
+	case EEasingFunc::EASE_IN_BOUNCE: return BounceIn( progress, 0.f, 1.f, 1.f );
+	case EEasingFunc::EASE_OUT_BOUNCE: return BounceOut( progress, 0.f, 1.f, 1.f );
+	case EEasingFunc::EASE_IN_OUT_BOUNCE: return BounceInOut( progress, 0.f, 1.f, 1.f );
+	case EEasingFunc::EASE_IN_CIRC: return CircularIn( progress, 0.f, 1.f, 1.f );
+	case EEasingFunc::EASE_OUT_CIRC: return CircularOut( progress, 0.f, 1.f, 1.f );
+	case EEasingFunc::EASE_IN_OUT_CIRC: return CircularInOut( progress, 0.f, 1.f, 1.f );
+	default: return progress;
+	}
+}
+
 float Tween::GetEasingFunc( EEasingFunc func, float currentTime, float start, float change, float duration )
 {
 	return g_mapEasingFunctions[ func ]( currentTime, start, change, duration );
@@ -0,0 +1,84 @@
+-- Compares the lua allocations of the vector patterns the sample games use every frame with the
+-- allocation free versions. Not part of the script list, add it there or load it from a script and call
+-- VectorBenchmark.Run() to print the results.
+-- Allocations are counted by the engine's lua allocator, S2D_LuaAllocations() returns 0 without it.
+
+VectorBenchmark = {}
+
+local function Measure(name, frames, objects, func)
+	local timer = Timer()
+	local startAllocations = S2D_LuaAllocations()
+	timer:start()
+
+	for frame = 1, frames do
+		for i = 1, objects do
+			func(i)
+		end
+	end
+
+	local elapsed = timer:elapsed_ms()
+	timer:stop()
+
+	local allocations = S2D_LuaAllocations() - startAllocations
+	S2D_log("%-36s %10.1f allocations/frame %8.3f ms/frame", name, allocations / frames, elapsed / frames)
+	return allocations / frames
+end
+
+function VectorBenchmark.Run(frames, objects)
+	frames = frames or 60
+	objects = objects or 200
+
+	local entity = Entity("", "")
+	local transform = entity:addComponent(Transform(vec2(0, 0), vec2(1, 1), 0))
+	local rigid_body = entity:addComponent(RigidBody(vec2(200, 200)))
+	rigid_body:setVelocity(200, 200)
+
+	local forward = vec2(math.cos(0.5), math.sin(0.5))
+	local velocity = vec2(200, 200)
+	local target = vec2(640, 320)
+	local speed = 4
+	local dt = 1 / 60
+
+	S2D_log("Vector benchmark, %d frames of %d objects", frames, objects)
+
+	-- ship.lua: transform.position = transform.position + forward * self.forwardSpeed * speedUp
+	local before = Measure("ship move (operators)", frames, objects, function()
+		transform.position = transform.position + forward * speed
+	end)
+	local after = Measure("ship move (translate)", frames, objects, function()
+		transform:translate(forward.x * speed, forward.y * speed)
+	end)
+	S2D_log("ship move saves %.1f allocations/frame", before - after)
+
+	-- rain_generator.lua: transform.position = transform.position + (rigid_body.maxVelocity * dt)
+	before = Measure("rain move (operators)", frames, objects, function()
+		transform.position = transform.position + (velocity * dt)
+	end)
+	after = Measure("rain move (rigid body)", frames, objects, function()
+		rigid_body:move(transform, dt)
+	end)
+	S2D_log("rain move saves %.1f allocations/frame", before - after)
+
+	-- Seeking a target: direction = (target - position):normalize()
+	before = Measure("seek (operators)", frames, objects, function()
+		local direction = (target - velocity):normalize()
+		return direction.x
+	end)
+	after = Measure("seek (scalars)", frames, objects, function()
+		local dx, dy = S2D_normalize(target.x - velocity.x, target.y - velocity.y)
+		return dx
+	end)
+	S2D_log("seek saves %.1f allocations/frame", before - after)
+
+	-- Accumulating into a vector that is kept between frames.
+	local position = vec2(0, 0)
+	before = Measure("accumulate (operators)", frames, objects, function()
+		position = position + velocity * dt
+	end)
+	after = Measure("accumulate (addScaled)", frames, objects, function()
+		position:addScaled(velocity, dt)
+	end)
+	S2D_log("accumulate saves %.1f allocations/frame", before - after)
+
+	entity:destroy()
+end